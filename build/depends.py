@@ -717,6 +717,7 @@ class MixxxCore(Feature):
                    "src/control/controllinpotmeter.cpp",
                    "src/control/controllogpotmeter.cpp",
                    "src/control/controlmodel.cpp",
+                   "src/control/controlnotifier.cpp",
                    "src/control/controlobject.cpp",
                    "src/control/controlobjectscript.cpp",
                    "src/control/controlpotmeter.cpp",
@@ -763,6 +764,7 @@ class MixxxCore(Feature):
 
                    "src/effects/effectchain.cpp",
                    "src/effects/effect.cpp",
+                   "src/effects/effectstatepool.cpp",
                    "src/effects/effectparameter.cpp",
 
                    "src/effects/effectrack.cpp",
@@ -800,6 +802,7 @@ class MixxxCore(Feature):
                    "src/engine/effects/engineeffectrack.cpp",
                    "src/engine/effects/engineeffectchain.cpp",
                    "src/engine/effects/engineeffect.cpp",
+                   "src/engine/effects/engineeffectsworkerpool.cpp",
 
                    "src/engine/sync/basesyncablelistener.cpp",
                    "src/engine/sync/enginesync.cpp",
@@ -850,6 +853,8 @@ class MixxxCore(Feature):
                    "src/engine/cachingreader/cachingreader.cpp",
                    "src/engine/cachingreader/cachingreaderchunk.cpp",
                    "src/engine/cachingreader/cachingreaderworker.cpp",
+                   "src/engine/cachingreader/decodedsamplebank.cpp",
+                   "src/engine/cachingreader/prefetchedchunkcache.cpp",
 
                    "src/analyzer/trackanalysisscheduler.cpp",
                    "src/analyzer/analyzerthread.cpp",
@@ -859,6 +864,7 @@ class MixxxCore(Feature):
                    "src/analyzer/analyzerkey.cpp",
                    "src/analyzer/analyzerebur128.cpp",
                    "src/analyzer/analyzersilence.cpp",
+                   "src/analyzer/analyzerchromaprint.cpp",
                    "src/analyzer/plugins/analyzersoundtouchbeats.cpp",
                    "src/analyzer/plugins/analyzerqueenmarybeats.cpp",
                    "src/analyzer/plugins/analyzerqueenmarykey.cpp",
@@ -901,6 +907,7 @@ class MixxxCore(Feature):
                    "src/sources/audiosource.cpp",
                    "src/sources/audiosourcestereoproxy.cpp",
                    "src/sources/metadatasourcetaglib.cpp",
+                   "src/sources/seekindexcache.cpp",
                    "src/sources/soundsource.cpp",
                    "src/sources/soundsourceproviderregistry.cpp",
                    "src/sources/soundsourceproxy.cpp",
@@ -965,6 +972,7 @@ class MixxxCore(Feature):
                    "src/musicbrainz/crc.c",
                    "src/musicbrainz/acoustidclient.cpp",
                    "src/musicbrainz/chromaprinter.cpp",
+                   "src/musicbrainz/fingerprintindex.cpp",
                    "src/musicbrainz/musicbrainzclient.cpp",
 
                    "src/widget/wtracktableview.cpp",
@@ -979,6 +987,9 @@ class MixxxCore(Feature):
                    "src/database/schemamanager.cpp",
 
                    "src/library/trackcollection.cpp",
+                   "src/library/tracksavequeue.cpp",
+                   "src/library/trackprefetcher.cpp",
+                   "src/library/duplicatetrackfinder.cpp",
                    "src/library/basesqltablemodel.cpp",
                    "src/library/basetrackcache.cpp",
                    "src/library/columncache.cpp",
@@ -1030,11 +1041,13 @@ class MixxxCore(Feature):
                    "src/library/recording/dlgrecording.cpp",
                    "src/recording/recordingmanager.cpp",
                    "src/engine/sidechain/enginerecord.cpp",
+                   "src/engine/sidechain/recordingfilewriter.cpp",
 
                    # External Library Features
                    "src/library/baseexternallibraryfeature.cpp",
                    "src/library/baseexternaltrackmodel.cpp",
                    "src/library/baseexternalplaylistmodel.cpp",
+                   "src/library/externallibraryimporter.cpp",
                    "src/library/rhythmbox/rhythmboxfeature.cpp",
 
                    "src/library/banshee/bansheefeature.cpp",
@@ -1145,6 +1158,7 @@ class MixxxCore(Feature):
                    "src/skin/colorschemeparser.cpp",
                    "src/skin/tooltips.cpp",
                    "src/skin/skincontext.cpp",
+                   "src/skin/skincache.cpp",
                    "src/skin/svgparser.cpp",
                    "src/skin/pixmapsource.cpp",
                    "src/skin/launchimage.cpp",
@@ -1182,8 +1196,10 @@ class MixxxCore(Feature):
                    "src/mixer/sampler.cpp",
                    "src/mixer/samplerbank.cpp",
 
+                   "src/soundio/driftcorrector.cpp",
                    "src/soundio/sounddevice.cpp",
                    "src/soundio/sounddevicenetwork.cpp",
+                   "src/soundio/sounddevicerender.cpp",
                    "src/engine/sidechain/enginenetworkstream.cpp",
                    "src/soundio/soundmanager.cpp",
                    "src/soundio/soundmanagerconfig.cpp",
@@ -1210,6 +1226,7 @@ class MixxxCore(Feature):
                    "src/util/time.cpp",
                    "src/util/timer.cpp",
                    "src/util/performancetimer.cpp",
+                   "src/util/startupprofile.cpp",
                    "src/util/threadcputimer.cpp",
                    "src/util/version.cpp",
                    "src/util/rlimit.cpp",
@@ -1217,6 +1234,8 @@ class MixxxCore(Feature):
                    "src/util/valuetransformer.cpp",
                    "src/util/sandbox.cpp",
                    "src/util/file.cpp",
+                   "src/util/filecopy.cpp",
+                   "src/util/cachedirectory.cpp",
                    "src/util/mac.cpp",
                    "src/util/task.cpp",
                    "src/util/experiment.cpp",
@@ -1229,6 +1248,7 @@ class MixxxCore(Feature):
                    "src/util/db/dbconnectionpool.cpp",
                    "src/util/db/dbconnectionpooler.cpp",
                    "src/util/db/dbconnectionpooled.cpp",
+                   "src/util/db/dbwritequeue.cpp",
                    "src/util/db/dbid.cpp",
                    "src/util/db/fwdsqlquery.cpp",
                    "src/util/db/fwdsqlqueryselectresult.cpp",
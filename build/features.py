@@ -293,6 +293,7 @@ class VinylControl(Feature):
     def sources(self, build):
         sources = ['src/vinylcontrol/vinylcontrol.cpp',
                    'src/vinylcontrol/vinylcontrolxwax.cpp',
+                   'src/vinylcontrol/timecodelutcache.cpp',
                    'src/preferences/dialog/dlgprefvinyl.cpp',
                    'src/vinylcontrol/vinylcontrolsignalwidget.cpp',
                    'src/vinylcontrol/vinylcontrolmanager.cpp',
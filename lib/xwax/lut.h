@@ -20,6 +20,11 @@
 #ifndef LUT_H
 #define LUT_H
 
+/* The number of bits to form the hash. The hash lookup table of
+ * each lut has (1 << LUT_HASH_BITS) entries */
+
+#define LUT_HASH_BITS 16
+
 typedef unsigned int slot_no_t;
 
 struct slot {
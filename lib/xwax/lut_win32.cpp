@@ -27,7 +27,7 @@ extern "C" {
 /* The number of bits to form the hash, which governs the overall size
  * of the hash lookup table, and hence the amount of chaining */
 
-#define HASH_BITS 16
+#define HASH_BITS LUT_HASH_BITS
 
 #define HASH(timecode) ((timecode) & ((1 << HASH_BITS) - 1))
 #define NO_SLOT ((unsigned)-1)
@@ -84,6 +84,7 @@ struct timecoder {
     int mon_size, mon_counter;
 };
 
+struct timecode_def* timecoder_find_definition_unbuilt(const char *name);
 struct timecode_def* timecoder_find_definition(const char *name);
 void timecoder_free_lookup(void);
 
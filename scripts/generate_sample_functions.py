@@ -99,11 +99,20 @@ def write_channelmixer_autogen(output, num_channels):
                 write('// Process effects for each channel in place', depth=2)
             else:
                 write('// Process effects for each channel and mix the processed signal into pOutput', depth=2)
-            for j in xrange(i):
-              if inplace:
-                  write('pEngineEffectsManager->processPostFaderInPlace(pChannel%(j)d->m_handle, outputHandle, pBuffer%(j)d, iBufferSize, iSampleRate, pChannel%(j)d->m_features, oldGain[%(j)d], newGain[%(j)d]);' % {'j': j}, depth=2)
-              else:
-                  write('pEngineEffectsManager->processPostFaderAndMix(pChannel%(j)d->m_handle, outputHandle, pBuffer%(j)d, pOutput, iBufferSize, iSampleRate, pChannel%(j)d->m_features, oldGain[%(j)d], newGain[%(j)d]);' % {'j': j}, depth=2)
+            if inplace and i > 1:
+                # The channels are processed independently of each other, so
+                # they are passed as a batch that may be processed concurrently.
+                write('EngineEffectsManager::PostFaderJob jobs[%(i)d] = {' % {'i': i}, depth=2)
+                for j in xrange(i):
+                    write('{&pChannel%(j)d->m_handle, pBuffer%(j)d, &pChannel%(j)d->m_features, oldGain[%(j)d], newGain[%(j)d]},' % {'j': j}, depth=3)
+                write('};', depth=2)
+                write('pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, %(i)d, iBufferSize, iSampleRate);' % {'i': i}, depth=2)
+            else:
+                for j in xrange(i):
+                  if inplace:
+                      write('pEngineEffectsManager->processPostFaderInPlace(pChannel%(j)d->m_handle, outputHandle, pBuffer%(j)d, iBufferSize, iSampleRate, pChannel%(j)d->m_features, oldGain[%(j)d], newGain[%(j)d]);' % {'j': j}, depth=2)
+                  else:
+                      write('pEngineEffectsManager->processPostFaderAndMix(pChannel%(j)d->m_handle, outputHandle, pBuffer%(j)d, pOutput, iBufferSize, iSampleRate, pChannel%(j)d->m_features, oldGain[%(j)d], newGain[%(j)d]);' % {'j': j}, depth=2)
 
             if inplace:
                 write('// Mix the effected channel buffers together to replace the old pOutput from the last engine callback', depth=2)
@@ -28,6 +28,7 @@ AnalyzerBeats::AnalyzerBeats(UserSettingsPointer pConfig, bool enforceBpmDetecti
           m_bPreferencesFixedTempo(true),
           m_bPreferencesOffsetCorrection(false),
           m_bPreferencesFastAnalysis(false),
+          m_bPreferencesParallelAnalysis(false),
           m_iSampleRate(0),
           m_iTotalSamples(0),
           m_iMaxSamplesToProcess(0),
@@ -66,6 +67,7 @@ bool AnalyzerBeats::initialize(TrackPointer tio, int sampleRate, int totalSample
     m_bPreferencesOffsetCorrection = m_bpmSettings.getFixedTempoOffsetCorrection();
     m_bPreferencesReanalyzeOldBpm = m_bpmSettings.getReanalyzeWhenSettingsChange();
     m_bPreferencesFastAnalysis = m_bpmSettings.getFastAnalysis();
+    m_bPreferencesParallelAnalysis = m_bpmSettings.getParallelAnalysis();
     m_pluginId = m_bpmSettings.getBeatPluginId();
 
     qDebug() << "AnalyzerBeats preference settings:"
@@ -74,7 +76,8 @@ bool AnalyzerBeats::initialize(TrackPointer tio, int sampleRate, int totalSample
              << "\nFixed tempo assumption:" << m_bPreferencesFixedTempo
              << "\nOffset correction:" << m_bPreferencesOffsetCorrection
              << "\nRe-analyze when settings change:" << m_bPreferencesReanalyzeOldBpm
-             << "\nFast analysis:" << m_bPreferencesFastAnalysis;
+             << "\nFast analysis:" << m_bPreferencesFastAnalysis
+             << "\nParallel analysis:" << m_bPreferencesParallelAnalysis;
 
     m_iSampleRate = sampleRate;
     m_iTotalSamples = totalSamples;
@@ -94,9 +97,11 @@ bool AnalyzerBeats::initialize(TrackPointer tio, int sampleRate, int totalSample
         if (m_pluginId == mixxx::AnalyzerSoundTouchBeats::pluginInfo().id) {
             m_pPlugin = std::make_unique<mixxx::AnalyzerSoundTouchBeats>();
         } else if (m_pluginId == mixxx::AnalyzerQueenMaryBeats::pluginInfo().id) {
-            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryBeats>();
+            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryBeats>(
+                    m_bPreferencesParallelAnalysis);
         } else {
-            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryBeats>();
+            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryBeats>(
+                    m_bPreferencesParallelAnalysis);
         }
         bShouldAnalyze = m_pPlugin->initialize(m_iSampleRate);
     }
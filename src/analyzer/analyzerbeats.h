@@ -44,6 +44,7 @@ class AnalyzerBeats: public Analyzer {
     bool m_bPreferencesFixedTempo;
     bool m_bPreferencesOffsetCorrection;
     bool m_bPreferencesFastAnalysis;
+    bool m_bPreferencesParallelAnalysis;
 
     int m_iSampleRate;
     int m_iTotalSamples;
@@ -0,0 +1,233 @@
+#include "analyzer/analyzerchromaprint.h"
+
+#include <chromaprint.h>
+
+#include <QtEndian>
+
+#include "analyzer/constants.h"
+#include "util/db/dbwritequeue.h"
+#include "util/logger.h"
+#include "util/math.h"
+#include "util/sample.h"
+
+namespace {
+
+mixxx::Logger kLogger("AnalyzerChromaprint");
+
+const ConfigKey kEnabledConfigKey("[Library]", "EnableFingerprintAnalysis");
+
+// Same duration as ChromaPrinter, because AcoustID only stores the
+// fingerprints of the first two minutes
+const int kFingerprintDurationSeconds = 120;
+
+const QString kVersion = QStringLiteral("ChromaprintRaw-1.0");
+const QString kDescription = QStringLiteral("Raw Chromaprint fingerprint");
+
+// Type declaration of the raw fingerprint depends on the Chromaprint API
+// version, see ChromaPrinter
+#if (CHROMAPRINT_VERSION_MINOR > 3) || (CHROMAPRINT_VERSION_MAJOR > 1)
+typedef uint32_t* uint32_p;
+#else
+typedef void* uint32_p;
+#endif
+
+} // anonymous namespace
+
+AnalyzerChromaprint::AnalyzerChromaprint(
+        UserSettingsPointer pConfig,
+        QSqlDatabase dbConnection,
+        mixxx::DbWriteQueue* pWriteQueue)
+        : m_pConfig(pConfig),
+          m_analysisDao(pConfig),
+          m_pWriteQueue(pWriteQueue),
+          m_pContext(nullptr),
+          m_sampleBuffer(mixxx::kAnalysisSamplesPerBlock),
+          m_remainingSamples(0) {
+    m_analysisDao.initialize(dbConnection);
+}
+
+AnalyzerChromaprint::~AnalyzerChromaprint() {
+    cleanup(TrackPointer());
+}
+
+// static
+bool AnalyzerChromaprint::isEnabled(UserSettingsPointer pConfig) {
+    // Fingerprinting decodes the first two minutes of tracks that have
+    // been analyzed completely before. It is only needed for finding
+    // duplicates and needs to be enabled explicitly.
+    return pConfig->getValue(kEnabledConfigKey, false);
+}
+
+bool AnalyzerChromaprint::initialize(TrackPointer tio, int sampleRate, int totalSamples) {
+    cleanup(tio);
+    if (isDisabledOrLoadStoredSuccess(tio) || totalSamples == 0) {
+        return false;
+    }
+
+    m_pContext = chromaprint_new(CHROMAPRINT_ALGORITHM_DEFAULT);
+    if (!chromaprint_start(m_pContext, sampleRate, mixxx::kAnalysisChannels)) {
+        kLogger.warning() << "Failed to start fingerprinting";
+        cleanup(tio);
+        return false;
+    }
+    m_remainingSamples = kFingerprintDurationSeconds * sampleRate *
+            mixxx::kAnalysisChannels;
+    return true;
+}
+
+bool AnalyzerChromaprint::isDisabledOrLoadStoredSuccess(TrackPointer tio) const {
+    const TrackId trackId = tio->getId();
+    if (!trackId.isValid()) {
+        // The fingerprint could not be stored
+        return true;
+    }
+    return !loadStoredFingerprint(&m_analysisDao, trackId).empty();
+}
+
+void AnalyzerChromaprint::process(const CSAMPLE* pIn, const int iLen) {
+    if (!m_pContext || m_remainingSamples <= 0) {
+        return;
+    }
+    const int numSamples = math_min(iLen, m_remainingSamples);
+    DEBUG_ASSERT(numSamples <= static_cast<int>(m_sampleBuffer.size()));
+    // Chromaprint expects 16-bit integer samples
+    SampleUtil::convertFloat32ToS16(m_sampleBuffer.data(), pIn, numSamples);
+    if (!chromaprint_feed(m_pContext, m_sampleBuffer.data(), numSamples)) {
+        kLogger.warning() << "Failed to generate fingerprint from sample data";
+        cleanup(TrackPointer());
+        return;
+    }
+    m_remainingSamples -= numSamples;
+}
+
+void AnalyzerChromaprint::cleanup(TrackPointer tio) {
+    Q_UNUSED(tio);
+    if (m_pContext) {
+        chromaprint_free(m_pContext);
+        m_pContext = nullptr;
+    }
+    m_remainingSamples = 0;
+}
+
+void AnalyzerChromaprint::finalize(TrackPointer tio) {
+    if (!m_pContext) {
+        return;
+    }
+
+    RawFingerprint fingerprint;
+    if (chromaprint_finish(m_pContext)) {
+        uint32_p pRawFingerprint = nullptr;
+        int size = 0;
+        if (chromaprint_get_raw_fingerprint(m_pContext, &pRawFingerprint, &size)) {
+            const quint32* pBegin = static_cast<const quint32*>(pRawFingerprint);
+            fingerprint.assign(pBegin, pBegin + size);
+            chromaprint_dealloc(pRawFingerprint);
+        }
+    }
+    cleanup(tio);
+
+    if (fingerprint.empty()) {
+        kLogger.warning()
+                << "Failed to generate fingerprint for track"
+                << tio->getId();
+        return;
+    }
+
+    const TrackId trackId = tio->getId();
+    if (m_pWriteQueue) {
+        const UserSettingsPointer pConfig = m_pConfig;
+        m_pWriteQueue->post([pConfig, trackId, fingerprint](
+                QSqlDatabase database) {
+            AnalysisDao analysisDao(pConfig);
+            analysisDao.initialize(database);
+            return storeFingerprint(&analysisDao, trackId, fingerprint);
+        });
+    } else {
+        storeFingerprint(&m_analysisDao, trackId, fingerprint);
+    }
+}
+
+// static
+RawFingerprint AnalyzerChromaprint::loadStoredFingerprint(
+        AnalysisDao* pAnalysisDao,
+        TrackId trackId) {
+    DEBUG_ASSERT(pAnalysisDao);
+    const QList<AnalysisDao::AnalysisInfo> analyses =
+            pAnalysisDao->getAnalysesForTrackByType(
+                    trackId, AnalysisDao::TYPE_FINGERPRINT);
+    for (const auto& analysis : analyses) {
+        RawFingerprint fingerprint = fingerprintFromAnalysis(analysis);
+        if (!fingerprint.empty()) {
+            return fingerprint;
+        }
+        // Outdated fingerprints are calculated again and replaced by
+        // storeFingerprint()
+    }
+    return RawFingerprint();
+}
+
+// static
+bool AnalyzerChromaprint::storeFingerprint(
+        AnalysisDao* pAnalysisDao,
+        TrackId trackId,
+        const RawFingerprint& fingerprint) {
+    DEBUG_ASSERT(pAnalysisDao);
+    const QList<AnalysisDao::AnalysisInfo> analyses =
+            pAnalysisDao->getAnalysesForTrackByType(
+                    trackId, AnalysisDao::TYPE_FINGERPRINT);
+    for (const auto& analysis : analyses) {
+        pAnalysisDao->deleteAnalysis(analysis.analysisId);
+    }
+    AnalysisDao::AnalysisInfo analysis =
+            analysisFromFingerprint(trackId, fingerprint);
+    return pAnalysisDao->saveAnalysis(&analysis);
+}
+
+// static
+AnalysisDao::AnalysisInfo AnalyzerChromaprint::analysisFromFingerprint(
+        TrackId trackId,
+        const RawFingerprint& fingerprint) {
+    AnalysisDao::AnalysisInfo analysis;
+    analysis.trackId = trackId;
+    analysis.type = AnalysisDao::TYPE_FINGERPRINT;
+    analysis.description = kDescription;
+    analysis.version = kVersion;
+    analysis.data = serializeFingerprint(fingerprint);
+    return analysis;
+}
+
+// static
+RawFingerprint AnalyzerChromaprint::fingerprintFromAnalysis(
+        const AnalysisDao::AnalysisInfo& analysis) {
+    DEBUG_ASSERT(analysis.type == AnalysisDao::TYPE_FINGERPRINT);
+    if (analysis.version != kVersion) {
+        return RawFingerprint();
+    }
+    return deserializeFingerprint(analysis.data);
+}
+
+// static
+QByteArray AnalyzerChromaprint::serializeFingerprint(
+        const RawFingerprint& fingerprint) {
+    QByteArray data(
+            static_cast<int>(fingerprint.size() * sizeof(quint32)),
+            Qt::Uninitialized);
+    uchar* pData = reinterpret_cast<uchar*>(data.data());
+    for (const quint32 subFingerprint : fingerprint) {
+        qToLittleEndian(subFingerprint, pData);
+        pData += sizeof(quint32);
+    }
+    return data;
+}
+
+// static
+RawFingerprint AnalyzerChromaprint::deserializeFingerprint(
+        const QByteArray& data) {
+    RawFingerprint fingerprint(data.size() / sizeof(quint32));
+    const uchar* pData = reinterpret_cast<const uchar*>(data.constData());
+    for (auto& subFingerprint : fingerprint) {
+        subFingerprint = qFromLittleEndian<quint32>(pData);
+        pData += sizeof(quint32);
+    }
+    return fingerprint;
+}
@@ -0,0 +1,68 @@
+#ifndef ANALYZER_ANALYZERCHROMAPRINT_H
+#define ANALYZER_ANALYZERCHROMAPRINT_H
+
+#include <QSqlDatabase>
+
+#include <vector>
+
+#include "analyzer/analyzer.h"
+#include "library/dao/analysisdao.h"
+#include "musicbrainz/fingerprintindex.h"
+#include "preferences/usersettings.h"
+
+struct ChromaprintContext;
+
+namespace mixxx {
+class DbWriteQueue;
+} // namespace mixxx
+
+// Calculates the raw Chromaprint fingerprint of the beginning of a track
+// from the samples that are decoded for the other analyzers and stores it
+// in the database.
+class AnalyzerChromaprint : public Analyzer {
+  public:
+    // The fingerprints are stored through the write queue if provided and
+    // synchronously with the given connection otherwise.
+    AnalyzerChromaprint(
+            UserSettingsPointer pConfig,
+            QSqlDatabase dbConnection,
+            mixxx::DbWriteQueue* pWriteQueue = nullptr);
+    ~AnalyzerChromaprint() override;
+
+    static bool isEnabled(UserSettingsPointer pConfig);
+
+    bool initialize(TrackPointer tio, int sampleRate, int totalSamples) override;
+    bool isDisabledOrLoadStoredSuccess(TrackPointer tio) const override;
+    void process(const CSAMPLE* pIn, const int iLen) override;
+    void cleanup(TrackPointer tio) override;
+    void finalize(TrackPointer tio) override;
+
+    // Returns an empty fingerprint if none has been stored for the track
+    static RawFingerprint loadStoredFingerprint(
+            AnalysisDao* pAnalysisDao,
+            TrackId trackId);
+    // Replaces all fingerprints of the track including outdated ones
+    static bool storeFingerprint(
+            AnalysisDao* pAnalysisDao,
+            TrackId trackId,
+            const RawFingerprint& fingerprint);
+    static AnalysisDao::AnalysisInfo analysisFromFingerprint(
+            TrackId trackId,
+            const RawFingerprint& fingerprint);
+    // Returns an empty fingerprint if the analysis is outdated
+    static RawFingerprint fingerprintFromAnalysis(
+            const AnalysisDao::AnalysisInfo& analysis);
+
+    static QByteArray serializeFingerprint(const RawFingerprint& fingerprint);
+    static RawFingerprint deserializeFingerprint(const QByteArray& data);
+
+  private:
+    const UserSettingsPointer m_pConfig;
+    mutable AnalysisDao m_analysisDao;
+    mixxx::DbWriteQueue* const m_pWriteQueue;
+    ChromaprintContext* m_pContext;
+    std::vector<SAMPLE> m_sampleBuffer;
+    int m_remainingSamples;
+};
+
+#endif // ANALYZER_ANALYZERCHROMAPRINT_H
@@ -23,6 +23,7 @@ AnalyzerKey::AnalyzerKey(KeyDetectionSettings keySettings)
           m_iCurrentSample(0),
           m_bPreferencesKeyDetectionEnabled(true),
           m_bPreferencesFastAnalysisEnabled(false),
+          m_bPreferencesParallelAnalysisEnabled(false),
           m_bPreferencesReanalyzeEnabled(false) {
 }
 
@@ -38,13 +39,15 @@ bool AnalyzerKey::initialize(TrackPointer tio, int sampleRate, int totalSamples)
     }
 
     m_bPreferencesFastAnalysisEnabled = m_keySettings.getFastAnalysis();
+    m_bPreferencesParallelAnalysisEnabled = m_keySettings.getParallelAnalysis();
     m_bPreferencesReanalyzeEnabled = m_keySettings.getReanalyzeWhenSettingsChange();
     m_pluginId = m_keySettings.getKeyPluginId();
 
     qDebug() << "AnalyzerKey preference settings:"
              << "\nPlugin:" << m_pluginId
              << "\nRe-analyze when settings change:" << m_bPreferencesReanalyzeEnabled
-             << "\nFast analysis:" << m_bPreferencesFastAnalysisEnabled;
+             << "\nFast analysis:" << m_bPreferencesFastAnalysisEnabled
+             << "\nParallel analysis:" << m_bPreferencesParallelAnalysisEnabled;
 
     m_iSampleRate = sampleRate;
     m_iTotalSamples = totalSamples;
@@ -63,10 +66,12 @@ bool AnalyzerKey::initialize(TrackPointer tio, int sampleRate, int totalSamples)
     DEBUG_ASSERT(!m_pPlugin);
     if (bShouldAnalyze) {
         if (m_pluginId == mixxx::AnalyzerQueenMaryKey::pluginInfo().id) {
-            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryKey>();
+            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryKey>(
+                    m_bPreferencesParallelAnalysisEnabled);
         } else {
             // Default to our built-in key detector.
-            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryKey>();
+            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryKey>(
+                    m_bPreferencesParallelAnalysisEnabled);
         }
         bShouldAnalyze = m_pPlugin->initialize(sampleRate);
     }
@@ -39,6 +39,7 @@ class AnalyzerKey : public Analyzer {
 
     bool m_bPreferencesKeyDetectionEnabled;
     bool m_bPreferencesFastAnalysisEnabled;
+    bool m_bPreferencesParallelAnalysisEnabled;
     bool m_bPreferencesReanalyzeEnabled;
 };
 
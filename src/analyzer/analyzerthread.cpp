@@ -3,6 +3,7 @@
 #include <mutex>
 
 #include "analyzer/analyzerbeats.h"
+#include "analyzer/analyzerchromaprint.h"
 #include "analyzer/constants.h"
 #include "analyzer/analyzerkey.h"
 #include "analyzer/analyzergain.h"
@@ -98,15 +99,24 @@ void AnalyzerThread::doRun() {
     // before returning from this function.
     mixxx::DbConnectionPooler dbConnectionPooler;
 
-    if (m_modeFlags & AnalyzerModeFlags::WithWaveform) {
-        dbConnectionPooler = mixxx::DbConnectionPooler(m_dbConnectionPool); // move assignment
+    const bool withWaveform = (m_modeFlags & AnalyzerModeFlags::WithWaveform) != 0;
+    const bool withFingerprint = AnalyzerChromaprint::isEnabled(m_pConfig);
+    QSqlDatabase dbConnection;
+    if (withWaveform || withFingerprint) {
+        // All writes of the analyzers are posted into the write queue
+        dbConnectionPooler = mixxx::DbConnectionPooler(
+                m_dbConnectionPool,
+                mixxx::DbConnection::AccessMode::ReadOnly); // move assignment
         if (!dbConnectionPooler.isPooling()) {
             kLogger.warning()
                     << "Failed to obtain database connection for analyzer thread";
             return;
         }
-        QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_dbConnectionPool);
-        m_analyzers.push_back(std::make_unique<AnalyzerWaveform>(m_pConfig, dbConnection));
+        dbConnection = mixxx::DbConnectionPooled(m_dbConnectionPool);
+    }
+    if (withWaveform) {
+        m_analyzers.push_back(std::make_unique<AnalyzerWaveform>(
+                m_pConfig, dbConnection, m_dbConnectionPool->writeQueue()));
     }
     if (AnalyzerGain::isEnabled(ReplayGainSettings(m_pConfig))) {
         m_analyzers.push_back(std::make_unique<AnalyzerGain>(m_pConfig));
@@ -120,6 +130,12 @@ void AnalyzerThread::doRun() {
     m_analyzers.push_back(std::make_unique<AnalyzerBeats>(m_pConfig, enforceBpmDetection));
     m_analyzers.push_back(std::make_unique<AnalyzerKey>(m_pConfig));
     m_analyzers.push_back(std::make_unique<AnalyzerSilence>(m_pConfig));
+    if (withFingerprint) {
+        // Fingerprints are calculated from the same decoded samples for
+        // finding duplicates in the library
+        m_analyzers.push_back(std::make_unique<AnalyzerChromaprint>(
+                m_pConfig, dbConnection, m_dbConnectionPool->writeQueue()));
+    }
     DEBUG_ASSERT(!m_analyzers.empty());
     kLogger.debug() << "Activated" << m_analyzers.size() << "analyzers";
 
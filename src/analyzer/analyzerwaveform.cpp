@@ -6,6 +6,7 @@
 #include "library/trackcollection.h"
 #include "track/track.h"
 #include "waveform/waveformfactory.h"
+#include "util/db/dbwritequeue.h"
 #include "util/logger.h"
 
 namespace {
@@ -16,8 +17,11 @@ mixxx::Logger kLogger("AnalyzerWaveform");
 
 AnalyzerWaveform::AnalyzerWaveform(
         UserSettingsPointer pConfig,
-        QSqlDatabase dbConnection)
-        : m_analysisDao(pConfig),
+        QSqlDatabase dbConnection,
+        mixxx::DbWriteQueue* pWriteQueue)
+        : m_pConfig(pConfig),
+          m_analysisDao(pConfig),
+          m_pWriteQueue(pWriteQueue),
           m_skipProcessing(false),
           m_waveformData(nullptr),
           m_waveformSummaryData(nullptr),
@@ -118,7 +122,7 @@ bool AnalyzerWaveform::isDisabledOrLoadStoredSuccess(TrackPointer tio) const {
                     missingWaveform = false;
                 } else if (vc != WaveformFactory::VC_KEEP) {
                     // remove all other Analysis except that one we should keep
-                    m_analysisDao.deleteAnalysis(analysis.analysisId);
+                    deleteAnalysis(analysis.analysisId);
                 }
             } if (analysis.type == AnalysisDao::TYPE_WAVESUMMARY) {
                 vc = WaveformFactory::waveformSummaryVersionToVersionClass(analysis.version);
@@ -128,7 +132,7 @@ bool AnalyzerWaveform::isDisabledOrLoadStoredSuccess(TrackPointer tio) const {
                     missingWavesummary = false;
                 } else if (vc != WaveformFactory::VC_KEEP) {
                     // remove all other Analysis except that one we should keep
-                    m_analysisDao.deleteAnalysis(analysis.analysisId);
+                    deleteAnalysis(analysis.analysisId);
                 }
             }
         }
@@ -310,15 +314,49 @@ void AnalyzerWaveform::finalize(TrackPointer tio) {
     // waveforms (i.e. if the config setting was disabled in a previous scan)
     // and then it is not called. The other analyzers have signals which control
     // the update of their data.
-    m_analysisDao.saveTrackAnalyses(
-            tio->getId(),
-            tio->getWaveform(),
-            tio->getWaveformSummary());
+    if (m_pWriteQueue) {
+        // Don't block the analysis of the next track while the database
+        // is busy, e.g. during a library scan. The waveforms are marked as
+        // queued before posting, so that TrackDAO doesn't save them again
+        // while the request is pending.
+        const UserSettingsPointer pConfig = m_pConfig;
+        const TrackId trackId = tio->getId();
+        const ConstWaveformPointer pWaveform = tio->getWaveform();
+        const ConstWaveformPointer pWaveformSummary = tio->getWaveformSummary();
+        if (m_analysisDao.queueTrackAnalyses(pWaveform, pWaveformSummary)) {
+            m_pWriteQueue->post([pConfig, trackId, pWaveform, pWaveformSummary](
+                    QSqlDatabase database) {
+                AnalysisDao analysisDao(pConfig);
+                analysisDao.initialize(database);
+                analysisDao.saveQueuedTrackAnalyses(
+                        trackId, pWaveform, pWaveformSummary);
+                return true;
+            });
+        }
+    } else {
+        m_analysisDao.saveTrackAnalyses(
+                tio->getId(),
+                tio->getWaveform(),
+                tio->getWaveformSummary());
+    }
 
     kLogger.debug() << "Waveform generation for track" << tio->getId() << "done"
              << m_timer.elapsed().debugSecondsWithUnit();
 }
 
+void AnalyzerWaveform::deleteAnalysis(int analysisId) const {
+    if (m_pWriteQueue) {
+        const UserSettingsPointer pConfig = m_pConfig;
+        m_pWriteQueue->post([pConfig, analysisId](QSqlDatabase database) {
+            AnalysisDao analysisDao(pConfig);
+            analysisDao.initialize(database);
+            return analysisDao.deleteAnalysis(analysisId);
+        });
+    } else {
+        m_analysisDao.deleteAnalysis(analysisId);
+    }
+}
+
 void AnalyzerWaveform::storeIfGreater(float* pDest, float source) {
     if (*pDest < source) {
         *pDest = source;
@@ -17,6 +17,10 @@
 
 class EngineFilterIIRBase;
 
+namespace mixxx {
+class DbWriteQueue;
+} // namespace mixxx
+
 inline CSAMPLE scaleSignal(CSAMPLE invalue, FilterIndex index = FilterCount) {
     if (invalue == 0.0) {
         return 0;
@@ -137,9 +141,12 @@ struct WaveformStride {
 
 class AnalyzerWaveform : public Analyzer {
   public:
+    // The waveforms are stored and deleted through the write queue if
+    // provided and synchronously with the given connection otherwise.
     AnalyzerWaveform(
             UserSettingsPointer pConfig,
-            QSqlDatabase dbConnection);
+            QSqlDatabase dbConnection,
+            mixxx::DbWriteQueue* pWriteQueue = nullptr);
     ~AnalyzerWaveform() override;
 
     bool initialize(TrackPointer tio, int sampleRate, int totalSamples) override;
@@ -154,9 +161,12 @@ class AnalyzerWaveform : public Analyzer {
 
     void createFilters(int sampleRate);
     void destroyFilters();
+    void deleteAnalysis(int analysisId) const;
     void storeIfGreater(float* pDest, float source);
 
+    const UserSettingsPointer m_pConfig;
     mutable AnalysisDao m_analysisDao;
+    mixxx::DbWriteQueue* const m_pWriteQueue;
 
     bool m_skipProcessing;
 
@@ -5,6 +5,8 @@
 // definitions interfere with qm-dsp's headers.
 #include "analyzer/plugins/analyzerqueenmarybeats.h"
 
+#include <QtConcurrentRun>
+
 #include "analyzer/constants.h"
 
 namespace mixxx {
@@ -13,6 +15,14 @@ namespace {
 constexpr size_t kWindowSize = 1024;
 constexpr size_t kStepSize = 512;
 
+// The number of windows per segment in parallel mode. About 24 seconds at
+// 44.1 kHz, i.e. long enough to keep the overhead of the overlap and the
+// scheduling negligible.
+constexpr size_t kSegmentWindows = 2048;
+// A segment ends with the last sample of its last window
+constexpr size_t kSegmentSize =
+        (kSegmentWindows - 1) * kStepSize + kWindowSize;
+
 DFConfig makeDetectionFunctionConfig() {
     // These are the defaults for the VAMP beat tracker plugin we used in Mixxx
     // 2.0.
@@ -29,11 +39,22 @@ DFConfig makeDetectionFunctionConfig() {
 
 }  // namespace
 
-AnalyzerQueenMaryBeats::AnalyzerQueenMaryBeats()
-        : m_iSampleRate(0) {
+// Enough for keeping all cores busy with the analyzer threads, which
+// usually run in parallel. Bounds the samples that are kept in memory if
+// the thread pool is busy otherwise.
+const int AnalyzerQueenMaryBeats::kMaxSegmentsInFlight = 4;
+
+AnalyzerQueenMaryBeats::AnalyzerQueenMaryBeats(bool parallel)
+        : m_parallel(parallel),
+          m_iSampleRate(0),
+          m_segmentWarmUp(false) {
 }
 
 AnalyzerQueenMaryBeats::~AnalyzerQueenMaryBeats() {
+    // The segments must not outlive the analysis
+    for (auto& segment : m_segments) {
+        segment.future.waitForFinished();
+    }
 }
 
 bool AnalyzerQueenMaryBeats::initialize(int samplerate) {
@@ -42,6 +63,14 @@ bool AnalyzerQueenMaryBeats::initialize(int samplerate) {
     m_pDetectionFunction = std::make_unique<DetectionFunction>(
         makeDetectionFunctionConfig());
 
+    if (m_parallel) {
+        m_segmentSamples.clear();
+        m_segmentSamples.reserve(kSegmentSize);
+        m_segmentWarmUp = false;
+        m_segments.clear();
+        return true;
+    }
+
     m_helper.initialize(
         kWindowSize, kStepSize, [this](double* pWindow, size_t) {
             // TODO(rryan) reserve?
@@ -59,13 +88,94 @@ bool AnalyzerQueenMaryBeats::process(const CSAMPLE* pIn, const int iLen) {
         return false;
     }
 
+    if (m_parallel) {
+        const int numInputFrames = iLen / kAnalysisChannels;
+        for (int i = 0; i < numInputFrames; ++i) {
+            // The same downmix as in DownmixAndOverlapHelper
+            m_segmentSamples.push_back((pIn[i * 2] + pIn[i * 2 + 1]) * 0.5);
+            if (m_segmentSamples.size() == kSegmentSize) {
+                processSegment();
+            }
+        }
+        return true;
+    }
+
     return m_helper.processStereoSamples(pIn, iLen);
 }
 
+void AnalyzerQueenMaryBeats::processSegment() {
+    // The last window of this segment is the first window of the next
+    // segment, where it is only needed for the spectral difference.
+    auto pSamples = std::make_shared<std::vector<double>>();
+    pSamples->reserve(kSegmentSize);
+    if (m_segmentSamples.size() >= kWindowSize) {
+        pSamples->assign(m_segmentSamples.end() - kWindowSize,
+                m_segmentSamples.end());
+    }
+    pSamples->swap(m_segmentSamples);
+    const bool warmUp = m_segmentWarmUp;
+    Segment segment;
+    if (segmentsInFlight() < kMaxSegmentsInFlight) {
+        segment.future = QtConcurrent::run([pSamples, warmUp] {
+            return calculateDetectionFunction(*pSamples, warmUp);
+        });
+    } else {
+        // Calculated here instead of queuing more samples while the
+        // thread pool is busy with other work
+        segment.results = calculateDetectionFunction(*pSamples, warmUp);
+    }
+    m_segments.append(segment);
+    m_segmentWarmUp = true;
+}
+
+int AnalyzerQueenMaryBeats::segmentsInFlight() const {
+    int count = 0;
+    for (const auto& segment : m_segments) {
+        if (!segment.future.isFinished()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// static
+std::vector<double> AnalyzerQueenMaryBeats::calculateDetectionFunction(
+        const std::vector<double>& samples, bool warmUp) {
+    std::vector<double> results;
+    if (samples.size() < kWindowSize) {
+        return results;
+    }
+    const size_t numWindows = (samples.size() - kWindowSize) / kStepSize + 1;
+    results.reserve(numWindows);
+    DetectionFunction detectionFunction(makeDetectionFunctionConfig());
+    for (size_t i = 0; i < numWindows; ++i) {
+        const double result = detectionFunction.processTimeDomain(
+                samples.data() + i * kStepSize);
+        if (i > 0 || !warmUp) {
+            results.push_back(result);
+        }
+    }
+    return results;
+}
+
 bool AnalyzerQueenMaryBeats::finalize() {
     // TODO(rryan) if iLen is less than frame size, pad with zeros. Do we need
     // flush support?
 
+    if (m_parallel) {
+        // Stitch the segments together in order
+        processSegment();
+        for (auto& segment : m_segments) {
+            if (!segment.future.isCanceled()) {
+                segment.results = segment.future.result();
+            }
+            m_detectionResults.insert(m_detectionResults.end(),
+                    segment.results.begin(), segment.results.end());
+        }
+        m_segments.clear();
+        std::vector<double>().swap(m_segmentSamples);
+    }
+
     int nonZeroCount = m_detectionResults.size();
     while (nonZeroCount > 0 && m_detectionResults.at(nonZeroCount - 1) <= 0.0) {
         --nonZeroCount;
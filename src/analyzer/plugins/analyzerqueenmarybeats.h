@@ -3,6 +3,8 @@
 
 #include <vector>
 
+#include <QFuture>
+#include <QList>
 #include <QObject>
 
 #include "analyzer/plugins/analyzerplugin.h"
@@ -23,7 +25,17 @@ class AnalyzerQueenMaryBeats : public AnalyzerBeatsPlugin {
             QObject::tr("Queen Mary Tempo and Beat Tracker"));
     }
 
-    AnalyzerQueenMaryBeats();
+    // The number of segments per analyzer that are calculated or waiting
+    // on the global thread pool in parallel mode. Further segments are
+    // calculated by the analyzer thread.
+    static const int kMaxSegmentsInFlight;
+
+    // In parallel mode the onset detection function is calculated for
+    // segments of the track on the global thread pool while decoding
+    // continues. The segments overlap by one step, so that the spectral
+    // difference of the first window of each segment can be calculated,
+    // and the stitched result is identical to that of the serial mode.
+    explicit AnalyzerQueenMaryBeats(bool parallel = false);
     ~AnalyzerQueenMaryBeats() override;
 
     AnalyzerPluginInfo info() const override {
@@ -42,11 +54,34 @@ class AnalyzerQueenMaryBeats : public AnalyzerBeatsPlugin {
         return m_resultBeats;
     }
 
+    // Returns the detection function results for all complete windows
+    // of the samples. If warmUp is set, the result of the first window
+    // is omitted, because the samples continue a preceding segment.
+    static std::vector<double> calculateDetectionFunction(
+            const std::vector<double>& samples, bool warmUp);
+
+    int segmentsInFlight() const;
+
   private:
+    struct Segment {
+        // Canceled if the segment has been calculated by the analyzer
+        // thread
+        QFuture<std::vector<double>> future;
+        std::vector<double> results;
+    };
+
+    void processSegment();
+
+    const bool m_parallel;
     std::unique_ptr<DetectionFunction> m_pDetectionFunction;
     DownmixAndOverlapHelper m_helper;
     int m_iSampleRate;
     std::vector<double> m_detectionResults;
+
+    // Parallel mode
+    std::vector<double> m_segmentSamples;
+    bool m_segmentWarmUp;
+    QList<Segment> m_segments;
     QVector<double> m_resultBeats;
 };
 
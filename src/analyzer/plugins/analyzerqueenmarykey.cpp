@@ -1,6 +1,7 @@
 #include <dsp/keydetection/GetKeyMode.h>
 
 #include <QMutex>
+#include <QtConcurrentRun>
 
 // Class header comes after library includes here since our preprocessor
 // definitions interfere with qm-dsp's headers.
@@ -21,50 +22,94 @@ constexpr int kChromaWindowLength = 10;
 // Tuning frequency of concert A in Hertz. Default value from VAMP plugin.
 constexpr int kTuningFrequencyHertz = 440;
 
+// The number of windows per segment in parallel mode. About 24 seconds at
+// 44.1 kHz, i.e. long enough to keep the overhead of the overlap and the
+// scheduling negligible.
+constexpr size_t kSegmentWindows = 32;
+
 // NOTE(2019-01-26, uklotzde) Temporary workaround until multi-threading
 // issues when using the qm-dsp key detector have been solved. Synchronizes
 // all invocations of initialize()/process()/finalize().
 // See also: https://bugs.launchpad.net/mixxx/+bug/1813413
+// The key decision of GetKeyMode rotates the key profiles that are shared
+// by all instances. Only calculating the chroma in parallel mode doesn't
+// need to be synchronized.
 QMutex s_mutex;
 
+std::unique_ptr<GetKeyMode> makeKeyMode(int sampleRate) {
+    return std::make_unique<GetKeyMode>(sampleRate, kTuningFrequencyHertz,
+            kChromaWindowLength, kChromaWindowLength);
+}
+
 } // namespace
 
-AnalyzerQueenMaryKey::AnalyzerQueenMaryKey()
-        : m_currentFrame(0),
-          m_prevKey(mixxx::track::io::key::INVALID) {
+// Enough for keeping all cores busy with the analyzer threads, which
+// usually run in parallel. Bounds the samples that are kept in memory if
+// the thread pool is busy otherwise.
+const int AnalyzerQueenMaryKey::kMaxSegmentsInFlight = 4;
+
+AnalyzerQueenMaryKey::AnalyzerQueenMaryKey(bool parallel)
+        : m_parallel(parallel),
+          m_currentFrame(0),
+          m_prevKey(mixxx::track::io::key::INVALID),
+          m_iSampleRate(0),
+          m_windowSize(0),
+          m_segmentWarmUp(false) {
 }
 
 AnalyzerQueenMaryKey::~AnalyzerQueenMaryKey() {
+    // The segments must not outlive the analysis
+    for (auto& segment : m_segments) {
+        segment.future.waitForFinished();
+    }
 }
 
 bool AnalyzerQueenMaryKey::initialize(int samplerate) {
     m_prevKey = mixxx::track::io::key::INVALID;
     m_resultKeys.clear();
     m_currentFrame = 0;
-    m_pKeyMode = std::make_unique<GetKeyMode>(samplerate, kTuningFrequencyHertz, kChromaWindowLength, kChromaWindowLength);
+    m_pKeyMode = makeKeyMode(samplerate);
     size_t windowSize = m_pKeyMode->getBlockSize();
     size_t stepSize = m_pKeyMode->getHopSize();
 
+    if (m_parallel) {
+        // Segments are stitched together window by window
+        VERIFY_OR_DEBUG_ASSERT(windowSize == stepSize) {
+            return false;
+        }
+        m_iSampleRate = samplerate;
+        m_windowSize = windowSize;
+        m_segmentSamples.clear();
+        m_segmentSamples.reserve(kSegmentWindows * m_windowSize);
+        m_segmentWarmUp = false;
+        m_segments.clear();
+        return true;
+    }
+
     QMutexLocker locked(&s_mutex);
     return m_helper.initialize(
             windowSize, stepSize, [this](double* pWindow, size_t) {
-                int iKey = m_pKeyMode->process(pWindow);
-
-                VERIFY_OR_DEBUG_ASSERT(ChromaticKey_IsValid(iKey)) {
-                    qWarning() << "No valid key detected in analyzed window:" << iKey;
-                    return false;
-                }
-                const auto key = static_cast<ChromaticKey>(iKey);
-                if (key != m_prevKey) {
-                    // TODO(rryan) reserve?
-                    m_resultKeys.push_back(qMakePair(
-                            key, static_cast<double>(m_currentFrame)));
-                    m_prevKey = key;
-                }
-                return true;
+                return processKey(m_pKeyMode->processChroma(pWindow));
             });
 }
 
+bool AnalyzerQueenMaryKey::processKey(const double* pChroma) {
+    int iKey = m_pKeyMode->processKey(pChroma);
+
+    VERIFY_OR_DEBUG_ASSERT(ChromaticKey_IsValid(iKey)) {
+        qWarning() << "No valid key detected in analyzed window:" << iKey;
+        return false;
+    }
+    const auto key = static_cast<ChromaticKey>(iKey);
+    if (key != m_prevKey) {
+        // TODO(rryan) reserve?
+        m_resultKeys.push_back(qMakePair(
+                key, static_cast<double>(m_currentFrame)));
+        m_prevKey = key;
+    }
+    return true;
+}
+
 bool AnalyzerQueenMaryKey::process(const CSAMPLE* pIn, const int iLen) {
     DEBUG_ASSERT(iLen == kAnalysisSamplesPerBlock);
     DEBUG_ASSERT(iLen % kAnalysisChannels == 0);
@@ -74,13 +119,111 @@ bool AnalyzerQueenMaryKey::process(const CSAMPLE* pIn, const int iLen) {
     }
 
     const size_t numInputFrames = iLen / kAnalysisChannels;
+    if (m_parallel) {
+        for (size_t i = 0; i < numInputFrames; ++i) {
+            // The same downmix as in DownmixAndOverlapHelper
+            m_segmentSamples.push_back((pIn[i * 2] + pIn[i * 2 + 1]) * 0.5);
+            if (m_segmentSamples.size() == kSegmentWindows * m_windowSize) {
+                processSegment();
+            }
+        }
+        return true;
+    }
+
     m_currentFrame += numInputFrames;
     QMutexLocker locked(&s_mutex);
     return m_helper.processStereoSamples(pIn, iLen);
 }
 
+void AnalyzerQueenMaryKey::processSegment() {
+    // The last window of this segment is repeated by the next segment,
+    // where it only warms up the decimation filter.
+    auto pSamples = std::make_shared<std::vector<double>>();
+    pSamples->reserve(kSegmentWindows * m_windowSize);
+    if (m_segmentSamples.size() >= m_windowSize) {
+        pSamples->assign(m_segmentSamples.end() - m_windowSize,
+                m_segmentSamples.end());
+    }
+    pSamples->swap(m_segmentSamples);
+    const int sampleRate = m_iSampleRate;
+    const bool warmUp = m_segmentWarmUp;
+    Segment segment;
+    if (segmentsInFlight() < kMaxSegmentsInFlight) {
+        segment.future = QtConcurrent::run([sampleRate, pSamples, warmUp] {
+            return calculateChromagram(sampleRate, *pSamples, warmUp);
+        });
+    } else {
+        // Calculated here instead of queuing more samples while the
+        // thread pool is busy with other work
+        segment.results = calculateChromagram(sampleRate, *pSamples, warmUp);
+    }
+    m_segments.append(segment);
+    m_segmentWarmUp = true;
+}
+
+int AnalyzerQueenMaryKey::segmentsInFlight() const {
+    int count = 0;
+    for (const auto& segment : m_segments) {
+        if (!segment.future.isFinished()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// static
+std::vector<double> AnalyzerQueenMaryKey::calculateChromagram(
+        int sampleRate, const std::vector<double>& samples, bool warmUp) {
+    // Only the decimator and the chromagram of this instance are used,
+    // which doesn't need to be synchronized
+    const auto pKeyMode = makeKeyMode(sampleRate);
+    const size_t windowSize = pKeyMode->getBlockSize();
+    const size_t chromaSize = pKeyMode->getChromaSize();
+    const size_t numWindows = samples.size() / windowSize;
+    std::vector<double> results;
+    results.reserve(numWindows * chromaSize);
+    for (size_t i = 0; i < numWindows; ++i) {
+        const double* pChroma = pKeyMode->processChroma(
+                samples.data() + i * windowSize);
+        if (i > 0 || !warmUp) {
+            results.insert(results.end(), pChroma, pChroma + chromaSize);
+        }
+    }
+    return results;
+}
+
 bool AnalyzerQueenMaryKey::finalize() {
     // TODO(rryan) do we need a flush?
+    if (m_parallel && m_pKeyMode) {
+        processSegment();
+        // Other key analyzers are not blocked while waiting
+        for (auto& segment : m_segments) {
+            if (!segment.future.isCanceled()) {
+                segment.results = segment.future.result();
+            }
+        }
+        QMutexLocker locked(&s_mutex);
+        const size_t chromaSize = m_pKeyMode->getChromaSize();
+        const size_t framesPerBlock = kAnalysisFramesPerBlock;
+        size_t windowEnd = 0;
+        bool result = true;
+        for (const auto& segment : m_segments) {
+            for (size_t i = 0; result && i + chromaSize <= segment.results.size();
+                    i += chromaSize) {
+                // The serial mode reports the key at the end of the
+                // input block that completes the window
+                windowEnd += m_windowSize;
+                m_currentFrame = ((windowEnd + framesPerBlock - 1) /
+                        framesPerBlock) * framesPerBlock;
+                result = processKey(segment.results.data() + i);
+            }
+        }
+        m_segments.clear();
+        std::vector<double>().swap(m_segmentSamples);
+        m_pKeyMode.reset();
+        return result;
+    }
+
     QMutexLocker locked(&s_mutex);
     m_helper.finalize();
     m_pKeyMode.reset();
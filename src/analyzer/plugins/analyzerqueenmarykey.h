@@ -3,6 +3,8 @@
 
 #include <vector>
 
+#include <QFuture>
+#include <QList>
 #include <QObject>
 
 #include "analyzer/plugins/analyzerplugin.h"
@@ -23,7 +25,17 @@ class AnalyzerQueenMaryKey : public AnalyzerKeyPlugin {
                 QObject::tr("Queen Mary Key Detector"));
     }
 
-    AnalyzerQueenMaryKey();
+    // The number of segments per analyzer that are calculated or waiting
+    // on the global thread pool in parallel mode. Further segments are
+    // calculated by the analyzer thread.
+    static const int kMaxSegmentsInFlight;
+
+    // In parallel mode the chromagram is calculated for segments of the
+    // track on the global thread pool while decoding continues. Each
+    // segment repeats the last window of its predecessor for warming up
+    // the decimation filter. The key decision runs on the stitched
+    // chromagram when the analysis is finalized.
+    explicit AnalyzerQueenMaryKey(bool parallel = false);
     ~AnalyzerQueenMaryKey() override;
 
     AnalyzerPluginInfo info() const override {
@@ -38,12 +50,38 @@ class AnalyzerQueenMaryKey : public AnalyzerKeyPlugin {
         return m_resultKeys;
     }
 
+    // Returns the chroma of all complete windows of the samples, one
+    // after another. If warmUp is set, the chroma of the first window is
+    // omitted, because the samples continue a preceding segment.
+    static std::vector<double> calculateChromagram(
+            int sampleRate, const std::vector<double>& samples, bool warmUp);
+
+    int segmentsInFlight() const;
+
   private:
+    struct Segment {
+        // Canceled if the segment has been calculated by the analyzer
+        // thread
+        QFuture<std::vector<double>> future;
+        std::vector<double> results;
+    };
+
+    void processSegment();
+    bool processKey(const double* pChroma);
+
+    const bool m_parallel;
     std::unique_ptr<GetKeyMode> m_pKeyMode;
     DownmixAndOverlapHelper m_helper;
     size_t m_currentFrame;
     KeyChangeList m_resultKeys;
     mixxx::track::io::key::ChromaticKey m_prevKey;
+
+    // Parallel mode
+    int m_iSampleRate;
+    size_t m_windowSize;
+    std::vector<double> m_segmentSamples;
+    bool m_segmentWarmUp;
+    QList<Segment> m_segments;
 };
 
 } // namespace mixxx
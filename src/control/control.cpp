@@ -3,6 +3,7 @@
 
 #include "control/control.h"
 
+#include "control/controlnotifier.h"
 #include "util/stat.h"
 
 // Static member variable definition
@@ -40,6 +41,8 @@ ControlDoublePrivate::ControlDoublePrivate(ConfigKey key,
           m_trackFlags(Stat::COUNT | Stat::SUM | Stat::AVERAGE |
                        Stat::SAMPLE_VARIANCE | Stat::MIN | Stat::MAX),
           m_confirmRequired(false),
+          m_notifierIndex(-1),
+          m_pCoalescedSender(nullptr),
           m_pCreatorCO(pCreatorCO) {
     initialize(defaultValue);
 }
@@ -72,6 +75,10 @@ ControlDoublePrivate::~ControlDoublePrivate() {
     s_qCOHash.remove(m_key);
     s_qCOHashMutex.unlock();
 
+    if (m_notifierIndex >= 0) {
+        ControlNotifier::unregisterControl(m_notifierIndex);
+    }
+
     if (m_bPersistInConfiguration) {
         UserSettingsPointer pConfig = ControlDoublePrivate::s_pUserConfig;
         if (pConfig != NULL) {
@@ -134,6 +141,7 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
             pControl = QSharedPointer<ControlDoublePrivate>(
                     new ControlDoublePrivate(key, pCreatorCO, bIgnoreNops,
                                              bTrack, bPersist, defaultValue));
+            pControl->m_notifierIndex = ControlNotifier::registerControl(pControl);
             MMutexLocker locker(&s_qCOHashMutex);
             //qDebug() << "ControlDoublePrivate::s_qCOHash.insert(" << key.group << "," << key.item << ")";
             s_qCOHash.insert(key, pControl);
@@ -197,6 +205,19 @@ void ControlDoublePrivate::setInner(double value, QObject* pSender) {
     m_value.setValue(value);
     emit(valueChanged(value, pSender));
 
+    // Queued connections would allocate an event for every change in the
+    // engine thread. Controls that live in the engine thread, e.g. in
+    // tests, are not affected.
+    if (m_notifierIndex >= 0 &&
+            ControlNotifier::isEngineThread() &&
+            QThread::currentThread() != thread()) {
+        // Published to the GUI thread by markChanged()
+        m_pCoalescedSender.store(pSender);
+        ControlNotifier::markChanged(m_notifierIndex);
+    } else {
+        emit(valueChangedCoalesced(value, pSender));
+    }
+
     if (m_bTrack) {
         Stat::track(m_trackKey, static_cast<Stat::StatType>(m_trackType),
                     static_cast<Stat::ComputeFlags>(m_trackFlags), value);
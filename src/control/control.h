@@ -128,14 +128,25 @@ class ControlDoublePrivate : public QObject {
     // Emitted when the ControlDoublePrivate value changes. pSender is a
     // pointer to the setter of the value (potentially NULL).
     void valueChanged(double value, QObject* pSender);
+    // Emitted like valueChanged() for changes from any thread but the
+    // engine thread. The changes of the engine thread are coalesced and
+    // emitted once per GuiTick with the latest value by ControlNotifier.
+    // Use this signal for queued connections, which would allocate in the
+    // engine thread otherwise.
+    void valueChangedCoalesced(double value, QObject* pSender);
     void valueChangeRequest(double value);
 
   private:
+    friend class ControlNotifier;
+
     ControlDoublePrivate(ConfigKey key, ControlObject* pCreatorCO,
                          bool bIgnoreNops, bool bTrack, bool bPersist,
                          double defaultValue);
     void initialize(double defaultValue);
     void setInner(double value, QObject* pSender);
+    void emitValueChangedCoalesced() {
+        emit(valueChangedCoalesced(get(), m_pCoalescedSender.load()));
+    }
 
     ConfigKey m_key;
 
@@ -160,6 +171,12 @@ class ControlDoublePrivate : public QObject {
     int m_trackFlags;
     bool m_confirmRequired;
 
+    // The index for ControlNotifier or -1 if not registered
+    int m_notifierIndex;
+    // The setter of the latest change that has been coalesced by
+    // ControlNotifier. It is only compared and never dereferenced.
+    QAtomicPointer<QObject> m_pCoalescedSender;
+
     // The control value.
     ControlValueAtomic<double> m_value;
     // The default control value.
@@ -0,0 +1,92 @@
+#include "control/controlnotifier.h"
+
+#include <QTimer>
+#include <QtAlgorithms>
+
+#include "control/control.h"
+
+namespace {
+
+// Short enough that controllers don't notice any delay, e.g. when
+// mirroring the play indicator on an LED, while the GUI thread is only
+// woken up once for many changes of the engine.
+constexpr int kDeliveryIntervalMillis = 5;
+
+} // anonymous namespace
+
+// static
+std::atomic<QThread*> ControlNotifier::s_pEngineThread(nullptr);
+// static
+std::atomic<quint64> ControlNotifier::s_changed[kMaxControls / kBitsPerWord];
+// static
+MMutex ControlNotifier::s_mutex;
+// static
+QVector<QWeakPointer<ControlDoublePrivate>> ControlNotifier::s_controls;
+// static
+QVector<int> ControlNotifier::s_freeIndices;
+
+// static
+int ControlNotifier::registerControl(
+        const QSharedPointer<ControlDoublePrivate>& pControl) {
+    MMutexLocker locker(&s_mutex);
+    if (!s_freeIndices.isEmpty()) {
+        const int index = s_freeIndices.takeLast();
+        s_controls[index] = pControl;
+        return index;
+    }
+    if (s_controls.size() >= kMaxControls) {
+        return -1;
+    }
+    s_controls.append(pControl);
+    return s_controls.size() - 1;
+}
+
+// static
+void ControlNotifier::unregisterControl(int index) {
+    MMutexLocker locker(&s_mutex);
+    s_controls[index].clear();
+    // A pending change must not be delivered to the next control with
+    // this index.
+    s_changed[index / kBitsPerWord].fetch_and(
+            ~(static_cast<quint64>(1) << (index % kBitsPerWord)),
+            std::memory_order_relaxed);
+    s_freeIndices.append(index);
+}
+
+// static
+void ControlNotifier::deliverChanges() {
+    int numWords;
+    {
+        MMutexLocker locker(&s_mutex);
+        numWords = (s_controls.size() + kBitsPerWord - 1) / kBitsPerWord;
+    }
+    for (int word = 0; word < numWords; ++word) {
+        if (s_changed[word].load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        quint64 changed = s_changed[word].exchange(0, std::memory_order_acquire);
+        while (changed != 0) {
+            const int bit = qCountTrailingZeroBits(changed);
+            changed &= changed - 1;
+
+            QSharedPointer<ControlDoublePrivate> pControl;
+            {
+                MMutexLocker locker(&s_mutex);
+                pControl = s_controls[word * kBitsPerWord + bit].toStrongRef();
+            }
+            // Emitting without holding the lock allows the receivers to
+            // create and delete controls.
+            if (pControl) {
+                pControl->emitValueChangedCoalesced();
+            }
+        }
+    }
+}
+
+// static
+void ControlNotifier::startDeliveryTimer(QObject* pParent) {
+    QTimer* pTimer = new QTimer(pParent);
+    pTimer->setTimerType(Qt::PreciseTimer);
+    QObject::connect(pTimer, &QTimer::timeout, &ControlNotifier::deliverChanges);
+    pTimer->start(kDeliveryIntervalMillis);
+}
@@ -0,0 +1,75 @@
+#ifndef CONTROLNOTIFIER_H
+#define CONTROLNOTIFIER_H
+
+#include <QSharedPointer>
+#include <QThread>
+#include <QVector>
+
+#include <atomic>
+
+#include "util/mutex.h"
+
+class ControlDoublePrivate;
+
+// Delivers the value changes of controls that are set by the engine thread
+// to the other threads without allocating in the engine thread.
+//
+// Instead of emitting a queued signal for every change, the engine only marks
+// the control in a wait-free bitmap. The GUI thread delivers the latest value
+// and setter of each marked control by emitting
+// ControlDoublePrivate::valueChangedCoalesced(). This is done by a dedicated
+// timer every few milliseconds and additionally once per GuiTick before the
+// widgets are updated. Multiple changes in between are coalesced into a single
+// notification. Receivers in other threads, e.g. the controller thread, are
+// notified by a queued connection from the GUI thread.
+class ControlNotifier {
+  public:
+    // Sets the thread that runs the engine callback. Called at the start of
+    // each callback because the callback thread changes when the sound
+    // devices are reopened.
+    static void setEngineThread(QThread* pThread) {
+        s_pEngineThread.store(pThread, std::memory_order_relaxed);
+    }
+    static bool isEngineThread() {
+        return QThread::currentThread() ==
+                s_pEngineThread.load(std::memory_order_relaxed);
+    }
+
+    // Returns the index of the control for markChanged() or -1 if all
+    // indices are in use. Changes of unregistered controls are always
+    // delivered immediately.
+    static int registerControl(const QSharedPointer<ControlDoublePrivate>& pControl);
+    static void unregisterControl(int index);
+
+    // Wait-free, may be called from the engine thread.
+    static void markChanged(int index) {
+        s_changed[index / kBitsPerWord].fetch_or(
+                static_cast<quint64>(1) << (index % kBitsPerWord),
+                std::memory_order_release);
+    }
+
+    // Emits valueChangedCoalesced() for all controls that have been marked
+    // since the last call. Must be called from the GUI thread.
+    static void deliverChanges();
+
+    // Starts a timer in the calling thread, which must be the GUI thread,
+    // that delivers the changes periodically. The timer is owned by
+    // pParent.
+    static void startDeliveryTimer(QObject* pParent);
+
+  private:
+    ControlNotifier() = delete;
+
+    static constexpr int kMaxControls = 1 << 16;
+    static constexpr int kBitsPerWord = 64;
+
+    static std::atomic<QThread*> s_pEngineThread;
+    static std::atomic<quint64> s_changed[kMaxControls / kBitsPerWord];
+
+    // Guards s_controls and s_freeIndices
+    static MMutex s_mutex;
+    static QVector<QWeakPointer<ControlDoublePrivate>> s_controls;
+    static QVector<int> s_freeIndices;
+};
+
+#endif /* CONTROLNOTIFIER_H */
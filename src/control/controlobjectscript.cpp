@@ -10,7 +10,7 @@ bool ControlObjectScript::addScriptConnection(const ScriptConnection& conn) {
     if (m_scriptConnections.isEmpty()) {
         // Only connect the slots when they are actually needed
         // by script connections.
-        connect(m_pControl.data(), SIGNAL(valueChanged(double, QObject*)),
+        connect(m_pControl.data(), SIGNAL(valueChangedCoalesced(double, QObject*)),
                 this, SLOT(slotValueChanged(double,QObject*)),
                 Qt::QueuedConnection);
         connect(this, SIGNAL(trigger(double, QObject*)),
@@ -48,7 +48,7 @@ bool ControlObjectScript::removeScriptConnection(const ScriptConnection& conn) {
     }
     if (m_scriptConnections.isEmpty()) {
         // no ScriptConnections left, so disconnect signals
-        disconnect(m_pControl.data(), SIGNAL(valueChanged(double, QObject*)),
+        disconnect(m_pControl.data(), SIGNAL(valueChangedCoalesced(double, QObject*)),
                 this, SLOT(slotValueChanged(double,QObject*)));
         disconnect(this, SIGNAL(trigger(double, QObject*)),
                 this, SLOT(slotValueChanged(double,QObject*)));
@@ -85,7 +85,12 @@ class ControlProxy : public QObject {
         // use only explicit direct connection if requested
         // the caller must not delete this until the all signals are
         // processed to avoid segfaults
-        connect(m_pControl.data(), &ControlDoublePrivate::valueChanged,
+        // Connections that may be queued receive the coalesced changes of
+        // the engine thread.
+        auto copSignal = copConnection == Qt::DirectConnection ?
+                &ControlDoublePrivate::valueChanged :
+                &ControlDoublePrivate::valueChangedCoalesced;
+        connect(m_pControl.data(), copSignal,
                 this, copSlot,
                 static_cast<Qt::ConnectionType>(copConnection | Qt::UniqueConnection));
         return true;
@@ -15,6 +15,11 @@ class BalanceGroupState : public EffectState {
 
     void setFilters(int sampleRate, int freq);
 
+    size_t heapMemoryUsage() const override {
+        return m_pHighBuf.size() * sizeof(CSAMPLE)
+                + sizeof(*m_low) + sizeof(*m_high);
+    }
+
     std::unique_ptr<EngineFilterLinkwitzRiley4Low> m_low;
     std::unique_ptr<EngineFilterLinkwitzRiley4High> m_high;
 
@@ -38,6 +38,10 @@ class EchoGroupState : public EffectState {
         ping_pong = 0;
     };
 
+    size_t heapMemoryUsage() const override {
+        return delay_buf.size() * sizeof(CSAMPLE);
+    }
+
     mixxx::SampleBuffer delay_buf;
     CSAMPLE_GAIN prev_send;
     CSAMPLE_GAIN prev_feedback;
@@ -18,6 +18,11 @@ struct FilterGroupState : public EffectState {
 
     void setFilters(int sampleRate, double lowFreq, double highFreq);
 
+    size_t heapMemoryUsage() const override {
+        return m_buffer.size() * sizeof(CSAMPLE)
+                + sizeof(*m_pLowFilter) + sizeof(*m_pHighFilter);
+    }
+
     mixxx::SampleBuffer m_buffer;
     EngineFilterBiquad1Low* m_pLowFilter;
     EngineFilterBiquad1High* m_pHighFilter;
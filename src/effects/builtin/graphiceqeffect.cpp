@@ -79,7 +79,8 @@ EffectManifestPointer GraphicEQEffect::getManifest() {
 
 GraphicEQEffectGroupState::GraphicEQEffectGroupState(
         const mixxx::EngineParameters& bufferParameters)
-            : EffectState(bufferParameters) {
+            : EffectState(bufferParameters),
+              m_samplesPerBuffer(bufferParameters.samplesPerBuffer()) {
     m_oldLow = 0;
     for (int i = 0; i < 6; i++) {
         m_oldMid.append(1.0);
@@ -122,6 +123,12 @@ GraphicEQEffectGroupState::~GraphicEQEffectGroupState() {
     }
 }
 
+size_t GraphicEQEffectGroupState::heapMemoryUsage() const {
+    return m_pBufs.size() * m_samplesPerBuffer * sizeof(CSAMPLE)
+            + sizeof(*m_low) + sizeof(*m_high)
+            + m_bands.size() * sizeof(EngineFilterBiquad1Peaking);
+}
+
 void GraphicEQEffectGroupState::setFilters(int sampleRate) {
     m_low->setFrequencyCorners(sampleRate, m_centerFrequencies[0], Q,
                                m_oldLow);
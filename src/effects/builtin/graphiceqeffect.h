@@ -21,6 +21,8 @@ class GraphicEQEffectGroupState : public EffectState {
 
     void setFilters(int sampleRate);
 
+    size_t heapMemoryUsage() const override;
+
     EngineFilterBiquad1LowShelving* m_low;
     QList<EngineFilterBiquad1Peaking*> m_bands;
     EngineFilterBiquad1HighShelving* m_high;
@@ -29,6 +31,9 @@ class GraphicEQEffectGroupState : public EffectState {
     double m_oldLow;
     double m_oldHigh;
     float m_centerFrequencies[8];
+
+  private:
+    const SINT m_samplesPerBuffer;
 };
 
 class GraphicEQEffect : public EffectProcessorImpl<GraphicEQEffectGroupState> {
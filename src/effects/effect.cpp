@@ -6,6 +6,8 @@
 #include "effects/effectxmlelements.h"
 #include "engine/effects/engineeffectchain.h"
 #include "engine/effects/engineeffect.h"
+#include "engine/effects/message.h"
+#include "util/defs.h"
 #include "util/xml.h"
 
 Effect::Effect(EffectsManager* pEffectsManager,
@@ -40,10 +42,6 @@ Effect::~Effect() {
     }
 }
 
-EffectState* Effect::createState(const mixxx::EngineParameters& bufferParameters) {
-    return m_pEngineEffect->createState(bufferParameters);
-}
-
 void Effect::addToEngine(EngineEffectChain* pChain, int iIndex,
                          const QSet<ChannelHandleAndGroup>& activeInputChannels) {
     VERIFY_OR_DEBUG_ASSERT(pChain) {
@@ -56,8 +54,10 @@ void Effect::addToEngine(EngineEffectChain* pChain, int iIndex,
         return;
     }
 
+    // EffectStates are not preallocated for the active input channels,
+    // but only on demand when the effect gets enabled.
     m_pEngineEffect = new EngineEffect(m_pManifest,
-            activeInputChannels,
+            QSet<ChannelHandleAndGroup>(),
             m_pEffectsManager,
             m_pInstantiator);
 
@@ -69,6 +69,14 @@ void Effect::addToEngine(EngineEffectChain* pChain, int iIndex,
     m_pEffectsManager->writeRequest(request);
 
     m_bAddedToEngine = true;
+
+    m_activeInputChannels = activeInputChannels;
+    DEBUG_ASSERT(m_stateMemoryUsage.isEmpty());
+    if (m_bEnabled) {
+        for (const ChannelHandleAndGroup& handle_group : m_activeInputChannels) {
+            loadStatesForInputChannel(handle_group);
+        }
+    }
 }
 
 void Effect::removeFromEngine(EngineEffectChain* pChain, int iIndex) {
@@ -91,6 +99,85 @@ void Effect::removeFromEngine(EngineEffectChain* pChain, int iIndex) {
     m_pEngineEffect = NULL;
 
     m_bAddedToEngine = false;
+
+    // The EffectStates are deleted together with the EngineEffect
+    m_activeInputChannels.clear();
+    if (!m_stateMemoryUsage.isEmpty()) {
+        m_stateMemoryUsage.clear();
+        emit(stateMemoryUsageChanged());
+    }
+}
+
+void Effect::enableForInputChannel(const ChannelHandleAndGroup& handle_group,
+                                   EffectStatesMap* pStatesMap) {
+    m_activeInputChannels.insert(handle_group);
+    if (m_bEnabled && m_pEngineEffect) {
+        createStatesForInputChannel(handle_group, pStatesMap);
+    }
+}
+
+void Effect::disableForInputChannel(const ChannelHandleAndGroup& handle_group) {
+    m_activeInputChannels.remove(handle_group);
+    // The EffectStates are deleted by EngineEffectChain after the audio
+    // thread has processed them for the last time.
+    if (m_stateMemoryUsage.remove(handle_group) > 0) {
+        emit(stateMemoryUsageChanged());
+    }
+}
+
+void Effect::createStatesForInputChannel(const ChannelHandleAndGroup& handle_group,
+                                         EffectStatesMap* pStatesMap) {
+    //TODO: get actual configuration of engine
+    const mixxx::EngineParameters bufferParameters(
+          mixxx::AudioSignal::SampleRate(96000),
+          MAX_BUFFER_LEN / mixxx::kEngineChannelCount);
+
+    size_t memoryUsage = 0;
+    for (const auto& outputChannel : m_pEffectsManager->registeredOutputChannels()) {
+        if (kEffectDebugOutput) {
+            qDebug() << debugString() << "creating EffectState for input"
+                     << handle_group << "output" << outputChannel;
+        }
+        EffectState* pState = m_pEngineEffect->createState(bufferParameters);
+        memoryUsage += m_pEngineEffect->stateSize() + pState->heapMemoryUsage();
+        pStatesMap->insert(outputChannel.handle(), pState);
+    }
+    m_stateMemoryUsage.insert(handle_group, memoryUsage);
+    emit(stateMemoryUsageChanged());
+}
+
+void Effect::loadStatesForInputChannel(const ChannelHandleAndGroup& handle_group) {
+    // The request may be processed after handle_group has been removed from
+    // m_activeInputChannels, so the ChannelHandle must be owned by
+    // EffectsManager.
+    const QSet<ChannelHandleAndGroup>& registeredInputChannels =
+            m_pEffectsManager->registeredInputChannels();
+    const auto it = registeredInputChannels.constFind(handle_group);
+    VERIFY_OR_DEBUG_ASSERT(it != registeredInputChannels.constEnd()) {
+        return;
+    }
+
+    // Allocate EffectStates here in the main thread to avoid allocating
+    // memory in the realtime audio callback thread. The container gets
+    // deleted by ~EffectsRequest, but the EffectStates are managed by
+    // EffectProcessorImpl.
+    auto pStatesMap = new EffectStatesMap;
+    createStatesForInputChannel(handle_group, pStatesMap);
+
+    EffectsRequest* request = new EffectsRequest();
+    request->type = EffectsRequest::LOAD_EFFECT_STATES_FOR_INPUT_CHANNEL;
+    request->pTargetEffect = m_pEngineEffect;
+    request->LoadEffectStatesForInputChannel.pEffectStatesMap = pStatesMap;
+    request->LoadEffectStatesForInputChannel.pChannelHandle = &it->handle();
+    m_pEffectsManager->writeRequest(request);
+}
+
+size_t Effect::stateMemoryUsage() const {
+    size_t memoryUsage = 0;
+    for (size_t inputMemoryUsage : m_stateMemoryUsage) {
+        memoryUsage += inputMemoryUsage;
+    }
+    return memoryUsage;
 }
 
 void Effect::updateEngineState() {
@@ -114,6 +201,17 @@ EffectManifestPointer Effect::getManifest() const {
 void Effect::setEnabled(bool enabled) {
     if (enabled != m_bEnabled) {
         m_bEnabled = enabled;
+        if (m_bEnabled && m_pEngineEffect) {
+            // Allocate the EffectStates for all input channels that have
+            // been routed to the chain while the effect was disabled. The
+            // requests are processed before the engine receives the new
+            // enabled state from updateEngineState().
+            for (const ChannelHandleAndGroup& handle_group : m_activeInputChannels) {
+                if (!m_stateMemoryUsage.contains(handle_group)) {
+                    loadStatesForInputChannel(handle_group);
+                }
+            }
+        }
         updateEngineState();
         emit(enabledChanged(m_bEnabled));
     }
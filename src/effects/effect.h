@@ -3,9 +3,12 @@
 
 #include <QSharedPointer>
 #include <QDomDocument>
+#include <QHash>
+#include <QSet>
 
 #include "engine/channelhandle.h"
 #include "engine/engine.h"
+#include "effects/defs.h"
 #include "effects/effectmanifest.h"
 #include "effects/effectparameter.h"
 #include "effects/effectinstantiator.h"
@@ -31,8 +34,6 @@ class Effect : public QObject {
            EffectInstantiatorPointer pInstantiator);
     virtual ~Effect();
 
-    EffectState* createState(const mixxx::EngineParameters& bufferParameters);
-
     EffectManifestPointer getManifest() const;
 
     unsigned int numKnobParameters() const;
@@ -59,6 +60,18 @@ class Effect : public QObject {
     void removeFromEngine(EngineEffectChain* pChain, int iIndex);
     void updateEngineState();
 
+    // Called by EffectChain when an input channel is routed to or from
+    // the chain. EffectStates are only allocated into pStatesMap if the
+    // effect is enabled, otherwise they are allocated and loaded when
+    // the effect is enabled for the first time.
+    void enableForInputChannel(const ChannelHandleAndGroup& handle_group,
+                               EffectStatesMap* pStatesMap);
+    void disableForInputChannel(const ChannelHandleAndGroup& handle_group);
+
+    // The approximate number of bytes allocated for the EffectStates of
+    // all input channels.
+    size_t stateMemoryUsage() const;
+
     static EffectPointer createFromXml(EffectsManager* pEffectsManager,
                                  const QDomElement& element);
 
@@ -66,6 +79,7 @@ class Effect : public QObject {
 
   signals:
     void enabledChanged(bool enabled);
+    void stateMemoryUsageChanged();
 
   private:
     QString debugString() const {
@@ -73,6 +87,9 @@ class Effect : public QObject {
     }
 
     void sendParameterUpdate();
+    void createStatesForInputChannel(const ChannelHandleAndGroup& handle_group,
+                                     EffectStatesMap* pStatesMap);
+    void loadStatesForInputChannel(const ChannelHandleAndGroup& handle_group);
 
     EffectsManager* m_pEffectsManager;
     EffectManifestPointer m_pManifest;
@@ -82,6 +99,12 @@ class Effect : public QObject {
     bool m_bEnabled;
     QList<EffectParameter*> m_parameters;
     QMap<QString, EffectParameter*> m_parametersById;
+    // The input channels that are routed to the chain of this effect
+    QSet<ChannelHandleAndGroup> m_activeInputChannels;
+    // The memory of the EffectStates for each of the active input channels
+    // that has EffectStates. Input channels without an entry have not been
+    // processed by this effect yet.
+    QHash<ChannelHandleAndGroup, size_t> m_stateMemoryUsage;
 
     DISALLOW_COPY_AND_ASSIGN(Effect);
 };
@@ -179,30 +179,13 @@ void EffectChain::enableForInputChannel(const ChannelHandleAndGroup& handle_grou
     // EffectStates are passed to the EffectRequest and the EffectProcessorImpls
     // store the pointers. The containers of EffectState* pointers get deleted
     // by ~EffectsRequest, but the EffectStates are managed by EffectProcessorImpl.
+    // Effects that are disabled leave their EffectStatesMap empty and
+    // allocate the EffectStates when they get enabled.
     auto pEffectStatesMapArray = new EffectStatesMapArray;
-
-    //TODO: get actual configuration of engine
-    const mixxx::EngineParameters bufferParameters(
-          mixxx::AudioSignal::SampleRate(96000),
-          MAX_BUFFER_LEN / mixxx::kEngineChannelCount);
-
     for (int i = 0; i < m_effects.size(); ++i) {
-        auto& statesMap = (*pEffectStatesMapArray)[i];
         if (m_effects[i] != nullptr) {
-            for (const auto& outputChannel : m_pEffectsManager->registeredOutputChannels()) {
-                if (kEffectDebugOutput) {
-                    qDebug() << debugString() << "EffectChain::enableForInputChannel creating EffectState for input" << handle_group << "output" << outputChannel;
-                }
-                statesMap.insert(outputChannel.handle(),
-                        m_effects[i]->createState(bufferParameters));
-            }
-        } else {
-            for (EffectState* pState : statesMap) {
-                if (pState != nullptr) {
-                    delete pState;
-                }
-            }
-            statesMap.clear();
+            m_effects[i]->enableForInputChannel(handle_group,
+                    &(*pEffectStatesMapArray)[i]);
         }
     }
     request->EnableInputChannelForChain.pEffectStatesMapArray = pEffectStatesMapArray;
@@ -220,6 +203,11 @@ void EffectChain::disableForInputChannel(const ChannelHandleAndGroup& handle_gro
         if (!m_bAddedToEngine) {
             return;
         }
+        for (const auto& pEffect : m_effects) {
+            if (pEffect != nullptr) {
+                pEffect->disableForInputChannel(handle_group);
+            }
+        }
         EffectsRequest* request = new EffectsRequest();
         request->type = EffectsRequest::DISABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL;
         request->pTargetChain = m_pEngineEffectChain;
@@ -264,6 +252,8 @@ void EffectChain::addEffect(EffectPointer pEffect) {
     }
 
     m_effects.append(pEffect);
+    connect(pEffect.data(), SIGNAL(stateMemoryUsageChanged()),
+            this, SIGNAL(stateMemoryUsageChanged()));
     if (m_bAddedToEngine) {
         pEffect->addToEngine(m_pEngineEffectChain, m_effects.size() - 1, m_enabledInputChannels);
     }
@@ -285,10 +275,13 @@ void EffectChain::replaceEffect(unsigned int effectSlotNumber,
         if (m_bAddedToEngine) {
             pOldEffect->removeFromEngine(m_pEngineEffectChain, effectSlotNumber);
         }
+        pOldEffect->disconnect(this);
     }
 
     m_effects.replace(effectSlotNumber, pEffect);
     if (!pEffect.isNull()) {
+        connect(pEffect.data(), SIGNAL(stateMemoryUsageChanged()),
+                this, SIGNAL(stateMemoryUsageChanged()));
         if (m_bAddedToEngine) {
             pEffect->addToEngine(m_pEngineEffectChain, effectSlotNumber, m_enabledInputChannels);
         }
@@ -307,6 +300,16 @@ void EffectChain::refreshAllEffects() {
     }
 }
 
+size_t EffectChain::stateMemoryUsage() const {
+    size_t memoryUsage = 0;
+    for (const auto& pEffect : m_effects) {
+        if (pEffect != nullptr) {
+            memoryUsage += pEffect->stateMemoryUsage();
+        }
+    }
+    return memoryUsage;
+}
+
 unsigned int EffectChain::numEffects() const {
     return m_effects.size();
 }
@@ -88,6 +88,10 @@ class EffectChain : public QObject {
     const QList<EffectPointer>& effects() const;
     unsigned int numEffects() const;
 
+    // The approximate number of bytes allocated for the EffectStates of
+    // all effects in the chain
+    size_t stateMemoryUsage() const;
+
     EngineEffectChain* getEngineEffectChain();
 
     static EffectChainPointer createFromXml(EffectsManager* pEffectsManager,
@@ -103,6 +107,7 @@ class EffectChain : public QObject {
     void mixChanged(double v);
     void mixModeChanged(EffectChainMixMode type);
     void channelStatusChanged(const QString& group, bool enabled);
+    void stateMemoryUsageChanged();
 
   private:
     QString debugString() const {
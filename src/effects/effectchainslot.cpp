@@ -30,6 +30,9 @@ EffectChainSlot::EffectChainSlot(EffectRack* pRack, const QString& group,
     m_pControlChainLoaded = new ControlObject(ConfigKey(m_group, "loaded"));
     m_pControlChainLoaded->setReadOnly();
 
+    m_pControlChainStateMemory = new ControlObject(ConfigKey(m_group, "state_memory"));
+    m_pControlChainStateMemory->setReadOnly();
+
     m_pControlChainEnabled = new ControlPushButton(ConfigKey(m_group, "enabled"));
     m_pControlChainEnabled->setButtonMode(ControlPushButton::POWERWINDOW);
     // Default to enabled. The skin might not show these buttons.
@@ -95,6 +98,7 @@ EffectChainSlot::~EffectChainSlot() {
     delete m_pControlNumEffects;
     delete m_pControlNumEffectSlots;
     delete m_pControlChainLoaded;
+    delete m_pControlChainStateMemory;
     delete m_pControlChainEnabled;
     delete m_pControlChainMix;
     delete m_pControlChainSuperParameter;
@@ -163,6 +167,13 @@ void EffectChainSlot::slotChainChannelStatusChanged(const QString& group,
     }
 }
 
+void EffectChainSlot::slotChainStateMemoryUsageChanged() {
+    if (m_pEffectChain) {
+        m_pControlChainStateMemory->forceSet(
+                static_cast<double>(m_pEffectChain->stateMemoryUsage()));
+    }
+}
+
 void EffectChainSlot::slotChainEffectChanged(unsigned int effectSlotNumber,
                                              bool shouldEmit) {
     //qDebug() << debugString() << "slotChainEffectChanged" << effectSlotNumber;
@@ -214,8 +225,11 @@ void EffectChainSlot::loadEffectChainToSlot(EffectChainPointer pEffectChain) {
                 this, SLOT(slotChainMixModeChanged(EffectChainMixMode)));
         connect(m_pEffectChain.data(), SIGNAL(channelStatusChanged(const QString&, bool)),
                 this, SLOT(slotChainChannelStatusChanged(const QString&, bool)));
+        connect(m_pEffectChain.data(), SIGNAL(stateMemoryUsageChanged()),
+                this, SLOT(slotChainStateMemoryUsageChanged()));
 
         m_pControlChainLoaded->forceSet(true);
+        slotChainStateMemoryUsageChanged();
         m_pControlChainMixMode->set(
                 static_cast<double>(m_pEffectChain->mixMode()));
 
@@ -279,6 +293,7 @@ void EffectChainSlot::clear() {
     }
     m_pControlNumEffects->forceSet(0.0);
     m_pControlChainLoaded->forceSet(0.0);
+    m_pControlChainStateMemory->forceSet(0.0);
     m_pControlChainMixMode->set(
             static_cast<double>(EffectChainMixMode::DrySlashWet));
     emit(updated());
@@ -101,6 +101,7 @@ class EffectChainSlot : public QObject {
     void slotChainMixChanged(double mix);
     void slotChainMixModeChanged(EffectChainMixMode mixMode);
     void slotChainChannelStatusChanged(const QString& group, bool enabled);
+    void slotChainStateMemoryUsageChanged();
 
     void slotEffectLoaded(EffectPointer pEffect, unsigned int slotNumber);
     // Clears the effect in the given position in the loaded EffectChain.
@@ -131,6 +132,8 @@ class EffectChainSlot : public QObject {
     ControlObject* m_pControlNumEffects;
     ControlObject* m_pControlNumEffectSlots;
     ControlObject* m_pControlChainLoaded;
+    // Memory of the EffectStates of the loaded chain in bytes
+    ControlObject* m_pControlChainStateMemory;
     ControlPushButton* m_pControlChainEnabled;
     ControlObject* m_pControlChainMix;
     ControlObject* m_pControlChainSuperParameter;
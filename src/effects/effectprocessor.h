@@ -14,6 +14,8 @@
 #include "engine/effects/message.h"
 #include "engine/channelhandle.h"
 #include "effects/effectsmanager.h"
+#include "effects/effectstatepool.h"
+#include "util/sample.h"
 
 class EngineEffect;
 
@@ -33,10 +35,13 @@ class EngineEffect;
 
 // Input signals can be any EngineChannel, but output channels are hardcoded in
 // EngineMaster as the post-fader processing for the master mix and pre-fader
-// processing for headphones. EffectStates are allocated when an input signal is
-// enabled for a chain. Also, when a new effect is loaded to a chain,
-// EffectStates are only allocated for input signals that are enabled at that
-// time. This allows for scaling up to an arbitrary number of input signals
+// processing for headphones. EffectStates are only allocated for input signals
+// that are enabled for the chain of an effect and only after the effect has
+// been enabled for the first time. Until then the EffectStates for an input
+// signal are null. The EffectStates are released into the EffectStatePool of
+// the manifest when the input signal is disabled for the chain and deleted
+// when the effect is unloaded. This allows for scaling up
+// to an arbitrary number of input signals and loaded but unused effects
 // without wasting a lot of memory.
 class EffectState {
   public:
@@ -45,6 +50,13 @@ class EffectState {
         Q_UNUSED(bufferParameters);
     };
     virtual ~EffectState() {};
+
+    // The number of bytes that have been allocated by this state in
+    // addition to the object itself, e.g. for delay lines. This is
+    // only used for reporting the memory usage of effect units.
+    virtual size_t heapMemoryUsage() const {
+        return 0;
+    }
 };
 
 // EffectProcessor is an abstract base class for interfacing with the main
@@ -60,11 +72,19 @@ class EffectProcessor {
             EffectsManager* pEffectsManager,
             const mixxx::EngineParameters& bufferParameters) = 0;
     virtual EffectState* createState(const mixxx::EngineParameters& bufferParameters) = 0;
+    // The size of the EffectState objects returned by createState()
+    virtual size_t stateSize() const = 0;
+    // An empty pStatesMap unloads the EffectStates for the input channel
+    // without deleting them. This is used for effects that have not been
+    // enabled yet and do not need any EffectStates.
     virtual bool loadStatesForInputChannel(const ChannelHandle* inputChannel,
           const EffectStatesMap* pStatesMap) = 0;
     // Called from main thread for garbage collection after the last audio thread
-    // callback executes process() with EffectEnableState::Disabling
-    virtual void deleteStatesForInputChannel(const ChannelHandle* inputChannel) = 0;
+    // callback executes process() with EffectEnableState::Disabling. The
+    // EffectStates are released into pStatePool for reuse by other effects
+    // with the same manifest if they do not depend on this processor.
+    virtual void deleteStatesForInputChannel(const ChannelHandle* inputChannel,
+            EffectStatePool* pStatePool) = 0;
 
     // Take a buffer of audio samples as pInput, process the buffer according to
     // Effect-specific logic, and output it to the buffer pOutput. Both pInput
@@ -82,6 +102,13 @@ class EffectProcessor {
                          const mixxx::EngineParameters& bufferParameters,
                          const EffectEnableState enableState,
                          const GroupFeatureState& groupFeatures) = 0;
+
+    // Whether process() may be called concurrently for different input
+    // channels. This is true if all data that is modified while processing
+    // is stored in the EffectStates.
+    virtual bool supportsConcurrentProcessing() const {
+        return true;
+    }
 };
 
 // EffectProcessorImpl manages a separate EffectState for every routing of
@@ -104,7 +131,10 @@ class EffectProcessorImpl : public EffectProcessor {
         for (ChannelHandleMap<EffectSpecificState*>& outputsMap : m_channelStateMatrix) {
             int outputChannelHandleNumber = 0;
             for (EffectSpecificState* pState : outputsMap) {
-                VERIFY_OR_DEBUG_ASSERT(pState != nullptr) {
+                if (pState == nullptr) {
+                    // Not allocated, because the effect has never been
+                    // enabled for this input channel
+                    outputChannelHandleNumber++;
                     continue;
                 }
                 if (kEffectDebugOutput) {
@@ -142,7 +172,16 @@ class EffectProcessorImpl : public EffectProcessor {
                          const mixxx::EngineParameters& bufferParameters,
                          const EffectEnableState enableState,
                          const GroupFeatureState& groupFeatures) final {
-        EffectSpecificState* pState = m_channelStateMatrix[inputHandle][outputHandle];
+        // Different input channels may be processed concurrently, so the
+        // matrix must neither be expanded nor modified here.
+        EffectSpecificState* pState = nullptr;
+        const auto pOutputsMap = m_channelStateMatrix.find(inputHandle);
+        if (pOutputsMap) {
+            const auto ppState = pOutputsMap->find(outputHandle);
+            if (ppState) {
+                pState = *ppState;
+            }
+        }
         VERIFY_OR_DEBUG_ASSERT(pState != nullptr) {
             if (kEffectDebugOutput) {
                 qWarning() << "EffectProcessorImpl::process could not retrieve"
@@ -151,8 +190,10 @@ class EffectProcessorImpl : public EffectProcessor {
                            << "EffectState should have been preallocated in the"
                               "main thread.";
             }
-            pState = createSpecificState(bufferParameters);
-            m_channelStateMatrix[inputHandle][outputHandle] = pState;
+            if (pOutput != pInput) {
+                SampleUtil::copy(pOutput, pInput, bufferParameters.samplesPerBuffer());
+            }
+            return;
         }
         processChannel(inputHandle, pState, pInput, pOutput, bufferParameters,
                        enableState, groupFeatures);
@@ -186,6 +227,10 @@ class EffectProcessorImpl : public EffectProcessor {
         return createSpecificState(bufferParameters);
     };
 
+    size_t stateSize() const final {
+        return sizeof(EffectSpecificState);
+    }
+
     bool loadStatesForInputChannel(const ChannelHandle* inputChannel,
               const EffectStatesMap* pStatesMap) final {
           if (kEffectDebugOutput) {
@@ -224,6 +269,12 @@ class EffectProcessorImpl : public EffectProcessor {
                            << this << "output" << outputChannel;
               }
 
+              if (pStatesMap->isEmpty()) {
+                  // The effect has not been enabled yet, the EffectStates
+                  // will be loaded later on demand.
+                  effectSpecificStatesMap.insert(outputChannel.handle(), nullptr);
+                  continue;
+              }
               auto pState = dynamic_cast<EffectSpecificState*>(
                         pStatesMap->at(outputChannel.handle()));
               VERIFY_OR_DEBUG_ASSERT(pState != nullptr) {
@@ -235,7 +286,8 @@ class EffectProcessorImpl : public EffectProcessor {
     };
 
     // Called from main thread for garbage collection after an input channel is disabled
-    void deleteStatesForInputChannel(const ChannelHandle* inputChannel) final {
+    void deleteStatesForInputChannel(const ChannelHandle* inputChannel,
+            EffectStatePool* pStatePool) final {
           if (kEffectDebugOutput) {
               qDebug() << "EffectProcessorImpl::deleteStatesForInputChannel"
                        << this << *inputChannel;
@@ -250,14 +302,15 @@ class EffectProcessorImpl : public EffectProcessor {
           ChannelHandleMap<EffectSpecificState*>& stateMap =
                   m_channelStateMatrix[*inputChannel];
           for (EffectSpecificState* pState : stateMap) {
-                VERIFY_OR_DEBUG_ASSERT(pState != nullptr) {
+                if (pState == nullptr) {
+                      // The effect has never been enabled for this input
                       continue;
                 }
                 if (kEffectDebugOutput) {
                       qDebug() << "EffectProcessorImpl::deleteStatesForInputChannel"
-                               << this << "deleting state" << pState;
+                               << this << "releasing state" << pState;
                 }
-                delete pState;
+                pStatePool->release(pState);
           }
           stateMap.clear();
     };
@@ -9,6 +9,7 @@
 #include "effects/effectchainmanager.h"
 #include "effects/effectsbackend.h"
 #include "effects/effectslot.h"
+#include "effects/effectstatepool.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectrack.h"
 #include "engine/effects/engineeffectchain.h"
@@ -18,6 +19,9 @@ namespace {
 const QString kEffectGroupSeparator = "_";
 const QString kGroupClose = "]";
 const unsigned int kEffectMessagPipeFifoSize = 2048;
+// Enough for the EffectStates of a few input channels with a state for
+// each output channel
+const int kEffectStatePoolCapacity = 16;
 } // anonymous namespace
 
 
@@ -49,6 +53,10 @@ EffectsManager::~EffectsManager() {
     // This must be done here, since the engineRacks are deleted via
     // the queue
     processEffectsResponses();
+    // The EffectStates of external plugins must be deleted before their
+    // backend
+    qDeleteAll(m_effectStatePools);
+    m_effectStatePools.clear();
     while (!m_effectsBackends.isEmpty()) {
         EffectsBackend* pBackend = m_effectsBackends.takeLast();
         delete pBackend;
@@ -123,6 +131,14 @@ const QSet<ChannelHandleAndGroup>& EffectsManager::registeredOutputChannels() co
     return m_pEffectChainManager->registeredOutputChannels();
 }
 
+EffectStatePool* EffectsManager::getEffectStatePool(const QString& effectId) {
+    EffectStatePool*& pPool = m_effectStatePools[effectId];
+    if (!pPool) {
+        pPool = new EffectStatePool(kEffectStatePoolCapacity);
+    }
+    return pPool;
+}
+
 const QList<EffectManifestPointer> EffectsManager::getAvailableEffectManifestsFiltered(
         EffectManifestFilterFnc filter) const {
     if (filter == nullptr) {
@@ -20,6 +20,7 @@ class EngineEffectsManager;
 class EffectChainManager;
 class EffectManifest;
 class EffectsBackend;
+class EffectStatePool;
 
 class EffectsManager : public QObject {
     Q_OBJECT
@@ -51,6 +52,11 @@ class EffectsManager : public QObject {
     const QSet<ChannelHandleAndGroup>& registeredInputChannels() const;
     const QSet<ChannelHandleAndGroup>& registeredOutputChannels() const;
 
+    // Returns the pool of released EffectStates that is shared by all
+    // effects of the manifest. Not thread safe -- use only from the GUI
+    // thread.
+    EffectStatePool* getEffectStatePool(const QString& effectId);
+
     StandardEffectRackPointer addStandardEffectRack();
     StandardEffectRackPointer getStandardEffectRack(int rack);
 
@@ -133,6 +139,8 @@ class EffectsManager : public QObject {
     qint64 m_nextRequestId;
     QHash<qint64, EffectsRequest*> m_activeRequests;
 
+    QHash<QString, EffectStatePool*> m_effectStatePools;
+
     ControlObject* m_pNumEffectsAvailable;
     // We need to create Control Objects for Equalizers' frequencies
     ControlPotmeter* m_pLoEqFreq;
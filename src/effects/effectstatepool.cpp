@@ -0,0 +1,34 @@
+#include "effects/effectstatepool.h"
+
+#include "effects/effectprocessor.h"
+
+EffectStatePool::EffectStatePool(int capacity)
+        : m_capacity(capacity) {
+    m_states.reserve(capacity);
+}
+
+EffectStatePool::~EffectStatePool() {
+    for (EffectState* pState : m_states) {
+        delete pState;
+    }
+}
+
+EffectState* EffectStatePool::acquire() {
+    if (m_states.empty()) {
+        return nullptr;
+    }
+    EffectState* pState = m_states.back();
+    m_states.pop_back();
+    return pState;
+}
+
+void EffectStatePool::release(EffectState* pState) {
+    if (pState == nullptr) {
+        return;
+    }
+    if (size() >= m_capacity) {
+        delete pState;
+        return;
+    }
+    m_states.push_back(pState);
+}
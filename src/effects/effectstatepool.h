@@ -0,0 +1,44 @@
+#ifndef EFFECTSTATEPOOL_H
+#define EFFECTSTATEPOOL_H
+
+#include <vector>
+
+#include "util/class.h"
+
+class EffectState;
+
+// Keeps the EffectStates of input channels that have been disabled for a
+// chain, so that routing an input channel to an effect of the same manifest
+// again reuses their delay lines and filter buffers instead of allocating
+// new ones. The slots are allocated in advance, so releasing a state never
+// allocates. Only accessed from the main thread.
+//
+// Released states must have been processed with
+// EffectEnableState::Disabling for the last time, which resets the state
+// of the effects that depend on their history.
+class EffectStatePool {
+  public:
+    explicit EffectStatePool(int capacity);
+    ~EffectStatePool();
+
+    // Returns a released state or nullptr if the pool is empty. The caller
+    // takes ownership.
+    EffectState* acquire();
+    // Takes ownership of the state and deletes it if the pool is full
+    void release(EffectState* pState);
+
+    int size() const {
+        return static_cast<int>(m_states.size());
+    }
+    int capacity() const {
+        return m_capacity;
+    }
+
+  private:
+    const int m_capacity;
+    std::vector<EffectState*> m_states;
+
+    DISALLOW_COPY_AND_ASSIGN(EffectStatePool);
+};
+
+#endif /* EFFECTSTATEPOOL_H */
@@ -1,14 +1,26 @@
 #include "effects/lv2/lv2backend.h"
 #include "effects/lv2/lv2manifest.h"
+#include "util/assert.h"
 
 LV2Backend::LV2Backend(QObject* pParent)
-        : EffectsBackend(pParent, EffectBackendType::LV2) {
-    m_pWorld = lilv_world_new();
+        : LV2Backend(pParent, loadWorld()) {
+}
+
+LV2Backend::LV2Backend(QObject* pParent, LilvWorld* pWorld)
+        : EffectsBackend(pParent, EffectBackendType::LV2),
+          m_pWorld(pWorld) {
+    DEBUG_ASSERT(m_pWorld);
     initializeProperties();
-    lilv_world_load_all(m_pWorld);
     enumeratePlugins();
 }
 
+// static
+LilvWorld* LV2Backend::loadWorld() {
+    LilvWorld* pWorld = lilv_world_new();
+    lilv_world_load_all(pWorld);
+    return pWorld;
+}
+
 LV2Backend::~LV2Backend() {
     foreach(LilvNode* node, m_properties) {
         lilv_node_free(node);
@@ -11,8 +11,16 @@ class LV2Backend : public EffectsBackend {
     Q_OBJECT
   public:
     LV2Backend(QObject* pParent);
+    // Takes ownership of a world that has already been loaded by
+    // loadWorld(), e.g. concurrently on a worker thread during startup.
+    LV2Backend(QObject* pParent, LilvWorld* pWorld);
     virtual ~LV2Backend();
 
+    // Creates a new world and loads all installed LV2 bundles. This is the
+    // expensive part of plugin discovery. It does not touch any Qt objects
+    // and can safely be executed on any thread.
+    static LilvWorld* loadWorld();
+
     void enumeratePlugins();
     const QList<QString> getEffectIds() const;
     const QSet<QString> getDiscoveredPluginIds() const;
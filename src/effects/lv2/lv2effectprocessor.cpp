@@ -36,7 +36,9 @@ LV2EffectProcessor::~LV2EffectProcessor() {
     for (auto& outputsMap : m_channelStateMatrix) {
         int outputChannelHandleNumber = 0;
         for (LV2EffectGroupState* pState : outputsMap) {
-              VERIFY_OR_DEBUG_ASSERT(pState != nullptr) {
+              if (pState == nullptr) {
+                    // The effect has never been enabled for this input
+                    outputChannelHandleNumber++;
                     continue;
               }
               if (kEffectDebugOutput) {
@@ -165,6 +167,10 @@ EffectState* LV2EffectProcessor::createState(const mixxx::EngineParameters& buff
     return createGroupState(bufferParameters);
 };
 
+size_t LV2EffectProcessor::stateSize() const {
+    return sizeof(LV2EffectGroupState);
+}
+
 bool LV2EffectProcessor::loadStatesForInputChannel(const ChannelHandle* inputChannel,
       const EffectStatesMap* pStatesMap) {
     if (kEffectDebugOutput) {
@@ -204,6 +210,12 @@ bool LV2EffectProcessor::loadStatesForInputChannel(const ChannelHandle* inputCha
                      << this << "output" << outputChannel;
         }
 
+        if (pStatesMap->isEmpty()) {
+            // The effect has not been enabled yet, the EffectStates
+            // will be loaded later on demand.
+            effectSpecificStatesMap.insert(outputChannel.handle(), nullptr);
+            continue;
+        }
         auto pState = dynamic_cast<LV2EffectGroupState*>(
                   pStatesMap->at(outputChannel.handle()));
         VERIFY_OR_DEBUG_ASSERT(pState != nullptr) {
@@ -216,7 +228,9 @@ bool LV2EffectProcessor::loadStatesForInputChannel(const ChannelHandle* inputCha
 
 // Called from main thread for garbage collection after the last audio thread
 // callback executes process() with EffectEnableState::Disabling
-void LV2EffectProcessor::deleteStatesForInputChannel(const ChannelHandle* inputChannel) {
+void LV2EffectProcessor::deleteStatesForInputChannel(const ChannelHandle* inputChannel,
+        EffectStatePool* pStatePool) {
+    Q_UNUSED(pStatePool);
     if (kEffectDebugOutput) {
         qDebug() << "LV2EffectProcessor::deleteStatesForInputChannel"
                  << this << *inputChannel;
@@ -231,7 +245,8 @@ void LV2EffectProcessor::deleteStatesForInputChannel(const ChannelHandle* inputC
     ChannelHandleMap<LV2EffectGroupState*>& stateMap =
             m_channelStateMatrix[*inputChannel];
     for (LV2EffectGroupState* pState : stateMap) {
-          VERIFY_OR_DEBUG_ASSERT(pState != nullptr) {
+          if (pState == nullptr) {
+                // The effect has never been enabled for this input
                 continue;
           }
           if (kEffectDebugOutput) {
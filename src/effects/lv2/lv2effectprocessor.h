@@ -40,11 +40,15 @@ class LV2EffectProcessor : public EffectProcessor {
             EffectsManager* pEffectsManager,
             const mixxx::EngineParameters& bufferParameters) override;
     EffectState* createState(const mixxx::EngineParameters& bufferParameters) final;
+    size_t stateSize() const final;
     bool loadStatesForInputChannel(const ChannelHandle* inputChannel,
           const EffectStatesMap* pStatesMap) override;
     // Called from main thread for garbage collection after the last audio thread
     // callback executes process() with EffectEnableState::Disabling
-    void deleteStatesForInputChannel(const ChannelHandle* inputChannel) override;
+    // The LilvInstances of the states are connected to the ports of this
+    // processor and are not released into pStatePool.
+    void deleteStatesForInputChannel(const ChannelHandle* inputChannel,
+            EffectStatePool* pStatePool) override;
 
     void process(const ChannelHandle& inputHandle,
             const ChannelHandle& outputHandle,
@@ -52,6 +56,10 @@ class LV2EffectProcessor : public EffectProcessor {
             const mixxx::EngineParameters& bufferParameters,
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatures) override;
+    // The port buffers are shared by all LilvInstances
+    bool supportsConcurrentProcessing() const override {
+        return false;
+    }
   private:
     LV2EffectGroupState* createGroupState(const mixxx::EngineParameters& bufferParameters);
 
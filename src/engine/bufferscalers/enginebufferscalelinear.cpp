@@ -2,14 +2,93 @@
 
 #include <QtDebug>
 
+#include <algorithm>
+
 #include "track/keyutils.h"
 #include "util/assert.h"
 #include "util/math.h"
 #include "util/sample.h"
 
+namespace {
+
+// The number of stereo frames of the previously read buffers that are kept
+// in front of m_bufferInt. After reading a new buffer the current position
+// may be up to the lookahead of the kernel in front of the new buffer, so
+// the history must cover both the lookbehind and the lookahead.
+constexpr SINT kHistoryFrames = 16;
+constexpr SINT kHistorySamples = kHistoryFrames * 2;
+
+// Sampling the sinc at 256 positions between two frames and interpolating
+// linearly in between keeps the interpolation error below the noise floor
+// of the 16 taps.
+constexpr int kSincTaps = 16;
+constexpr int kSincPhases = 256;
+// Slightly below Nyquist to leave room for the transition band
+constexpr double kSincCutoff = 0.95;
+
+class SincTable {
+  public:
+    SincTable() {
+        for (int phase = 0; phase <= kSincPhases; ++phase) {
+            const double frac = static_cast<double>(phase) / kSincPhases;
+            double coefficients[kSincTaps];
+            double sum = 0.0;
+            for (int tap = 0; tap < kSincTaps; ++tap) {
+                // Distance of the tap from the interpolated position
+                const double x = tap - (kSincTaps / 2 - 1) - frac;
+                coefficients[tap] = sinc(kSincCutoff * x) *
+                        blackmanHarris(x / (kSincTaps / 2));
+                sum += coefficients[tap];
+            }
+            for (int tap = 0; tap < kSincTaps; ++tap) {
+                // Normalize to unity gain at DC. Each coefficient is stored
+                // twice for multiplying the interleaved stereo frames
+                // without shuffling.
+                const CSAMPLE coefficient =
+                        static_cast<CSAMPLE>(coefficients[tap] / sum);
+                m_coefficients[phase][tap * 2] = coefficient;
+                m_coefficients[phase][tap * 2 + 1] = coefficient;
+            }
+        }
+    }
+
+    const CSAMPLE* phase(int phase) const {
+        return m_coefficients[phase];
+    }
+
+  private:
+    static double sinc(double x) {
+        if (x == 0.0) {
+            return 1.0;
+        }
+        return sin(M_PI * x) / (M_PI * x);
+    }
+
+    // 4-term Blackman-Harris window for t in [-1, 1]
+    static double blackmanHarris(double t) {
+        return 0.35875 +
+                0.48829 * cos(M_PI * t) +
+                0.14128 * cos(2 * M_PI * t) +
+                0.01168 * cos(3 * M_PI * t);
+    }
+
+    // One extra phase for interpolating behind the last phase
+    CSAMPLE m_coefficients[kSincPhases + 1][kSincTaps * 2];
+};
+
+const SincTable& sincTable() {
+    static const SincTable s_table;
+    return s_table;
+}
+
+} // anonymous namespace
+
 EngineBufferScaleLinear::EngineBufferScaleLinear(ReadAheadManager *pReadAheadManager)
     : m_pReadAheadManager(pReadAheadManager),
-      m_bufferInt(SampleUtil::alloc(kiLinearScaleReadAheadLength)),
+      m_interpolation(Interpolation::Linear),
+      m_bufferIntStorage(SampleUtil::alloc(
+              kHistorySamples + kiLinearScaleReadAheadLength)),
+      m_bufferInt(m_bufferIntStorage + kHistorySamples),
       m_bufferIntSize(0),
       m_bClear(false),
       m_dRate(1.0),
@@ -18,11 +97,14 @@ EngineBufferScaleLinear::EngineBufferScaleLinear(ReadAheadManager *pReadAheadMan
       m_dNextFrame(0.0) {
     m_floorSampleOld[0] = 0.0;
     m_floorSampleOld[1] = 0.0;
-    SampleUtil::clear(m_bufferInt, kiLinearScaleReadAheadLength);
+    SampleUtil::clear(m_bufferIntStorage,
+            kHistorySamples + kiLinearScaleReadAheadLength);
+    // Build the table now instead of on the first use in the engine thread
+    sincTable();
 }
 
 EngineBufferScaleLinear::~EngineBufferScaleLinear() {
-    SampleUtil::free(m_bufferInt);
+    SampleUtil::free(m_bufferIntStorage);
 }
 
 void EngineBufferScaleLinear::setScaleParameters(double base_rate,
@@ -41,6 +123,20 @@ void EngineBufferScaleLinear::clear() {
     m_dNextFrame = 0;
     m_floorSampleOld[0] = 0;
     m_floorSampleOld[1] = 0;
+    SampleUtil::clear(m_bufferIntStorage, kHistorySamples);
+}
+
+void EngineBufferScaleLinear::saveHistory(const CSAMPLE* pSamples, SINT numSamples) {
+    CSAMPLE* pHistory = m_bufferInt - kHistorySamples;
+    if (numSamples >= kHistorySamples) {
+        SampleUtil::copy(pHistory, pSamples + numSamples - kHistorySamples,
+                kHistorySamples);
+    } else if (numSamples > 0) {
+        // Keep the most recent frames of the history
+        std::copy(pHistory + numSamples, pHistory + kHistorySamples, pHistory);
+        SampleUtil::copy(pHistory + kHistorySamples - numSamples,
+                pSamples, numSamples);
+    }
 }
 
 // laurent de soras - punked from musicdsp.org (mad props)
@@ -54,6 +150,60 @@ inline float hermite4(float frac_pos, float xm1, float x0, float x1, float x2)
     return ((((a * frac_pos) - b_neg) * frac_pos + c) * frac_pos + x0);
 }
 
+namespace {
+
+// The kernels interpolate a stereo frame at the fractional position frac
+// after the frame pFrames[kLookbehind * 2]. All frames from
+// pFrames[0] to pFrames[(kLookbehind + kLookahead) * 2 + 1] are valid.
+struct CubicKernel {
+    static constexpr SINT kLookbehind = 1;
+    static constexpr SINT kLookahead = 2;
+
+    static void interpolate(const CSAMPLE* pFrames, CSAMPLE frac, CSAMPLE* pOutput) {
+        pOutput[0] = hermite4(frac, pFrames[0], pFrames[2], pFrames[4], pFrames[6]);
+        pOutput[1] = hermite4(frac, pFrames[1], pFrames[3], pFrames[5], pFrames[7]);
+    }
+};
+
+struct SincKernel {
+    static constexpr SINT kLookbehind = kSincTaps / 2 - 1;
+    static constexpr SINT kLookahead = kSincTaps / 2;
+
+    static void interpolate(const CSAMPLE* pFrames, CSAMPLE frac, CSAMPLE* pOutput) {
+        const SincTable& table = sincTable();
+        const CSAMPLE position = frac * kSincPhases;
+        // frac may be rounded up to 1.0f
+        const int phase = math_min(static_cast<int>(position), kSincPhases - 1);
+        const CSAMPLE phaseFrac = position - phase;
+        const CSAMPLE* pCoefficients1 = table.phase(phase);
+        const CSAMPLE* pCoefficients2 = table.phase(phase + 1);
+
+        // note: LOOP VECTORIZED.
+        CSAMPLE products[kSincTaps * 2];
+        for (int i = 0; i < kSincTaps * 2; ++i) {
+            const CSAMPLE coefficient = pCoefficients1[i] +
+                    phaseFrac * (pCoefficients2[i] - pCoefficients1[i]);
+            products[i] = pFrames[i] * coefficient;
+        }
+        // Sum up the halves until a single frame is left. The offsets are
+        // even, so left and right samples stay separated.
+        for (int offset = kSincTaps; offset >= 2; offset /= 2) {
+            for (int i = 0; i < offset; ++i) {
+                products[i] += products[i + offset];
+            }
+        }
+        pOutput[0] = products[0];
+        pOutput[1] = products[1];
+    }
+};
+
+static_assert(CubicKernel::kLookbehind + CubicKernel::kLookahead <= kHistoryFrames,
+        "History too short for the cubic kernel");
+static_assert(SincKernel::kLookbehind + SincKernel::kLookahead <= kHistoryFrames,
+        "History too short for the sinc kernel");
+
+} // anonymous namespace
+
 // Determine if we're changing directions (scratching) and then perform
 // a stretch
 double EngineBufferScaleLinear::scaleBuffer(
@@ -88,6 +238,25 @@ double EngineBufferScaleLinear::scaleBuffer(
             m_floorSampleOld[0] = m_bufferInt[iNextSample];
             m_floorSampleOld[1] = m_bufferInt[iNextSample + 1];
         }
+        // Likewise the history for the other direction are the frames
+        // ahead of the position in reverse order.
+        CSAMPLE history[kHistorySamples];
+        for (SINT frame = 0; frame < kHistoryFrames; ++frame) {
+            const SINT iSample = iNextSample + getAudioSignal().frames2samples(frame);
+            CSAMPLE* pDest = &history[kHistorySamples - 2 * (frame + 1)];
+            const CSAMPLE* pSource;
+            if (iSample >= -kHistorySamples && iSample + 1 < m_bufferIntSize) {
+                pSource = &m_bufferInt[iSample];
+            } else if (frame == 0) {
+                pSource = m_floorSampleOld;
+            } else {
+                // Repeat the last available frame
+                pSource = pDest + 2;
+            }
+            pDest[0] = pSource[0];
+            pDest[1] = pSource[1];
+        }
+        SampleUtil::copy(m_bufferInt - kHistorySamples, history, kHistorySamples);
 
         // if the buffer has extra samples, do a read so RAMAN ends up back where
         // it should be
@@ -172,6 +341,7 @@ SINT EngineBufferScaleLinear::do_copy(CSAMPLE* buf, SINT buf_size) {
         m_floorSampleOld[0] = buf[read_samples - 2];
         m_floorSampleOld[1] = buf[read_samples - 1];
     }
+    saveHistory(buf, read_samples);
     return read_samples;
 }
 
@@ -236,6 +406,17 @@ SINT EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
     const double rate_delta_abs =
             rate_old < 0 || rate_new < 0 ? -rate_delta : rate_delta;
 
+    switch (m_interpolation) {
+    case Interpolation::Cubic:
+        return do_scale_kernel<CubicKernel>(buf, buf_size,
+                rate_old, rate_new, unscaled_frames_needed, rate_delta_abs);
+    case Interpolation::Sinc:
+        return do_scale_kernel<SincKernel>(buf, buf_size,
+                rate_old, rate_new, unscaled_frames_needed, rate_delta_abs);
+    case Interpolation::Linear:
+        break;
+    }
+
     // Hot frame loop
     while (i < buf_size) {
         // shift indices
@@ -285,6 +466,7 @@ SINT EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
                         kiLinearScaleReadAheadLength,
                         getAudioSignal().frames2samples(unscaled_frames_needed));
 
+                saveHistory(m_bufferInt, m_bufferIntSize);
                 m_bufferIntSize = m_pReadAheadManager->getNextSamples(
                         rate_new == 0 ? rate_old : rate_new,
                         m_bufferInt, samples_to_read);
@@ -346,3 +528,84 @@ SINT EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
 
     return frames_read;
 }
+
+template<typename Kernel>
+SINT EngineBufferScaleLinear::do_scale_kernel(CSAMPLE* buf, SINT buf_size,
+        float rate_old, float rate_new,
+        SINT unscaled_frames_needed, double rate_delta_abs) {
+    int read_failed_count = 0;
+    SINT frames_read = 0;
+    SINT i = 0;
+    double rate_add = fabs(rate_old);
+
+    // Hot frame loop
+    while (i < buf_size) {
+        m_dCurrentFrame = m_dNextFrame;
+        SINT currentFrameFloor = static_cast<SINT>(floor(m_dCurrentFrame));
+
+        // The frames behind the floor are taken from the history if they
+        // are not in the buffer. The frames ahead must be read.
+        if (getAudioSignal().frames2samples(currentFrameFloor + Kernel::kLookahead) + 1 >=
+                m_bufferIntSize) {
+            do {
+                // Reading at least the lookahead also protects against an
+                // infinite loop due to double precision issues.
+                if (unscaled_frames_needed < Kernel::kLookahead) {
+                    unscaled_frames_needed = Kernel::kLookahead;
+                }
+                SINT samples_to_read = math_min<SINT>(
+                        kiLinearScaleReadAheadLength,
+                        getAudioSignal().frames2samples(unscaled_frames_needed));
+
+                // Move the current buffer into the history and adapt the
+                // m_dCurrentFrame to the index of the new buffer
+                saveHistory(m_bufferInt, m_bufferIntSize);
+                m_dCurrentFrame -= getAudioSignal().samples2frames(m_bufferIntSize);
+                currentFrameFloor = static_cast<SINT>(floor(m_dCurrentFrame));
+
+                m_bufferIntSize = m_pReadAheadManager->getNextSamples(
+                        rate_new == 0 ? rate_old : rate_new,
+                        m_bufferInt, samples_to_read);
+
+                if (m_bufferIntSize == 0) {
+                    if (++read_failed_count > 1) {
+                        break;
+                    } else {
+                        continue;
+                    }
+                }
+
+                frames_read += getAudioSignal().samples2frames(m_bufferIntSize);
+                unscaled_frames_needed -= getAudioSignal().samples2frames(m_bufferIntSize);
+            } while (getAudioSignal().frames2samples(currentFrameFloor + Kernel::kLookahead) + 1 >=
+                    m_bufferIntSize);
+
+            if (read_failed_count > 1) {
+                break;
+            }
+        }
+
+        // Computing the fraction in double precision keeps it accurate at
+        // large frame indices.
+        const CSAMPLE frac = static_cast<CSAMPLE>(m_dCurrentFrame - currentFrameFloor);
+        const CSAMPLE* pFrames = &m_bufferInt[getAudioSignal().frames2samples(
+                currentFrameFloor - Kernel::kLookbehind)];
+        Kernel::interpolate(pFrames, frac, &buf[i]);
+
+        // Allows to continue with linear interpolation seamlessly
+        m_floorSampleOld[0] = pFrames[Kernel::kLookbehind * 2];
+        m_floorSampleOld[1] = pFrames[Kernel::kLookbehind * 2 + 1];
+
+        // increment the index for the next loop
+        m_dNextFrame = m_dCurrentFrame + rate_add;
+
+        // Smooth any changes in the playback rate over one buf_size
+        // samples.
+        rate_add += rate_delta_abs;
+        i += getAudioSignal().channelCount();
+    }
+
+    SampleUtil::clear(&buf[i], buf_size - i);
+
+    return frames_read;
+}
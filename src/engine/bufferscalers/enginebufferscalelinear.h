@@ -10,10 +10,30 @@ const int kiLinearScaleReadAheadLength = 10240;
 
 class EngineBufferScaleLinear : public EngineBufferScale  {
   public:
+    // The interpolation between the frames of the track. The higher
+    // qualities need more CPU but reduce the aliasing when scratching or
+    // playing at a rate far off 1.0.
+    enum class Interpolation {
+        Linear = 0,
+        // 4-point cubic Hermite (Catmull-Rom)
+        Cubic = 1,
+        // Blackman-Harris windowed sinc from a precomputed polyphase table
+        Sinc = 2,
+    };
+
     explicit EngineBufferScaleLinear(
             ReadAheadManager *pReadAheadManager);
     ~EngineBufferScaleLinear() override;
 
+    // May be changed between two calls of scaleBuffer() without
+    // interrupting the playback.
+    void setInterpolation(Interpolation interpolation) {
+        m_interpolation = interpolation;
+    }
+    Interpolation getInterpolation() const {
+        return m_interpolation;
+    }
+
     double scaleBuffer(
             CSAMPLE* pOutputBuffer,
             SINT iOutputBufferSize) override;
@@ -26,11 +46,27 @@ class EngineBufferScaleLinear : public EngineBufferScale  {
   private:
     SINT do_scale(CSAMPLE* buf, SINT buf_size);
     SINT do_copy(CSAMPLE* buf, SINT buf_size);
+    // The hot frame loop of do_scale() for the interpolations that need
+    // more than the two surrounding frames.
+    template<typename Kernel>
+    SINT do_scale_kernel(CSAMPLE* buf, SINT buf_size,
+            float rate_old, float rate_new,
+            SINT unscaled_frames_needed, double rate_delta_abs);
+
+    // Moves the last frames of the given samples into the history in front
+    // of m_bufferInt.
+    void saveHistory(const CSAMPLE* pSamples, SINT numSamples);
 
     // The read-ahead manager that we use to fetch samples
     ReadAheadManager* m_pReadAheadManager;
 
-    // Buffer for handling calls to ReadAheadManager
+    Interpolation m_interpolation;
+
+    // Buffer for handling calls to ReadAheadManager. The samples are
+    // preceded by the history of the last frames of the previously read
+    // buffers, i.e. m_bufferInt[-2] is the left sample of the frame
+    // before m_bufferInt[0].
+    CSAMPLE* m_bufferIntStorage;
     CSAMPLE* m_bufferInt;
     SINT m_bufferIntSize;
 
@@ -21,39 +21,28 @@ mixxx::Logger kLogger("CachingReader");
 // TODO() Do we suffer cache misses if we use an audio buffer of above 23 ms?
 const SINT kDefaultHintFrames = 1024;
 
-// currently CachingReaderWorker::kCachingReaderChunkLength is 65536 (0x10000);
-// For 80 chunks we need 5242880 (0x500000) bytes (5 MiB) of Memory
-//static
-const SINT kNumberOfCachedChunksInMemory = 80;
-
 } // anonymous namespace
 
 
 CachingReader::CachingReader(QString group,
-                             UserSettingsPointer config)
+                             UserSettingsPointer config,
+                             bool useSampleBank)
         : m_pConfig(config),
+          m_useSampleBank(useSampleBank),
           m_chunkReadRequestFIFO(1024),
           m_readerStatusFIFO(1024),
           m_readerStatus(INVALID),
           m_mruCachingReaderChunk(nullptr),
           m_lruCachingReaderChunk(nullptr),
-          m_sampleBuffer(CachingReaderChunk::kSamples * kNumberOfCachedChunksInMemory),
+          m_pDecodedSample(nullptr),
           m_worker(group, &m_chunkReadRequestFIFO, &m_readerStatusFIFO) {
-
-    m_allocatedCachingReaderChunks.reserve(kNumberOfCachedChunksInMemory);
-    // Divide up the allocated raw memory buffer into total_chunks
-    // chunks. Initialize each chunk to hold nothing and add it to the free
-    // list.
-    for (SINT i = 0; i < kNumberOfCachedChunksInMemory; ++i) {
-        CachingReaderChunkForOwner* c =
-                new CachingReaderChunkForOwner(
-                        mixxx::SampleBuffer::WritableSlice(
-                                m_sampleBuffer,
-                                CachingReaderChunk::kSamples * i,
-                                CachingReaderChunk::kSamples));
-        m_chunks.push_back(c);
-        m_freeChunks.push_back(c);
-    }
+    // The chunks are allocated by the worker when loading the first track
+    // that is read chunk by chunk. Readers that share decoded samples only
+    // need them after a long track has been loaded. Adding them to the
+    // free list in the engine callback must not allocate memory.
+    m_freeChunks.reserve(CachingReaderWorker::kNumberOfCachedChunksInMemory);
+    m_allocatedCachingReaderChunks.reserve(
+            CachingReaderWorker::kNumberOfCachedChunksInMemory);
 
     // Forward signals from worker
     connect(&m_worker, &CachingReaderWorker::trackLoading,
@@ -65,13 +54,24 @@ CachingReader::CachingReader(QString group,
     connect(&m_worker, &CachingReaderWorker::trackLoadFailed,
             this, &CachingReader::trackLoadFailed,
             Qt::DirectConnection);
-
-    m_worker.start(QThread::HighPriority);
 }
 
 CachingReader::~CachingReader() {
+    // A sample that is decoded by another reader must not wake up the
+    // worker after it has been removed from the scheduler
+    DecodedSampleBank::cancel(&m_worker);
     m_worker.quitWait();
-    qDeleteAll(m_chunks);
+}
+
+void CachingReader::adoptChunks(const QVector<CachingReaderChunkForOwner*>& chunks) {
+    if (!m_chunks.isEmpty()) {
+        return;
+    }
+    // Implicitly shared with the worker that never modifies them
+    m_chunks = chunks;
+    for (const auto& pChunk : qAsConst(m_chunks)) {
+        m_freeChunks.push_back(pChunk);
+    }
 }
 
 void CachingReader::freeChunk(CachingReaderChunkForOwner* pChunk) {
@@ -113,7 +113,7 @@ CachingReaderChunkForOwner* CachingReader::allocateChunk(SINT chunkIndex) {
     if (m_freeChunks.isEmpty()) {
         return nullptr;
     }
-    CachingReaderChunkForOwner* pChunk = m_freeChunks.takeFirst();
+    CachingReaderChunkForOwner* pChunk = m_freeChunks.takeLast();
     pChunk->init(chunkIndex);
 
     //kLogger.debug() << "Allocating chunk" << pChunk << pChunk->getIndex();
@@ -178,7 +178,9 @@ CachingReaderChunkForOwner* CachingReader::lookupChunkAndFreshen(SINT chunkIndex
 }
 
 void CachingReader::newTrack(TrackPointer pTrack) {
-    m_worker.newTrack(pTrack);
+    const bool decodeCompletely = m_useSampleBank && pTrack &&
+            DecodedSampleBank::isEligible(*pTrack);
+    m_worker.newTrack(pTrack, decodeCompletely);
     m_worker.workReady();
 }
 
@@ -202,12 +204,21 @@ void CachingReader::process() {
         }
         if (status.status == TRACK_NOT_LOADED) {
             m_readerStatus = status.status;
+            m_pDecodedSample = nullptr;
+            m_worker.trackLoadProcessed();
         } else if (status.status == TRACK_LOADED) {
             m_readerStatus = status.status;
             // Reset the max. readable frame index
             m_readableFrameIndexRange = status.readableFrameIndexRange();
-            // Free all chunks with sample data from a previous track
-            freeAllChunks();
+            m_pDecodedSample = status.decodedSample;
+            m_worker.trackLoadProcessed();
+            if (status.chunks) {
+                adoptChunks(*status.chunks);
+            }
+            if (!m_pDecodedSample) {
+                // Free all chunks with sample data from a previous track
+                freeAllChunks();
+            }
         }
         if (m_readerStatus == TRACK_LOADED) {
             // Adjust the readable frame index range after loading or reading
@@ -264,6 +275,10 @@ CachingReader::ReadResult CachingReader::read(SINT startSample, SINT numSamples,
     // the first chunk and to update m_readableFrameIndexRange
     process();
 
+    if (m_pDecodedSample) {
+        return readDecodedSample(sample, numSamples, reverse, buffer);
+    }
+
     auto remainingFrameIndexRange =
             mixxx::IndexRange::forward(
                     CachingReaderChunk::samples2frames(sample),
@@ -432,9 +447,43 @@ CachingReader::ReadResult CachingReader::read(SINT startSample, SINT numSamples,
     return result;
 }
 
+CachingReader::ReadResult CachingReader::readDecodedSample(
+        SINT sample, SINT numSamples, bool reverse, CSAMPLE* buffer) {
+    DEBUG_ASSERT(m_pDecodedSample);
+    const auto frameIndexRange = mixxx::IndexRange::forward(
+            CachingReaderChunk::samples2frames(sample),
+            CachingReaderChunk::samples2frames(numSamples));
+    const auto readFrameIndexRange = reverse ?
+            m_pDecodedSample->readSampleFramesReverse(
+                    &buffer[numSamples], frameIndexRange) :
+            m_pDecodedSample->readSampleFrames(
+                    buffer, frameIndexRange);
+    if (readFrameIndexRange == frameIndexRange) {
+        return ReadResult::AVAILABLE;
+    }
+    if (readFrameIndexRange.empty()) {
+        SampleUtil::clear(buffer, numSamples);
+        return ReadResult::PARTIALLY_AVAILABLE;
+    }
+    // Fill the frames before and after the sample with silence, e.g.
+    // while in preroll
+    const SINT leadingSamples = CachingReaderChunk::frames2samples(
+            readFrameIndexRange.start() - frameIndexRange.start());
+    const SINT trailingSamples = CachingReaderChunk::frames2samples(
+            frameIndexRange.end() - readFrameIndexRange.end());
+    if (reverse) {
+        SampleUtil::clear(buffer, trailingSamples);
+        SampleUtil::clear(&buffer[numSamples - leadingSamples], leadingSamples);
+    } else {
+        SampleUtil::clear(buffer, leadingSamples);
+        SampleUtil::clear(&buffer[numSamples - trailingSamples], trailingSamples);
+    }
+    return ReadResult::PARTIALLY_AVAILABLE;
+}
+
 void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
-    // If no file is loaded, skip.
-    if (m_readerStatus != TRACK_LOADED) {
+    // If no file is loaded, skip. Decoded samples are always available.
+    if (m_readerStatus != TRACK_LOADED || m_pDecodedSample) {
         return;
     }
 
@@ -7,7 +7,6 @@
 #include <QtDebug>
 #include <QList>
 #include <QVector>
-#include <QLinkedList>
 #include <QHash>
 #include <QVarLengthArray>
 
@@ -75,9 +74,12 @@ class CachingReader : public QObject {
     Q_OBJECT
 
   public:
-    // Construct a CachingReader with the given group.
+    // Construct a CachingReader with the given group. Readers of samplers
+    // load short tracks from the DecodedSampleBank that is shared between
+    // all of them and only allocate the chunk cache for long tracks.
     CachingReader(QString group,
-                  UserSettingsPointer _config);
+                  UserSettingsPointer _config,
+                  bool useSampleBank = false);
     virtual ~CachingReader();
 
     virtual void process();
@@ -112,6 +114,14 @@ class CachingReader : public QObject {
         m_worker.setScheduler(pScheduler);
     }
 
+    // Readers of playing decks are served first by the shared threads of
+    // the EngineWorkerScheduler. Must only be called from the engine
+    // callback.
+    void setPlaying(bool playing) {
+        m_worker.setPriority(playing ?
+                EngineWorker::Priority::High : EngineWorker::Priority::Low);
+    }
+
   signals:
     // Emitted once a new track is loaded and ready to be read from.
     void trackLoading();
@@ -120,6 +130,7 @@ class CachingReader : public QObject {
 
   private:
     const UserSettingsPointer m_pConfig;
+    const bool m_useSampleBank;
 
     // Thread-safe FIFOs for communication between the engine callback and
     // reader thread.
@@ -144,6 +155,13 @@ class CachingReader : public QObject {
     // Returns all allocated chunks to the free list
     void freeAllChunks();
 
+    // Puts the chunks that have been allocated by the worker on the free
+    // list when the first track is loaded that is read chunk by chunk
+    void adoptChunks(const QVector<CachingReaderChunkForOwner*>& chunks);
+
+    // Reads from the decoded sample without any chunk bookkeeping
+    ReadResult readDecodedSample(SINT sample, SINT numSamples, bool reverse, CSAMPLE* buffer);
+
     // Gets a chunk from the free list. Returns nullptr if none available.
     CachingReaderChunkForOwner* allocateChunk(SINT chunkIndex);
 
@@ -152,12 +170,13 @@ class CachingReader : public QObject {
 
     ReaderStatus m_readerStatus;
 
-    // Keeps track of all CachingReaderChunks we've allocated.
+    // Keeps track of all CachingReaderChunks the worker has allocated.
     QVector<CachingReaderChunkForOwner*> m_chunks;
 
-    // List of free chunks. Linked list so that we have constant time insertions
-    // and deletions. Iteration is not necessary.
-    QLinkedList<CachingReaderChunkForOwner*> m_freeChunks;
+    // List of free chunks. The capacity is reserved for all chunks so that
+    // insertions and deletions at the back never allocate memory. Iteration
+    // is not necessary.
+    QVector<CachingReaderChunkForOwner*> m_freeChunks;
 
     // Keeps track of what CachingReaderChunks we've allocated and indexes them based on what
     // chunk number they are allocated to.
@@ -167,8 +186,9 @@ class CachingReader : public QObject {
     CachingReaderChunkForOwner* m_mruCachingReaderChunk;
     CachingReaderChunkForOwner* m_lruCachingReaderChunk;
 
-    // The raw memory buffer which is divided up into chunks.
-    mixxx::SampleBuffer m_sampleBuffer;
+    // The sample of the current track if it has been decoded completely.
+    // It is owned by the worker.
+    const DecodedSample* m_pDecodedSample;
 
     // The readable frame index range as reported by the worker.
     mixxx::IndexRange m_readableFrameIndexRange;
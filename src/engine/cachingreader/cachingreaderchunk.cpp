@@ -76,6 +76,19 @@ mixxx::IndexRange CachingReaderChunk::bufferSampleFrames(
     return m_bufferedSampleFrames.frameIndexRange();
 }
 
+mixxx::IndexRange CachingReaderChunk::bufferSampleFrames(
+        const mixxx::IndexRange& frameIndexRange,
+        const CSAMPLE* sampleBuffer) {
+    const SINT sampleCount = frames2samples(frameIndexRange.length());
+    DEBUG_ASSERT(sampleCount <= m_sampleBuffer.length());
+    SampleUtil::copy(m_sampleBuffer.data(), sampleBuffer, sampleCount);
+    m_bufferedSampleFrames = mixxx::ReadableSampleFrames(
+            frameIndexRange,
+            mixxx::SampleBuffer::ReadableSlice(
+                    m_sampleBuffer.data(), sampleCount));
+    return m_bufferedSampleFrames.frameIndexRange();
+}
+
 mixxx::IndexRange CachingReaderChunk::readBufferedSampleFrames(
         CSAMPLE* sampleBuffer,
         const mixxx::IndexRange& frameIndexRange) const {
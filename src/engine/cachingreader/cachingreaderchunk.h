@@ -56,6 +56,12 @@ public:
     mixxx::IndexRange bufferSampleFrames(
             const mixxx::AudioSourcePointer& pAudioSource,
             mixxx::SampleBuffer::WritableSlice tempOutputBuffer);
+    // Copy sample frames that have already been read from the audio
+    // source, e.g. while prefetching the track, instead of reading them
+    // again.
+    mixxx::IndexRange bufferSampleFrames(
+            const mixxx::IndexRange& frameIndexRange,
+            const CSAMPLE* sampleBuffer);
 
     mixxx::IndexRange readBufferedSampleFrames(
             CSAMPLE* sampleBuffer,
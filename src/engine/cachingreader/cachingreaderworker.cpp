@@ -2,13 +2,17 @@
 #include <QFileInfo>
 #include <QMutexLocker>
 
+#include <chrono>
+
 #include "control/controlobject.h"
 
 #include "engine/cachingreader/cachingreaderworker.h"
+#include "engine/cachingreader/prefetchedchunkcache.h"
 #include "sources/soundsourceproxy.h"
 #include "util/compatibility.h"
 #include "util/event.h"
 #include "util/logger.h"
+#include "util/stat.h"
 
 
 namespace {
@@ -17,19 +21,50 @@ mixxx::Logger kLogger("CachingReaderWorker");
 
 } // anonymous namespace
 
+// currently CachingReaderWorker::kCachingReaderChunkLength is 65536 (0x10000);
+// For 80 chunks we need 5242880 (0x500000) bytes (5 MiB) of Memory
+//static
+const int CachingReaderWorker::kNumberOfCachedChunksInMemory = 80;
+
 CachingReaderWorker::CachingReaderWorker(
         QString group,
         FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
         FIFO<ReaderStatusUpdate>* pReaderStatusFIFO)
         : m_group(group),
           m_tag(QString("CachingReaderWorker %1").arg(m_group)),
+          m_queueDepthStatKey(m_tag + " queue depth"),
+          m_chunkLatencyStatKey(m_tag + " chunk latency"),
           m_pChunkReadRequestFIFO(pChunkReadRequestFIFO),
           m_pReaderStatusFIFO(pReaderStatusFIFO),
           m_newTrackAvailable(false),
-          m_stop(0) {
+          m_newTrackDecodeCompletely(false),
+          m_trackLoads(0),
+          m_processedTrackLoads(0) {
 }
 
 CachingReaderWorker::~CachingReaderWorker() {
+    qDeleteAll(m_chunks);
+}
+
+void CachingReaderWorker::allocateChunks() {
+    if (!m_chunks.isEmpty()) {
+        return;
+    }
+    mixxx::SampleBuffer(
+            CachingReaderChunk::kSamples * kNumberOfCachedChunksInMemory)
+            .swap(m_chunkSampleBuffer);
+    m_chunks.reserve(kNumberOfCachedChunksInMemory);
+    // Divide up the allocated raw memory buffer into total_chunks
+    // chunks. The owner puts them on its free list when it receives
+    // them with the status of the track.
+    for (int i = 0; i < kNumberOfCachedChunksInMemory; ++i) {
+        m_chunks.push_back(
+                new CachingReaderChunkForOwner(
+                        mixxx::SampleBuffer::WritableSlice(
+                                m_chunkSampleBuffer,
+                                CachingReaderChunk::kSamples * i,
+                                CachingReaderChunk::kSamples)));
+    }
 }
 
 ReaderStatusUpdate CachingReaderWorker::processReadRequest(
@@ -47,11 +82,18 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
         return result;
     }
 
-    // Try to read the data required for the chunk from the audio source
-    // and adjust the max. readable frame index if decoding errors occur.
-    const mixxx::IndexRange bufferedFrameIndexRange = pChunk->bufferSampleFrames(
-            m_pAudioSource,
-            mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+    // Chunks that have been decoded while prefetching the track are not
+    // read again
+    mixxx::IndexRange bufferedFrameIndexRange =
+            PrefetchedChunkCache::take(m_prefetchedChunksKey, pChunk);
+    if (bufferedFrameIndexRange.empty() ||
+            !(bufferedFrameIndexRange <= chunkFrameIndexRange)) {
+        // Try to read the data required for the chunk from the audio source
+        // and adjust the max. readable frame index if decoding errors occur.
+        bufferedFrameIndexRange = pChunk->bufferSampleFrames(
+                m_pAudioSource,
+                mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+    }
     ReaderStatus status = bufferedFrameIndexRange.empty() ? CHUNK_READ_EOF : CHUNK_READ_SUCCESS;
     if (chunkFrameIndexRange != bufferedFrameIndexRange) {
         kLogger.warning()
@@ -85,39 +127,62 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
 }
 
 // WARNING: Always called from a different thread (GUI)
-void CachingReaderWorker::newTrack(TrackPointer pTrack) {
+void CachingReaderWorker::newTrack(TrackPointer pTrack, bool decodeCompletely) {
     QMutexLocker locker(&m_newTrackMutex);
     m_pNewTrack = pTrack;
+    m_newTrackDecodeCompletely = decodeCompletely;
     m_newTrackAvailable = true;
 }
 
-void CachingReaderWorker::run() {
-    unsigned static id = 0; //the id of this thread, for debugging purposes
-    QThread::currentThread()->setObjectName(QString("CachingReaderWorker %1").arg(++id));
+void CachingReaderWorker::releaseRetiredSamples() {
+    if (!m_retiredDecodedSamples.isEmpty() &&
+            m_processedTrackLoads.load() == m_trackLoads) {
+        m_retiredDecodedSamples.clear();
+    }
+}
 
-    Event::start(m_tag);
-    while (!m_stop.load()) {
-        // Request is initialized by reading from FIFO
-        CachingReaderChunkReadRequest request;
-        if (m_newTrackAvailable) {
-            TrackPointer pLoadTrack;
-            { // locking scope
-                QMutexLocker locker(&m_newTrackMutex);
-                pLoadTrack = m_pNewTrack;
-                m_pNewTrack.reset();
-                m_newTrackAvailable = false;
-            } // implicitly unlocks the mutex
-            loadTrack(pLoadTrack);
-        } else if (m_pChunkReadRequestFIFO->read(&request, 1) == 1) {
-            // Read the requested chunk and send the result
-            const ReaderStatusUpdate update(processReadRequest(request));
-            m_pReaderStatusFIFO->writeBlocking(&update, 1);
-        } else {
-            Event::end(m_tag);
-            m_semaRun.acquire();
-            Event::start(m_tag);
+bool CachingReaderWorker::runOnce() {
+    releaseRetiredSamples();
+    if (m_newTrackAvailable) {
+        TrackPointer pLoadTrack;
+        bool decodeCompletely;
+        { // locking scope
+            QMutexLocker locker(&m_newTrackMutex);
+            pLoadTrack = m_pNewTrack;
+            decodeCompletely = m_newTrackDecodeCompletely;
+            m_pNewTrack.reset();
+            m_newTrackAvailable = false;
+        } // implicitly unlocks the mutex
+        Event::start(m_tag);
+        loadTrack(pLoadTrack, decodeCompletely);
+        Event::end(m_tag);
+        return true;
+    }
+    if (m_decodedSampleFuture.valid()) {
+        if (!isDecodedSampleReady()) {
+            // Woken up again when the other reader has finished decoding
+            return false;
         }
+        finishLoadDecodedSample();
+        return true;
     }
+    const int queueDepth = m_pChunkReadRequestFIFO->readAvailable();
+    // Request is initialized by reading from FIFO
+    CachingReaderChunkReadRequest request;
+    if (m_pChunkReadRequestFIFO->read(&request, 1) != 1) {
+        return false;
+    }
+    Stat::track(m_queueDepthStatKey, Stat::UNSPECIFIED,
+            Stat::AVERAGE | Stat::MAX, queueDepth);
+    // Read the requested chunk and send the result
+    Event::start(m_tag);
+    const ReaderStatusUpdate update(processReadRequest(request));
+    Event::end(m_tag);
+    m_pReaderStatusFIFO->writeBlocking(&update, 1);
+    Stat::track(m_chunkLatencyStatKey, Stat::DURATION_NANOSEC,
+            Stat::AVERAGE | Stat::MAX | Stat::SAMPLE_VARIANCE,
+            mixxx::Time::elapsed().toIntegerNanos() - request.timestampNanos);
+    return true;
 }
 
 namespace {
@@ -132,10 +197,22 @@ mixxx::AudioSourcePointer openAudioSourceForReading(const TrackPointer& pTrack,
 
 } // anonymous namespace
 
-void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
+void CachingReaderWorker::loadTrack(const TrackPointer& pTrack, bool decodeCompletely) {
     ReaderStatusUpdate status;
     status.init(TRACK_NOT_LOADED);
 
+    abortLoadDecodedSample();
+    m_prefetchedChunksKey.clear();
+
+    // Every invocation writes exactly one TRACK_LOADED or TRACK_NOT_LOADED
+    // status. The owner might still read from the previous decoded sample
+    // until it has processed this status.
+    ++m_trackLoads;
+    if (m_pDecodedSample) {
+        m_retiredDecodedSamples.append(m_pDecodedSample);
+        m_pDecodedSample.reset();
+    }
+
     if (!pTrack) {
         // Unload track
         m_pAudioSource.reset(); // Close open file handles
@@ -159,6 +236,11 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
         return;
     }
 
+    if (decodeCompletely) {
+        loadDecodedSample(pTrack);
+        return;
+    }
+
     mixxx::AudioSource::OpenParams config;
     config.setChannelCount(CachingReaderChunk::kChannels);
     m_pAudioSource = openAudioSourceForReading(pTrack, config);
@@ -182,20 +264,19 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
     // is available for reading. Later if read errors occur this value will
     // be decreased to avoid repeated reading of corrupt audio data.
     m_readableFrameIndexRange = m_pAudioSource->frameIndexRange();
+    m_prefetchedChunksKey = PrefetchedChunkCache::trackKey(*pTrack);
+
+    // The engine callback does not touch the chunks until it has received
+    // this status
+    allocateChunks();
 
     status.status = TRACK_LOADED;
     status.readableFrameIndexRangeStart = m_readableFrameIndexRange.start();
     status.readableFrameIndexRangeEnd = m_readableFrameIndexRange.end();
+    status.chunks = &m_chunks;
     m_pReaderStatusFIFO->writeBlocking(&status, 1);
 
-    // Clear the chunks to read list.
-    CachingReaderChunkReadRequest request;
-    while (m_pChunkReadRequestFIFO->read(&request, 1) == 1) {
-        kLogger.debug() << "Cancelling read request for " << request.chunk->getIndex();
-        status.status = CHUNK_READ_INVALID;
-        status.chunk = request.chunk;
-        m_pReaderStatusFIFO->writeBlocking(&status, 1);
-    }
+    cancelReadRequests();
 
     // Emit that the track is loaded.
     const SINT sampleCount =
@@ -204,8 +285,82 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
     emit(trackLoaded(pTrack, m_pAudioSource->sampleRate(), sampleCount));
 }
 
-void CachingReaderWorker::quitWait() {
-    m_stop = 1;
-    m_semaRun.release();
-    wait();
+void CachingReaderWorker::loadDecodedSample(const TrackPointer& pTrack) {
+    // Reads are served from the shared sample. No file is kept open.
+    m_pAudioSource.reset();
+    // Another reader might currently decode the same file. Instead of
+    // blocking a thread of the scheduler the load is finished when the
+    // worker is woken up again.
+    m_pDecodedSampleTrack = pTrack;
+    m_decodedSampleFuture = DecodedSampleBank::load(pTrack, this, [this] {
+        workReady();
+    });
+    if (isDecodedSampleReady()) {
+        finishLoadDecodedSample();
+    }
+}
+
+bool CachingReaderWorker::isDecodedSampleReady() const {
+    return m_decodedSampleFuture.wait_for(std::chrono::seconds(0)) ==
+            std::future_status::ready;
+}
+
+void CachingReaderWorker::abortLoadDecodedSample() {
+    if (!m_decodedSampleFuture.valid()) {
+        return;
+    }
+    DecodedSampleBank::cancel(this);
+    m_decodedSampleFuture = DecodedSampleFuture();
+    m_pDecodedSampleTrack.reset();
+    m_readableFrameIndexRange = mixxx::IndexRange();
+    ReaderStatusUpdate status;
+    status.init(TRACK_NOT_LOADED);
+    m_pReaderStatusFIFO->writeBlocking(&status, 1);
+}
+
+void CachingReaderWorker::finishLoadDecodedSample() {
+    ReaderStatusUpdate status;
+    status.init(TRACK_NOT_LOADED);
+
+    const TrackPointer pTrack = m_pDecodedSampleTrack;
+    m_pDecodedSampleTrack.reset();
+    m_pDecodedSample = m_decodedSampleFuture.get();
+    m_decodedSampleFuture = DecodedSampleFuture();
+    if (!m_pDecodedSample) {
+        m_readableFrameIndexRange = mixxx::IndexRange();
+        kLogger.debug() << m_group << "loadTrack() load failed for\""
+                 << pTrack->getLocation() << "\", file could not be decoded";
+        m_pReaderStatusFIFO->writeBlocking(&status, 1);
+        emit(trackLoadFailed(
+            pTrack, QString("The file '%1' could not be loaded.")
+                    .arg(pTrack->getLocation())));
+        return;
+    }
+
+    m_readableFrameIndexRange = m_pDecodedSample->frameIndexRange();
+
+    status.status = TRACK_LOADED;
+    status.readableFrameIndexRangeStart = m_readableFrameIndexRange.start();
+    status.readableFrameIndexRangeEnd = m_readableFrameIndexRange.end();
+    status.decodedSample = m_pDecodedSample.get();
+    m_pReaderStatusFIFO->writeBlocking(&status, 1);
+
+    cancelReadRequests();
+
+    const SINT sampleCount =
+            CachingReaderChunk::frames2samples(
+                    m_readableFrameIndexRange.length());
+    emit(trackLoaded(pTrack, m_pDecodedSample->sampleRate(), sampleCount));
+}
+
+void CachingReaderWorker::cancelReadRequests() {
+    // Clear the chunks to read list.
+    ReaderStatusUpdate status;
+    status.init(CHUNK_READ_INVALID, nullptr, m_readableFrameIndexRange);
+    CachingReaderChunkReadRequest request;
+    while (m_pChunkReadRequestFIFO->read(&request, 1) == 1) {
+        kLogger.debug() << "Cancelling read request for " << request.chunk->getIndex();
+        status.chunk = request.chunk;
+        m_pReaderStatusFIFO->writeBlocking(&status, 1);
+    }
 }
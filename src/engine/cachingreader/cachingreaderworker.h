@@ -2,26 +2,35 @@
 #define ENGINE_CACHINGREADERWORKER_H
 
 #include <QtDebug>
+#include <QList>
 #include <QMutex>
 #include <QSemaphore>
 #include <QThread>
 #include <QString>
+#include <QVector>
+
+#include <atomic>
 
 #include "engine/cachingreader/cachingreaderchunk.h"
+#include "engine/cachingreader/decodedsamplebank.h"
 #include "track/track.h"
 #include "engine/engineworker.h"
 #include "sources/audiosource.h"
 #include "util/fifo.h"
+#include "util/time.h"
 
 
 // POD with trivial ctor/dtor/copy for passing through FIFO
 typedef struct CachingReaderChunkReadRequest {
     CachingReaderChunk* chunk;
+    // The time when the request has been issued for measuring the latency
+    qint64 timestampNanos;
 
     void giveToWorker(CachingReaderChunkForOwner* chunkForOwner) {
         DEBUG_ASSERT(chunkForOwner);
         chunk = chunkForOwner;
         chunkForOwner->giveToWorker();
+        timestampNanos = mixxx::Time::elapsed().toIntegerNanos();
     }
 } CachingReaderChunkReadRequest;
 
@@ -40,6 +49,13 @@ typedef struct ReaderStatusUpdate {
     CachingReaderChunk* chunk;
     SINT readableFrameIndexRangeStart;
     SINT readableFrameIndexRangeEnd;
+    // The completely decoded sample if a track has been loaded from the
+    // DecodedSampleBank. It is kept alive by the worker until the owner
+    // has acknowledged all following track loads.
+    const DecodedSample* decodedSample;
+    // The chunks of the cache if a track has been loaded that is read
+    // chunk by chunk. They are allocated and owned by the worker.
+    const QVector<CachingReaderChunkForOwner*>* chunks;
 
     void init(
             ReaderStatus statusArg = INVALID,
@@ -49,6 +65,8 @@ typedef struct ReaderStatusUpdate {
         chunk = chunkArg;
         readableFrameIndexRangeStart = readableFrameIndexRangeArg.start();
         readableFrameIndexRangeEnd = readableFrameIndexRangeArg.end();
+        decodedSample = nullptr;
+        chunks = nullptr;
     }
 
     mixxx::IndexRange readableFrameIndexRange() const {
@@ -62,6 +80,9 @@ class CachingReaderWorker : public EngineWorker {
     Q_OBJECT
 
   public:
+    // The number of chunks of the cache
+    static const int kNumberOfCachedChunksInMemory;
+
     // Construct a CachingReader with the given group.
     CachingReaderWorker(QString group,
             FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
@@ -69,13 +90,20 @@ class CachingReaderWorker : public EngineWorker {
     virtual ~CachingReaderWorker();
 
     // Request to load a new track. wake() must be called afterwards.
-    virtual void newTrack(TrackPointer pTrack);
+    // Samples are decoded completely into the shared DecodedSampleBank
+    // instead of being read chunk by chunk if requested.
+    virtual void newTrack(TrackPointer pTrack, bool decodeCompletely = false);
+
+    // Acknowledges that the owner has received the status of a track load,
+    // i.e. TRACK_LOADED or TRACK_NOT_LOADED. Must be called from the engine
+    // callback.
+    void trackLoadProcessed() {
+        m_processedTrackLoads.fetch_add(1);
+    }
 
     // Run upkeep operations like loading tracks and reading from file. Run by a
     // thread pool via the EngineWorkerScheduler.
-    virtual void run();
-
-    void quitWait();
+    bool runOnce() override;
 
   signals:
     // Emitted once a new track is loaded and ready to be read from.
@@ -86,6 +114,10 @@ class CachingReaderWorker : public EngineWorker {
   private:
     QString m_group;
     QString m_tag;
+    // Keys for reporting the number of pending chunk read requests and
+    // the time until a chunk is read per player
+    QString m_queueDepthStatKey;
+    QString m_chunkLatencyStatKey;
 
     // Thread-safe FIFOs for communication between the engine callback and
     // reader thread.
@@ -97,28 +129,61 @@ class CachingReaderWorker : public EngineWorker {
     QMutex m_newTrackMutex;
     bool m_newTrackAvailable;
     TrackPointer m_pNewTrack;
+    bool m_newTrackDecodeCompletely;
 
     // Internal method to load a track. Emits trackLoaded when finished.
-    void loadTrack(const TrackPointer& pTrack);
+    void loadTrack(const TrackPointer& pTrack, bool decodeCompletely);
+    void loadDecodedSample(const TrackPointer& pTrack);
+    bool isDecodedSampleReady() const;
+    void finishLoadDecodedSample();
+    // Responds with TRACK_NOT_LOADED if a new track is requested while
+    // another reader is still decoding the sample
+    void abortLoadDecodedSample();
+
+    // Allocates the memory of all chunks once before loading the first
+    // track that is read chunk by chunk
+    void allocateChunks();
+
+    // Responds to all pending read requests with CHUNK_READ_INVALID
+    void cancelReadRequests();
+
+    // Releases the decoded samples of previous tracks as soon as the owner
+    // has processed all track loads and does not read from them anymore.
+    void releaseRetiredSamples();
 
     ReaderStatusUpdate processReadRequest(
             const CachingReaderChunkReadRequest& request);
 
     // The current audio source of the track loaded
     mixxx::AudioSourcePointer m_pAudioSource;
+    // Identifies the chunks of the track loaded in the PrefetchedChunkCache
+    QString m_prefetchedChunksKey;
+
+    // The decoded sample of the track loaded instead of an audio source
+    DecodedSamplePointer m_pDecodedSample;
+    // The sample that is currently decoded by another reader
+    DecodedSampleFuture m_decodedSampleFuture;
+    TrackPointer m_pDecodedSampleTrack;
+    QList<DecodedSamplePointer> m_retiredDecodedSamples;
+    // The number of track loads that have been issued by the worker and
+    // processed by the owner
+    int m_trackLoads;
+    std::atomic<int> m_processedTrackLoads;
 
     // Temporary buffer for reading samples from all channels
     // before conversion to a stereo signal.
     mixxx::SampleBuffer m_tempReadBuffer;
 
+    // The raw memory buffer which is divided up into chunks.
+    mixxx::SampleBuffer m_chunkSampleBuffer;
+    QVector<CachingReaderChunkForOwner*> m_chunks;
+
     // The maximum readable frame index of the AudioSource. Might
     // be adjusted when decoding errors occur to prevent reading
     // the same chunk(s) over and over again.
     // This frame index references the frame that follows the
     // last frame with readable sample data.
     mixxx::IndexRange m_readableFrameIndexRange;
-
-    QAtomicInt m_stop;
 };
 
 
@@ -0,0 +1,274 @@
+#include "engine/cachingreader/decodedsamplebank.h"
+
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPair>
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "sources/audiosourcestereoproxy.h"
+#include "sources/soundsourceproxy.h"
+#include "util/compatibility.h"
+#include "util/logger.h"
+#include "util/sample.h"
+#include "util/timer.h"
+
+namespace {
+
+const mixxx::Logger kLogger("DecodedSampleBank");
+
+// About 5 MiB of stereo samples at 44.1 kHz, i.e. the size of the chunk
+// cache of a CachingReader
+const double kMaxDurationSeconds = 15.0;
+
+// A sample that is currently decoded and the callbacks of all loads
+// that share the result
+struct PendingDecode {
+    DecodedSampleFuture future;
+    QList<QPair<const void*, std::function<void()>>> callbacks;
+};
+
+QMutex s_mutex;
+QHash<QString, std::weak_ptr<const DecodedSample>> s_samples;
+QHash<QString, PendingDecode> s_pendingDecodes;
+
+// A changed file is decoded again
+QString sampleKey(const Track& track) {
+    QString location = track.getCanonicalLocation();
+    if (location.isEmpty()) {
+        location = track.getLocation();
+    }
+    return location + QChar('|') +
+            QString::number(track.getFileModifiedTime().toMSecsSinceEpoch());
+}
+
+DecodedSamplePointer decodeSample(const TrackPointer& pTrack) {
+    ScopedTimer t("DecodedSampleBank::decodeSample");
+    mixxx::AudioSource::OpenParams config;
+    config.setChannelCount(CachingReaderChunk::kChannels);
+    mixxx::AudioSourcePointer pAudioSource =
+            SoundSourceProxy(pTrack).openAudioSource(config);
+    if (!pAudioSource) {
+        kLogger.warning() << "Failed to open file:" << pTrack->getLocation();
+        return DecodedSamplePointer();
+    }
+    mixxx::AudioSourceStereoProxy audioSourceProxy(
+            pAudioSource, CachingReaderChunk::kFrames);
+    DEBUG_ASSERT(audioSourceProxy.channelCount() == CachingReaderChunk::kChannels);
+
+    const auto sourceFrameIndexRange = pAudioSource->frameIndexRange();
+    mixxx::SampleBuffer sampleBuffer(
+            CachingReaderChunk::frames2samples(sourceFrameIndexRange.length()));
+    mixxx::SampleBuffer tempBuffer(CachingReaderChunk::kSamples);
+    // Decoding stops at the first error. Only the frames that have
+    // been decoded without gaps are readable.
+    SINT decodedFrameIndex = sourceFrameIndexRange.start();
+    while (decodedFrameIndex < sourceFrameIndexRange.end()) {
+        const auto blockFrameIndexRange = intersect(
+                mixxx::IndexRange::forward(
+                        decodedFrameIndex, CachingReaderChunk::kFrames),
+                sourceFrameIndexRange);
+        const auto readableSampleFrames = audioSourceProxy.readSampleFrames(
+                mixxx::WritableSampleFrames(
+                        blockFrameIndexRange,
+                        mixxx::SampleBuffer::WritableSlice(tempBuffer)));
+        const auto readableFrameIndexRange =
+                readableSampleFrames.frameIndexRange();
+        if (readableFrameIndexRange.empty()) {
+            break;
+        }
+        // Fill unreadable frames at the start of the block with silence
+        const SINT paddingFrames =
+                readableFrameIndexRange.start() - decodedFrameIndex;
+        const SINT sampleOffset = CachingReaderChunk::frames2samples(
+                decodedFrameIndex - sourceFrameIndexRange.start());
+        SampleUtil::clear(
+                sampleBuffer.data(sampleOffset),
+                CachingReaderChunk::frames2samples(paddingFrames));
+        SampleUtil::copy(
+                sampleBuffer.data(sampleOffset +
+                        CachingReaderChunk::frames2samples(paddingFrames)),
+                readableSampleFrames.readableData(),
+                CachingReaderChunk::frames2samples(
+                        readableFrameIndexRange.length()));
+        decodedFrameIndex = readableFrameIndexRange.end();
+        if (readableFrameIndexRange.end() < blockFrameIndexRange.end()) {
+            break;
+        }
+    }
+    const auto frameIndexRange = mixxx::IndexRange::between(
+            sourceFrameIndexRange.start(), decodedFrameIndex);
+    if (frameIndexRange != sourceFrameIndexRange) {
+        kLogger.warning()
+                << "Failed to decode sample frames:"
+                << "actual =" << frameIndexRange
+                << ", expected =" << sourceFrameIndexRange;
+    }
+    if (frameIndexRange.empty()) {
+        return DecodedSamplePointer();
+    }
+    return std::make_shared<const DecodedSample>(
+            pAudioSource->sampleRate(),
+            frameIndexRange,
+            std::move(sampleBuffer));
+}
+
+} // anonymous namespace
+
+DecodedSample::DecodedSample(
+        int sampleRate,
+        mixxx::IndexRange frameIndexRange,
+        mixxx::SampleBuffer sampleBuffer)
+        : m_sampleRate(sampleRate),
+          m_frameIndexRange(frameIndexRange),
+          m_sampleBuffer(std::move(sampleBuffer)) {
+    DEBUG_ASSERT(CachingReaderChunk::frames2samples(m_frameIndexRange.length()) <=
+            m_sampleBuffer.size());
+}
+
+mixxx::IndexRange DecodedSample::readSampleFrames(
+        CSAMPLE* sampleBuffer,
+        const mixxx::IndexRange& frameIndexRange) const {
+    const auto copyableFrameIndexRange =
+            intersect(frameIndexRange, m_frameIndexRange);
+    if (!copyableFrameIndexRange.empty()) {
+        const SINT dstSampleOffset = CachingReaderChunk::frames2samples(
+                copyableFrameIndexRange.start() - frameIndexRange.start());
+        const SINT srcSampleOffset = CachingReaderChunk::frames2samples(
+                copyableFrameIndexRange.start() - m_frameIndexRange.start());
+        SampleUtil::copy(
+                sampleBuffer + dstSampleOffset,
+                m_sampleBuffer.data(srcSampleOffset),
+                CachingReaderChunk::frames2samples(copyableFrameIndexRange.length()));
+    }
+    return copyableFrameIndexRange;
+}
+
+mixxx::IndexRange DecodedSample::readSampleFramesReverse(
+        CSAMPLE* reverseSampleBuffer,
+        const mixxx::IndexRange& frameIndexRange) const {
+    const auto copyableFrameIndexRange =
+            intersect(frameIndexRange, m_frameIndexRange);
+    if (!copyableFrameIndexRange.empty()) {
+        const SINT dstSampleOffset = CachingReaderChunk::frames2samples(
+                copyableFrameIndexRange.start() - frameIndexRange.start());
+        const SINT srcSampleOffset = CachingReaderChunk::frames2samples(
+                copyableFrameIndexRange.start() - m_frameIndexRange.start());
+        const SINT sampleCount =
+                CachingReaderChunk::frames2samples(copyableFrameIndexRange.length());
+        SampleUtil::copyReverse(
+                reverseSampleBuffer - dstSampleOffset - sampleCount,
+                m_sampleBuffer.data(srcSampleOffset),
+                sampleCount);
+    }
+    return copyableFrameIndexRange;
+}
+
+// static
+bool DecodedSampleBank::isEligible(const Track& track) {
+    // The duration is unknown until the track has been loaded once
+    const double duration = track.getDuration();
+    return duration > 0.0 && duration <= kMaxDurationSeconds;
+}
+
+// static
+DecodedSampleFuture DecodedSampleBank::load(
+        const TrackPointer& pTrack,
+        const void* pReceiver,
+        std::function<void()> onDecoded) {
+    std::promise<DecodedSamplePointer> promise;
+    VERIFY_OR_DEBUG_ASSERT(pTrack) {
+        promise.set_value(DecodedSamplePointer());
+        return promise.get_future().share();
+    }
+    const QString key = sampleKey(*pTrack);
+    DecodedSampleFuture future;
+    {
+        QMutexLocker locker(&s_mutex);
+        auto pendingIt = s_pendingDecodes.find(key);
+        if (pendingIt != s_pendingDecodes.end()) {
+            // Share the result of the other thread instead of waiting
+            if (onDecoded) {
+                pendingIt->callbacks.append(qMakePair(pReceiver, onDecoded));
+            }
+            return pendingIt->future;
+        }
+        future = promise.get_future().share();
+        DecodedSamplePointer pSample = s_samples.value(key).lock();
+        if (pSample) {
+            promise.set_value(std::move(pSample));
+            return future;
+        }
+        PendingDecode pendingDecode;
+        pendingDecode.future = future;
+        s_pendingDecodes.insert(key, pendingDecode);
+    }
+
+    DecodedSamplePointer pSample = decodeSample(pTrack);
+
+    QMutexLocker locker(&s_mutex);
+    const PendingDecode pendingDecode = s_pendingDecodes.take(key);
+    // Purge the samples that are not used anymore
+    auto it = s_samples.begin();
+    while (it != s_samples.end()) {
+        if (it.value().expired()) {
+            it = s_samples.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (pSample) {
+        s_samples.insert(key, pSample);
+        kLogger.debug()
+                << "Decoded" << pTrack->getLocation()
+                << "into" << pSample->sizeInBytes() << "bytes";
+    }
+    promise.set_value(std::move(pSample));
+    // The callbacks are invoked while locked for synchronizing them
+    // with cancel()
+    for (const auto& callback : pendingDecode.callbacks) {
+        callback.second();
+    }
+    return future;
+}
+
+// static
+void DecodedSampleBank::cancel(const void* pReceiver) {
+    QMutexLocker locker(&s_mutex);
+    for (auto& pendingDecode : s_pendingDecodes) {
+        auto it = pendingDecode.callbacks.begin();
+        while (it != pendingDecode.callbacks.end()) {
+            if (it->first == pReceiver) {
+                it = pendingDecode.callbacks.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+// static
+int DecodedSampleBank::sampleCount() {
+    QMutexLocker locker(&s_mutex);
+    int count = 0;
+    for (const auto& pSample : qAsConst(s_samples)) {
+        if (!pSample.expired()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// static
+qint64 DecodedSampleBank::sizeInBytes() {
+    QMutexLocker locker(&s_mutex);
+    qint64 bytes = 0;
+    for (const auto& pWeakSample : qAsConst(s_samples)) {
+        const DecodedSamplePointer pSample = pWeakSample.lock();
+        if (pSample) {
+            bytes += pSample->sizeInBytes();
+        }
+    }
+    return bytes;
+}
@@ -0,0 +1,90 @@
+#ifndef ENGINE_CACHINGREADER_DECODEDSAMPLEBANK_H
+#define ENGINE_CACHINGREADER_DECODEDSAMPLEBANK_H
+
+#include <functional>
+#include <future>
+#include <memory>
+
+#include "track/track.h"
+#include "util/indexrange.h"
+#include "util/samplebuffer.h"
+
+// The completely decoded stereo signal of a short track. The sample data
+// is immutable and can be read concurrently by multiple engine buffers.
+class DecodedSample final {
+  public:
+    DecodedSample(
+            int sampleRate,
+            mixxx::IndexRange frameIndexRange,
+            mixxx::SampleBuffer sampleBuffer);
+
+    int sampleRate() const {
+        return m_sampleRate;
+    }
+
+    // The range of decoded frames
+    mixxx::IndexRange frameIndexRange() const {
+        return m_frameIndexRange;
+    }
+
+    qint64 sizeInBytes() const {
+        return m_sampleBuffer.size() * sizeof(CSAMPLE);
+    }
+
+    // Copies the decoded frames within the given range into sampleBuffer
+    // and returns the range of frames that have been copied. Works exactly
+    // like CachingReaderChunk::readBufferedSampleFrames().
+    mixxx::IndexRange readSampleFrames(
+            CSAMPLE* sampleBuffer,
+            const mixxx::IndexRange& frameIndexRange) const;
+    mixxx::IndexRange readSampleFramesReverse(
+            CSAMPLE* reverseSampleBuffer,
+            const mixxx::IndexRange& frameIndexRange) const;
+
+  private:
+    const int m_sampleRate;
+    const mixxx::IndexRange m_frameIndexRange;
+    const mixxx::SampleBuffer m_sampleBuffer;
+};
+
+typedef std::shared_ptr<const DecodedSample> DecodedSamplePointer;
+typedef std::shared_future<DecodedSamplePointer> DecodedSampleFuture;
+
+// A process-wide bank of decoded samples that are shared between all
+// samplers. Loading the same file into multiple samplers decodes it only
+// once and all of them read from the same memory. A sample is released
+// when the last reference to it is dropped.
+//
+// All functions are thread-safe.
+class DecodedSampleBank {
+  public:
+    // Checks if the track is short enough for being decoded completely.
+    // Decoding a short sample needs less memory than the chunk cache of
+    // a CachingReader.
+    static bool isEligible(const Track& track);
+
+    // Returns the shared decoded sample of the track. The file is only
+    // decoded if no sampler currently holds it. The calling thread decodes
+    // the file unless another thread is already decoding it, i.e. the
+    // returned future is ready then. Otherwise the load does not wait and
+    // the future becomes ready when the other thread has finished. Then
+    // onDecoded is invoked by that thread unless the receiver has been
+    // cancelled in the meantime. The future is ready when onDecoded is
+    // invoked. onDecoded runs while the bank is locked and must neither
+    // block nor access the bank, e.g. it may only wake up the receiver.
+    // The result is a null pointer if the file could not be decoded.
+    static DecodedSampleFuture load(
+            const TrackPointer& pTrack,
+            const void* pReceiver = nullptr,
+            std::function<void()> onDecoded = std::function<void()>());
+
+    // Discards all pending onDecoded callbacks of the receiver. None of
+    // them is running or invoked after this function has returned.
+    static void cancel(const void* pReceiver);
+
+    // The number and total size of all samples in the bank
+    static int sampleCount();
+    static qint64 sizeInBytes();
+};
+
+#endif // ENGINE_CACHINGREADER_DECODEDSAMPLEBANK_H
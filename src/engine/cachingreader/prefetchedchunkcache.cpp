@@ -0,0 +1,156 @@
+#include "engine/cachingreader/prefetchedchunkcache.h"
+
+#include <QMutex>
+#include <QMutexLocker>
+
+#include <iterator>
+#include <list>
+
+namespace {
+
+// Enough for the chunks around the cue points of a few tracks
+const qint64 kMaxSizeInBytesDefault = 16 * 1024 * 1024;
+
+struct PrefetchedChunk {
+    QString trackKey;
+    SINT index;
+    mixxx::IndexRange frameIndexRange;
+    mixxx::SampleBuffer sampleBuffer;
+};
+
+qint64 sizeInBytesOf(const PrefetchedChunk& chunk) {
+    return chunk.sampleBuffer.size() * sizeof(CSAMPLE);
+}
+
+QMutex s_mutex;
+// Ordered from the oldest to the newest chunk
+std::list<PrefetchedChunk> s_chunks;
+qint64 s_sizeInBytes = 0;
+qint64 s_maxSizeInBytes = kMaxSizeInBytesDefault;
+
+// Requires s_mutex to be locked
+std::list<PrefetchedChunk>::iterator findChunk(
+        const QString& trackKey, SINT chunkIndex) {
+    auto it = s_chunks.begin();
+    while (it != s_chunks.end() &&
+            (it->index != chunkIndex || it->trackKey != trackKey)) {
+        ++it;
+    }
+    return it;
+}
+
+// Requires s_mutex to be locked
+void evictChunks() {
+    while (s_sizeInBytes > s_maxSizeInBytes) {
+        DEBUG_ASSERT(!s_chunks.empty());
+        s_sizeInBytes -= sizeInBytesOf(s_chunks.front());
+        s_chunks.pop_front();
+    }
+}
+
+} // anonymous namespace
+
+// static
+QString PrefetchedChunkCache::trackKey(const Track& track) {
+    QString location = track.getCanonicalLocation();
+    if (location.isEmpty()) {
+        location = track.getLocation();
+    }
+    return location + QChar('|') +
+            QString::number(track.getFileModifiedTime().toMSecsSinceEpoch());
+}
+
+// static
+void PrefetchedChunkCache::insert(
+        const QString& trackKey,
+        SINT chunkIndex,
+        mixxx::IndexRange frameIndexRange,
+        mixxx::SampleBuffer sampleBuffer) {
+    VERIFY_OR_DEBUG_ASSERT(!frameIndexRange.empty() &&
+            frameIndexRange.length() <= CachingReaderChunk::kFrames &&
+            CachingReaderChunk::frames2samples(frameIndexRange.length()) <=
+                    sampleBuffer.size()) {
+        return;
+    }
+    PrefetchedChunk chunk;
+    chunk.trackKey = trackKey;
+    chunk.index = chunkIndex;
+    chunk.frameIndexRange = frameIndexRange;
+    chunk.sampleBuffer = std::move(sampleBuffer);
+    // The chunk that is replaced is freed after unlocking
+    std::list<PrefetchedChunk> replacedChunks;
+
+    QMutexLocker locker(&s_mutex);
+    const auto it = findChunk(trackKey, chunkIndex);
+    if (it != s_chunks.end()) {
+        s_sizeInBytes -= sizeInBytesOf(*it);
+        replacedChunks.splice(replacedChunks.end(), s_chunks, it);
+    }
+    s_sizeInBytes += sizeInBytesOf(chunk);
+    s_chunks.push_back(std::move(chunk));
+    evictChunks();
+}
+
+// static
+mixxx::IndexRange PrefetchedChunkCache::take(
+        const QString& trackKey,
+        CachingReaderChunk* pChunk) {
+    DEBUG_ASSERT(pChunk);
+    if (trackKey.isEmpty()) {
+        return mixxx::IndexRange();
+    }
+    std::list<PrefetchedChunk> takenChunks;
+    {
+        QMutexLocker locker(&s_mutex);
+        const auto it = findChunk(trackKey, pChunk->getIndex());
+        if (it == s_chunks.end()) {
+            return mixxx::IndexRange();
+        }
+        s_sizeInBytes -= sizeInBytesOf(*it);
+        takenChunks.splice(takenChunks.end(), s_chunks, it);
+    }
+    // Copied without blocking other readers
+    const PrefetchedChunk& chunk = takenChunks.front();
+    return pChunk->bufferSampleFrames(
+            chunk.frameIndexRange, chunk.sampleBuffer.data());
+}
+
+// static
+bool PrefetchedChunkCache::contains(const QString& trackKey, SINT chunkIndex) {
+    QMutexLocker locker(&s_mutex);
+    return findChunk(trackKey, chunkIndex) != s_chunks.end();
+}
+
+// static
+void PrefetchedChunkCache::retainTracks(const QSet<QString>& trackKeys) {
+    std::list<PrefetchedChunk> evictedChunks;
+    QMutexLocker locker(&s_mutex);
+    auto it = s_chunks.begin();
+    while (it != s_chunks.end()) {
+        auto next = std::next(it);
+        if (!trackKeys.contains(it->trackKey)) {
+            s_sizeInBytes -= sizeInBytesOf(*it);
+            evictedChunks.splice(evictedChunks.end(), s_chunks, it);
+        }
+        it = next;
+    }
+}
+
+// static
+void PrefetchedChunkCache::setMaxSizeInBytes(qint64 maxSizeInBytes) {
+    QMutexLocker locker(&s_mutex);
+    s_maxSizeInBytes = maxSizeInBytes;
+    evictChunks();
+}
+
+// static
+int PrefetchedChunkCache::chunkCount() {
+    QMutexLocker locker(&s_mutex);
+    return static_cast<int>(s_chunks.size());
+}
+
+// static
+qint64 PrefetchedChunkCache::sizeInBytes() {
+    QMutexLocker locker(&s_mutex);
+    return s_sizeInBytes;
+}
@@ -0,0 +1,56 @@
+#ifndef ENGINE_CACHINGREADER_PREFETCHEDCHUNKCACHE_H
+#define ENGINE_CACHINGREADER_PREFETCHEDCHUNKCACHE_H
+
+#include <QSet>
+#include <QString>
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "track/track.h"
+#include "util/indexrange.h"
+#include "util/samplebuffer.h"
+
+// A process-wide cache of chunks that have been decoded before their track
+// is loaded into a deck, e.g. around the main cue point of the next Auto DJ
+// track. The CachingReader that loads the track takes these chunks instead
+// of decoding them again. Each chunk is handed over only once, afterwards
+// it is owned by the reader's own chunk cache.
+//
+// The total size of the chunks is limited. The oldest chunks are evicted
+// first if the limit is exceeded.
+//
+// All functions are thread-safe.
+class PrefetchedChunkCache {
+  public:
+    // Identifies the decoded file. Chunks of a file that has been modified
+    // afterwards don't match anymore.
+    static QString trackKey(const Track& track);
+
+    // Stores the samples of a chunk that have been read with
+    // CachingReaderChunk::bufferSampleFrames(). Replaces a chunk with the
+    // same index.
+    static void insert(
+            const QString& trackKey,
+            SINT chunkIndex,
+            mixxx::IndexRange frameIndexRange,
+            mixxx::SampleBuffer sampleBuffer);
+
+    // Moves the samples of the chunk with the same index into pChunk and
+    // returns the range of frames. Returns an empty range if the chunk is
+    // not available.
+    static mixxx::IndexRange take(
+            const QString& trackKey,
+            CachingReaderChunk* pChunk);
+
+    static bool contains(const QString& trackKey, SINT chunkIndex);
+
+    // Evicts the chunks of all other tracks
+    static void retainTracks(const QSet<QString>& trackKeys);
+
+    static void setMaxSizeInBytes(qint64 maxSizeInBytes);
+
+    // The number and total size of all chunks in the cache
+    static int chunkCount();
+    static qint64 sizeInBytes();
+};
+
+#endif // ENGINE_CACHINGREADER_PREFETCHEDCHUNKCACHE_H
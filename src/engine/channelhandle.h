@@ -183,10 +183,32 @@ class ChannelHandleMap {
         return m_data[iHandle];
     }
 
+    // Returns the value for the handle or nullptr if the map has not been
+    // expanded to the handle yet. Unlike operator[] this never modifies
+    // the container, so values of different handles can be accessed
+    // concurrently from multiple threads.
+    T* find(const ChannelHandle& handle) {
+        if (!handle.valid() || handle.handle() >= m_data.size()) {
+            return nullptr;
+        }
+        return &m_data[handle.handle()];
+    }
+
+    const T* find(const ChannelHandle& handle) const {
+        if (!handle.valid() || handle.handle() >= m_data.size()) {
+            return nullptr;
+        }
+        return &m_data[handle.handle()];
+    }
+
     void clear() {
         m_data.clear();
     }
 
+    bool isEmpty() const {
+        return m_data.isEmpty();
+    }
+
     typename container_type::iterator begin() {
         return m_data.begin();
     }
@@ -7141,8 +7141,11 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache1.m_gain = newGain[1];
         CSAMPLE* pBuffer1 = pChannel1->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
+        EngineEffectsManager::PostFaderJob jobs[2] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 2, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i];
@@ -7188,9 +7191,12 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache2.m_gain = newGain[2];
         CSAMPLE* pBuffer2 = pChannel2->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
+        EngineEffectsManager::PostFaderJob jobs[3] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 3, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i];
@@ -7248,10 +7254,13 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache3.m_gain = newGain[3];
         CSAMPLE* pBuffer3 = pChannel3->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
+        EngineEffectsManager::PostFaderJob jobs[4] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 4, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i];
@@ -7321,11 +7330,14 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache4.m_gain = newGain[4];
         CSAMPLE* pBuffer4 = pChannel4->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
+        EngineEffectsManager::PostFaderJob jobs[5] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 5, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i];
@@ -7407,12 +7419,15 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache5.m_gain = newGain[5];
         CSAMPLE* pBuffer5 = pChannel5->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
+        EngineEffectsManager::PostFaderJob jobs[6] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 6, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i];
@@ -7506,13 +7521,16 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache6.m_gain = newGain[6];
         CSAMPLE* pBuffer6 = pChannel6->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
+        EngineEffectsManager::PostFaderJob jobs[7] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 7, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i];
@@ -7618,14 +7636,17 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache7.m_gain = newGain[7];
         CSAMPLE* pBuffer7 = pChannel7->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
+        EngineEffectsManager::PostFaderJob jobs[8] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 8, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i];
@@ -7743,15 +7764,18 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache8.m_gain = newGain[8];
         CSAMPLE* pBuffer8 = pChannel8->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
+        EngineEffectsManager::PostFaderJob jobs[9] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 9, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i];
@@ -7881,16 +7905,19 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache9.m_gain = newGain[9];
         CSAMPLE* pBuffer9 = pChannel9->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
+        EngineEffectsManager::PostFaderJob jobs[10] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 10, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i];
@@ -8032,17 +8059,20 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache10.m_gain = newGain[10];
         CSAMPLE* pBuffer10 = pChannel10->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
+        EngineEffectsManager::PostFaderJob jobs[11] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 11, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i];
@@ -8196,18 +8226,21 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache11.m_gain = newGain[11];
         CSAMPLE* pBuffer11 = pChannel11->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
+        EngineEffectsManager::PostFaderJob jobs[12] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 12, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i];
@@ -8373,19 +8406,22 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache12.m_gain = newGain[12];
         CSAMPLE* pBuffer12 = pChannel12->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
+        EngineEffectsManager::PostFaderJob jobs[13] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 13, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i];
@@ -8563,20 +8599,23 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache13.m_gain = newGain[13];
         CSAMPLE* pBuffer13 = pChannel13->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
+        EngineEffectsManager::PostFaderJob jobs[14] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 14, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i];
@@ -8766,21 +8805,24 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache14.m_gain = newGain[14];
         CSAMPLE* pBuffer14 = pChannel14->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
+        EngineEffectsManager::PostFaderJob jobs[15] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 15, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i];
@@ -8982,22 +9024,25 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache15.m_gain = newGain[15];
         CSAMPLE* pBuffer15 = pChannel15->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
+        EngineEffectsManager::PostFaderJob jobs[16] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 16, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i];
@@ -9211,23 +9256,26 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache16.m_gain = newGain[16];
         CSAMPLE* pBuffer16 = pChannel16->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
+        EngineEffectsManager::PostFaderJob jobs[17] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 17, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i];
@@ -9453,24 +9501,27 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache17.m_gain = newGain[17];
         CSAMPLE* pBuffer17 = pChannel17->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
+        EngineEffectsManager::PostFaderJob jobs[18] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 18, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i];
@@ -9708,25 +9759,28 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache18.m_gain = newGain[18];
         CSAMPLE* pBuffer18 = pChannel18->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
+        EngineEffectsManager::PostFaderJob jobs[19] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 19, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i];
@@ -9976,26 +10030,29 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache19.m_gain = newGain[19];
         CSAMPLE* pBuffer19 = pChannel19->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
+        EngineEffectsManager::PostFaderJob jobs[20] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 20, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i];
@@ -10257,27 +10314,30 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache20.m_gain = newGain[20];
         CSAMPLE* pBuffer20 = pChannel20->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
+        EngineEffectsManager::PostFaderJob jobs[21] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 21, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i];
@@ -10551,28 +10611,31 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache21.m_gain = newGain[21];
         CSAMPLE* pBuffer21 = pChannel21->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
+        EngineEffectsManager::PostFaderJob jobs[22] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 22, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i];
@@ -10858,29 +10921,32 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache22.m_gain = newGain[22];
         CSAMPLE* pBuffer22 = pChannel22->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
+        EngineEffectsManager::PostFaderJob jobs[23] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 23, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i];
@@ -11178,30 +11244,33 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache23.m_gain = newGain[23];
         CSAMPLE* pBuffer23 = pChannel23->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
+        EngineEffectsManager::PostFaderJob jobs[24] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+            {&pChannel23->m_handle, pBuffer23, &pChannel23->m_features, oldGain[23], newGain[23]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 24, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i];
@@ -11511,31 +11580,34 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache24.m_gain = newGain[24];
         CSAMPLE* pBuffer24 = pChannel24->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
+        EngineEffectsManager::PostFaderJob jobs[25] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+            {&pChannel23->m_handle, pBuffer23, &pChannel23->m_features, oldGain[23], newGain[23]},
+            {&pChannel24->m_handle, pBuffer24, &pChannel24->m_features, oldGain[24], newGain[24]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 25, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i];
@@ -11857,32 +11929,35 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache25.m_gain = newGain[25];
         CSAMPLE* pBuffer25 = pChannel25->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
+        EngineEffectsManager::PostFaderJob jobs[26] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+            {&pChannel23->m_handle, pBuffer23, &pChannel23->m_features, oldGain[23], newGain[23]},
+            {&pChannel24->m_handle, pBuffer24, &pChannel24->m_features, oldGain[24], newGain[24]},
+            {&pChannel25->m_handle, pBuffer25, &pChannel25->m_features, oldGain[25], newGain[25]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 26, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i];
@@ -12216,33 +12291,36 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache26.m_gain = newGain[26];
         CSAMPLE* pBuffer26 = pChannel26->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
+        EngineEffectsManager::PostFaderJob jobs[27] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+            {&pChannel23->m_handle, pBuffer23, &pChannel23->m_features, oldGain[23], newGain[23]},
+            {&pChannel24->m_handle, pBuffer24, &pChannel24->m_features, oldGain[24], newGain[24]},
+            {&pChannel25->m_handle, pBuffer25, &pChannel25->m_features, oldGain[25], newGain[25]},
+            {&pChannel26->m_handle, pBuffer26, &pChannel26->m_features, oldGain[26], newGain[26]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 27, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i];
@@ -12588,34 +12666,37 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache27.m_gain = newGain[27];
         CSAMPLE* pBuffer27 = pChannel27->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
+        EngineEffectsManager::PostFaderJob jobs[28] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+            {&pChannel23->m_handle, pBuffer23, &pChannel23->m_features, oldGain[23], newGain[23]},
+            {&pChannel24->m_handle, pBuffer24, &pChannel24->m_features, oldGain[24], newGain[24]},
+            {&pChannel25->m_handle, pBuffer25, &pChannel25->m_features, oldGain[25], newGain[25]},
+            {&pChannel26->m_handle, pBuffer26, &pChannel26->m_features, oldGain[26], newGain[26]},
+            {&pChannel27->m_handle, pBuffer27, &pChannel27->m_features, oldGain[27], newGain[27]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 28, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i];
@@ -12973,35 +13054,38 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache28.m_gain = newGain[28];
         CSAMPLE* pBuffer28 = pChannel28->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features, oldGain[28], newGain[28]);
+        EngineEffectsManager::PostFaderJob jobs[29] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+            {&pChannel23->m_handle, pBuffer23, &pChannel23->m_features, oldGain[23], newGain[23]},
+            {&pChannel24->m_handle, pBuffer24, &pChannel24->m_features, oldGain[24], newGain[24]},
+            {&pChannel25->m_handle, pBuffer25, &pChannel25->m_features, oldGain[25], newGain[25]},
+            {&pChannel26->m_handle, pBuffer26, &pChannel26->m_features, oldGain[26], newGain[26]},
+            {&pChannel27->m_handle, pBuffer27, &pChannel27->m_features, oldGain[27], newGain[27]},
+            {&pChannel28->m_handle, pBuffer28, &pChannel28->m_features, oldGain[28], newGain[28]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 29, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i] + pBuffer28[i];
@@ -13371,36 +13455,39 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache29.m_gain = newGain[29];
         CSAMPLE* pBuffer29 = pChannel29->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features, oldGain[28], newGain[28]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel29->m_handle, outputHandle, pBuffer29, iBufferSize, iSampleRate, pChannel29->m_features, oldGain[29], newGain[29]);
+        EngineEffectsManager::PostFaderJob jobs[30] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+            {&pChannel23->m_handle, pBuffer23, &pChannel23->m_features, oldGain[23], newGain[23]},
+            {&pChannel24->m_handle, pBuffer24, &pChannel24->m_features, oldGain[24], newGain[24]},
+            {&pChannel25->m_handle, pBuffer25, &pChannel25->m_features, oldGain[25], newGain[25]},
+            {&pChannel26->m_handle, pBuffer26, &pChannel26->m_features, oldGain[26], newGain[26]},
+            {&pChannel27->m_handle, pBuffer27, &pChannel27->m_features, oldGain[27], newGain[27]},
+            {&pChannel28->m_handle, pBuffer28, &pChannel28->m_features, oldGain[28], newGain[28]},
+            {&pChannel29->m_handle, pBuffer29, &pChannel29->m_features, oldGain[29], newGain[29]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 30, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i] + pBuffer28[i] + pBuffer29[i];
@@ -13782,37 +13869,40 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache30.m_gain = newGain[30];
         CSAMPLE* pBuffer30 = pChannel30->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features, oldGain[28], newGain[28]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel29->m_handle, outputHandle, pBuffer29, iBufferSize, iSampleRate, pChannel29->m_features, oldGain[29], newGain[29]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel30->m_handle, outputHandle, pBuffer30, iBufferSize, iSampleRate, pChannel30->m_features, oldGain[30], newGain[30]);
+        EngineEffectsManager::PostFaderJob jobs[31] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+            {&pChannel23->m_handle, pBuffer23, &pChannel23->m_features, oldGain[23], newGain[23]},
+            {&pChannel24->m_handle, pBuffer24, &pChannel24->m_features, oldGain[24], newGain[24]},
+            {&pChannel25->m_handle, pBuffer25, &pChannel25->m_features, oldGain[25], newGain[25]},
+            {&pChannel26->m_handle, pBuffer26, &pChannel26->m_features, oldGain[26], newGain[26]},
+            {&pChannel27->m_handle, pBuffer27, &pChannel27->m_features, oldGain[27], newGain[27]},
+            {&pChannel28->m_handle, pBuffer28, &pChannel28->m_features, oldGain[28], newGain[28]},
+            {&pChannel29->m_handle, pBuffer29, &pChannel29->m_features, oldGain[29], newGain[29]},
+            {&pChannel30->m_handle, pBuffer30, &pChannel30->m_features, oldGain[30], newGain[30]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 31, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i] + pBuffer28[i] + pBuffer29[i] + pBuffer30[i];
@@ -14206,38 +14296,41 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(const EngineMaster::GainCal
         gainCache31.m_gain = newGain[31];
         CSAMPLE* pBuffer31 = pChannel31->m_pBuffer;
         // Process effects for each channel in place
-        pEngineEffectsManager->processPostFaderInPlace(pChannel0->m_handle, outputHandle, pBuffer0, iBufferSize, iSampleRate, pChannel0->m_features, oldGain[0], newGain[0]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel1->m_handle, outputHandle, pBuffer1, iBufferSize, iSampleRate, pChannel1->m_features, oldGain[1], newGain[1]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel2->m_handle, outputHandle, pBuffer2, iBufferSize, iSampleRate, pChannel2->m_features, oldGain[2], newGain[2]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel3->m_handle, outputHandle, pBuffer3, iBufferSize, iSampleRate, pChannel3->m_features, oldGain[3], newGain[3]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel4->m_handle, outputHandle, pBuffer4, iBufferSize, iSampleRate, pChannel4->m_features, oldGain[4], newGain[4]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel5->m_handle, outputHandle, pBuffer5, iBufferSize, iSampleRate, pChannel5->m_features, oldGain[5], newGain[5]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel6->m_handle, outputHandle, pBuffer6, iBufferSize, iSampleRate, pChannel6->m_features, oldGain[6], newGain[6]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel7->m_handle, outputHandle, pBuffer7, iBufferSize, iSampleRate, pChannel7->m_features, oldGain[7], newGain[7]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel8->m_handle, outputHandle, pBuffer8, iBufferSize, iSampleRate, pChannel8->m_features, oldGain[8], newGain[8]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel9->m_handle, outputHandle, pBuffer9, iBufferSize, iSampleRate, pChannel9->m_features, oldGain[9], newGain[9]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel10->m_handle, outputHandle, pBuffer10, iBufferSize, iSampleRate, pChannel10->m_features, oldGain[10], newGain[10]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel11->m_handle, outputHandle, pBuffer11, iBufferSize, iSampleRate, pChannel11->m_features, oldGain[11], newGain[11]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel12->m_handle, outputHandle, pBuffer12, iBufferSize, iSampleRate, pChannel12->m_features, oldGain[12], newGain[12]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel13->m_handle, outputHandle, pBuffer13, iBufferSize, iSampleRate, pChannel13->m_features, oldGain[13], newGain[13]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel14->m_handle, outputHandle, pBuffer14, iBufferSize, iSampleRate, pChannel14->m_features, oldGain[14], newGain[14]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel15->m_handle, outputHandle, pBuffer15, iBufferSize, iSampleRate, pChannel15->m_features, oldGain[15], newGain[15]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel16->m_handle, outputHandle, pBuffer16, iBufferSize, iSampleRate, pChannel16->m_features, oldGain[16], newGain[16]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel17->m_handle, outputHandle, pBuffer17, iBufferSize, iSampleRate, pChannel17->m_features, oldGain[17], newGain[17]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel18->m_handle, outputHandle, pBuffer18, iBufferSize, iSampleRate, pChannel18->m_features, oldGain[18], newGain[18]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel19->m_handle, outputHandle, pBuffer19, iBufferSize, iSampleRate, pChannel19->m_features, oldGain[19], newGain[19]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel20->m_handle, outputHandle, pBuffer20, iBufferSize, iSampleRate, pChannel20->m_features, oldGain[20], newGain[20]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel21->m_handle, outputHandle, pBuffer21, iBufferSize, iSampleRate, pChannel21->m_features, oldGain[21], newGain[21]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel22->m_handle, outputHandle, pBuffer22, iBufferSize, iSampleRate, pChannel22->m_features, oldGain[22], newGain[22]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel23->m_handle, outputHandle, pBuffer23, iBufferSize, iSampleRate, pChannel23->m_features, oldGain[23], newGain[23]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel24->m_handle, outputHandle, pBuffer24, iBufferSize, iSampleRate, pChannel24->m_features, oldGain[24], newGain[24]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel25->m_handle, outputHandle, pBuffer25, iBufferSize, iSampleRate, pChannel25->m_features, oldGain[25], newGain[25]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel26->m_handle, outputHandle, pBuffer26, iBufferSize, iSampleRate, pChannel26->m_features, oldGain[26], newGain[26]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel27->m_handle, outputHandle, pBuffer27, iBufferSize, iSampleRate, pChannel27->m_features, oldGain[27], newGain[27]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel28->m_handle, outputHandle, pBuffer28, iBufferSize, iSampleRate, pChannel28->m_features, oldGain[28], newGain[28]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel29->m_handle, outputHandle, pBuffer29, iBufferSize, iSampleRate, pChannel29->m_features, oldGain[29], newGain[29]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel30->m_handle, outputHandle, pBuffer30, iBufferSize, iSampleRate, pChannel30->m_features, oldGain[30], newGain[30]);
-        pEngineEffectsManager->processPostFaderInPlace(pChannel31->m_handle, outputHandle, pBuffer31, iBufferSize, iSampleRate, pChannel31->m_features, oldGain[31], newGain[31]);
+        EngineEffectsManager::PostFaderJob jobs[32] = {
+            {&pChannel0->m_handle, pBuffer0, &pChannel0->m_features, oldGain[0], newGain[0]},
+            {&pChannel1->m_handle, pBuffer1, &pChannel1->m_features, oldGain[1], newGain[1]},
+            {&pChannel2->m_handle, pBuffer2, &pChannel2->m_features, oldGain[2], newGain[2]},
+            {&pChannel3->m_handle, pBuffer3, &pChannel3->m_features, oldGain[3], newGain[3]},
+            {&pChannel4->m_handle, pBuffer4, &pChannel4->m_features, oldGain[4], newGain[4]},
+            {&pChannel5->m_handle, pBuffer5, &pChannel5->m_features, oldGain[5], newGain[5]},
+            {&pChannel6->m_handle, pBuffer6, &pChannel6->m_features, oldGain[6], newGain[6]},
+            {&pChannel7->m_handle, pBuffer7, &pChannel7->m_features, oldGain[7], newGain[7]},
+            {&pChannel8->m_handle, pBuffer8, &pChannel8->m_features, oldGain[8], newGain[8]},
+            {&pChannel9->m_handle, pBuffer9, &pChannel9->m_features, oldGain[9], newGain[9]},
+            {&pChannel10->m_handle, pBuffer10, &pChannel10->m_features, oldGain[10], newGain[10]},
+            {&pChannel11->m_handle, pBuffer11, &pChannel11->m_features, oldGain[11], newGain[11]},
+            {&pChannel12->m_handle, pBuffer12, &pChannel12->m_features, oldGain[12], newGain[12]},
+            {&pChannel13->m_handle, pBuffer13, &pChannel13->m_features, oldGain[13], newGain[13]},
+            {&pChannel14->m_handle, pBuffer14, &pChannel14->m_features, oldGain[14], newGain[14]},
+            {&pChannel15->m_handle, pBuffer15, &pChannel15->m_features, oldGain[15], newGain[15]},
+            {&pChannel16->m_handle, pBuffer16, &pChannel16->m_features, oldGain[16], newGain[16]},
+            {&pChannel17->m_handle, pBuffer17, &pChannel17->m_features, oldGain[17], newGain[17]},
+            {&pChannel18->m_handle, pBuffer18, &pChannel18->m_features, oldGain[18], newGain[18]},
+            {&pChannel19->m_handle, pBuffer19, &pChannel19->m_features, oldGain[19], newGain[19]},
+            {&pChannel20->m_handle, pBuffer20, &pChannel20->m_features, oldGain[20], newGain[20]},
+            {&pChannel21->m_handle, pBuffer21, &pChannel21->m_features, oldGain[21], newGain[21]},
+            {&pChannel22->m_handle, pBuffer22, &pChannel22->m_features, oldGain[22], newGain[22]},
+            {&pChannel23->m_handle, pBuffer23, &pChannel23->m_features, oldGain[23], newGain[23]},
+            {&pChannel24->m_handle, pBuffer24, &pChannel24->m_features, oldGain[24], newGain[24]},
+            {&pChannel25->m_handle, pBuffer25, &pChannel25->m_features, oldGain[25], newGain[25]},
+            {&pChannel26->m_handle, pBuffer26, &pChannel26->m_features, oldGain[26], newGain[26]},
+            {&pChannel27->m_handle, pBuffer27, &pChannel27->m_features, oldGain[27], newGain[27]},
+            {&pChannel28->m_handle, pBuffer28, &pChannel28->m_features, oldGain[28], newGain[28]},
+            {&pChannel29->m_handle, pBuffer29, &pChannel29->m_features, oldGain[29], newGain[29]},
+            {&pChannel30->m_handle, pBuffer30, &pChannel30->m_features, oldGain[30], newGain[30]},
+            {&pChannel31->m_handle, pBuffer31, &pChannel31->m_features, oldGain[31], newGain[31]},
+        };
+        pEngineEffectsManager->processPostFaderInPlace(outputHandle, jobs, 32, iBufferSize, iSampleRate);
         // Mix the effected channel buffers together to replace the old pOutput from the last engine callback
         for (unsigned int i = 0; i < iBufferSize; ++i) {
             pOutput[i] = pBuffer0[i] + pBuffer1[i] + pBuffer2[i] + pBuffer3[i] + pBuffer4[i] + pBuffer5[i] + pBuffer6[i] + pBuffer7[i] + pBuffer8[i] + pBuffer9[i] + pBuffer10[i] + pBuffer11[i] + pBuffer12[i] + pBuffer13[i] + pBuffer14[i] + pBuffer15[i] + pBuffer16[i] + pBuffer17[i] + pBuffer18[i] + pBuffer19[i] + pBuffer20[i] + pBuffer21[i] + pBuffer22[i] + pBuffer23[i] + pBuffer24[i] + pBuffer25[i] + pBuffer26[i] + pBuffer27[i] + pBuffer28[i] + pBuffer29[i] + pBuffer30[i] + pBuffer31[i];
@@ -7,6 +7,7 @@
 #include "engine/enginebuffer.h"
 #include "engine/controls/cuecontrol.h"
 
+#include "control/controlnotifier.h"
 #include "control/controlobject.h"
 #include "control/controlpushbutton.h"
 #include "control/controlindicator.h"
@@ -202,6 +203,11 @@ CueControl::CueControl(QString group,
 
     m_pVinylControlEnabled = new ControlProxy(group, "vinylcontrol_enabled");
     m_pVinylControlMode = new ControlProxy(group, "vinylcontrol_mode");
+
+    m_pGuiTick50ms = new ControlProxy("[Master]", "guiTick50ms");
+    m_pGuiTick50ms->connectValueChanged(this, &CueControl::slotGuiTick50ms);
+
+    publishHotcueTable();
 }
 
 CueControl::~CueControl() {
@@ -242,6 +248,7 @@ CueControl::~CueControl() {
     delete m_pOutroEndActivate;
     delete m_pVinylControlEnabled;
     delete m_pVinylControlMode;
+    delete m_pGuiTick50ms;
     qDeleteAll(m_hotcueControls);
 }
 
@@ -308,6 +315,8 @@ void CueControl::detachCue(int hotCue) {
 
 void CueControl::trackLoaded(TrackPointer pNewTrack) {
     QMutexLocker lock(&m_mutex);
+    // Pending edits belong to the previous track
+    processCueEdits();
     if (m_pLoadedTrack) {
         disconnect(m_pLoadedTrack.get(), 0, this, 0);
         for (int i = 0; i < m_iNumHotCues; ++i) {
@@ -325,6 +334,7 @@ void CueControl::trackLoaded(TrackPointer pNewTrack) {
         m_pOutroEndPosition->set(-1.0);
         m_pOutroEndEnabled->forceSet(0.0);
         m_pLoadedTrack.reset();
+        publishHotcueTable();
     }
 
     if (!pNewTrack) {
@@ -472,6 +482,8 @@ void CueControl::loadCuesFromTrack() {
             detachCue(i);
         }
     }
+
+    publishHotcueTable();
 }
 
 void CueControl::reloadCuesFromTrack() {
@@ -515,6 +527,72 @@ void CueControl::trackBeatsUpdated() {
     reloadCuesFromTrack();
 }
 
+void CueControl::slotGuiTick50ms(double v) {
+    Q_UNUSED(v);
+    processCueEdits();
+}
+
+void CueControl::processCueEdits() {
+    QMutexLocker lock(&m_mutex);
+    CueEdit edit;
+    while (m_cueEdits.dequeue(&edit)) {
+        applyCueEdit(edit);
+    }
+}
+
+void CueControl::applyCueEdit(const CueEdit& edit) {
+    if (!m_pLoadedTrack) {
+        return;
+    }
+    switch (edit.type) {
+    case CueEdit::Type::SetMainCue:
+        m_pLoadedTrack->setCuePoint(CuePosition(edit.position, Cue::MANUAL));
+        break;
+    case CueEdit::Type::SetHotcue: {
+        HotcueControl* pControl = m_hotcueControls.value(edit.hotcue, nullptr);
+        if (pControl) {
+            setHotcue(pControl, edit.position);
+        }
+        break;
+    }
+    }
+}
+
+void CueControl::postCueEdit(CueEdit::Type type, int hotcue, double position) {
+    CueEdit edit;
+    edit.type = type;
+    edit.hotcue = hotcue;
+    edit.position = position;
+    if (!m_cueEdits.enqueue(edit)) {
+        qWarning() << "CueControl: Dropping cue edit, too many pending edits";
+    }
+}
+
+void CueControl::publishHotcueTable() {
+    HotcueTable table;
+    table.trackLoaded = m_pLoadedTrack != nullptr;
+    for (int i = 0; i < NUM_HOT_CUES; ++i) {
+        HotcueControl* pControl = m_hotcueControls.value(i, nullptr);
+        table.positions[i] = (table.trackLoaded && pControl) ?
+                pControl->getPosition() : -1.0;
+    }
+    m_hotcueTable.setValue(table);
+}
+
+double CueControl::getHotcuePosition(HotcueControl* pControl) const {
+    const HotcueTable table = m_hotcueTable.getValue();
+    if (!table.trackLoaded) {
+        return -1.0;
+    }
+    return table.positions[pControl->getHotcueNumber()];
+}
+
+double CueControl::getCueSetPosition() const {
+    double closestBeat = m_pClosestBeat->get();
+    return (m_pQuantizeEnabled->toBool() && closestBeat != -1) ?
+            closestBeat : getSampleOfTrack().current;
+}
+
 void CueControl::quantizeChanged(double v) {
     Q_UNUSED(v);
 
@@ -531,56 +609,46 @@ void CueControl::hotcueSet(HotcueControl* pControl, double v) {
     if (!m_pLoadedTrack)
         return;
 
+    double cuePosition = getCueSetPosition();
+    setHotcue(pControl, cuePosition);
+
+    // If quantize is enabled and we are not playing, jump to the cue point
+    // since it's not necessarily where we currently are. TODO(XXX) is this
+    // potentially invalid for vinyl control?
+    bool playing = m_pPlay->toBool();
+    if (!playing && m_pQuantizeEnabled->toBool()) {
+        lock.unlock();  // prevent deadlock.
+        // Enginebuffer will quantize more exactly than we can.
+        seekAbs(cuePosition);
+    }
+}
+
+void CueControl::setHotcue(HotcueControl* pControl, double position) {
     int hotcue = pControl->getHotcueNumber();
     // Note: the cue is just detached from the hotcue control
     // It remains in the database for later use
     // TODO: find a rule, that allows us to delete the cue as well
     // https://bugs.launchpad.net/mixxx/+bug/1653276
-    hotcueClear(pControl, v);
+    hotcueClear(pControl, 1.0);
 
     CuePointer pCue(m_pLoadedTrack->createAndAddCue());
-    double closestBeat = m_pClosestBeat->get();
-    double cuePosition =
-            (m_pQuantizeEnabled->toBool() && closestBeat != -1) ?
-                    closestBeat : getSampleOfTrack().current;
-    pCue->setPosition(cuePosition);
+    pCue->setPosition(position);
     pCue->setHotCue(hotcue);
     pCue->setLabel("");
     pCue->setType(Cue::CUE);
     pCue->setSource(Cue::MANUAL);
     // TODO(XXX) deal with spurious signals
     attachCue(pCue, hotcue);
-
-    // If quantize is enabled and we are not playing, jump to the cue point
-    // since it's not necessarily where we currently are. TODO(XXX) is this
-    // potentially invalid for vinyl control?
-    bool playing = m_pPlay->toBool();
-    if (!playing && m_pQuantizeEnabled->toBool()) {
-        lock.unlock();  // prevent deadlock.
-        // Enginebuffer will quantize more exactly than we can.
-        seekAbs(cuePosition);
-    }
+    publishHotcueTable();
 }
 
 void CueControl::hotcueGoto(HotcueControl* pControl, double v) {
     if (!v)
         return;
 
-    QMutexLocker lock(&m_mutex);
-    if (!m_pLoadedTrack) {
-        return;
-    }
-
-    CuePointer pCue(pControl->getCue());
-
-    // Need to unlock before emitting any signals to prevent deadlock.
-    lock.unlock();
-
-    if (pCue) {
-        int position = pCue->getPosition();
-        if (position != -1) {
-            seekAbs(position);
-        }
+    int position = getHotcuePosition(pControl);
+    if (position != -1) {
+        seekAbs(position);
     }
 }
 
@@ -588,21 +656,10 @@ void CueControl::hotcueGotoAndStop(HotcueControl* pControl, double v) {
     if (!v)
         return;
 
-    QMutexLocker lock(&m_mutex);
-    if (!m_pLoadedTrack)
-        return;
-
-    CuePointer pCue(pControl->getCue());
-
-    // Need to unlock before emitting any signals to prevent deadlock.
-    lock.unlock();
-
-    if (pCue) {
-        int position = pCue->getPosition();
-        if (position != -1) {
-            m_pPlay->set(0.0);
-            seekExact(position);
-        }
+    int position = getHotcuePosition(pControl);
+    if (position != -1) {
+        m_pPlay->set(0.0);
+        seekExact(position);
     }
 }
 
@@ -610,29 +667,17 @@ void CueControl::hotcueGotoAndPlay(HotcueControl* pControl, double v) {
     if (!v)
         return;
 
-    QMutexLocker lock(&m_mutex);
-    if (!m_pLoadedTrack) {
-        return;
-    }
-
-    CuePointer pCue(pControl->getCue());
-
-    // Need to unlock before emitting any signals to prevent deadlock.
-    lock.unlock();
-
-    if (pCue) {
-        int position = pCue->getPosition();
-        if (position != -1) {
-            seekAbs(position);
-            if (!isPlayingByPlayButton()) {
-                // cueGoto is processed asynchrony.
-                // avoid a wrong cue set if seek by cueGoto is still pending
-                m_bPreviewing = false;
-                m_iCurrentlyPreviewingHotcues = 0;
-                // don't move the cue point to the hot cue point in DENON mode
-                m_bypassCueSetByPlay = true;
-                m_pPlay->set(1.0);
-            }
+    int position = getHotcuePosition(pControl);
+    if (position != -1) {
+        seekAbs(position);
+        if (!isPlayingByPlayButton()) {
+            // cueGoto is processed asynchrony.
+            // avoid a wrong cue set if seek by cueGoto is still pending
+            m_bPreviewing = false;
+            m_iCurrentlyPreviewingHotcues = 0;
+            // don't move the cue point to the hot cue point in DENON mode
+            m_bypassCueSetByPlay = true;
+            m_pPlay->set(1.0);
         }
     }
 }
@@ -640,36 +685,37 @@ void CueControl::hotcueGotoAndPlay(HotcueControl* pControl, double v) {
 void CueControl::hotcueActivate(HotcueControl* pControl, double v) {
     //qDebug() << "CueControl::hotcueActivate" << v;
 
-    QMutexLocker lock(&m_mutex);
-
-    if (!m_pLoadedTrack) {
+    const HotcueTable table = m_hotcueTable.getValue();
+    if (!table.trackLoaded) {
         return;
     }
 
-    CuePointer pCue(pControl->getCue());
-
-    lock.unlock();
-
-    if (pCue) {
+    if (table.positions[pControl->getHotcueNumber()] != -1) {
         if (v) {
-            if (pCue->getPosition() == -1) {
-                hotcueSet(pControl, v);
+            if (isPlayingByPlayButton()) {
+                hotcueGoto(pControl, v);
             } else {
-                if (isPlayingByPlayButton()) {
-                    hotcueGoto(pControl, v);
-                } else {
-                    hotcueActivatePreview(pControl, v);
-                }
-            }
-        } else {
-            if (pCue->getPosition() != -1) {
                 hotcueActivatePreview(pControl, v);
             }
+        } else {
+            hotcueActivatePreview(pControl, v);
         }
     } else {
         if (v) {
-            // just in case
-            hotcueSet(pControl, v);
+            if (ControlNotifier::isEngineThread()) {
+                // The engine must not block on m_mutex. The cue is created
+                // by the thread that owns the track, but the position is
+                // captured now.
+                const double cuePosition = getCueSetPosition();
+                postCueEdit(CueEdit::Type::SetHotcue,
+                        pControl->getHotcueNumber(), cuePosition);
+                if (!m_pPlay->toBool() && m_pQuantizeEnabled->toBool()) {
+                    // Enginebuffer will quantize more exactly than we can.
+                    seekAbs(cuePosition);
+                }
+            } else {
+                hotcueSet(pControl, v);
+            }
         } else if (m_iCurrentlyPreviewingHotcues) {
             // The cue is non-existent, yet we got a release for it and are
             // currently previewing a hotcue. This is indicative of a corner
@@ -681,24 +727,14 @@ void CueControl::hotcueActivate(HotcueControl* pControl, double v) {
 }
 
 void CueControl::hotcueActivatePreview(HotcueControl* pControl, double v) {
-    QMutexLocker lock(&m_mutex);
-    if (!m_pLoadedTrack) {
-        return;
-    }
-    CuePointer pCue(pControl->getCue());
-
     if (v) {
-        if (pCue && pCue->getPosition() != -1) {
+        double position = getHotcuePosition(pControl);
+        if (position != -1) {
             m_iCurrentlyPreviewingHotcues++;
-            double position = pCue->getPosition();
             m_bypassCueSetByPlay = true;
             m_pPlay->set(1.0);
             pControl->setPreviewing(true);
             pControl->setPreviewingPosition(position);
-
-            // Need to unlock before emitting any signals to prevent deadlock.
-            lock.unlock();
-
             seekAbs(position);
         }
     } else if (m_iCurrentlyPreviewingHotcues) {
@@ -713,8 +749,6 @@ void CueControl::hotcueActivatePreview(HotcueControl* pControl, double v) {
             // If this is the last hotcue to leave preview.
             if (--m_iCurrentlyPreviewingHotcues == 0 && !m_bPreviewing) {
                 m_pPlay->set(0.0);
-                // Need to unlock before emitting any signals to prevent deadlock.
-                lock.unlock();
                 seekExact(position);
             }
         }
@@ -733,6 +767,7 @@ void CueControl::hotcueClear(HotcueControl* pControl, double v) {
     CuePointer pCue(pControl->getCue());
     detachCue(pControl->getHotcueNumber());
     m_pLoadedTrack->removeCue(pCue);
+    publishHotcueTable();
 }
 
 void CueControl::hotcuePositionChanged(HotcueControl* pControl, double newPosition) {
@@ -750,6 +785,7 @@ void CueControl::hotcuePositionChanged(HotcueControl* pControl, double newPositi
             pCue->setPosition(newPosition);
         }
     }
+    publishHotcueTable();
 }
 
 void CueControl::hintReader(HintVector* pHintList) {
@@ -763,10 +799,13 @@ void CueControl::hintReader(HintVector* pHintList) {
     }
 
     // this is called from the engine thread
-    // it is no locking required, because m_hotcueControl is filled during the
-    // constructor and getPosition()->get() is a ControlObject
-    for (const auto& pControl: m_hotcueControls) {
-        double position = pControl->getPosition();
+    // it is no locking required, because the hotcue table is published
+    // atomically
+    const HotcueTable table = m_hotcueTable.getValue();
+    if (!table.trackLoaded) {
+        return;
+    }
+    for (double position : table.positions) {
         if (position != -1) {
             cue_hint.frame = SampleUtil::floorPlayPosToFrame(position);
             cue_hint.frameCount = Hint::kFrameCountForward;
@@ -783,9 +822,7 @@ void CueControl::cueSet(double v) {
         return;
 
     QMutexLocker lock(&m_mutex);
-    double closestBeat = m_pClosestBeat->get();
-    double cue = (m_pQuantizeEnabled->toBool() && closestBeat != -1) ?
-            closestBeat : getSampleOfTrack().current;
+    double cue = getCueSetPosition();
     m_pCuePoint->set(cue);
     TrackPointer pLoadedTrack = m_pLoadedTrack;
     lock.unlock();
@@ -816,13 +853,8 @@ void CueControl::cueGoto(double v)
     if (!v)
         return;
 
-    QMutexLocker lock(&m_mutex);
     // Seek to cue point
     double cuePoint = m_pCuePoint->get();
-
-    // Need to unlock before emitting any signals to prevent deadlock.
-    lock.unlock();
-
     seekAbs(cuePoint);
 }
 
@@ -830,7 +862,6 @@ void CueControl::cueGotoAndPlay(double v)
 {
     if (!v) return;
     cueGoto(v);
-    QMutexLocker lock(&m_mutex);
     // Start playing if not already
     if (!isPlayingByPlayButton()) {
         // cueGoto is processed asynchrony.
@@ -847,20 +878,13 @@ void CueControl::cueGotoAndStop(double v)
     if (!v)
         return;
 
-    QMutexLocker lock(&m_mutex);
     m_pPlay->set(0.0);
     double cuePoint = m_pCuePoint->get();
-
-    // Need to unlock before emitting any signals to prevent deadlock.
-    lock.unlock();
-
     seekExact(cuePoint);
 }
 
 void CueControl::cuePreview(double v)
 {
-    QMutexLocker lock(&m_mutex);
-
     if (v) {
         m_bPreviewing = true;
         m_bypassCueSetByPlay = true;
@@ -876,9 +900,6 @@ void CueControl::cuePreview(double v)
         return;
     }
 
-    // Need to unlock before emitting any signals to prevent deadlock.
-    lock.unlock();
-
     seekAbs(m_pCuePoint->get());
 }
 
@@ -956,7 +977,6 @@ void CueControl::cueDenon(double v) {
     // If pressed while stopped and at cue, play while pressed.
     // Cue Point is moved by play from pause
 
-    QMutexLocker lock(&m_mutex);
     bool playing = (m_pPlay->toBool());
     TrackAt trackAt = getTrackAt();
 
@@ -965,7 +985,6 @@ void CueControl::cueDenon(double v) {
             // we are already previewing by hotcues
             // just jump to cue point and continue previewing
             m_bPreviewing = true;
-            lock.unlock();
             seekAbs(m_pCuePoint->get());
         } else if (!playing && trackAt == TrackAt::Cue) {
             // pause at cue point
@@ -975,20 +994,12 @@ void CueControl::cueDenon(double v) {
             // Just in case.
             m_bPreviewing = false;
             m_pPlay->set(0.0);
-
-            // Need to unlock before emitting any signals to prevent deadlock.
-            lock.unlock();
-
             seekAbs(m_pCuePoint->get());
         }
     } else if (m_bPreviewing) {
         m_bPreviewing = false;
         if (!m_iCurrentlyPreviewingHotcues) {
             m_pPlay->set(0.0);
-
-            // Need to unlock before emitting any signals to prevent deadlock.
-            lock.unlock();
-
             seekAbs(m_pCuePoint->get());
         }
     }
@@ -1052,7 +1063,6 @@ void CueControl::cueDefault(double v) {
 }
 
 void CueControl::pause(double v) {
-    QMutexLocker lock(&m_mutex);
     //qDebug() << "CueControl::pause()" << v;
     if (v != 0.0) {
         m_pPlay->set(0.0);
@@ -1060,7 +1070,6 @@ void CueControl::pause(double v) {
 }
 
 void CueControl::playStutter(double v) {
-    QMutexLocker lock(&m_mutex);
     //qDebug() << "playStutter" << v;
     if (v != 0.0) {
         if (isPlayingByPlayButton()) {
@@ -1400,15 +1409,19 @@ void CueControl::outroEndActivate(double v) {
 bool CueControl::updateIndicatorsAndModifyPlay(bool newPlay, bool playPossible) {
     //qDebug() << "updateIndicatorsAndModifyPlay" << newPlay << playPossible
     //        << m_iCurrentlyPreviewingHotcues << m_bPreviewing;
-    QMutexLocker lock(&m_mutex);
+    // This is called from the engine thread and must not block. The track
+    // is only modified by the thread that owns it.
     double cueMode = m_pCueMode->get();
     if ((cueMode == CUE_MODE_DENON || cueMode == CUE_MODE_NUMARK) &&
         newPlay && playPossible &&
         !m_pPlay->toBool() &&
-        !m_bypassCueSetByPlay) {
+        !m_bypassCueSetByPlay &&
+        m_hotcueTable.getValue().trackLoaded) {
         // in Denon mode each play from pause moves the cue point
         // if not previewing
-        cueSet(1.0);
+        double cue = getCueSetPosition();
+        m_pCuePoint->set(cue);
+        postCueEdit(CueEdit::Type::SetMainCue, -1, cue);
     }
     m_bypassCueSetByPlay = false;
 
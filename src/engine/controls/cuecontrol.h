@@ -7,10 +7,14 @@
 #include <QList>
 #include <QMutex>
 
+#include <atomic>
+
 #include "engine/controls/enginecontrol.h"
 #include "preferences/usersettings.h"
 #include "control/controlproxy.h"
+#include "control/controlvalue.h"
 #include "track/track.h"
+#include "util/mpscfifo.h"
 
 #define NUM_HOT_CUES 37
 
@@ -111,6 +115,15 @@ class HotcueControl : public QObject {
     double m_previewingPosition;
 };
 
+// The hotcues of the loaded track as seen by the engine. The table is
+// published as a whole by the thread that edits the cues and read by the
+// engine without locking.
+struct HotcueTable {
+    bool trackLoaded;
+    // -1 for hotcues that are not set
+    double positions[NUM_HOT_CUES];
+};
+
 class CueControl : public EngineControl {
     Q_OBJECT
   public:
@@ -130,8 +143,13 @@ class CueControl : public EngineControl {
     void trackLoaded(TrackPointer pNewTrack) override;
     SeekOnLoadMode getSeekOnLoadMode();
 
+    // Applies the cue edits that have been requested by threads that must
+    // not block, e.g. the engine. Called periodically from the GUI thread.
+    void processCueEdits();
+
   private slots:
     void quantizeChanged(double v);
+    void slotGuiTick50ms(double v);
 
     void cueUpdated();
     void trackCuesUpdated();
@@ -184,25 +202,47 @@ class CueControl : public EngineControl {
         ElseWhere
     };
 
+    // POD for passing through m_cueEdits
+    struct CueEdit {
+        enum class Type {
+            SetMainCue,
+            SetHotcue,
+        };
+        Type type;
+        int hotcue;
+        double position;
+    };
+
     // These methods are not thread safe, only call them when the lock is held.
     void createControls();
     void attachCue(CuePointer pCue, int hotcueNumber);
     void detachCue(int hotcueNumber);
     void loadCuesFromTrack();
     void reloadCuesFromTrack();
+    void setHotcue(HotcueControl* pControl, double position);
+    void publishHotcueTable();
+    void applyCueEdit(const CueEdit& edit);
+
     double quantizeCuePoint(double position, Cue::CueSource source, QuantizeMode mode);
     double quantizeCurrentPosition(QuantizeMode mode);
     TrackAt getTrackAt() const;
 
-    bool m_bPreviewing;
+    // These methods never block and can be called from the engine.
+    void postCueEdit(CueEdit::Type type, int hotcue, double position);
+    double getHotcuePosition(HotcueControl* pControl) const;
+    double getCueSetPosition() const;
+
+    // The preview state is shared with the engine and not protected by
+    // m_mutex.
+    std::atomic<bool> m_bPreviewing;
     ControlObject* m_pPlay;
     ControlObject* m_pStopButton;
-    int m_iCurrentlyPreviewingHotcues;
+    std::atomic<int> m_iCurrentlyPreviewingHotcues;
     ControlObject* m_pQuantizeEnabled;
     ControlObject* m_pPrevBeat;
     ControlObject* m_pNextBeat;
     ControlObject* m_pClosestBeat;
-    bool m_bypassCueSetByPlay;
+    std::atomic<bool> m_bypassCueSetByPlay;
 
     const int m_iNumHotCues;
     QList<HotcueControl*> m_hotcueControls;
@@ -250,12 +290,17 @@ class CueControl : public EngineControl {
 
     ControlProxy* m_pVinylControlEnabled;
     ControlProxy* m_pVinylControlMode;
+    ControlProxy* m_pGuiTick50ms;
+
+    ControlValueAtomic<HotcueTable> m_hotcueTable;
+    MpscFifo<CueEdit, 64> m_cueEdits;
 
     TrackPointer m_pLoadedTrack; // is written from an engine worker thread
 
     // Tells us which controls map to which hotcue
     QMap<QObject*, int> m_controlMap;
 
+    // Protects the loaded track and its cues. Never locked by the engine.
     QMutex m_mutex;
 };
 
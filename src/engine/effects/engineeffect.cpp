@@ -10,7 +10,8 @@ EngineEffect::EngineEffect(EffectManifestPointer pManifest,
                            EffectInstantiatorPointer pInstantiator)
         : m_pManifest(pManifest),
           m_parameters(pManifest->parameters().size()),
-          m_pEffectsManager(pEffectsManager) {
+          m_pEffectsManager(pEffectsManager),
+          m_pStatePool(pEffectsManager->getEffectStatePool(pManifest->id())) {
     const QList<EffectManifestParameterPointer>& parameters = m_pManifest->parameters();
     for (int i = 0; i < parameters.size(); ++i) {
         EffectManifestParameterPointer param = parameters.at(i);
@@ -54,12 +55,25 @@ EngineEffect::~EngineEffect() {
 }
 
 EffectState* EngineEffect::createState(const mixxx::EngineParameters& bufferParameters) {
+    // All states are created with the same parameters, so a state that
+    // has been released by another effect of the manifest can be reused.
+    EffectState* pState = m_pStatePool->acquire();
+    if (pState) {
+        return pState;
+    }
     if (!m_pProcessor) {
         return new EffectState(bufferParameters);
     }
     return m_pProcessor->createState(bufferParameters);
 }
 
+size_t EngineEffect::stateSize() const {
+    if (!m_pProcessor) {
+        return sizeof(EffectState);
+    }
+    return m_pProcessor->stateSize();
+}
+
 void EngineEffect::loadStatesForInputChannel(const ChannelHandle* inputChannel,
     EffectStatesMap* pStatesMap) {
     if (kEffectDebugOutput) {
@@ -71,7 +85,7 @@ void EngineEffect::loadStatesForInputChannel(const ChannelHandle* inputChannel,
 
 // Called from the main thread for garbage collection after an input channel is disabled
 void EngineEffect::deleteStatesForInputChannel(const ChannelHandle* inputChannel) {
-    m_pProcessor->deleteStatesForInputChannel(inputChannel);
+    m_pProcessor->deleteStatesForInputChannel(inputChannel, m_pStatePool);
 }
 
 bool EngineEffect::processEffectsRequest(EffectsRequest& message,
@@ -130,6 +144,16 @@ bool EngineEffect::processEffectsRequest(EffectsRequest& message,
             }
             pResponsePipe->writeMessages(&response, 1);
             return true;
+        case EffectsRequest::LOAD_EFFECT_STATES_FOR_INPUT_CHANNEL:
+            if (kEffectDebugOutput) {
+                qDebug() << debugString() << "LOAD_EFFECT_STATES_FOR_INPUT_CHANNEL"
+                         << *message.LoadEffectStatesForInputChannel.pChannelHandle;
+            }
+            response.success = m_pProcessor->loadStatesForInputChannel(
+                    message.LoadEffectStatesForInputChannel.pChannelHandle,
+                    message.LoadEffectStatesForInputChannel.pEffectStatesMap);
+            pResponsePipe->writeMessages(&response, 1);
+            return true;
         default:
             break;
     }
@@ -159,8 +183,19 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
     // enabling/disabling signal. For example, the Echo effect clears its
     // internal buffer for the channel when it gets the intermediate disabling signal.
 
-    EffectEnableState effectiveEffectEnableState =
-        m_effectEnableStateForChannelMatrix[inputHandle][outputHandle];
+    // Different input channels may be processed concurrently, so the
+    // matrix must not be expanded here
+    EffectEnableState* pEffectOnChannelState = nullptr;
+    const auto pOutputMap = m_effectEnableStateForChannelMatrix.find(inputHandle);
+    if (pOutputMap) {
+        pEffectOnChannelState = pOutputMap->find(outputHandle);
+    }
+    if (!pEffectOnChannelState) {
+        // Not registered when this effect has been created
+        return false;
+    }
+
+    EffectEnableState effectiveEffectEnableState = *pEffectOnChannelState;
 
     // If the EngineEffect is fully disabled, do not let
     // intermediate enabling/disabing signals from the chain override
@@ -222,7 +257,7 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
 
     // Now that the EffectProcessor has been sent the intermediate enabling/disabling
     // signal, set the channel state to fully enabled/disabled for the next engine callback.
-    EffectEnableState& effectOnChannelState = m_effectEnableStateForChannelMatrix[inputHandle][outputHandle];
+    EffectEnableState& effectOnChannelState = *pEffectOnChannelState;
     if (effectOnChannelState == EffectEnableState::Disabling) {
         effectOnChannelState = EffectEnableState::Disabled;
     } else if (effectOnChannelState == EffectEnableState::Enabling) {
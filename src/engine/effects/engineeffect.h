@@ -34,6 +34,7 @@ class EngineEffect : public EffectsRequestHandler {
     }
 
     EffectState* createState(const mixxx::EngineParameters& bufferParameters);
+    size_t stateSize() const;
 
     void loadStatesForInputChannel(const ChannelHandle* inputChannel,
       EffectStatesMap* pStatesMap);
@@ -50,6 +51,10 @@ class EngineEffect : public EffectsRequestHandler {
                  const EffectEnableState chainEnableState,
                  const GroupFeatureState& groupFeatures);
 
+    bool supportsConcurrentProcessing() const {
+        return m_pProcessor->supportsConcurrentProcessing();
+    }
+
     const EffectManifestPointer getManifest() const {
         return m_pManifest;
     }
@@ -61,6 +66,9 @@ class EngineEffect : public EffectsRequestHandler {
 
     EffectManifestPointer m_pManifest;
     EffectProcessor* m_pProcessor;
+    // Sized for all registered channels on construction in the main thread
+    // and never expanded afterwards, because the channels are processed
+    // concurrently.
     ChannelHandleMap<ChannelHandleMap<EffectEnableState>> m_effectEnableStateForChannelMatrix;
     bool m_effectRampsFromDry;
     // Must not be modified after construction.
@@ -68,6 +76,8 @@ class EngineEffect : public EffectsRequestHandler {
     QMap<QString, EngineEffectParameter*> m_parametersById;
 
     const EffectsManager* m_pEffectsManager;
+    // Owned by EffectsManager and shared with all effects of the manifest
+    EffectStatePool* const m_pStatePool;
 
     DISALLOW_COPY_AND_ASSIGN(EngineEffect);
 };
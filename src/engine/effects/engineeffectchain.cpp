@@ -3,16 +3,16 @@
 #include "engine/effects/engineeffect.h"
 #include "util/defs.h"
 #include "util/sample.h"
+#include "util/timer.h"
 
 EngineEffectChain::EngineEffectChain(const QString& id,
                                      const QSet<ChannelHandleAndGroup>& registeredInputChannels,
                                      const QSet<ChannelHandleAndGroup>& registeredOutputChannels)
         : m_id(id),
+          m_processTimerKey(QString("EngineEffectChain::process %1").arg(id)),
           m_enableState(EffectEnableState::Enabled),
           m_mixMode(EffectChainMixMode::DrySlashWet),
-          m_dMix(0),
-          m_buffer1(MAX_BUFFER_LEN),
-          m_buffer2(MAX_BUFFER_LEN) {
+          m_dMix(0) {
     // Try to prevent memory allocation.
     m_effects.reserve(256);
 
@@ -150,8 +150,12 @@ bool EngineEffectChain::enableForInputChannel(const ChannelHandle* inputHandle,
     if (kEffectDebugOutput) {
         qDebug() << "EngineEffectChain::enableForInputChannel" << this << inputHandle;
     }
-    auto& outputMap = m_chainStatusForChannelMatrix[*inputHandle];
-    for (auto&& outputChannelStatus : outputMap) {
+    auto pOutputMap = m_chainStatusForChannelMatrix.find(*inputHandle);
+    if (!pOutputMap) {
+        // Registered after this chain has been created
+        return false;
+    }
+    for (auto&& outputChannelStatus : *pOutputMap) {
         VERIFY_OR_DEBUG_ASSERT(outputChannelStatus.enableState !=
                 EffectEnableState::Enabled) {
             for (auto&& pStatesMap : *statesForEffectsInChain) {
@@ -180,8 +184,11 @@ bool EngineEffectChain::enableForInputChannel(const ChannelHandle* inputHandle,
 }
 
 bool EngineEffectChain::disableForInputChannel(const ChannelHandle* inputHandle) {
-    auto& outputMap = m_chainStatusForChannelMatrix[*inputHandle];
-    for (auto&& outputChannelStatus : outputMap) {
+    auto pOutputMap = m_chainStatusForChannelMatrix.find(*inputHandle);
+    if (!pOutputMap) {
+        return false;
+    }
+    for (auto&& outputChannelStatus : *pOutputMap) {
         if (outputChannelStatus.enableState != EffectEnableState::Disabled) {
             outputChannelStatus.enableState = EffectEnableState::Disabling;
         }
@@ -207,10 +214,13 @@ void EngineEffectChain::deleteStatesForInputChannel(const ChannelHandle* inputCh
     // a ChannelHandle key, but it actually backed by a QVarLengthArray, not a
     // QMap. So it is okay that m_chainStatusForChannelMatrix may be
     // accessed concurrently in the audio engine thread in process(),
-    // enableForInputChannel(), or disableForInputChannel().
-    auto& outputMap = m_chainStatusForChannelMatrix[*inputChannel];
-    for (auto&& outputChannelStatus : outputMap) {
-        outputChannelStatus.enableState = EffectEnableState::Disabled;
+    // enableForInputChannel(), or disableForInputChannel() as long as
+    // the matrix is never expanded after construction.
+    auto pOutputMap = m_chainStatusForChannelMatrix.find(*inputChannel);
+    if (pOutputMap) {
+        for (auto&& outputChannelStatus : *pOutputMap) {
+            outputChannelStatus.enableState = EffectEnableState::Disabled;
+        }
     }
     for (EngineEffect* pEffect : m_effects) {
         if (pEffect != nullptr) {
@@ -219,11 +229,14 @@ void EngineEffectChain::deleteStatesForInputChannel(const ChannelHandle* inputCh
     }
 }
 
-EngineEffectChain::ChannelStatus& EngineEffectChain::getChannelStatus(
+EngineEffectChain::ChannelStatus* EngineEffectChain::findChannelStatus(
         const ChannelHandle& inputHandle,
         const ChannelHandle& outputHandle) {
-    ChannelStatus& status = m_chainStatusForChannelMatrix[inputHandle][outputHandle];
-    return status;
+    auto pOutputMap = m_chainStatusForChannelMatrix.find(inputHandle);
+    if (!pOutputMap) {
+        return nullptr;
+    }
+    return pOutputMap->find(outputHandle);
 }
 
 bool EngineEffectChain::process(const ChannelHandle& inputHandle,
@@ -231,7 +244,8 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
                                 CSAMPLE* pIn, CSAMPLE* pOut,
                                 const unsigned int numSamples,
                                 const unsigned int sampleRate,
-                                const GroupFeatureState& groupFeatures) {
+                                const GroupFeatureState& groupFeatures,
+                                EngineEffectChainBuffers* pBuffers) {
     // Compute the effective enable state from the channel input routing switch and
     // the chain's enable state. When either of these are turned on/off, send the
     // effects the intermediate enabling/disabling signal.
@@ -240,7 +254,14 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
     // appropriately, for example the Echo effect clears its internal buffer for the channel
     // when it gets the intermediate disabling signal.
 
-    ChannelStatus& channelStatus = m_chainStatusForChannelMatrix[inputHandle][outputHandle];
+    // Channels of different inputs may be processed concurrently, so the
+    // matrix must not be expanded here
+    ChannelStatus* pChannelStatus = findChannelStatus(inputHandle, outputHandle);
+    if (!pChannelStatus) {
+        // Not registered when this chain has been created
+        return false;
+    }
+    ChannelStatus& channelStatus = *pChannelStatus;
     EffectEnableState effectiveChainEnableState = channelStatus.enableState;
 
     // If the channel is fully disabled, do not let intermediate
@@ -257,6 +278,8 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
 
     bool processingOccured = false;
     if (effectiveChainEnableState != EffectEnableState::Disabled) {
+        ScopedTimer timer(m_processTimerKey);
+
         // Ramping code inside the effects need to access the original samples
         // after writing to the output buffer. This requires not to use the same buffer
         // for in and output: Also, ChannelMixer::applyEffectsAndMixChannels
@@ -268,10 +291,10 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         for (EngineEffect* pEffect: m_effects) {
             if (pEffect != nullptr) {
                 // Select an unused intermediate buffer for the next output
-                if (pIntermediateInput == m_buffer1.data()) {
-                    pIntermediateOutput = m_buffer2.data();
+                if (pIntermediateInput == pBuffers->buffer1.data()) {
+                    pIntermediateOutput = pBuffers->buffer2.data();
                 } else {
-                    pIntermediateOutput = m_buffer1.data();
+                    pIntermediateOutput = pBuffers->buffer1.data();
                 }
 
                 if (pEffect->process(inputHandle, outputHandle,
@@ -342,11 +365,26 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         chainOnChannelEnableState = EffectEnableState::Enabled;
     }
 
+    return processingOccured;
+}
+
+bool EngineEffectChain::supportsConcurrentProcessing() const {
+    for (EngineEffect* pEffect : m_effects) {
+        if (pEffect != nullptr && !pEffect->supportsConcurrentProcessing()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EngineEffectChain::onCallbackStart() {
+    // The chain's own enable state is shared by all channels, which may be
+    // processed concurrently. So it is only changed from the intermediate to
+    // the final state between two callbacks, after all channels have been
+    // sent the intermediate state.
     if (m_enableState == EffectEnableState::Disabling) {
         m_enableState = EffectEnableState::Disabled;
     } else if (m_enableState == EffectEnableState::Enabling) {
         m_enableState = EffectEnableState::Enabled;
     }
-
-    return processingOccured;
 }
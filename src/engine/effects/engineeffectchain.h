@@ -6,6 +6,7 @@
 #include <QLinkedList>
 
 #include "util/class.h"
+#include "util/defs.h"
 #include "util/types.h"
 #include "util/samplebuffer.h"
 #include "util/memory.h"
@@ -16,6 +17,18 @@
 
 class EngineEffect;
 
+// Scratch buffers for the intermediate results of the effects in a chain.
+// They are owned by EngineEffectsManager and shared by all chains. Chains
+// that are processed concurrently must use separate buffers.
+struct EngineEffectChainBuffers {
+    EngineEffectChainBuffers()
+            : buffer1(MAX_BUFFER_LEN),
+              buffer2(MAX_BUFFER_LEN) {
+    }
+    mixxx::SampleBuffer buffer1;
+    mixxx::SampleBuffer buffer2;
+};
+
 class EngineEffectChain : public EffectsRequestHandler {
   public:
     EngineEffectChain(const QString& id,
@@ -32,7 +45,16 @@ class EngineEffectChain : public EffectsRequestHandler {
                  CSAMPLE* pIn, CSAMPLE* pOut,
                  const unsigned int numSamples,
                  const unsigned int sampleRate,
-                 const GroupFeatureState& groupFeatures);
+                 const GroupFeatureState& groupFeatures,
+                 EngineEffectChainBuffers* pBuffers);
+
+    // Called once at the beginning of each engine callback before any
+    // channel has been processed.
+    void onCallbackStart();
+
+    // Channels of different inputs may be processed concurrently unless
+    // one of the effects does not support it.
+    bool supportsConcurrentProcessing() const;
 
     const QString& id() const {
         return m_id;
@@ -63,18 +85,22 @@ class EngineEffectChain : public EffectsRequestHandler {
             EffectStatesMapArray* statesForEffectsInChain);
     bool disableForInputChannel(const ChannelHandle* inputHandle);
 
-    // Gets or creates a ChannelStatus entry in m_channelStatus for the provided
-    // handle.
-    ChannelStatus& getChannelStatus(const ChannelHandle& inputHandle,
-                                    const ChannelHandle& outputHandle);
+    // Returns the ChannelStatus entry for the provided handles or nullptr
+    // if the channels have not been registered when the chain was created.
+    // Never modifies m_chainStatusForChannelMatrix.
+    ChannelStatus* findChannelStatus(const ChannelHandle& inputHandle,
+                                     const ChannelHandle& outputHandle);
 
     QString m_id;
+    // Built in advance, because process() runs on the audio thread
+    const QString m_processTimerKey;
     EffectEnableState m_enableState;
     EffectChainMixMode m_mixMode;
     CSAMPLE m_dMix;
     QList<EngineEffect*> m_effects;
-    mixxx::SampleBuffer m_buffer1;
-    mixxx::SampleBuffer m_buffer2;
+    // Sized for all registered channels on construction in the main thread
+    // and never expanded afterwards, because the channels are processed
+    // concurrently.
     ChannelHandleMap<ChannelHandleMap<ChannelStatus>> m_chainStatusForChannelMatrix;
 
     DISALLOW_COPY_AND_ASSIGN(EngineEffectChain);
@@ -49,7 +49,8 @@ bool EngineEffectRack::process(const ChannelHandle& inputHandle,
                                CSAMPLE* pIn, CSAMPLE* pOut,
                                const unsigned int numSamples,
                                const unsigned int sampleRate,
-                               const GroupFeatureState& groupFeatures) {
+                               const GroupFeatureState& groupFeatures,
+                               EngineEffectChainBuffers* pChainBuffers) {
     bool processingOccured = false;
     if (pIn == pOut) {
         // Effects are applied to the buffer in place
@@ -57,7 +58,8 @@ bool EngineEffectRack::process(const ChannelHandle& inputHandle,
             if (pChain != nullptr) {
                 if (pChain->process(inputHandle, outputHandle,
                                     pIn, pOut,
-                                    numSamples, sampleRate, groupFeatures)) {
+                                    numSamples, sampleRate, groupFeatures,
+                                    pChainBuffers)) {
                     processingOccured = true;
                 }
             }
@@ -78,7 +80,8 @@ bool EngineEffectRack::process(const ChannelHandle& inputHandle,
 
                 if (pChain->process(inputHandle, outputHandle,
                                     pIntermediateInput, pIntermediateOutput,
-                                    numSamples, sampleRate, groupFeatures)) {
+                                    numSamples, sampleRate, groupFeatures,
+                                    pChainBuffers)) {
                     processingOccured = true;
                     // Output of this chain becomes the input of the next chain.
                     pIntermediateInput = pIntermediateOutput;
@@ -9,6 +9,7 @@
 #include "util/samplebuffer.h"
 
 class EngineEffectChain;
+struct EngineEffectChainBuffers;
 
 //TODO(Be): Remove this superfluous class.
 class EngineEffectRack : public EffectsRequestHandler {
@@ -25,7 +26,8 @@ class EngineEffectRack : public EffectsRequestHandler {
                  CSAMPLE* pIn, CSAMPLE* pOut,
                  const unsigned int numSamples,
                  const unsigned int sampleRate,
-                 const GroupFeatureState& groupFeatures);
+                 const GroupFeatureState& groupFeatures,
+                 EngineEffectChainBuffers* pChainBuffers);
 
     int number() const {
         return m_iRackNumber;
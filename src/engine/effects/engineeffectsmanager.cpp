@@ -3,24 +3,164 @@
 #include "engine/effects/engineeffectrack.h"
 #include "engine/effects/engineeffectchain.h"
 #include "engine/effects/engineeffect.h"
+#include "engine/effects/engineeffectsworkerpool.h"
 
+#include <QThread>
+
+#include "engine/engine.h"
 #include "util/defs.h"
+#include "util/math.h"
 #include "util/sample.h"
+#include "util/timer.h"
+
+namespace {
+
+// Channels are only processed concurrently on systems with enough cores
+// to spare some for the worker threads besides the engine and GUI threads.
+constexpr int kMaxEffectsWorkers = 3;
+
+// The part of the buffer period after which the post-fader effects of
+// channels that are still processed by a worker are dropped.
+constexpr double kPostFaderDeadlineFraction = 0.5;
+
+int numEffectsWorkers() {
+    return math_clamp(QThread::idealThreadCount() - 2, 0, kMaxEffectsWorkers);
+}
+
+} // anonymous namespace
+
+// Each job is processed in the buffer of its lane and only touches the
+// EffectStates of its own input channel. Jobs that are still running on a
+// worker after missing the deadline only access the lane, so the buffers of
+// the input channels can be reused immediately.
+class EngineEffectsManager::PostFaderTask : public EngineEffectsWorkerPool::Task {
+  public:
+    PostFaderTask(EngineEffectsManager* pManager, int numLanes)
+            : m_pManager(pManager),
+              m_pJobs(nullptr),
+              m_numSamples(0),
+              m_sampleRate(0) {
+        for (int i = 0; i < numLanes; ++i) {
+            m_lanes.push_back(std::make_unique<Lane>());
+        }
+    }
+
+    void setBatch(const ChannelHandle& outputHandle,
+                  PostFaderJob* pJobs,
+                  const unsigned int numSamples,
+                  const unsigned int sampleRate) {
+        m_outputHandle = outputHandle;
+        m_pJobs = pJobs;
+        m_numSamples = numSamples;
+        m_sampleRate = sampleRate;
+    }
+
+    void prepare(int jobIndex, int lane) override {
+        const PostFaderJob& job = m_pJobs[jobIndex];
+        Lane* pLane = m_lanes[lane].get();
+        pLane->inputHandle = *job.pInputHandle;
+        pLane->outputHandle = m_outputHandle;
+        pLane->groupFeatures = *job.pGroupFeatures;
+        pLane->oldGain = job.oldGain;
+        pLane->newGain = job.newGain;
+        pLane->numSamples = m_numSamples;
+        pLane->sampleRate = m_sampleRate;
+        SampleUtil::copy(pLane->buffer.data(), job.pInOut, m_numSamples);
+    }
+
+    void run(int /*jobIndex*/, int lane) override {
+        Lane* pLane = m_lanes[lane].get();
+        m_pManager->processInner(SignalProcessingStage::Postfader,
+                pLane->inputHandle, pLane->outputHandle,
+                pLane->buffer.data(), pLane->buffer.data(),
+                pLane->numSamples, pLane->sampleRate, pLane->groupFeatures,
+                m_pManager->m_chainBuffers[lane].get(),
+                pLane->oldGain, pLane->newGain);
+    }
+
+    void commit(int jobIndex, int lane) override {
+        SampleUtil::copy(m_pJobs[jobIndex].pInOut,
+                m_lanes[lane]->buffer.data(), m_numSamples);
+    }
+
+    void drop(int jobIndex) override {
+        // Keep the volume of the channel without applying the effects
+        const PostFaderJob& job = m_pJobs[jobIndex];
+        SampleUtil::applyRampingGain(job.pInOut,
+                job.oldGain, job.newGain, m_numSamples);
+    }
+
+  private:
+    struct Lane {
+        Lane()
+                : oldGain(CSAMPLE_GAIN_ONE),
+                  newGain(CSAMPLE_GAIN_ONE),
+                  numSamples(0),
+                  sampleRate(0),
+                  buffer(MAX_BUFFER_LEN) {
+        }
+
+        ChannelHandle inputHandle;
+        ChannelHandle outputHandle;
+        GroupFeatureState groupFeatures;
+        CSAMPLE_GAIN oldGain;
+        CSAMPLE_GAIN newGain;
+        unsigned int numSamples;
+        unsigned int sampleRate;
+        mixxx::SampleBuffer buffer;
+    };
+
+    EngineEffectsManager* const m_pManager;
+    std::vector<std::unique_ptr<Lane>> m_lanes;
+
+    // Only valid on the engine thread during a batch
+    ChannelHandle m_outputHandle;
+    PostFaderJob* m_pJobs;
+    unsigned int m_numSamples;
+    unsigned int m_sampleRate;
+};
 
 EngineEffectsManager::EngineEffectsManager(EffectsResponsePipe* pResponsePipe)
         : m_pResponsePipe(pResponsePipe),
           m_buffer1(MAX_BUFFER_LEN),
-          m_buffer2(MAX_BUFFER_LEN) {
+          m_buffer2(MAX_BUFFER_LEN),
+          m_bConcurrentProcessingSupported(true) {
     // Try to prevent memory allocation.
     m_chains.reserve(256);
     m_effects.reserve(256);
+
+    int numLanes = 1;
+    const int numWorkers = numEffectsWorkers();
+    if (numWorkers > 0) {
+        m_pWorkerPool = std::make_unique<EngineEffectsWorkerPool>(numWorkers);
+        numLanes = m_pWorkerPool->numLanes();
+        m_pPostFaderTask = std::make_unique<PostFaderTask>(this, numLanes);
+    }
+    for (int i = 0; i < numLanes; ++i) {
+        m_chainBuffers.push_back(std::make_unique<EngineEffectChainBuffers>());
+    }
 }
 
 EngineEffectsManager::~EngineEffectsManager() {
+    // Waits until dropped jobs that are still running on a worker have
+    // finished using the task, the chain buffers and the racks.
+    m_pWorkerPool.reset();
 }
 
 void EngineEffectsManager::onCallbackStart() {
+    if (m_pWorkerPool && m_pWorkerPool->isBusy()) {
+        // A worker is still processing the dropped effects of a channel.
+        // Changes to the chains and racks are postponed until it has
+        // finished.
+        return;
+    }
+
+    for (EngineEffectChain* pChain : m_chains) {
+        pChain->onCallbackStart();
+    }
+
     EffectsRequest* request = NULL;
+    bool effectsChanged = false;
     while (m_pResponsePipe->readMessages(&request, 1) > 0) {
         EffectsResponse response(*request);
         bool processed = false;
@@ -51,6 +191,7 @@ void EngineEffectsManager::onCallbackStart() {
                     } else if (request->type == EffectsRequest::REMOVE_CHAIN_FROM_RACK) {
                         m_chains.removeAll(request->RemoveChainFromRack.pChain);
                     }
+                    effectsChanged = true;
                 } else {
                     if (!processed) {
                         // If we got here, the message was not handled for
@@ -79,8 +220,10 @@ void EngineEffectsManager::onCallbackStart() {
                     // requests about it.
                     if (request->type == EffectsRequest::ADD_EFFECT_TO_CHAIN) {
                         m_effects.append(request->AddEffectToChain.pEffect);
+                        effectsChanged = true;
                     } else if (request->type == EffectsRequest::REMOVE_EFFECT_FROM_CHAIN) {
                         m_effects.removeAll(request->RemoveEffectFromChain.pEffect);
+                        effectsChanged = true;
                     }
                 } else {
                     // If we got here, the message was not handled for
@@ -91,6 +234,7 @@ void EngineEffectsManager::onCallbackStart() {
                 break;
             case EffectsRequest::SET_EFFECT_PARAMETERS:
             case EffectsRequest::SET_PARAMETER_PARAMETERS:
+            case EffectsRequest::LOAD_EFFECT_STATES_FOR_INPUT_CHANNEL:
                 VERIFY_OR_DEBUG_ASSERT(m_effects.contains(request->pTargetEffect)) {
                     response.success = false;
                     response.status = EffectsResponse::NO_SUCH_EFFECT;
@@ -117,6 +261,19 @@ void EngineEffectsManager::onCallbackStart() {
             m_pResponsePipe->writeMessages(&response, 1);
         }
     }
+
+    if (effectsChanged) {
+        m_bConcurrentProcessingSupported = supportsConcurrentProcessing();
+    }
+}
+
+bool EngineEffectsManager::supportsConcurrentProcessing() const {
+    for (EngineEffectChain* pChain : m_chains) {
+        if (!pChain->supportsConcurrentProcessing()) {
+            return false;
+        }
+    }
+    return true;
 }
 
 void EngineEffectsManager::processPreFaderInPlace(const ChannelHandle& inputHandle,
@@ -133,7 +290,8 @@ void EngineEffectsManager::processPreFaderInPlace(const ChannelHandle& inputHand
     processInner(SignalProcessingStage::Prefader,
                  inputHandle, outputHandle,
                  pInOut, pInOut,
-                 numSamples, sampleRate, featureState);
+                 numSamples, sampleRate, featureState,
+                 m_chainBuffers[0].get());
 }
 
 void EngineEffectsManager::processPostFaderInPlace(
@@ -149,9 +307,41 @@ void EngineEffectsManager::processPostFaderInPlace(
                  inputHandle, outputHandle,
                  pInOut, pInOut,
                  numSamples, sampleRate, groupFeatures,
+                 m_chainBuffers[0].get(),
                  oldGain, newGain);
 }
 
+void EngineEffectsManager::processPostFaderInPlace(
+    const ChannelHandle& outputHandle,
+    PostFaderJob* pJobs,
+    int numJobs,
+    const unsigned int numSamples,
+    const unsigned int sampleRate) {
+    if (numJobs > 1 && m_pWorkerPool && m_bConcurrentProcessingSupported) {
+        ScopedTimer timer("EngineEffectsManager::processPostFaderInPlace concurrent");
+        m_pPostFaderTask->setBatch(outputHandle, pJobs, numSamples, sampleRate);
+        // Leave enough of the buffer period for mixing and for the other
+        // outputs of the engine.
+        const double bufferPeriodSeconds = static_cast<double>(numSamples) /
+                (mixxx::kEngineChannelCount * sampleRate);
+        const mixxx::Duration maxDuration = mixxx::Duration::fromMicros(
+                static_cast<qint64>(kPostFaderDeadlineFraction * 1000000 * bufferPeriodSeconds));
+        m_pWorkerPool->run(m_pPostFaderTask.get(), numJobs, maxDuration);
+        return;
+    }
+
+    // Process inline
+    for (int i = 0; i < numJobs; ++i) {
+        const PostFaderJob& job = pJobs[i];
+        processInner(SignalProcessingStage::Postfader,
+                     *job.pInputHandle, outputHandle,
+                     job.pInOut, job.pInOut,
+                     numSamples, sampleRate, *job.pGroupFeatures,
+                     m_chainBuffers[0].get(),
+                     job.oldGain, job.newGain);
+    }
+}
+
 void EngineEffectsManager::processPostFaderAndMix(
     const ChannelHandle& inputHandle,
     const ChannelHandle& outputHandle,
@@ -165,6 +355,7 @@ void EngineEffectsManager::processPostFaderAndMix(
                  inputHandle, outputHandle,
                  pIn, pOut,
                  numSamples, sampleRate, groupFeatures,
+                 m_chainBuffers[0].get(),
                  oldGain, newGain);
 }
 
@@ -176,6 +367,7 @@ void EngineEffectsManager::processInner(
     const unsigned int numSamples,
     const unsigned int sampleRate,
     const GroupFeatureState& groupFeatures,
+    EngineEffectChainBuffers* pChainBuffers,
     const CSAMPLE_GAIN oldGain,
     const CSAMPLE_GAIN newGain) {
 
@@ -188,7 +380,8 @@ void EngineEffectsManager::processInner(
             if (pRack != nullptr) {
                 pRack->process(inputHandle, outputHandle,
                                pIn, pIn,
-                               numSamples, sampleRate, groupFeatures);
+                               numSamples, sampleRate, groupFeatures,
+                               pChainBuffers);
             }
         }
     } else {
@@ -221,7 +414,8 @@ void EngineEffectsManager::processInner(
 
                 if (pRack->process(inputHandle, outputHandle,
                                    pIntermediateInput, pIntermediateOutput,
-                                   numSamples, sampleRate, groupFeatures)) {
+                                   numSamples, sampleRate, groupFeatures,
+                                   pChainBuffers)) {
                     // Output of this rack becomes the input of the next rack.
                     pIntermediateInput = pIntermediateOutput;
                 }
@@ -3,9 +3,12 @@
 
 #include <QScopedPointer>
 
+#include <vector>
+
 #include "util/samplebuffer.h"
 #include "util/types.h"
 #include "util/fifo.h"
+#include "util/memory.h"
 #include "engine/effects/message.h"
 #include "engine/effects/groupfeaturestate.h"
 #include "engine/channelhandle.h"
@@ -13,6 +16,8 @@
 class EngineEffectRack;
 class EngineEffectChain;
 class EngineEffect;
+class EngineEffectsWorkerPool;
+struct EngineEffectChainBuffers;
 
 class EngineEffectsManager : public EffectsRequestHandler {
   public:
@@ -45,6 +50,25 @@ class EngineEffectsManager : public EffectsRequestHandler {
         const CSAMPLE_GAIN oldGain = CSAMPLE_GAIN_ONE,
         const CSAMPLE_GAIN newGain = CSAMPLE_GAIN_ONE);
 
+
+    // The arguments of processPostFaderInPlace() for a single input channel
+    struct PostFaderJob {
+        const ChannelHandle* pInputHandle;
+        CSAMPLE* pInOut;
+        const GroupFeatureState* pGroupFeatures;
+        CSAMPLE_GAIN oldGain;
+        CSAMPLE_GAIN newGain;
+    };
+    // Same as processPostFaderInPlace() for multiple input channels with
+    // separate buffers. The input channels are independent of each other
+    // and are processed concurrently if possible.
+    void processPostFaderInPlace(
+        const ChannelHandle& outputHandle,
+        PostFaderJob* pJobs,
+        int numJobs,
+        const unsigned int numSamples,
+        const unsigned int sampleRate);
+
     void processPostFaderAndMix(
         const ChannelHandle& inputHandle,
         const ChannelHandle& outputHandle,
@@ -80,8 +104,12 @@ class EngineEffectsManager : public EffectsRequestHandler {
                       const unsigned int numSamples,
                       const unsigned int sampleRate,
                       const GroupFeatureState& groupFeatures,
+                      EngineEffectChainBuffers* pChainBuffers,
                       const CSAMPLE_GAIN oldGain = CSAMPLE_GAIN_ONE,
                       const CSAMPLE_GAIN newGain = CSAMPLE_GAIN_ONE);
+    bool supportsConcurrentProcessing() const;
+
+    class PostFaderTask;
 
     QScopedPointer<EffectsResponsePipe> m_pResponsePipe;
     QHash<SignalProcessingStage, QList<EngineEffectRack*>> m_racksByStage;
@@ -90,6 +118,14 @@ class EngineEffectsManager : public EffectsRequestHandler {
 
     mixxx::SampleBuffer m_buffer1;
     mixxx::SampleBuffer m_buffer2;
+
+    std::unique_ptr<PostFaderTask> m_pPostFaderTask;
+    // Null if there are not enough CPU cores for concurrent processing
+    std::unique_ptr<EngineEffectsWorkerPool> m_pWorkerPool;
+    // One set of buffers for each lane of the worker pool
+    std::vector<std::unique_ptr<EngineEffectChainBuffers>> m_chainBuffers;
+    // Updated whenever effects or chains are added or removed
+    bool m_bConcurrentProcessingSupported;
 };
 
 
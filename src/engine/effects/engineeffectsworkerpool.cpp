@@ -0,0 +1,186 @@
+#include "engine/effects/engineeffectsworkerpool.h"
+
+#include <QSemaphore>
+
+#include <algorithm>
+
+#include "util/performancetimer.h"
+
+namespace {
+
+enum LaneState {
+    kLaneIdle,
+    // Prepared and waiting for the worker
+    kLanePending,
+    kLaneRunning,
+    // Waiting for the engine thread to commit the results
+    kLaneFinished,
+    kLaneTakenOver,
+    kLaneDropped,
+};
+
+} // anonymous namespace
+
+class EngineEffectsWorkerPool::Worker : public QThread {
+  public:
+    Worker(EngineEffectsWorkerPool* pPool, int lane)
+            : m_pPool(pPool),
+              m_lane(lane) {
+        setObjectName(QString("EffectsWorker %1").arg(lane));
+    }
+
+    void wakeUp() {
+        m_wakeUp.release();
+    }
+
+  protected:
+    void run() override {
+        while (true) {
+            m_wakeUp.acquire();
+            if (m_pPool->m_quit.load()) {
+                return;
+            }
+            m_pPool->runJob(m_lane);
+        }
+    }
+
+  private:
+    EngineEffectsWorkerPool* const m_pPool;
+    const int m_lane;
+    QSemaphore m_wakeUp;
+};
+
+EngineEffectsWorkerPool::EngineEffectsWorkerPool(int numWorkers)
+        : m_quit(false),
+          m_laneStates(new std::atomic<int>[numWorkers + 1]),
+          m_runningJobs(0),
+          m_pTask(nullptr),
+          m_missedDeadlines("EngineEffectsWorkerPool::run missed deadline"),
+          m_droppedJobs("EngineEffectsWorkerPool::run dropped jobs") {
+    for (int lane = 0; lane <= numWorkers; ++lane) {
+        m_laneStates[lane].store(kLaneIdle);
+    }
+    for (int i = 0; i < numWorkers; ++i) {
+        m_workers.push_back(std::make_unique<Worker>(this, i + 1));
+        // The workers run parts of the engine callback and need the same
+        // priority as the audio thread.
+        m_workers.back()->start(QThread::TimeCriticalPriority);
+    }
+}
+
+EngineEffectsWorkerPool::~EngineEffectsWorkerPool() {
+    m_quit.store(true);
+    for (const auto& pWorker : m_workers) {
+        pWorker->wakeUp();
+    }
+    for (const auto& pWorker : m_workers) {
+        pWorker->wait();
+    }
+}
+
+void EngineEffectsWorkerPool::runJob(int lane) {
+    // Counted before starting the job, so that the engine thread doesn't
+    // prepare the next batch while the job might be running
+    m_runningJobs.fetch_add(1);
+    int state = kLanePending;
+    if (m_laneStates[lane].compare_exchange_strong(state, kLaneRunning)) {
+        m_pTask->run(lane - 1, lane);
+        state = kLaneRunning;
+        // Fails if the job has been dropped in the meantime
+        m_laneStates[lane].compare_exchange_strong(state, kLaneFinished);
+    }
+    // Otherwise the job has been taken over by the engine thread or the
+    // wake up is outdated
+    m_runningJobs.fetch_sub(1);
+}
+
+int EngineEffectsWorkerPool::run(
+        Task* pTask,
+        int numJobs,
+        mixxx::Duration maxDuration) {
+    if (numJobs <= 0) {
+        return 0;
+    }
+
+    PerformanceTimer timer;
+    timer.start();
+
+    // A worker that has just found an outdated wake up is done within a
+    // few instructions, but a dropped job might still take a while.
+    while (isBusy()) {
+        if (timer.elapsed() >= maxDuration) {
+            for (int i = 0; i < numJobs; ++i) {
+                pTask->drop(i);
+            }
+            m_missedDeadlines.increment();
+            m_droppedJobs.increment(numJobs);
+            return 0;
+        }
+    }
+
+    // The engine thread runs at least one of the jobs itself
+    const int numWorkerJobs = std::min(static_cast<int>(m_workers.size()), numJobs - 1);
+    m_pTask = pTask;
+    for (int lane = 1; lane <= numWorkerJobs; ++lane) {
+        pTask->prepare(lane - 1, lane);
+        // Publishing the state releases the prepared job for the worker
+        m_laneStates[lane].store(kLanePending, std::memory_order_release);
+        m_workers[lane - 1]->wakeUp();
+    }
+
+    for (int jobIndex = numWorkerJobs; jobIndex < numJobs; ++jobIndex) {
+        pTask->prepare(jobIndex, 0);
+        pTask->run(jobIndex, 0);
+        pTask->commit(jobIndex, 0);
+    }
+
+    // Only jobs that have been started by a worker can still be running,
+    // so the wait is usually bounded by the time needed for processing a
+    // single job.
+    int numJobsRunByWorkers = 0;
+    int numDroppedJobs = 0;
+    int numUnfinishedJobs;
+    do {
+        numUnfinishedJobs = 0;
+        const bool deadlineMissed = timer.elapsed() >= maxDuration;
+        for (int lane = 1; lane <= numWorkerJobs; ++lane) {
+            int state = m_laneStates[lane].load(std::memory_order_acquire);
+            switch (state) {
+            case kLanePending:
+                if (m_laneStates[lane].compare_exchange_strong(state, kLaneTakenOver)) {
+                    // The worker has not been scheduled yet and won't
+                    // touch the buffers of its lane anymore
+                    pTask->run(lane - 1, lane);
+                    pTask->commit(lane - 1, lane);
+                    m_laneStates[lane].store(kLaneIdle, std::memory_order_relaxed);
+                } else {
+                    ++numUnfinishedJobs;
+                }
+                break;
+            case kLaneRunning:
+                if (deadlineMissed &&
+                        m_laneStates[lane].compare_exchange_strong(state, kLaneDropped)) {
+                    pTask->drop(lane - 1);
+                    ++numDroppedJobs;
+                } else {
+                    ++numUnfinishedJobs;
+                }
+                break;
+            case kLaneFinished:
+                pTask->commit(lane - 1, lane);
+                m_laneStates[lane].store(kLaneIdle, std::memory_order_relaxed);
+                ++numJobsRunByWorkers;
+                break;
+            default:
+                // Already committed or dropped
+                break;
+            }
+        }
+    } while (numUnfinishedJobs > 0);
+
+    if (numDroppedJobs > 0) {
+        m_missedDeadlines.increment();
+        m_droppedJobs.increment(numDroppedJobs);
+    }
+    return numJobsRunByWorkers;
+}
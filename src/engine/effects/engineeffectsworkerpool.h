@@ -0,0 +1,98 @@
+#ifndef ENGINEEFFECTSWORKERPOOL_H
+#define ENGINEEFFECTSWORKERPOOL_H
+
+#include <QThread>
+
+#include <atomic>
+#include <vector>
+
+#include "util/class.h"
+#include "util/counter.h"
+#include "util/duration.h"
+#include "util/memory.h"
+
+// Processes independent jobs of the engine callback concurrently on a
+// small pool of real-time worker threads.
+//
+// Each worker is handed at most one job per batch. The engine thread
+// prepares these jobs in the buffers of the workers' lanes, wakes up the
+// workers and runs all other jobs itself. Afterwards it takes over the
+// jobs that have not been started yet, and commits the results of the
+// finished jobs. It never blocks on the workers, but spins until the
+// jobs that have been started by a worker are finished or until the
+// deadline of the batch is missed. The engine callback thus never waits
+// for the scheduling of a worker thread and degrades to processing all
+// jobs inline if no worker is available in time.
+//
+// Jobs that have missed the deadline are dropped. Their workers keep
+// running in the background until the job is finished, and until then
+// all jobs of the following batches are dropped, because they might share
+// state with the running job. The task must therefore outlive the pool.
+class EngineEffectsWorkerPool {
+  public:
+    class Task {
+      public:
+        virtual ~Task() = default;
+
+        // Prepares the job for running it with the given lane, e.g. by
+        // copying its input into the buffers of the lane.
+        virtual void prepare(int jobIndex, int lane) = 0;
+        // Runs a prepared job. Jobs that run concurrently are passed
+        // different lanes in the range [0, numLanes()). Must only access
+        // the buffers of the lane and the state that is exclusively used
+        // by the job.
+        virtual void run(int jobIndex, int lane) = 0;
+        // Publishes the results of a job from the buffers of the lane
+        virtual void commit(int jobIndex, int lane) = 0;
+        // Invoked instead of run() and commit() for jobs that have missed
+        // the deadline
+        virtual void drop(int jobIndex) = 0;
+    };
+
+    explicit EngineEffectsWorkerPool(int numWorkers);
+    ~EngineEffectsWorkerPool();
+
+    // The engine thread uses lane 0 and the workers use the lanes
+    // 1 to numWorkers.
+    int numLanes() const {
+        return static_cast<int>(m_workers.size()) + 1;
+    }
+
+    // Runs all jobs of the task and returns after all of them have been
+    // either committed or dropped, at the latest shortly after maxDuration
+    // has elapsed. Returns the number of jobs that have been run by the
+    // worker threads. Must only be called from the engine thread, which
+    // also invokes prepare(), commit() and drop().
+    int run(Task* pTask, int numJobs, mixxx::Duration maxDuration);
+
+    // A dropped job is still running on a worker
+    bool isBusy() const {
+        return m_runningJobs.load() > 0;
+    }
+
+  private:
+    class Worker;
+
+    // Runs the prepared job of the lane unless the engine thread has
+    // taken it over
+    void runJob(int lane);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<bool> m_quit;
+
+    // The state of the job that has been handed to each lane. The job
+    // of lane n always has the index n - 1.
+    std::unique_ptr<std::atomic<int>[]> m_laneStates;
+    // The number of workers that might be running a job, including
+    // dropped jobs of previous batches
+    std::atomic<int> m_runningJobs;
+    // Only written by the engine thread while no job is running
+    Task* m_pTask;
+
+    Counter m_missedDeadlines;
+    Counter m_droppedJobs;
+
+    DISALLOW_COPY_AND_ASSIGN(EngineEffectsWorkerPool);
+};
+
+#endif /* ENGINEEFFECTSWORKERPOOL_H */
@@ -36,6 +36,7 @@ struct EffectsRequest {
         // Messages for EngineEffect
         SET_EFFECT_PARAMETERS,
         SET_PARAMETER_PARAMETERS,
+        LOAD_EFFECT_STATES_FOR_INPUT_CHANNEL,
 
         // Must come last.
         NUM_REQUEST_TYPES
@@ -63,6 +64,7 @@ struct EffectsRequest {
         CLEAR_STRUCT(SetEffectChainParameters);
         CLEAR_STRUCT(SetEffectParameters);
         CLEAR_STRUCT(SetParameterParameters);
+        CLEAR_STRUCT(LoadEffectStatesForInputChannel);
 #undef CLEAR_STRUCT
     }
 
@@ -77,6 +79,13 @@ struct EffectsRequest {
             // to EffectProcessorImpl. The EffectStates are managed by
             // EffectProcessorImpl.
             delete EnableInputChannelForChain.pEffectStatesMapArray;
+        } else if (type == LOAD_EFFECT_STATES_FOR_INPUT_CHANNEL) {
+            VERIFY_OR_DEBUG_ASSERT(LoadEffectStatesForInputChannel.pEffectStatesMap != nullptr) {
+                return;
+            }
+            // Same as above, the EffectStates are managed by
+            // EffectProcessorImpl.
+            delete LoadEffectStatesForInputChannel.pEffectStatesMap;
         }
     }
 
@@ -98,6 +107,7 @@ struct EffectsRequest {
         EngineEffectChain* pTargetChain;
         // Used by:
         // - SET_EFFECT_PARAMETER
+        // - LOAD_EFFECT_STATES_FOR_INPUT_CHANNEL
         EngineEffect* pTargetEffect;
     };
 
@@ -145,6 +155,10 @@ struct EffectsRequest {
         struct {
             int iParameter;
         } SetParameterParameters;
+        struct {
+            EffectStatesMap* pEffectStatesMap;
+            const ChannelHandle* pChannelHandle;
+        } LoadEffectStatesForInputChannel;
     };
 
     // Used by SET_EFFECT_PARAMETER.
@@ -26,6 +26,7 @@
 #include "engine/readaheadmanager.h"
 #include "engine/sync/enginesync.h"
 #include "engine/sync/synccontrol.h"
+#include "mixer/playermanager.h"
 #include "track/beatfactory.h"
 #include "track/keyutils.h"
 #include "track/track.h"
@@ -92,7 +93,9 @@ EngineBuffer::EngineBuffer(const QString& group, UserSettingsPointer pConfig,
     // zero out crossfade buffer
     SampleUtil::clear(m_pCrossfadeBuffer, MAX_BUFFER_LEN);
 
-    m_pReader = new CachingReader(group, pConfig);
+    // Samplers share the decoded samples of short one-shots
+    m_pReader = new CachingReader(group, pConfig,
+            PlayerManager::isSamplerGroup(group));
     connect(m_pReader, &CachingReader::trackLoading,
             this, &EngineBuffer::slotTrackLoading,
             Qt::DirectConnection);
@@ -168,6 +171,11 @@ EngineBuffer::EngineBuffer(const QString& group, UserSettingsPointer pConfig,
     m_pKeylock = new ControlPushButton(ConfigKey(m_group, "keylock"), true);
     m_pKeylock->setButtonMode(ControlPushButton::TOGGLE);
 
+    // Selects the EngineBufferScaleLinear::Interpolation of the vinyl scaler
+    m_pVinylInterpolation = new ControlPushButton(
+            ConfigKey(m_group, "vinyl_interpolation"), true);
+    m_pVinylInterpolation->setStates(3);
+
     m_pEject = new ControlPushButton(ConfigKey(m_group, "eject"));
     connect(m_pEject, &ControlObject::valueChanged,
             this, &EngineBuffer::slotEjectTrack,
@@ -290,6 +298,7 @@ EngineBuffer::~EngineBuffer() {
     delete m_pScaleRB;
 
     delete m_pKeylock;
+    delete m_pVinylInterpolation;
     delete m_pEject;
 
     SampleUtil::free(m_pCrossfadeBuffer);
@@ -715,6 +724,10 @@ void EngineBuffer::processTrackLocked(
     double tempoRatio = pitchTempoRatio.tempoRatio;
     const bool keylock_enabled = pitchTempoRatio.keylock;
 
+    m_pScaleLinear->setInterpolation(
+            static_cast<EngineBufferScaleLinear::Interpolation>(
+                    math_clamp(static_cast<int>(m_pVinylInterpolation->get()), 0, 2)));
+
     bool is_scratching = false;
     bool is_reverse = false;
 
@@ -1251,6 +1264,7 @@ void EngineBuffer::hintReader(const double dRate) {
     for (const auto& pControl: qAsConst(m_engineControls)) {
         pControl->hintReader(&m_hintList);
     }
+    m_pReader->setPlaying(dRate != 0.0);
     m_pReader->hintAndMaybeWake(m_hintList);
 }
 
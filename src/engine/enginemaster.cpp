@@ -7,6 +7,7 @@
 #include "preferences/usersettings.h"
 #include "control/controlaudiotaperpot.h"
 #include "control/controlaudiotaperpot.h"
+#include "control/controlnotifier.h"
 #include "control/controlpotmeter.h"
 #include "control/controlpushbutton.h"
 #include "effects/effectsmanager.h"
@@ -377,6 +378,7 @@ void EngineMaster::process(const int iBufferSize) {
         QThread::currentThread()->setObjectName("Engine");
         haveSetName = true;
     }
+    ControlNotifier::setEngineThread(QThread::currentThread());
     Trace t("EngineMaster::process");
 
     bool masterEnabled = m_pMasterEnabled->get();
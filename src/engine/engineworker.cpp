@@ -5,14 +5,13 @@
 #include "engine/engineworkerscheduler.h"
 
 EngineWorker::EngineWorker()
-    : m_pScheduler(nullptr) {
+    : m_pScheduler(nullptr),
+      m_priority(Priority::Low) {
     m_notReady.test_and_set();
 }
 
 EngineWorker::~EngineWorker() {
-}
-
-void EngineWorker::run() {
+    DEBUG_ASSERT(m_pScheduler == nullptr);
 }
 
 void EngineWorker::setScheduler(EngineWorkerScheduler* pScheduler) {
@@ -29,8 +28,9 @@ void EngineWorker::workReady() {
     m_pScheduler->workerReady();
 }
 
-void EngineWorker::wakeIfReady() {
-    if (!m_notReady.test_and_set()) {
-        m_semaRun.release();
+void EngineWorker::quitWait() {
+    if (m_pScheduler) {
+        m_pScheduler->removeWorker(this);
+        m_pScheduler = nullptr;
     }
 }
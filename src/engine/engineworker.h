@@ -6,34 +6,58 @@
 
 #include <atomic>
 #include <QObject>
-#include <QSemaphore>
-#include <QThread>
 
 // EngineWorker is an interface for running background processing work when the
 // audio callback is not active. While the audio callback is active, an
 // EngineWorker can emit its workReady signal, and an EngineWorkerManager will
 // schedule it for running after the audio callback has completed.
+//
+// Workers do not own a thread. They are run by the fixed number of threads
+// of the EngineWorkerScheduler, which picks the ready worker with the
+// highest priority.
 
 class EngineWorkerScheduler;
 
-class EngineWorker : public QThread {
+class EngineWorker : public QObject {
     Q_OBJECT
   public:
+    enum class Priority {
+        Low = 0,
+        High = 1,
+    };
+
     EngineWorker();
     virtual ~EngineWorker();
 
-    virtual void run();
+    // Performs the next unit of pending work, e.g. reading a single chunk.
+    // Returns false if there is nothing left to do. Called by a thread of
+    // the scheduler, but never concurrently for the same worker.
+    virtual bool runOnce() = 0;
 
     void setScheduler(EngineWorkerScheduler* pScheduler);
     void workReady();
-    void wakeIfReady();
-
-  protected:
-    QSemaphore m_semaRun;
+    // Returns true once after each call of workReady()
+    bool takeReady() {
+        return !m_notReady.test_and_set();
+    }
+
+    Priority priority() const {
+        return m_priority.load();
+    }
+    void setPriority(Priority priority) {
+        m_priority.store(priority);
+    }
+
+    // Removes the worker from the scheduler and waits until it is no longer
+    // running. Must be called by the destructor of derived classes.
+    void quitWait();
 
   private:
+    friend class EngineWorkerScheduler;
+
     EngineWorkerScheduler* m_pScheduler;
     std::atomic_flag m_notReady;
+    std::atomic<Priority> m_priority;
 };
 
 #endif /* ENGINEWORKER_H */
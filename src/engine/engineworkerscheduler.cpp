@@ -6,17 +6,77 @@
 #include "engine/engineworker.h"
 #include "engine/engineworkerscheduler.h"
 #include "util/event.h"
+#include "util/logger.h"
+#include "util/math.h"
+
+namespace {
+
+const mixxx::Logger kLogger("EngineWorkerScheduler");
+
+// Decoding is CPU bound, but also waits for the disk. A few threads keep
+// the disk busy without oversubscribing the CPU with dozens of players.
+const int kMinThreads = 2;
+const int kMaxThreads = 4;
+
+// The number of units of work, e.g. chunks, that a thread performs for
+// one worker before picking the next one.
+const int kMaxBatchSize = 8;
+
+// runWorkers() wakes the threads without locking the mutex, because it is
+// called from the engine callback. The wake up is lost if it happens while
+// a thread is about to wait, so idle threads also look for ready workers
+// periodically.
+const unsigned long kMaxIdleMillis = 50;
+
+} // anonymous namespace
+
+class EngineWorkerScheduler::WorkerThread : public QThread {
+  public:
+    WorkerThread(EngineWorkerScheduler* pScheduler, int index)
+            : m_pScheduler(pScheduler) {
+        setObjectName(QString("EngineWorkerScheduler %1").arg(index));
+    }
+
+  protected:
+    void run() override {
+        m_pScheduler->runThread();
+    }
+
+  private:
+    EngineWorkerScheduler* const m_pScheduler;
+};
 
 EngineWorkerScheduler::EngineWorkerScheduler(QObject* pParent)
         : m_bWakeScheduler(false),
+          m_nextWorker(0),
           m_bQuit(false) {
     Q_UNUSED(pParent);
 }
 
 EngineWorkerScheduler::~EngineWorkerScheduler() {
-    m_bQuit = true;
-    m_waitCondition.wakeAll();
-    wait();
+    {
+        QMutexLocker locker(&m_mutex);
+        m_bQuit = true;
+        m_waitCondition.wakeAll();
+    }
+    for (const auto& pThread : m_threads) {
+        pThread->wait();
+    }
+    // Workers that are destroyed later must not access the scheduler
+    for (const auto& state : m_workers) {
+        state.pWorker->m_pScheduler = nullptr;
+    }
+}
+
+void EngineWorkerScheduler::start(QThread::Priority priority) {
+    DEBUG_ASSERT(m_threads.empty());
+    const int threadCount = math_clamp(
+            QThread::idealThreadCount(), kMinThreads, kMaxThreads);
+    kLogger.info() << "Starting" << threadCount << "threads";
+    for (int i = 0; i < threadCount; ++i) {
+        m_threads.push_back(std::make_unique<WorkerThread>(this, i + 1));
+        m_threads.back()->start(priority);
+    }
 }
 
 void EngineWorkerScheduler::workerReady() {
@@ -26,35 +86,90 @@ void EngineWorkerScheduler::workerReady() {
 void EngineWorkerScheduler::addWorker(EngineWorker* pWorker) {
     DEBUG_ASSERT(pWorker);
     QMutexLocker locker(&m_mutex);
-    m_workers.push_back(pWorker);
+    m_workers.push_back(WorkerState{pWorker, false, false});
+}
+
+void EngineWorkerScheduler::removeWorker(EngineWorker* pWorker) {
+    QMutexLocker locker(&m_mutex);
+    int index = indexOfWorker(pWorker);
+    while (index >= 0 && m_workers[index].running) {
+        m_workerFinished.wait(&m_mutex);
+        index = indexOfWorker(pWorker);
+    }
+    if (index >= 0) {
+        m_workers.erase(m_workers.begin() + index);
+    }
+}
+
+int EngineWorkerScheduler::indexOfWorker(EngineWorker* pWorker) const {
+    for (size_t i = 0; i < m_workers.size(); ++i) {
+        if (m_workers[i].pWorker == pWorker) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
 }
 
 void EngineWorkerScheduler::runWorkers() {
     // Wake the scheduler if we have written a worker-ready message to the
-    // scheduler. There is no race condition in accessing this boolean because
-    // both workerReady and runWorkers are called from the callback thread.
-    if (m_bWakeScheduler) {
-        m_bWakeScheduler = false;
+    // scheduler. workerReady() may be called concurrently from other threads,
+    // so the flag is reset atomically and a late call is picked up by the
+    // next callback.
+    if (m_bWakeScheduler.exchange(false)) {
         m_waitCondition.wakeAll();
     }
 }
 
-void EngineWorkerScheduler::run() {
+int EngineWorkerScheduler::takeNextWorker() {
+    const size_t count = m_workers.size();
+    int nextIndex = -1;
+    for (size_t i = 0; i < count; ++i) {
+        // Start after the last picked worker for round robin
+        const size_t index = (m_nextWorker + i) % count;
+        WorkerState& state = m_workers[index];
+        if (state.pWorker->takeReady()) {
+            state.pending = true;
+        }
+        if (!state.pending || state.running) {
+            continue;
+        }
+        if (nextIndex < 0 ||
+                state.pWorker->priority() > m_workers[nextIndex].pWorker->priority()) {
+            nextIndex = static_cast<int>(index);
+        }
+    }
+    if (nextIndex >= 0) {
+        m_workers[nextIndex].pending = false;
+        m_workers[nextIndex].running = true;
+        m_nextWorker = nextIndex + 1;
+    }
+    return nextIndex;
+}
+
+void EngineWorkerScheduler::runThread() {
+    QMutexLocker locker(&m_mutex);
     while (!m_bQuit) {
+        const int index = takeNextWorker();
+        if (index < 0) {
+            // Wait for next runWorkers() call
+            m_waitCondition.wait(&m_mutex, kMaxIdleMillis); // unlock mutex and wait
+            continue;
+        }
+        EngineWorker* pWorker = m_workers[index].pWorker;
+        locker.unlock();
+
         Event::start("EngineWorkerScheduler");
-        {
-            QMutexLocker lock(&m_mutex);
-            for(const auto& pWorker: m_workers) {
-                pWorker->wakeIfReady();
-            }
+        bool pending = true;
+        for (int i = 0; i < kMaxBatchSize && pending; ++i) {
+            pending = pWorker->runOnce();
         }
         Event::end("EngineWorkerScheduler");
-        {
-            QMutexLocker lock(&m_mutex);
-            if (!m_bQuit) {
-                // Wait for next runWorkers() call
-                m_waitCondition.wait(&m_mutex); // unlock mutex and wait
-            }
-        }
+
+        locker.relock();
+        // The worker might have moved within m_workers in the meantime
+        WorkerState& state = m_workers[indexOfWorker(pWorker)];
+        state.running = false;
+        state.pending = state.pending || pending;
+        m_workerFinished.wakeAll();
     }
 }
@@ -1,8 +1,12 @@
 #ifndef ENGINEWORKERSCHEDULER_H
 #define ENGINEWORKERSCHEDULER_H
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include <QMutex>
-#include <QThreadPool>
+#include <QThread>
 #include <QWaitCondition>
 
 #include "util/fifo.h"
@@ -13,27 +17,62 @@
 
 class EngineWorker;
 
-class EngineWorkerScheduler : public QThread {
+// Runs the EngineWorkers of all players, e.g. the CachingReaderWorkers of
+// decks, samplers and preview decks, on a fixed number of threads.
+//
+// Ready workers are picked by priority, i.e. playing decks are served
+// before idle samplers, and round robin among workers of the same priority.
+// A worker is never run by two threads at the same time and performs a
+// batch of work before the thread moves on, which keeps consecutive reads
+// from the same file together.
+class EngineWorkerScheduler : public QObject {
     Q_OBJECT
   public:
     EngineWorkerScheduler(QObject* pParent=NULL);
     virtual ~EngineWorkerScheduler();
 
+    // Starts the worker threads
+    void start(QThread::Priority priority);
+
+    int threadCount() const {
+        return static_cast<int>(m_threads.size());
+    }
+
     void addWorker(EngineWorker* pWorker);
+    // Blocks until the worker is no longer running
+    void removeWorker(EngineWorker* pWorker);
     void runWorkers();
     void workerReady();
 
-  protected:
-    void run();
-
   private:
+    class WorkerThread;
+
+    struct WorkerState {
+        EngineWorker* pWorker;
+        // The worker has work left that has not been picked by a thread
+        bool pending;
+        bool running;
+    };
+
+    void runThread();
+    // Returns the index of the next worker to run or -1. Must be called
+    // with m_mutex locked.
+    int takeNextWorker();
+    int indexOfWorker(EngineWorker* pWorker) const;
+
     // Indicates whether workerReady has been called since the last time
-    // runWorkers was run. This should only be touched from the engine callback.
-    bool m_bWakeScheduler;
+    // runWorkers was run. Set by any thread that hands work to a worker,
+    // e.g. the engine callback or a thread that finished decoding a sample.
+    std::atomic<bool> m_bWakeScheduler;
+
+    // Guarded by m_mutex
+    std::vector<WorkerState> m_workers;
+    size_t m_nextWorker;
 
-    std::vector<EngineWorker*> m_workers;
+    std::vector<std::unique_ptr<QThread>> m_threads;
 
     QWaitCondition m_waitCondition;
+    QWaitCondition m_workerFinished;
     QMutex m_mutex;
     volatile bool m_bQuit;
 };
@@ -8,6 +8,8 @@
 
 #include "engine/sidechain/enginerecord.h"
 
+#include <QFileInfo>
+
 #include "preferences/usersettings.h"
 #include "control/controlobject.h"
 #include "control/controlproxy.h"
@@ -21,6 +23,7 @@ const int kMetaDataLifeTimeout = 16;
 
 EngineRecord::EngineRecord(UserSettingsPointer pConfig)
         : m_pConfig(pConfig),
+          m_reportedOverruns(0),
           m_frames(0),
           m_recordedDuration(0),
           m_iMetaDataLife(0),
@@ -56,7 +59,18 @@ void EngineRecord::updateFromPreferences() {
     if (m_pEncoder) {
         m_pEncoder.reset();
     }
+    // The recording file's extension has been derived from the selected
+    // format unless the file has been given explicitly, e.g. for rendering.
+    // Then the extension chooses the format without touching the
+    // preferences.
     Encoder::Format format = EncoderFactory::getFactory().getSelectedFormat(m_pConfig);
+    const QString suffix = QFileInfo(m_fileName).suffix();
+    for (const auto& supportedFormat : EncoderFactory::getFactory().getFormats()) {
+        if (supportedFormat.internalName.compare(suffix, Qt::CaseInsensitive) == 0) {
+            format = supportedFormat;
+            break;
+        }
+    }
     m_encoding = format.internalName;
     m_pEncoder = EncoderFactory::getFactory().getNewEncoder(format,  m_pConfig, this);
     m_pEncoder->updateMetaData(m_baAuthor,m_baTitle,m_baAlbum);
@@ -254,49 +268,52 @@ void EngineRecord::write(const unsigned char *header, const unsigned char *body,
     }
     // Relevant for OGG
     if (headerLen > 0) {
-        m_dataStream.writeRawData((const char*) header, headerLen);
+        m_fileWriter.write((const char*) header, headerLen);
     }
     // Always write body
-    m_dataStream.writeRawData((const char*) body, bodyLen);
+    m_fileWriter.write((const char*) body, bodyLen);
     emit(bytesRecorded((headerLen+bodyLen)));
 
+    const int overruns = m_fileWriter.overruns();
+    if (overruns != m_reportedOverruns) {
+        emit(bufferOverruns(overruns - m_reportedOverruns));
+        m_reportedOverruns = overruns;
+    }
 }
 // Encoder calls this method to write compressed audio
 int EngineRecord::tell() {
     if (!fileOpen()) {
         return -1;
     }
-    return m_dataStream.device()->pos();
+    return static_cast<int>(m_fileWriter.pos());
 }
 // Encoder calls this method to write compressed audio
 void EngineRecord::seek(int pos) {
     if (!fileOpen()) {
         return;
     }
-    m_dataStream.device()->seek(static_cast<qint64>(pos));
+    m_fileWriter.seek(static_cast<qint64>(pos));
 }
 // These are not used for streaming, but the interface requires them
 int EngineRecord::filelen() {
     if (!fileOpen()) {
         return 0;
     }
-    return m_dataStream.device()->size();
+    return static_cast<int>(m_fileWriter.size());
 }
 
 bool EngineRecord::fileOpen() {
-    return (m_file.handle() != -1);
+    return m_fileWriter.isOpen();
 }
 
 bool EngineRecord::openFile() {
-    // We can use a QFile to write compressed audio.
+    // The file is written asynchronously, so that a slow disk doesn't
+    // block the sidechain thread.
     if (m_pEncoder) {
-        m_file.setFileName(m_fileName);
-        if (!m_file.open(QIODevice::WriteOnly)) {
+        if (!m_fileWriter.open(m_fileName)) {
             return false;
         }
-        if (m_file.handle() != -1) {
-            m_dataStream.setDevice(&m_file);
-        }
+        m_reportedOverruns = 0;
     } else {
         return false;
     }
@@ -342,13 +359,14 @@ bool EngineRecord::openCueFile() {
 }
 
 void EngineRecord::closeFile() {
-    if (m_file.handle() != -1) {
-        // Close QFile and encoder, if open.
+    if (fileOpen()) {
+        // Close file and encoder, if open.
         if (m_pEncoder) {
             m_pEncoder->flush();
             m_pEncoder.reset();
         }
-        m_file.close();
+        // Waits until all buffered data has been written
+        m_fileWriter.close();
     }
 }
 
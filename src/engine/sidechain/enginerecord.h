@@ -8,12 +8,12 @@
 #ifndef ENGINERECORD_H
 #define ENGINERECORD_H
 
-#include <QDataStream>
 #include <QFile>
 
 #include "preferences/usersettings.h"
 #include "encoder/encodercallback.h"
 #include "encoder/encoder.h"
+#include "engine/sidechain/recordingfilewriter.h"
 #include "engine/sidechain/sidechainworker.h"
 #include "track/track.h"
 
@@ -57,6 +57,9 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
     // writing.
     void isRecording(bool recording, bool error);
     void durationRecorded(quint64 durationInt);
+    // Emitted with the number of writes that have been dropped since the
+    // last notification, because the disk couldn't keep up
+    void bufferOverruns(int overruns);
 
   private:
     int getActiveTracks();
@@ -75,9 +78,9 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
     QString m_baAuthor;
     QString m_baAlbum;
 
-    QFile m_file;
+    RecordingFileWriter m_fileWriter;
+    int m_reportedOverruns;
     QFile m_cueFile;
-    QDataStream m_dataStream;
 
     ControlProxy* m_pRecReady;
     ControlProxy* m_pSamplerate;
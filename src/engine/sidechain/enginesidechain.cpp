@@ -30,6 +30,7 @@
 #include "engine/sidechain/sidechainworker.h"
 #include "util/counter.h"
 #include "util/event.h"
+#include "util/math.h"
 #include "util/sample.h"
 #include "util/timer.h"
 #include "util/trace.h"
@@ -52,6 +53,7 @@ EngineSideChain::~EngineSideChain() {
     m_waitLock.lock();
     m_bStopThread = true;
     m_waitForSamples.wakeAll();
+    m_waitForSpace.wakeAll();
     m_waitLock.unlock();
 
     // Wait until the thread has finished.
@@ -73,6 +75,23 @@ void EngineSideChain::addSideChainWorker(SideChainWorker* pWorker) {
     m_workers.append(pWorker);
 }
 
+void EngineSideChain::waitForWriteAvailable(int iFrames) {
+    // TODO: remove assumption of stereo buffer
+    const int kChannels = 2;
+    const int iSamples = math_min(iFrames * kChannels, SIDECHAIN_BUFFER_SIZE);
+    QMutexLocker locker(&m_waitLock);
+    while (m_sampleFifo.writeAvailable() < iSamples && !m_bStopThread) {
+        // The sidechain is only woken up by writeSamples() when the FIFO
+        // is almost full.
+        m_waitForSamples.wakeAll();
+        m_waitForSpace.wait(&m_waitLock);
+    }
+}
+
+void EngineSideChain::waitUntilDrained() {
+    waitForWriteAvailable(SIDECHAIN_BUFFER_SIZE);
+}
+
 void EngineSideChain::receiveBuffer(AudioInput input,
                                     const CSAMPLE* pBuffer,
                                     unsigned int iFrames) {
@@ -127,6 +146,10 @@ void EngineSideChain::run() {
             }
         }
 
+        m_waitLock.lock();
+        m_waitForSpace.wakeAll();
+        m_waitLock.unlock();
+
         // Check to see if we're supposed to exit/stop this thread.
         if (m_bStopThread) {
             return;
@@ -49,6 +49,14 @@ class EngineSideChain : public QThread, public AudioDestination {
     // Thread-safe, blocking.
     void addSideChainWorker(SideChainWorker* pWorker);
 
+    // Blocking. Waits until the sidechain has processed enough samples to
+    // accept the given number of frames without an overrun. Must only be
+    // called by the writer thread when it is not running in real-time,
+    // e.g. when rendering offline.
+    void waitForWriteAvailable(int iFrames);
+    // Blocking. Waits until all submitted samples have been processed.
+    void waitUntilDrained();
+
     static const int SIDECHAIN_BUFFER_SIZE = 65536;
 
   private:
@@ -65,6 +73,8 @@ class EngineSideChain : public QThread, public AudioDestination {
     QMutex m_waitLock;
     // Allows sleeping until we have samples to process.
     QWaitCondition m_waitForSamples;
+    // Allows the writer to sleep until samples have been processed.
+    QWaitCondition m_waitForSpace;
 
     // Sidechain workers registered with EngineSideChain.
     MMutex m_workerLock;
@@ -0,0 +1,228 @@
+#include "engine/sidechain/recordingfilewriter.h"
+
+#ifdef __LINUX__
+extern "C" {
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <linux/falloc.h>
+}
+#endif // __LINUX__
+
+#include <cstring>
+
+#include "util/assert.h"
+#include "util/logger.h"
+#include "util/math.h"
+
+namespace {
+
+mixxx::Logger kLogger("RecordingFileWriter");
+
+// Large blocks reduce the number of system calls. A block of uncompressed
+// 44.1 kHz stereo audio lasts about 0.4 s and much longer when compressed.
+const int kBlockSize = 64 * 1024;
+
+// 16 MiB hold more than a minute of uncompressed audio, which is longer
+// than any disk hiccup that can be hidden sensibly.
+const int kBlockCount = 256;
+
+// The file is extended in steps that are large enough to keep it in a
+// few contiguous extents.
+const qint64 kPreallocationSize = 32 * 1024 * 1024;
+
+} // anonymous namespace
+
+RecordingFileWriter::RecordingFileWriter()
+        : m_blocks(kBlockCount),
+          m_readIndex(0),
+          m_writeIndex(0),
+          m_stop(0),
+          m_pCurrentBlock(nullptr),
+          m_position(0),
+          m_size(0),
+          m_overruns(0),
+          m_writeErrors(0),
+          m_filePosition(0),
+          m_allocatedSize(0),
+          m_preallocationFailed(false) {
+    // Allocate all memory upfront instead of while recording
+    for (auto& block : m_blocks) {
+        block.offset = 0;
+        block.size = 0;
+        block.data.resize(kBlockSize);
+    }
+    start(QThread::HighPriority);
+}
+
+RecordingFileWriter::~RecordingFileWriter() {
+    if (isOpen()) {
+        close();
+    }
+    m_stop = 1;
+    m_blocksAvailable.release();
+    wait();
+}
+
+bool RecordingFileWriter::open(const QString& fileName) {
+    DEBUG_ASSERT(!isOpen());
+    m_file.setFileName(fileName);
+    // Unbuffered, because only large blocks are written
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Unbuffered)) {
+        kLogger.warning()
+                << "Failed to open" << fileName
+                << m_file.errorString();
+        return false;
+    }
+    m_pCurrentBlock = nullptr;
+    m_position = 0;
+    m_size = 0;
+    m_overruns = 0;
+    m_writeErrors = 0;
+    m_filePosition = 0;
+    m_allocatedSize = 0;
+    m_preallocationFailed = false;
+    return true;
+}
+
+void RecordingFileWriter::close() {
+    commitBlock();
+    {
+        QMutexLocker locker(&m_drainedMutex);
+        while (m_readIndex.load() != m_writeIndex.load()) {
+            m_drained.wait(&m_drainedMutex);
+        }
+    }
+    // Release the preallocated space behind the end of the recording.
+    // This also extends the file if the data at its end has been dropped.
+    if (!m_file.resize(m_size)) {
+        kLogger.warning()
+                << "Failed to truncate" << m_file.fileName()
+                << m_file.errorString();
+    }
+    m_file.close();
+    if (m_overruns > 0) {
+        kLogger.warning()
+                << "Dropped" << m_overruns
+                << "writes to" << m_file.fileName()
+                << "because the disk was too slow";
+    }
+    if (m_writeErrors.load() > 0) {
+        kLogger.warning()
+                << "Failed to write" << m_writeErrors.load()
+                << "blocks to" << m_file.fileName();
+    }
+}
+
+void RecordingFileWriter::write(const char* data, int size) {
+    DEBUG_ASSERT(isOpen());
+    while (size > 0) {
+        if (m_pCurrentBlock && m_pCurrentBlock->size > 0 &&
+                m_pCurrentBlock->offset + m_pCurrentBlock->size != m_position) {
+            // Discontinued after seeking
+            commitBlock();
+        }
+        if (!m_pCurrentBlock) {
+            m_pCurrentBlock = acquireBlock();
+            if (!m_pCurrentBlock) {
+                // The writer thread is behind by the size of the whole ring
+                ++m_overruns;
+                m_position += size;
+                m_size = math_max(m_size, m_position);
+                return;
+            }
+            m_pCurrentBlock->offset = m_position;
+            m_pCurrentBlock->size = 0;
+        }
+        const int bytesToCopy = math_min(size, kBlockSize - m_pCurrentBlock->size);
+        std::memcpy(m_pCurrentBlock->data.data() + m_pCurrentBlock->size,
+                data, bytesToCopy);
+        m_pCurrentBlock->size += bytesToCopy;
+        m_position += bytesToCopy;
+        m_size = math_max(m_size, m_position);
+        data += bytesToCopy;
+        size -= bytesToCopy;
+        if (m_pCurrentBlock->size == kBlockSize) {
+            commitBlock();
+        }
+    }
+}
+
+RecordingFileWriter::Block* RecordingFileWriter::acquireBlock() {
+    const int writeIndex = m_writeIndex.load();
+    if (writeIndex - m_readIndex.loadAcquire() >= kBlockCount) {
+        return nullptr;
+    }
+    return &m_blocks[writeIndex % kBlockCount];
+}
+
+void RecordingFileWriter::commitBlock() {
+    if (!m_pCurrentBlock) {
+        return;
+    }
+    if (m_pCurrentBlock->size > 0) {
+        m_writeIndex.storeRelease(m_writeIndex.load() + 1);
+        m_blocksAvailable.release();
+    }
+    m_pCurrentBlock = nullptr;
+}
+
+void RecordingFileWriter::run() {
+    while (true) {
+        m_blocksAvailable.acquire();
+        if (m_stop.load()) {
+            return;
+        }
+        const int readIndex = m_readIndex.load();
+        DEBUG_ASSERT(readIndex != m_writeIndex.loadAcquire());
+        writeBlock(m_blocks[readIndex % kBlockCount]);
+        QMutexLocker locker(&m_drainedMutex);
+        m_readIndex.storeRelease(readIndex + 1);
+        m_drained.wakeAll();
+    }
+}
+
+void RecordingFileWriter::writeBlock(const Block& block) {
+    const qint64 end = block.offset + block.size;
+    preallocate(end);
+    if (block.offset != m_filePosition && !m_file.seek(block.offset)) {
+        kLogger.warning()
+                << "Failed to seek in" << m_file.fileName()
+                << m_file.errorString();
+        m_writeErrors.fetchAndAddRelaxed(1);
+        m_filePosition = -1;
+        return;
+    }
+    if (m_file.write(block.data.data(), block.size) != block.size) {
+        kLogger.warning()
+                << "Failed to write" << m_file.fileName()
+                << m_file.errorString();
+        m_writeErrors.fetchAndAddRelaxed(1);
+        // Seek before the next write
+        m_filePosition = -1;
+        return;
+    }
+    m_filePosition = end;
+}
+
+void RecordingFileWriter::preallocate(qint64 end) {
+#ifdef __LINUX__
+    if (m_preallocationFailed || end <= m_allocatedSize) {
+        return;
+    }
+    // Keep the size, so that the file never appears longer than the
+    // recorded data
+    const qint64 allocatedSize = end + kPreallocationSize;
+    if (fallocate(m_file.handle(), FALLOC_FL_KEEP_SIZE,
+                m_allocatedSize, allocatedSize - m_allocatedSize) != 0) {
+        // e.g. EOPNOTSUPP on FAT formatted devices
+        kLogger.debug()
+                << "Preallocation is not supported for" << m_file.fileName()
+                << errno;
+        m_preallocationFailed = true;
+        return;
+    }
+    m_allocatedSize = allocatedSize;
+#else
+    Q_UNUSED(end);
+#endif // __LINUX__
+}
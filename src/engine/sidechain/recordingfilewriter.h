@@ -0,0 +1,107 @@
+#ifndef ENGINE_SIDECHAIN_RECORDINGFILEWRITER_H
+#define ENGINE_SIDECHAIN_RECORDINGFILEWRITER_H
+
+#include <QAtomicInt>
+#include <QFile>
+#include <QMutex>
+#include <QSemaphore>
+#include <QThread>
+#include <QWaitCondition>
+
+#include <vector>
+
+// Decouples the sidechain thread that encodes the recording from the disk.
+//
+// The encoded data is collected in large blocks of a preallocated ring.
+// Complete blocks are written by a separate thread, so a slow disk only
+// delays writing but doesn't block encoding. If the disk is too slow for
+// longer than the ring can buffer, the data that doesn't fit is dropped
+// and counted as an overrun. The dropped range is left as a hole in the
+// file, i.e. as silence in uncompressed formats. Blocks that fail to be
+// written are counted as overruns as well.
+//
+// On Linux the file is preallocated ahead of the written data to avoid
+// fragmentation and metadata updates while recording.
+//
+// All methods except the constructor and destructor must be called by the
+// single thread that encodes the recording.
+class RecordingFileWriter : public QThread {
+    Q_OBJECT
+  public:
+    RecordingFileWriter();
+    ~RecordingFileWriter() override;
+
+    bool open(const QString& fileName);
+    // Blocks until all buffered data has been written
+    void close();
+    bool isOpen() const {
+        return m_file.isOpen();
+    }
+
+    // Stream interface for the encoder. Seeking only affects the
+    // following writes.
+    void write(const char* data, int size);
+    qint64 pos() const {
+        return m_position;
+    }
+    void seek(qint64 position) {
+        m_position = position;
+    }
+    qint64 size() const {
+        return m_size;
+    }
+
+    // The number of writes that didn't fit into the ring and of blocks
+    // that failed to be written, e.g. when the disk is full, since opening
+    // the file. In both cases the data is missing in the file.
+    int overruns() const {
+        return m_overruns + m_writeErrors.load();
+    }
+
+  protected:
+    void run() override;
+
+  private:
+    struct Block {
+        qint64 offset;
+        int size;
+        std::vector<char> data;
+    };
+
+    // Producer side
+    Block* acquireBlock();
+    void commitBlock();
+
+    // Consumer side
+    void writeBlock(const Block& block);
+    void preallocate(qint64 end);
+
+    std::vector<Block> m_blocks;
+    // Blocks in the range [m_readIndex, m_writeIndex) are waiting to be
+    // written. Both indices only increase.
+    QAtomicInt m_readIndex;
+    QAtomicInt m_writeIndex;
+    QSemaphore m_blocksAvailable;
+
+    QMutex m_drainedMutex;
+    QWaitCondition m_drained;
+    QAtomicInt m_stop;
+
+    QFile m_file;
+
+    // Producer state
+    Block* m_pCurrentBlock;
+    qint64 m_position;
+    qint64 m_size;
+    int m_overruns;
+
+    // Counted by the consumer
+    QAtomicInt m_writeErrors;
+
+    // Consumer state
+    qint64 m_filePosition;
+    qint64 m_allocatedSize;
+    bool m_preallocationFailed;
+};
+
+#endif // ENGINE_SIDECHAIN_RECORDINGFILEWRITER_H
@@ -13,6 +13,7 @@
 #include "mixer/playermanager.h"
 #include "library/autodj/autodjprocessor.h"
 #include "library/trackcollection.h"
+#include "library/trackprefetcher.h"
 #include "library/autodj/dlgautodj.h"
 #include "library/treeitem.h"
 #include "library/crate/cratestorage.h"
@@ -57,7 +58,8 @@ AutoDJFeature::AutoDJFeature(Library* pLibrary,
 
     qRegisterMetaType<AutoDJProcessor::AutoDJState>("AutoDJState");
     m_pAutoDJProcessor = new AutoDJProcessor(
-            this, m_pConfig, pPlayerManager, m_iAutoDJPlaylistId, m_pTrackCollection);
+            this, m_pConfig, pPlayerManager, m_iAutoDJPlaylistId, m_pTrackCollection,
+            new TrackPrefetcher(this, m_pConfig, pLibrary->dbConnectionPool()));
     connect(m_pAutoDJProcessor, SIGNAL(loadTrackToPlayer(TrackPointer, QString, bool)),
             this, SIGNAL(loadTrackToPlayer(TrackPointer, QString, bool)));
     m_playlistDao.setAutoDJProcessor(m_pAutoDJProcessor);
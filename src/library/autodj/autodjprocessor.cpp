@@ -1,6 +1,7 @@
 #include "library/autodj/autodjprocessor.h"
 
 #include "library/trackcollection.h"
+#include "library/trackprefetcher.h"
 #include "control/controlpushbutton.h"
 #include "control/controlproxy.h"
 #include "engine/engine.h"
@@ -91,16 +92,31 @@ AutoDJProcessor::AutoDJProcessor(QObject* pParent,
                                  UserSettingsPointer pConfig,
                                  PlayerManagerInterface* pPlayerManager,
                                  int iAutoDJPlaylistId,
-                                 TrackCollection* pTrackCollection)
+                                 TrackCollection* pTrackCollection,
+                                 TrackPrefetcher* pTrackPrefetcher)
         : QObject(pParent),
           m_pConfig(pConfig),
           m_pPlayerManager(pPlayerManager),
           m_pAutoDJTableModel(NULL),
+          m_pTrackPrefetcher(pTrackPrefetcher),
           m_eState(ADJ_DISABLED),
           m_transitionTime(kTransitionPreferenceDefault) {
     m_pAutoDJTableModel = new PlaylistTableModel(this, pTrackCollection,
                                                  "mixxx.db.model.autodj");
     m_pAutoDJTableModel->setTableModel(iAutoDJPlaylistId);
+    if (m_pTrackPrefetcher) {
+        // Follow all changes of the queue
+        connect(m_pAutoDJTableModel, &QAbstractItemModel::rowsInserted,
+                this, &AutoDJProcessor::prefetchUpcomingTracks);
+        connect(m_pAutoDJTableModel, &QAbstractItemModel::rowsRemoved,
+                this, &AutoDJProcessor::prefetchUpcomingTracks);
+        connect(m_pAutoDJTableModel, &QAbstractItemModel::rowsMoved,
+                this, &AutoDJProcessor::prefetchUpcomingTracks);
+        connect(m_pAutoDJTableModel, &QAbstractItemModel::modelReset,
+                this, &AutoDJProcessor::prefetchUpcomingTracks);
+        connect(m_pAutoDJTableModel, &QAbstractItemModel::layoutChanged,
+                this, &AutoDJProcessor::prefetchUpcomingTracks);
+    }
 
     m_pShufflePlaylist = new ControlPushButton(
             ConfigKey("[AutoDJ]", "shuffle_playlist"));
@@ -414,6 +430,7 @@ AutoDJProcessor::AutoDJError AutoDJProcessor::toggleAutoDJ(bool enable) {
         m_pCOCrossfader->set(0);
         emitAutoDJStateChanged(m_eState);
     }
+    prefetchUpcomingTracks();
     return ADJ_OK;
 }
 
@@ -669,6 +686,39 @@ bool AutoDJProcessor::loadNextTrackFromQueue(const DeckAttributes& deck, bool pl
     return true;
 }
 
+void AutoDJProcessor::prefetchUpcomingTracks() {
+    if (!m_pTrackPrefetcher) {
+        return;
+    }
+    if (m_eState == ADJ_DISABLED) {
+        m_pTrackPrefetcher->cancel();
+        return;
+    }
+    QList<TrackPointer> tracks;
+    const int maxTracks = m_pTrackPrefetcher->maxTracks();
+    for (int row = 0;
+            row < m_pAutoDJTableModel->rowCount() && tracks.size() < maxTracks;
+            ++row) {
+        TrackPointer pTrack = m_pAutoDJTableModel->getTrack(
+                m_pAutoDJTableModel->index(row, 0));
+        if (!pTrack) {
+            continue;
+        }
+        // The top of the queue may already be loaded into a deck
+        bool loaded = false;
+        for (const auto* pDeck : m_decks) {
+            if (pDeck->getLoadedTrack() == pTrack) {
+                loaded = true;
+                break;
+            }
+        }
+        if (!loaded) {
+            tracks.append(pTrack);
+        }
+    }
+    m_pTrackPrefetcher->prefetchTracks(tracks);
+}
+
 bool AutoDJProcessor::removeLoadedTrackFromTopOfQueue(const DeckAttributes& deck) {
     return removeTrackFromTopOfQueue(deck.getLoadedTrack());
 }
@@ -894,6 +944,7 @@ void AutoDJProcessor::playerTrackLoaded(DeckAttributes* pDeck, TrackPointer pTra
     } else {
         calculateTransition(getOtherDeck(pDeck, true), pDeck);
     }
+    prefetchUpcomingTracks();
 }
 
 void AutoDJProcessor::playerLoadingTrack(DeckAttributes* pDeck,
@@ -17,6 +17,7 @@ class ControlPushButton;
 class TrackCollection;
 class PlayerManagerInterface;
 class BaseTrackPlayer;
+class TrackPrefetcher;
 
 class DeckAttributes : public QObject {
     Q_OBJECT
@@ -158,7 +159,8 @@ class AutoDJProcessor : public QObject {
                     UserSettingsPointer pConfig,
                     PlayerManagerInterface* pPlayerManager,
                     int iAutoDJPlaylistId,
-                    TrackCollection* pCollection);
+                    TrackCollection* pCollection,
+                    TrackPrefetcher* pTrackPrefetcher = nullptr);
     virtual ~AutoDJProcessor();
 
     AutoDJState getState() const {
@@ -214,6 +216,10 @@ class AutoDJProcessor : public QObject {
     void controlShuffle(double value);
     void controlSkipNext(double value);
 
+    // Prefetches the next tracks of the queue that are not loaded into a
+    // deck yet while Auto DJ is enabled
+    void prefetchUpcomingTracks();
+
   private:
     // Gets or sets the crossfader position while normalizing it so that -1 is
     // all the way mixed to the left side and 1 is all the way mixed to the
@@ -246,6 +252,7 @@ class AutoDJProcessor : public QObject {
     UserSettingsPointer m_pConfig;
     PlayerManagerInterface* m_pPlayerManager;
     PlaylistTableModel* m_pAutoDJTableModel;
+    TrackPrefetcher* m_pTrackPrefetcher;
 
     AutoDJState m_eState;
     double m_transitionTime; // the desired value set by the user
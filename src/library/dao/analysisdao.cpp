@@ -6,6 +6,7 @@
 #include "library/dao/analysisdao.h"
 #include "library/queryutil.h"
 #include "preferences/waveformsettings.h"
+#include "util/assert.h"
 #include "util/performancetimer.h"
 #include "waveform/waveform.h"
 
@@ -81,18 +82,12 @@ QList<AnalysisDao::AnalysisInfo> AnalysisDao::loadAnalysesFromQuery(TrackId trac
         info.type = static_cast<AnalysisType>(query->value(typeColumn).toInt());
         info.description = query->value(descriptionColumn).toString();
         info.version = query->value(versionColumn).toString();
-        int checksum = query->value(dataChecksumColumn).toInt();
-        QString dataPath = analysisPath.absoluteFilePath(
-            QString::number(info.analysisId));
-        QByteArray compressedData = loadDataFromFile(dataPath);
-        int file_checksum = qChecksum(compressedData.constData(),
-                                      compressedData.length());
-        if (checksum != file_checksum) {
-            qDebug() << "WARNING: Corrupt analysis loaded from" << dataPath
-                     << "length" << compressedData.length();
+        if (!loadAnalysisData(
+                analysisPath,
+                query->value(dataChecksumColumn).toInt(),
+                &info)) {
             continue;
         }
-        info.data = qUncompress(compressedData);
         bytes += info.data.length();
         analyses.append(info);
     }
@@ -102,6 +97,81 @@ QList<AnalysisDao::AnalysisInfo> AnalysisDao::loadAnalysesFromQuery(TrackId trac
     return analyses;
 }
 
+void AnalysisDao::visitAnalysesByType(
+        AnalysisType type,
+        const std::function<void(const AnalysisInfo&)>& visitor) {
+    if (!m_db.isOpen()) {
+        return;
+    }
+    PerformanceTimer time;
+    time.start();
+
+    QSqlQuery query(m_db);
+    // Every row is only visited once
+    query.setForwardOnly(true);
+    query.prepare(QString(
+        "SELECT id, track_id, description, version, data_checksum FROM %1 "
+        "WHERE type=:type").arg(s_analysisTableName));
+    query.bindValue(":type", type);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't get analyses of type" << type;
+        return;
+    }
+
+    int count = 0;
+    QSqlRecord queryRecord = query.record();
+    const int idColumn = queryRecord.indexOf("id");
+    const int trackIdColumn = queryRecord.indexOf("track_id");
+    const int descriptionColumn = queryRecord.indexOf("description");
+    const int versionColumn = queryRecord.indexOf("version");
+    const int dataChecksumColumn = queryRecord.indexOf("data_checksum");
+
+    QDir analysisPath(getAnalysisStoragePath());
+    while (query.next()) {
+        AnalysisDao::AnalysisInfo info;
+        info.analysisId = query.value(idColumn).toInt();
+        info.trackId = TrackId(query.value(trackIdColumn));
+        info.type = type;
+        info.description = query.value(descriptionColumn).toString();
+        info.version = query.value(versionColumn).toString();
+        if (!loadAnalysisData(
+                analysisPath,
+                query.value(dataChecksumColumn).toInt(),
+                &info)) {
+            continue;
+        }
+        visitor(info);
+        ++count;
+    }
+    qDebug() << "AnalysisDAO visited" << count << "analyses of type" << type
+             << "in" << time.elapsed().debugMillisWithUnit();
+}
+
+bool AnalysisDao::loadAnalysisData(
+        const QDir& analysisPath,
+        int checksum,
+        AnalysisInfo* pInfo) const {
+    QString dataPath = analysisPath.absoluteFilePath(
+        QString::number(pInfo->analysisId));
+    QByteArray compressedData = loadDataFromFile(dataPath);
+    int file_checksum = qChecksum(compressedData.constData(),
+                                  compressedData.length());
+    if (checksum != file_checksum) {
+        qDebug() << "WARNING: Corrupt analysis loaded from" << dataPath
+                 << "length" << compressedData.length();
+        return false;
+    }
+    if (Waveform::isCompactFormat(compressedData)) {
+        // Compact waveforms are stored as is and compress their
+        // payload themselves if needed. qCompress() data never starts
+        // with the magic, because it would announce more than 1 GB.
+        pInfo->data = compressedData;
+    } else {
+        pInfo->data = qUncompress(compressedData);
+    }
+    return true;
+}
+
 bool AnalysisDao::saveAnalysis(AnalysisDao::AnalysisInfo* info) {
     if (!m_db.isOpen() || info == NULL) {
         return false;
@@ -114,7 +184,8 @@ bool AnalysisDao::saveAnalysis(AnalysisDao::AnalysisInfo* info) {
     PerformanceTimer time;
     time.start();
 
-    QByteArray compressedData = qCompress(info->data, kCompressionLevel);
+    QByteArray compressedData = Waveform::isCompactFormat(info->data) ?
+            info->data : qCompress(info->data, kCompressionLevel);
     int checksum = qChecksum(compressedData.constData(),
                              compressedData.length());
 
@@ -308,18 +379,44 @@ void AnalysisDao::saveTrackAnalyses(
         TrackId trackId,
         ConstWaveformPointer pWaveform,
         ConstWaveformPointer pWaveSummary) {
+    if (queueTrackAnalyses(pWaveform, pWaveSummary)) {
+        saveQueuedTrackAnalyses(trackId, pWaveform, pWaveSummary);
+    }
+}
+
+bool AnalysisDao::queueTrackAnalyses(
+        ConstWaveformPointer pWaveform,
+        ConstWaveformPointer pWaveSummary) const {
     // The only analyses we have at the moment are waveform analyses so we have
     // nothing to do if it is disabled.
     WaveformSettings waveformSettings(m_pConfig);
     if (!waveformSettings.waveformCachingEnabled()) {
-        return;
+        return false;
     }
 
-    // Don't try to save invalid or non-dirty waveforms.
-    if (!pWaveform || pWaveform->saveState() != Waveform::SaveState::SavePending ||
-        !pWaveSummary || pWaveSummary->saveState() != Waveform::SaveState::SavePending) {
-        return;
+    // Don't try to save invalid or non-dirty waveforms. Waveforms that are
+    // already queued are saved by someone else.
+    if (!pWaveform || !pWaveSummary ||
+            !pWaveform->testAndSetSaveState(
+                    Waveform::SaveState::SavePending,
+                    Waveform::SaveState::SaveQueued)) {
+        return false;
+    }
+    if (!pWaveSummary->testAndSetSaveState(
+                Waveform::SaveState::SavePending,
+                Waveform::SaveState::SaveQueued)) {
+        pWaveform->setSaveState(Waveform::SaveState::SavePending);
+        return false;
     }
+    return true;
+}
+
+void AnalysisDao::saveQueuedTrackAnalyses(
+        TrackId trackId,
+        ConstWaveformPointer pWaveform,
+        ConstWaveformPointer pWaveSummary) {
+    DEBUG_ASSERT(pWaveform->saveState() == Waveform::SaveState::SaveQueued);
+    DEBUG_ASSERT(pWaveSummary->saveState() == Waveform::SaveState::SaveQueued);
 
     AnalysisDao::AnalysisInfo analysis;
     analysis.trackId = trackId;
@@ -329,11 +426,13 @@ void AnalysisDao::saveTrackAnalyses(
     analysis.type = AnalysisDao::TYPE_WAVEFORM;
     analysis.description = pWaveform->getDescription();
     analysis.version = pWaveform->getVersion();
-    analysis.data = pWaveform->toByteArray();
+    // The big waveform is only needed when a track is loaded into a deck.
+    // Compressing it halves the disk usage.
+    analysis.data = pWaveform->toByteArray(true);
     bool success = saveAnalysis(&analysis);
-    if (success) {
-        pWaveform->setSaveState(Waveform::SaveState::Saved);
-    }
+    // Failed saves are retried with the next save of the track
+    pWaveform->setSaveState(success ?
+            Waveform::SaveState::Saved : Waveform::SaveState::SavePending);
 
     qDebug() << (success ? "Saved" : "Failed to save")
                  << "waveform analysis for trackId" << trackId
@@ -341,15 +440,17 @@ void AnalysisDao::saveTrackAnalyses(
 
     // Clear analysisId since we are re-using the AnalysisInfo
     analysis.analysisId = -1;
+    if (pWaveSummary->getId() != -1) {
+        analysis.analysisId = pWaveSummary->getId();
+    }
     analysis.type = AnalysisDao::TYPE_WAVESUMMARY;
     analysis.description = pWaveSummary->getDescription();
     analysis.version = pWaveSummary->getVersion();
     analysis.data = pWaveSummary->toByteArray();
 
     success = saveAnalysis(&analysis);
-    if (success) {
-        pWaveSummary->setSaveState(Waveform::SaveState::Saved);
-    }
+    pWaveSummary->setSaveState(success ?
+            Waveform::SaveState::Saved : Waveform::SaveState::SavePending);
     qDebug() << (success ? "Saved" : "Failed to save")
              << "waveform summary analysis for trackId" << trackId
              << "analysisId" << analysis.analysisId;
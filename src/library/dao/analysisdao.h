@@ -5,6 +5,8 @@
 #include <QDir>
 #include <QSqlDatabase>
 
+#include <functional>
+
 #include "preferences/usersettings.h"
 #include "library/dao/dao.h"
 #include "track/trackid.h"
@@ -17,7 +19,8 @@ class AnalysisDao : public DAO {
     enum AnalysisType {
         TYPE_UNKNOWN = 0,
         TYPE_WAVEFORM,
-        TYPE_WAVESUMMARY
+        TYPE_WAVESUMMARY,
+        TYPE_FINGERPRINT
     };
 
     struct AnalysisInfo {
@@ -52,6 +55,11 @@ class AnalysisDao : public DAO {
 
     QList<AnalysisInfo> getAnalysesForTrackByType(TrackId trackId, AnalysisType type);
     QList<AnalysisInfo> getAnalysesForTrack(TrackId trackId);
+    // Loads the analyses of all tracks one after another without
+    // keeping them in memory
+    void visitAnalysesByType(
+            AnalysisType type,
+            const std::function<void(const AnalysisInfo&)>& visitor);
     bool saveAnalysis(AnalysisInfo* analysis);
     bool deleteAnalysis(const int analysisId);
     void deleteAnalyses(const QList<TrackId>& trackIds);
@@ -62,12 +70,28 @@ class AnalysisDao : public DAO {
             ConstWaveformPointer pWaveform,
             ConstWaveformPointer pWaveSummary);
 
+    // Marks the waveforms as queued if they need to be saved. Only the
+    // single caller that succeeds saves them with saveQueuedTrackAnalyses(),
+    // e.g. asynchronously on another thread.
+    bool queueTrackAnalyses(
+            ConstWaveformPointer pWaveform,
+            ConstWaveformPointer pWaveSummary) const;
+    void saveQueuedTrackAnalyses(
+            TrackId trackId,
+            ConstWaveformPointer pWaveform,
+            ConstWaveformPointer pWaveSummary);
+
   private:
     QDir getAnalysisStoragePath() const;
     QByteArray loadDataFromFile(const QString& fileName) const;
     bool saveDataToFile(const QString& fileName, const QByteArray& data) const;
     bool deleteFile(const QString& filename) const;
     QList<AnalysisInfo> loadAnalysesFromQuery(TrackId trackId, QSqlQuery* query);
+    // Returns false if the stored data is corrupt
+    bool loadAnalysisData(
+            const QDir& analysisPath,
+            int checksum,
+            AnalysisInfo* pInfo) const;
 
     UserSettingsPointer m_pConfig;
     QSqlDatabase m_db;
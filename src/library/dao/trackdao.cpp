@@ -1378,17 +1378,69 @@ TrackPointer TrackDAO::getTrack(TrackId trackId) const {
 
 // Saves a track's info back to the database
 bool TrackDAO::updateTrack(Track* pTrack) {
-    const TrackId trackId = pTrack->getId();
+    SqlTransaction transaction(m_database);
+    // PerformanceTimer time;
+    // time.start();
+
+    if (!updateTrackRecord(*pTrack)) {
+        return false;
+    }
+    transaction.commit();
+
+    //qDebug() << "Update track in database took: " << time.elapsed().formatMillisWithUnit();
+    //time.start();
+    pTrack->markClean();
+    //qDebug() << "Dirtying track took: " << time.elapsed().formatMillisWithUnit();
+    return true;
+}
+
+QList<TrackId> TrackDAO::saveTracks(
+        const QList<Track*>& tracks,
+        const QList<int>& dirtyRevisions) {
+    DEBUG_ASSERT(tracks.size() == dirtyRevisions.size());
+    QList<Track*> updatedTracks;
+    QList<int> updatedDirtyRevisions;
+    {
+        SqlTransaction transaction(m_database);
+        for (int i = 0; i < tracks.size(); ++i) {
+            Track* pTrack = tracks[i];
+            DEBUG_ASSERT(pTrack);
+            // Only update the database if the track has already been added!
+            if (!pTrack->isDirty() || !pTrack->getId().isValid()) {
+                continue;
+            }
+            if (updateTrackRecord(*pTrack)) {
+                updatedTracks.append(pTrack);
+                updatedDirtyRevisions.append(dirtyRevisions.value(i));
+            }
+        }
+        if (updatedTracks.isEmpty() || !transaction.commit()) {
+            return QList<TrackId>();
+        }
+    }
+
+    QList<TrackId> trackIds;
+    trackIds.reserve(updatedTracks.size());
+    for (int i = 0; i < updatedTracks.size(); ++i) {
+        Track* pTrack = updatedTracks[i];
+        const TrackId trackId = pTrack->getId();
+        trackIds.append(trackId);
+        // The saved record might not contain all modifications
+        if (pTrack->markClean(updatedDirtyRevisions[i])) {
+            emit(trackClean(trackId));
+        }
+    }
+    return trackIds;
+}
+
+bool TrackDAO::updateTrackRecord(const Track& track) {
+    const TrackId trackId = track.getId();
     DEBUG_ASSERT(trackId.isValid());
 
     qDebug() << "TrackDAO:"
             << "Updating track in database"
             << trackId
-            << pTrack->getLocation();
-
-    SqlTransaction transaction(m_database);
-    // PerformanceTimer time;
-    // time.start();
+            << track.getLocation();
 
     QSqlQuery query(m_database);
 
@@ -1435,7 +1487,7 @@ bool TrackDAO::updateTrack(Track* pTrack) {
             " WHERE id=:track_id");
 
     query.bindValue(":track_id", trackId.toVariant());
-    bindTrackLibraryValues(&query, *pTrack);
+    bindTrackLibraryValues(&query, track);
 
     if (!query.exec()) {
         LOG_FAILED_QUERY(query);
@@ -1451,16 +1503,10 @@ bool TrackDAO::updateTrack(Track* pTrack) {
     //time.start();
     m_analysisDao.saveTrackAnalyses(
             trackId,
-            pTrack->getWaveform(),
-            pTrack->getWaveformSummary());
+            track.getWaveform(),
+            track.getWaveformSummary());
     m_cueDao.saveTrackCues(
-            trackId, pTrack->getCuePoints());
-    transaction.commit();
-
-    //qDebug() << "Update track in database took: " << time.elapsed().formatMillisWithUnit();
-    //time.start();
-    pTrack->markClean();
-    //qDebug() << "Dirtying track took: " << time.elapsed().formatMillisWithUnit();
+            trackId, track.getCuePoints());
     return true;
 }
 
@@ -1531,44 +1577,59 @@ void TrackDAO::markUnverifiedTracksAsDeleted() {
     }
 }
 
+QList<TrackDAO::DeletedTrackLocation> TrackDAO::getDeletedTrackLocations() {
+    // Query tracks, where we need a successor for
+    QSqlQuery query(m_database);
+    query.setForwardOnly(true);
+    query.prepare("SELECT track_locations.id, filename, duration FROM track_locations "
+                  "INNER JOIN library ON track_locations.id=library.location "
+                  "WHERE fs_deleted=1");
+    QList<DeletedTrackLocation> deletedTrackLocations;
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return deletedTrackLocations;
+    }
+
+    const QSqlRecord queryRecord = query.record();
+    const int idColumn = queryRecord.indexOf("id");
+    const int filenameColumn = queryRecord.indexOf("filename");
+    const int durationColumn = queryRecord.indexOf("duration");
+    while (query.next()) {
+        DeletedTrackLocation deletedTrackLocation;
+        deletedTrackLocation.locationId = DbId(query.value(idColumn));
+        deletedTrackLocation.filename = query.value(filenameColumn).toString();
+        // rather use duration then filesize as an indicator of changes. The filesize
+        // can change by adding more ID3v2 tags
+        deletedTrackLocation.duration = query.value(durationColumn).toInt();
+        deletedTrackLocations.append(deletedTrackLocation);
+    }
+    return deletedTrackLocations;
+}
+
 // Look for moved files. Look for files that have been marked as
 // "deleted on disk" and see if another "file" with the same name and
 // files size exists in the track_locations table. That means the file has
 // moved instead of being deleted outright, and so we can salvage your
 // existing metadata that you have in your DB (like cue points, etc.).
-// returns falls if canceled
-bool TrackDAO::detectMovedTracks(QSet<TrackId>* pTracksMovedSetOld,
-        QSet<TrackId>* pTracksMovedSetNew,
+void TrackDAO::detectMovedTracks(
+        const QList<DeletedTrackLocation>& deletedTrackLocations,
         const QStringList& addedTracks,
-        volatile const bool* pCancel) {
+        QSet<TrackId>* pTracksMovedSetOld,
+        QSet<TrackId>* pTracksMovedSetNew) {
     // This function should not start a transaction on it's own!
     // When it's called from libraryscanner.cpp, there already is a transaction
     // started!
 
-    if (!addedTracks.size()) {
+    if (deletedTrackLocations.isEmpty() || addedTracks.isEmpty()) {
         // We have no moved track.
         // We can only guarantee for new tracks that the user has not
         // edited metadata, which we have to preserve
         // TODO(xxx) resolve old duplicates
-        return true;
+        return;
     }
 
-    QSqlQuery deletedTrackQuery(m_database);
     QSqlQuery newTrackQuery(m_database);
     QSqlQuery query(m_database);
-    QString filename;
-    // rather use duration then filesize as an indicator of changes. The filesize
-    // can change by adding more ID3v2 tags
-    int duration = -1;
-
-    // Query tracks, where we need a successor for
-    deletedTrackQuery.prepare("SELECT track_locations.id, filename, duration FROM track_locations "
-                  "INNER JOIN library ON track_locations.id=library.location "
-                  "WHERE fs_deleted=1");
-
-    if (!deletedTrackQuery.exec()) {
-        LOG_FAILED_QUERY(deletedTrackQuery);
-    }
 
     // Query possible successors
     // NOTE: Successors are identified by filename and duration (in seconds).
@@ -1582,20 +1643,11 @@ bool TrackDAO::detectMovedTracks(QSet<TrackId>* pTracksMovedSetOld,
                     "ABS(duration - :duration) < 1").arg(
                             SqlStringFormatter::formatList(m_database, addedTracks)));
 
-    QSqlRecord queryRecord = deletedTrackQuery.record();
-    const int idColumn = queryRecord.indexOf("id");
-    const int filenameColumn = queryRecord.indexOf("filename");
-    const int durationColumn = queryRecord.indexOf("duration");
-
-    // For each track that's been "deleted" on disk...
-    while (deletedTrackQuery.next()) {
-        if (*pCancel) {
-            return false;
-        }
+    for (const auto& deletedTrackLocation : deletedTrackLocations) {
         DbId newTrackLocationId;
-        DbId oldTrackLocationId(deletedTrackQuery.value(idColumn));
-        filename = deletedTrackQuery.value(filenameColumn).toString();
-        duration = deletedTrackQuery.value(durationColumn).toInt();
+        const DbId oldTrackLocationId = deletedTrackLocation.locationId;
+        const QString& filename = deletedTrackLocation.filename;
+        const int duration = deletedTrackLocation.duration;
 
         qDebug() << "TrackDAO::detectMovedTracks looking for a successor of" << filename << duration;
 
@@ -1614,7 +1666,6 @@ bool TrackDAO::detectMovedTracks(QSet<TrackId>* pTracksMovedSetOld,
         while (newTrackQuery.next()) {
             newTrackLocationId = DbId(newTrackQuery.value(query2idColumn));
         }
-
         //If we found a moved track...
         if (newTrackLocationId.isValid()) {
             qDebug() << "Found moved track!" << filename;
@@ -1683,7 +1734,6 @@ bool TrackDAO::detectMovedTracks(QSet<TrackId>* pTracksMovedSetOld,
             }
         }
     }
-    return true;
 }
 
 void TrackDAO::markTracksAsMixxxDeleted(const QString& dir) {
@@ -1715,74 +1765,41 @@ void TrackDAO::markTracksAsMixxxDeleted(const QString& dir) {
     }
 }
 
-bool TrackDAO::verifyRemainingTracks(
-        const QStringList& libraryRootDirs,
-        volatile const bool* pCancel) {
-    // This function is called from the LibraryScanner Thread, which also has a
-    // transaction running, so we do NOT NEED to use one here
-    QSqlQuery query(m_database);
-    QSqlQuery query2(m_database);
-
+QStringList TrackDAO::getUnverifiedTrackLocations() {
     // Because all tracks were marked with needs_verification anything that is
     // not inside one of the tracked library directories will need an explicit
     // check if it exists.
     // TODO(kain88) check if all others are marked with 0 again
+    QSqlQuery query(m_database);
     query.setForwardOnly(true);
     query.prepare("SELECT location "
                   "FROM track_locations "
                   "WHERE needs_verification = 1");
+    QStringList locations;
     if (!query.exec()) {
         LOG_FAILED_QUERY(query);
-        return false;
+        return locations;
     }
-
-    query2.prepare("UPDATE track_locations "
-                   "SET fs_deleted=:fs_deleted, needs_verification=0 "
-                   "WHERE location=:location");
-
     const int locationColumn = query.record().indexOf("location");
-    QString trackLocation;
     while (query.next()) {
-        trackLocation = query.value(locationColumn).toString();
-        int fs_deleted = 0;
-        for (const auto& dir: libraryRootDirs) {
-            if (trackLocation.startsWith(dir)) {
-                // Track is under the library root,
-                // but was not verified.
-                // This happens if the track was deleted
-                // a symlink duplicate or on a non normalized
-                // path like on non case sensitive file systems.
-                fs_deleted = 1;
-                break;
-            }
-        }
-
-        if (fs_deleted == 0) {
-            fs_deleted = QFile::exists(trackLocation) ? 0 : 1;
-        }
-
-        query2.bindValue(":fs_deleted", fs_deleted);
-        query2.bindValue(":location", trackLocation);
-        if (!query2.exec()) {
-            LOG_FAILED_QUERY(query2);
-        }
-        emit(progressVerifyTracksOutside(trackLocation));
-        if (*pCancel) {
-            return false;
-        }
+        locations.append(query.value(locationColumn).toString());
     }
-    return true;
+    return locations;
 }
 
-struct TrackWithoutCover {
-    TrackId trackId;
-    QString trackLocation;
-    QString directoryPath;
-    QString trackAlbum;
-};
+void TrackDAO::markTrackLocationsAsDeleted(const QStringList& locations) {
+    QSqlQuery query(m_database);
+    query.prepare(QString("UPDATE track_locations "
+                          "SET needs_verification=0, fs_deleted=1 "
+                          "WHERE location IN (%1)").arg(
+                                  SqlStringFormatter::formatList(m_database, locations)));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query)
+                << "Couldn't mark track locations as deleted.";
+    }
+}
 
-void TrackDAO::detectCoverArtForTracksWithoutCover(volatile const bool* pCancel,
-                                              QSet<TrackId>* pTracksChanged) {
+QList<TrackDAO::TrackWithoutCover> TrackDAO::getTracksWithoutCover() {
     // WARNING TO ANYONE TOUCHING THIS IN THE FUTURE
     // The library contains user selected cover art. There is nothing worse than
     // spending hours curating your library only to have an automated search
@@ -1805,21 +1822,17 @@ void TrackDAO::detectCoverArtForTracksWithoutCover(volatile const bool* pCancel,
                   "WHERE coverart_source IS NULL or coverart_source = 0 "
                   "ORDER BY track_locations.directory");
 
-    QVector<TrackWithoutCover> tracksWithoutCover;
+    QList<TrackWithoutCover> tracksWithoutCover;
 
     if (!query.exec()) {
         LOG_FAILED_QUERY(query)
                 << "failed looking for tracks with unknown cover art";
-        return;
+        return tracksWithoutCover;
     }
 
     // We quickly iterate through the results to prevent blocking the database
     // for other operations. Bug #1399981.
     while (query.next()) {
-        if (*pCancel) {
-            return;
-        }
-
         TrackWithoutCover track;
         track.trackId = TrackId(query.value(0));
         track.trackLocation = query.value(1).toString();
@@ -1830,13 +1843,20 @@ void TrackDAO::detectCoverArtForTracksWithoutCover(volatile const bool* pCancel,
         CoverInfo::Source source = static_cast<CoverInfo::Source>(
             query.value(4).toInt());
         VERIFY_OR_DEBUG_ASSERT(source != CoverInfo::USER_SELECTED) {
-            qWarning() << "PROGRAMMING ERROR! detectCoverArtForTracksWithoutCover()"
+            qWarning() << "PROGRAMMING ERROR! getTracksWithoutCover()"
                        << "got a USER_SELECTED track. Skipping.";
             continue;
         }
         tracksWithoutCover.append(track);
     }
+    return tracksWithoutCover;
+}
 
+void TrackDAO::updateGuessedCoverArt(
+        const QList<QPair<TrackId, CoverInfoRelative>>& coverArt,
+        QSet<TrackId>* pTracksChanged) {
+    // The user might have selected a cover in the meantime, which must not
+    // be overwritten
     QSqlQuery updateQuery(m_database);
     updateQuery.prepare(
         "UPDATE library SET "
@@ -1844,68 +1864,22 @@ void TrackDAO::detectCoverArtForTracksWithoutCover(volatile const bool* pCancel,
         "  coverart_source=:coverart_source,"
         "  coverart_hash=:coverart_hash,"
         "  coverart_location=:coverart_location "
-        "WHERE id=:track_id");
-
-
-    QString currentDirectoryPath;
-    MDir currentDirectory;
-    QLinkedList<QFileInfo> possibleCovers;
-
-    for (const auto& track: tracksWithoutCover) {
-        if (*pCancel) {
-            return;
-        }
-
-        //qDebug() << "Searching for cover art for" << trackLocation;
-        emit(progressCoverArt(track.trackLocation));
-
-        QFileInfo trackInfo(track.trackLocation);
-        if (!trackInfo.exists()) {
-            //qDebug() << trackLocation << "does not exist";
-            continue;
-        }
-
-        QImage image(CoverArtUtils::extractEmbeddedCover(trackInfo));
-        if (!image.isNull()) {
-            updateQuery.bindValue(":coverart_type",
-                                  static_cast<int>(CoverInfo::METADATA));
-            updateQuery.bindValue(":coverart_source",
-                                  static_cast<int>(CoverInfo::GUESSED));
-            // TODO() here we may introduce a duplicate hash code
-            updateQuery.bindValue(":coverart_hash",
-                                  CoverArtUtils::calculateHash(image));
-            updateQuery.bindValue(":coverart_location", "");
-            updateQuery.bindValue(":track_id", track.trackId.toVariant());
-            if (!updateQuery.exec()) {
-                LOG_FAILED_QUERY(updateQuery) << "failed to write metadata cover";
-            } else {
-                pTracksChanged->insert(track.trackId);
-            }
-            continue;
-        }
-
-        if (track.directoryPath != currentDirectoryPath) {
-            possibleCovers.clear();
-            currentDirectoryPath = track.directoryPath;
-            currentDirectory = MDir(currentDirectoryPath);
-            possibleCovers = CoverArtUtils::findPossibleCoversInFolder(
-                currentDirectoryPath);
-        }
-
-        CoverInfoRelative coverInfo = CoverArtUtils::selectCoverArtForTrack(
-            trackInfo.baseName(), track.trackAlbum, possibleCovers);
+        "WHERE id=:track_id AND "
+        "  (coverart_source IS NULL OR coverart_source = 0)");
 
+    for (const auto& trackCoverArt : coverArt) {
+        const CoverInfoRelative& coverInfo = trackCoverArt.second;
         updateQuery.bindValue(":coverart_type",
                               static_cast<int>(coverInfo.type));
         updateQuery.bindValue(":coverart_source",
                               static_cast<int>(coverInfo.source));
         updateQuery.bindValue(":coverart_hash", coverInfo.hash);
         updateQuery.bindValue(":coverart_location", coverInfo.coverLocation);
-        updateQuery.bindValue(":track_id", track.trackId.toVariant());
+        updateQuery.bindValue(":track_id", trackCoverArt.first.toVariant());
         if (!updateQuery.exec()) {
-            LOG_FAILED_QUERY(updateQuery) << "failed to write file or none cover";
-        } else {
-            pTracksChanged->insert(track.trackId);
+            LOG_FAILED_QUERY(updateQuery) << "failed to write guessed cover";
+        } else if (updateQuery.numRowsAffected() > 0) {
+            pTracksChanged->insert(trackCoverArt.first);
         }
     }
 }
@@ -5,10 +5,12 @@
 #include <QObject>
 #include <QSet>
 #include <QList>
+#include <QPair>
 #include <QSqlDatabase>
 #include <QString>
 
 #include "preferences/usersettings.h"
+#include "library/coverart.h"
 #include "library/dao/dao.h"
 #include "track/globaltrackcache.h"
 #include "util/class.h"
@@ -90,19 +92,47 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     void markTracksInDirectoriesAsVerified(const QStringList& directories);
     void invalidateTrackLocationsInLibrary();
     void markUnverifiedTracksAsDeleted();
-    bool detectMovedTracks(QSet<TrackId>* pTracksMovedSetOld,
-                          QSet<TrackId>* pTracksMovedSetNew,
-                          const QStringList& addedTracks,
-                          volatile const bool* pCancel);
 
-    bool verifyRemainingTracks(
-            const QStringList& libraryRootDirs,
-            volatile const bool* pCancel);
-
-    void detectCoverArtForTracksWithoutCover(volatile const bool* pCancel,
-                                        QSet<TrackId>* pTracksChanged);
+    // The following calls only access the database. The library scanner
+    // checks the file system on its own thread, so that slow disks don't
+    // block the writer connection.
+    QStringList getUnverifiedTrackLocations();
+    void markTrackLocationsAsDeleted(const QStringList& locations);
+
+    struct DeletedTrackLocation {
+        DbId locationId;
+        QString filename;
+        int duration;
+    };
+    QList<DeletedTrackLocation> getDeletedTrackLocations();
+    // Moves the metadata of the deleted track locations to their successors
+    // among the added tracks
+    void detectMovedTracks(const QList<DeletedTrackLocation>& deletedTrackLocations,
+                           const QStringList& addedTracks,
+                           QSet<TrackId>* pTracksMovedSetOld,
+                           QSet<TrackId>* pTracksMovedSetNew);
+
+    struct TrackWithoutCover {
+        TrackId trackId;
+        QString trackLocation;
+        QString directoryPath;
+        QString trackAlbum;
+    };
+    QList<TrackWithoutCover> getTracksWithoutCover();
+    // Only updates tracks whose cover art is still unknown and adds them
+    // to pTracksChanged
+    void updateGuessedCoverArt(
+            const QList<QPair<TrackId, CoverInfoRelative>>& coverArt,
+            QSet<TrackId>* pTracksChanged);
 
     void saveTrack(Track* pTrack);
+    // Saves all dirty tracks within a single database transaction and
+    // returns the ids of the tracks that have been saved. The dirty
+    // revisions must have been obtained before the tracks are saved.
+    // Tracks that have been modified since then remain dirty.
+    QList<TrackId> saveTracks(
+            const QList<Track*>& tracks,
+            const QList<int>& dirtyRevisions);
 
   signals:
     void trackDirty(TrackId trackId) const;
@@ -111,8 +141,6 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     void tracksAdded(QSet<TrackId> trackIds);
     void tracksRemoved(QSet<TrackId> trackIds);
     void dbTrackAdded(TrackPointer pTrack);
-    void progressVerifyTracksOutside(QString path);
-    void progressCoverArt(QString file);
     void forceModelUpdate();
 
   public slots:
@@ -129,6 +157,9 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     TrackPointer getTrackFromDB(TrackId trackId) const;
 
     bool updateTrack(Track* pTrack);
+    // Updates the library record, analyses and cues of the track
+    // within the current transaction.
+    bool updateTrackRecord(const Track& track);
 
     // Callback for GlobalTrackCache
     QFileInfo relocateCachedTrack(
@@ -0,0 +1,149 @@
+#include "library/duplicatetrackfinder.h"
+
+#include <QMultiHash>
+#include <QSet>
+#include <QtConcurrentRun>
+
+#include <algorithm>
+
+#include "analyzer/analyzerchromaprint.h"
+#include "library/dao/analysisdao.h"
+#include "library/trackcollection.h"
+#include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+#include "util/logger.h"
+#include "util/performancetimer.h"
+
+namespace {
+
+mixxx::Logger kLogger("DuplicateTrackFinder");
+
+} // anonymous namespace
+
+// Different encodings of the same audio have ~95% equal bits and
+// unrelated tracks ~50%
+const double DuplicateTrackFinder::kMinSimilarity = 0.9;
+
+DuplicateTrackFinder::DuplicateTrackFinder(
+        QObject* pParent,
+        UserSettingsPointer pConfig,
+        mixxx::DbConnectionPoolPtr pDbConnectionPool,
+        TrackCollection* pTrackCollection)
+        : QObject(pParent),
+          m_pConfig(pConfig),
+          m_pDbConnectionPool(pDbConnectionPool),
+          m_pTrackCollection(pTrackCollection) {
+    connect(&m_watcher, SIGNAL(finished()),
+            this, SLOT(slotFinished()));
+}
+
+DuplicateTrackFinder::~DuplicateTrackFinder() {
+    // The worker thread accesses the members
+    m_watcher.waitForFinished();
+}
+
+void DuplicateTrackFinder::findDuplicates() {
+    if (isSearching()) {
+        return;
+    }
+    m_watcher.setFuture(QtConcurrent::run(
+            this, &DuplicateTrackFinder::searchDuplicates));
+}
+
+QList<FingerprintIndex::Duplicate> DuplicateTrackFinder::searchDuplicates() const {
+    // Searching only reads and never competes for the write lock
+    const mixxx::DbConnectionPooler dbConnectionPooler(
+            m_pDbConnectionPool, mixxx::DbConnection::AccessMode::ReadOnly);
+    QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
+    if (!dbConnection.isOpen()) {
+        kLogger.warning()
+                << "Failed to open database connection for finding duplicates";
+        return QList<FingerprintIndex::Duplicate>();
+    }
+    AnalysisDao analysisDao(m_pConfig);
+    analysisDao.initialize(dbConnection);
+
+    PerformanceTimer timer;
+    timer.start();
+    FingerprintIndex index;
+    loadFingerprints(&analysisDao, &index);
+    const QList<FingerprintIndex::Duplicate> duplicates =
+            index.findDuplicates(kMinSimilarity);
+    kLogger.info()
+            << "Found" << duplicates.size()
+            << "pairs of duplicates among" << index.size()
+            << "tracks in" << timer.elapsed().debugMillisWithUnit();
+    return duplicates;
+}
+
+// static
+void DuplicateTrackFinder::loadFingerprints(
+        AnalysisDao* pAnalysisDao,
+        FingerprintIndex* pIndex) {
+    DEBUG_ASSERT(pAnalysisDao);
+    DEBUG_ASSERT(pIndex);
+    pAnalysisDao->visitAnalysesByType(
+            AnalysisDao::TYPE_FINGERPRINT,
+            [pIndex](const AnalysisDao::AnalysisInfo& analysis) {
+                const RawFingerprint fingerprint =
+                        AnalyzerChromaprint::fingerprintFromAnalysis(analysis);
+                // Outdated fingerprints are replaced during the next
+                // analysis of the track
+                if (!fingerprint.empty()) {
+                    pIndex->insert(analysis.trackId, fingerprint);
+                }
+            });
+}
+
+// static
+QList<TrackId> DuplicateTrackFinder::sortDuplicates(
+        const QList<FingerprintIndex::Duplicate>& duplicates) {
+    QMultiHash<TrackId, TrackId> neighbors;
+    for (const auto& duplicate : duplicates) {
+        neighbors.insert(duplicate.trackId, duplicate.otherTrackId);
+        neighbors.insert(duplicate.otherTrackId, duplicate.trackId);
+    }
+    QList<TrackId> trackIds = neighbors.uniqueKeys();
+    std::sort(trackIds.begin(), trackIds.end());
+
+    // Each group starts with the track that has been added first
+    QList<TrackId> sortedTrackIds;
+    QSet<TrackId> visited;
+    for (const auto& trackId : trackIds) {
+        if (visited.contains(trackId)) {
+            continue;
+        }
+        visited.insert(trackId);
+        const int groupStart = sortedTrackIds.size();
+        sortedTrackIds.append(trackId);
+        for (int i = groupStart; i < sortedTrackIds.size(); ++i) {
+            QList<TrackId> groupTrackIds = neighbors.values(sortedTrackIds[i]);
+            std::sort(groupTrackIds.begin(), groupTrackIds.end());
+            for (const auto& groupTrackId : groupTrackIds) {
+                if (!visited.contains(groupTrackId)) {
+                    visited.insert(groupTrackId);
+                    sortedTrackIds.append(groupTrackId);
+                }
+            }
+        }
+    }
+    return sortedTrackIds;
+}
+
+void DuplicateTrackFinder::slotFinished() {
+    const QList<TrackId> trackIds = sortDuplicates(m_watcher.result());
+    if (trackIds.isEmpty()) {
+        emit finished(-1, 0);
+        return;
+    }
+    PlaylistDAO& playlistDao = m_pTrackCollection->getPlaylistDAO();
+    QString name = tr("Duplicates");
+    const int playlistId = playlistDao.createUniquePlaylist(&name);
+    if (playlistId == -1 ||
+            !playlistDao.appendTracksToPlaylist(trackIds, playlistId)) {
+        kLogger.warning() << "Failed to create playlist" << name;
+        emit finished(-1, 0);
+        return;
+    }
+    emit finished(playlistId, trackIds.size());
+}
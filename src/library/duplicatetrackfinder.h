@@ -0,0 +1,63 @@
+#ifndef DUPLICATETRACKFINDER_H
+#define DUPLICATETRACKFINDER_H
+
+#include <QFutureWatcher>
+#include <QList>
+#include <QObject>
+
+#include "musicbrainz/fingerprintindex.h"
+#include "preferences/usersettings.h"
+#include "util/db/dbconnectionpool.h"
+
+class AnalysisDao;
+class TrackCollection;
+
+// Finds tracks with the same audio by the fingerprints that have been
+// stored during analysis and collects them in a new playlist. The stored
+// fingerprints are loaded and compared in a worker thread. Only the
+// playlist is created in the GUI thread.
+class DuplicateTrackFinder : public QObject {
+    Q_OBJECT
+  public:
+    DuplicateTrackFinder(
+            QObject* pParent,
+            UserSettingsPointer pConfig,
+            mixxx::DbConnectionPoolPtr pDbConnectionPool,
+            TrackCollection* pTrackCollection);
+    ~DuplicateTrackFinder() override;
+
+    // Starts searching for duplicates. Ignored while searching.
+    void findDuplicates();
+
+    bool isSearching() const {
+        return m_watcher.isRunning();
+    }
+
+    // Loads all stored fingerprints that are up to date into the index
+    static void loadFingerprints(
+            AnalysisDao* pAnalysisDao,
+            FingerprintIndex* pIndex);
+
+    // The tracks of each group of duplicates are adjacent
+    static QList<TrackId> sortDuplicates(
+            const QList<FingerprintIndex::Duplicate>& duplicates);
+
+    static const double kMinSimilarity;
+
+  signals:
+    // Emitted with an invalid playlist id if no duplicates have been found
+    void finished(int playlistId, int numTracks);
+
+  private slots:
+    void slotFinished();
+
+  private:
+    QList<FingerprintIndex::Duplicate> searchDuplicates() const;
+
+    const UserSettingsPointer m_pConfig;
+    const mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+    TrackCollection* const m_pTrackCollection;
+    QFutureWatcher<QList<FingerprintIndex::Duplicate>> m_watcher;
+};
+
+#endif // DUPLICATETRACKFINDER_H
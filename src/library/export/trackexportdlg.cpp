@@ -12,7 +12,8 @@ TrackExportDlg::TrackExportDlg(QWidget *parent,
         : QDialog(parent),
           Ui::DlgTrackExport(),
           m_pConfig(pConfig),
-          m_worker(worker) {
+          m_worker(worker),
+          m_bytesPerSecond(0.0) {
     setupUi(this);
     connect(cancelButton, SIGNAL(clicked()), this, SLOT(cancelButtonClicked()));
     exportProgress->setMinimum(0);
@@ -23,6 +24,8 @@ TrackExportDlg::TrackExportDlg(QWidget *parent,
 
     connect(m_worker, SIGNAL(progress(QString, int, int)), this,
             SLOT(slotProgress(QString, int, int)));
+    connect(m_worker, SIGNAL(throughput(double)),
+            this, SLOT(slotThroughput(double)));
     connect(m_worker,
             SIGNAL(askOverwriteMode(QString, std::promise<TrackExportWorker::OverwriteAnswer>*)),
             this,
@@ -46,6 +49,9 @@ void TrackExportDlg::slotProgress(QString filename, int progress, int count) {
     if (progress == count) {
         statusLabel->setText(tr("Export finished"));
         finish();
+    } else if (m_bytesPerSecond > 0.0) {
+        statusLabel->setText(tr("Exporting %1 (%2 MB/s)").arg(
+                filename, QString::number(m_bytesPerSecond / 1e6, 'f', 1)));
     } else {
         statusLabel->setText(tr("Exporting %1").arg(filename));
     }
@@ -54,6 +60,10 @@ void TrackExportDlg::slotProgress(QString filename, int progress, int count) {
     exportProgress->setValue(progress);
 }
 
+void TrackExportDlg::slotThroughput(double bytesPerSecond) {
+    m_bytesPerSecond = bytesPerSecond;
+}
+
 void TrackExportDlg::slotAskOverwriteMode(
         QString filename,
         std::promise<TrackExportWorker::OverwriteAnswer>* promise) {
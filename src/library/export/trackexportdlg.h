@@ -31,6 +31,7 @@ class TrackExportDlg : public QDialog, public Ui::DlgTrackExport {
 
   public slots:
     void slotProgress(QString filename, int progress, int count);
+    void slotThroughput(double bytesPerSecond);
     void slotAskOverwriteMode(
             QString filename,
             std::promise<TrackExportWorker::OverwriteAnswer>* promise);
@@ -50,6 +51,7 @@ class TrackExportDlg : public QDialog, public Ui::DlgTrackExport {
     UserSettingsPointer m_pConfig;
     QList<TrackPointer> m_tracks;
     TrackExportWorker* m_worker;
+    double m_bytesPerSecond;
 };
 
 #endif  // DLGTRACKEXPORT_H
@@ -1,11 +1,65 @@
 #include "library/export/trackexportworker.h"
 
+#include <QFile>
 #include <QFileInfo>
 #include <QMessageBox>
 #include <QDebug>
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrentRun>
+
+#include "util/filecopy.h"
+#include "util/math.h"
+#include "util/performancetimer.h"
 
 namespace {
 
+// All files are copied into the same directory on the same device. A few
+// copies in parallel hide the latency of reading the sources and of
+// opening and closing files on slow devices like USB sticks. More
+// parallel copies only cause seeks and fragmentation.
+const int kMaxCopiesPerDevice = 3;
+
+// Files are copied under a temporary name first. An interrupted copy is
+// continued if the partial file is newer than the source and matches it.
+const QString kPartialFileSuffix = QStringLiteral(".part");
+
+// Partial files might end with data that has not been written completely,
+// e.g. after a crash. This part is copied again when resuming.
+const qint64 kResumeOverlap = 1024 * 1024;
+
+// The data in front of the overlap is compared with the source before
+// resuming, because the partial file might have been copied from a
+// different file with the same name.
+const qint64 kResumeVerifySize = 1024 * 1024;
+
+// Returns the offset at which an interrupted copy into the partial file
+// is continued or 0 if the partial file doesn't match the source.
+qint64 resumeOffset(const QString& sourcePath, const QString& partialPath) {
+    QFile sourceFile(sourcePath);
+    QFile partialFile(partialPath);
+    if (!sourceFile.open(QIODevice::ReadOnly) ||
+            !partialFile.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    const qint64 offset = partialFile.size() - kResumeOverlap;
+    if (offset <= 0) {
+        return 0;
+    }
+    const qint64 verifyOffset = math_max(0LL, offset - kResumeVerifySize);
+    if (!sourceFile.seek(verifyOffset) || !partialFile.seek(verifyOffset)) {
+        return 0;
+    }
+    const QByteArray sourceData = sourceFile.read(offset - verifyOffset);
+    const QByteArray partialData = partialFile.read(offset - verifyOffset);
+    if (sourceData.size() != offset - verifyOffset || sourceData != partialData) {
+        qDebug() << "Partial file" << partialPath
+                 << "does not match" << sourcePath;
+        return 0;
+    }
+    return offset;
+}
+
 QString rewriteFilename(const QFileInfo& fileinfo, int index) {
     // We don't have total control over the inputs, so definitely
     // don't use .arg().arg().arg().
@@ -70,81 +124,180 @@ QMap<QString, QFileInfo> createCopylist(const QList<TrackPointer>& tracks) {
 }  // namespace
 
 void TrackExportWorker::run() {
-    int i = 0;
     QMap<QString, QFileInfo> copy_list = createCopylist(m_tracks);
+
+    // Ask all questions about existing files one after another before
+    // starting to copy.
+    QList<CopyJob> jobs;
+    int i = 0;
     for (auto it = copy_list.constBegin(); it != copy_list.constEnd(); ++it) {
-        // We emit progress twice per loop, which may seem excessive, but it
-        // guarantees that we emit a sane progress before we start and after
-        // we end.  In between, each filename will get its own visible tick
-        // on the bar, which looks really nice.
-        emit(progress(it->fileName(), i, copy_list.size()));
-        copyFile(*it, it.key());
+        CopyJob job;
+        if (prepareCopy(*it, it.key(), &job)) {
+            jobs.append(job);
+        } else {
+            ++i;
+        }
+        if (m_bStop.load()) {
+            emit(canceled());
+            return;
+        }
+    }
+
+    m_bytesCopied = 0;
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(kMaxCopiesPerDevice);
+    QList<QFuture<void>> futures;
+    for (const auto& job : jobs) {
+        futures.append(QtConcurrent::run(
+                &threadPool, this, &TrackExportWorker::copyFile, job));
+    }
+
+    PerformanceTimer timer;
+    timer.start();
+    // Skipped files are done already.  We emit progress twice per copy,
+    // which may seem excessive, but it guarantees that we emit a sane
+    // progress before we start and after we end.  In between, each filename
+    // will get its own visible tick on the bar, which looks really nice.
+    for (int j = 0; j < jobs.size(); ++j) {
+        const QString filename = jobs[j].sourceInfo.fileName();
+        emit(progress(filename, i, copy_list.size()));
+        futures[j].waitForFinished();
         if (m_bStop.load()) {
+            threadPool.waitForDone();
             emit(canceled());
             return;
         }
         ++i;
-        emit(progress(it->fileName(), i, copy_list.size()));
+        const double seconds = timer.elapsed().toDoubleSeconds();
+        if (seconds > 0) {
+            emit(throughput(m_bytesCopied.load() / seconds));
+        }
+        emit(progress(filename, i, copy_list.size()));
+    }
+    if (!jobs.isEmpty()) {
+        qDebug() << "Exported" << jobs.size() << "files with"
+                 << m_bytesCopied.load() << "bytes in" << timer.elapsed();
+    } else if (!copy_list.isEmpty()) {
+        // All files have been skipped
+        emit(progress(copy_list.lastKey(), i, copy_list.size()));
     }
 }
 
-void TrackExportWorker::copyFile(const QFileInfo& source_fileinfo,
-                                 const QString& dest_filename) {
-    QString sourceFilename = source_fileinfo.canonicalFilePath();
+bool TrackExportWorker::prepareCopy(const QFileInfo& source_fileinfo,
+                                    const QString& dest_filename,
+                                    CopyJob* pJob) {
     const QString dest_path = QDir(m_destDir).filePath(dest_filename);
     QFileInfo dest_fileinfo(dest_path);
 
     if (dest_fileinfo.exists()) {
+        if (FileCopy::isSameSizeAndModificationTime(
+                source_fileinfo, dest_fileinfo)) {
+            // Exported before, e.g. by an interrupted export
+            qDebug() << "skipping unchanged" << dest_path;
+            return false;
+        }
         switch (m_overwriteMode) {
         // Give the user the option to overwrite existing files in the destination.
         case OverwriteMode::ASK:
             switch (makeOverwriteRequest(dest_path)) {
             case OverwriteAnswer::SKIP:
             case OverwriteAnswer::SKIP_ALL:
-                qDebug() << "skipping" << sourceFilename;
-                return;
+                qDebug() << "skipping" << source_fileinfo.canonicalFilePath();
+                return false;
             case OverwriteAnswer::OVERWRITE:
             case OverwriteAnswer::OVERWRITE_ALL:
                 break;
             case OverwriteAnswer::CANCEL:
-                m_errorMessage = tr("Export process was canceled");
+                setErrorMessage(tr("Export process was canceled"));
                 stop();
-                return;
+                return false;
             }
             break;
         case OverwriteMode::SKIP_ALL:
-            qDebug() << "skipping" << sourceFilename;
-            return;
+            qDebug() << "skipping" << source_fileinfo.canonicalFilePath();
+            return false;
         case OverwriteMode::OVERWRITE_ALL:;
         }
+    }
+
+    pJob->sourceInfo = source_fileinfo;
+    pJob->destPath = dest_path;
+    pJob->offset = 0;
+    const QFileInfo partial_fileinfo(dest_path + kPartialFileSuffix);
+    if (partial_fileinfo.exists() &&
+            partial_fileinfo.size() <= source_fileinfo.size() &&
+            partial_fileinfo.lastModified() >= source_fileinfo.lastModified()) {
+        pJob->offset = resumeOffset(
+                source_fileinfo.canonicalFilePath(),
+                partial_fileinfo.filePath());
+        if (pJob->offset > 0) {
+            qDebug() << "Resuming copy of" << dest_path << "at" << pJob->offset;
+        }
+    }
+    return true;
+}
+
+void TrackExportWorker::copyFile(const CopyJob& job) {
+    if (m_bStop.load()) {
+        return;
+    }
+    const QString sourceFilename = job.sourceInfo.canonicalFilePath();
+    const QString partial_path = job.destPath + kPartialFileSuffix;
 
-        // Remove the existing file in preparation for overwriting.
-        QFile dest_file(dest_path);
-        qDebug() << "Removing existing file" << dest_path;
+    qDebug() << "Copying" << sourceFilename << "to" << job.destPath;
+    QString errorString;
+    const bool success = FileCopy::copyContents(
+            sourceFilename, partial_path, job.offset,
+            [this](qint64 bytes) {
+                m_bytesCopied.fetchAndAddRelaxed(bytes);
+                return !m_bStop.load();
+            },
+            &errorString);
+    if (m_bStop.load()) {
+        // Canceled or another copy failed.  Keep the partial file.
+        return;
+    }
+    if (!success) {
+        setErrorMessage(tr(
+                "Error exporting track %1 to %2: %3. Stopping.").arg(
+                sourceFilename, job.destPath, errorString));
+        stop();
+        return;
+    }
+    // Allows to skip the file when exporting it again
+    FileCopy::copyModificationTime(sourceFilename, partial_path);
+
+    // Remove the existing file that is overwritten
+    QFile dest_file(job.destPath);
+    if (dest_file.exists()) {
+        qDebug() << "Removing existing file" << job.destPath;
         if (!dest_file.remove()) {
-            const QString error_message = tr(
+            setErrorMessage(tr(
                     "Error removing file %1: %2. Stopping.").arg(
-                    dest_path, dest_file.errorString());
-            qWarning() << error_message;
-            m_errorMessage = error_message;
+                    job.destPath, dest_file.errorString()));
             stop();
             return;
         }
     }
-
-    qDebug() << "Copying" << sourceFilename << "to" << dest_path;
-    QFile source_file(sourceFilename);
-    if (!source_file.copy(dest_path)) {
-        const QString error_message = tr(
+    QFile partial_file(partial_path);
+    if (!partial_file.rename(job.destPath)) {
+        setErrorMessage(tr(
                 "Error exporting track %1 to %2: %3. Stopping.").arg(
-                sourceFilename, dest_path, source_file.errorString());
-        qWarning() << error_message;
-        m_errorMessage = error_message;
+                sourceFilename, job.destPath, partial_file.errorString()));
         stop();
         return;
     }
 }
 
+void TrackExportWorker::setErrorMessage(const QString& errorMessage) {
+    qWarning() << errorMessage;
+    QMutexLocker locker(&m_errorMessageMutex);
+    // Keep the first error, the others are consequences
+    if (m_errorMessage.isEmpty()) {
+        m_errorMessage = errorMessage;
+    }
+}
+
 TrackExportWorker::OverwriteAnswer TrackExportWorker::makeOverwriteRequest(
         QString filename) {
     // QT's QFuture is not quite right for this type of threaded question-and-answer.
@@ -166,7 +319,7 @@ TrackExportWorker::OverwriteAnswer TrackExportWorker::makeOverwriteRequest(
 
     if (!mode_future.valid()) {
         qWarning() << "TrackExportWorker::makeOverwriteRequest invalid answer from future";
-        m_errorMessage = tr("Error exporting tracks");
+        setErrorMessage(tr("Error exporting tracks"));
         stop();
         return OverwriteAnswer::CANCEL;
     }
@@ -181,7 +334,7 @@ TrackExportWorker::OverwriteAnswer TrackExportWorker::makeOverwriteRequest(
         break;
     case OverwriteAnswer::CANCEL:
         // Handle cancellation as a result of the question.
-        m_errorMessage = tr("Export process was canceled");
+        setErrorMessage(tr("Export process was canceled"));
         stop();
         break;
     default:;
@@ -191,6 +344,6 @@ TrackExportWorker::OverwriteAnswer TrackExportWorker::makeOverwriteRequest(
 }
 
 void TrackExportWorker::stop() {
-    // We'll wait for the current file to finish copying, then stop.
+    // Running copies will be aborted after their current chunk.
     m_bStop = true;
 }
@@ -1,6 +1,8 @@
 #ifndef TRACKEXPORTWORKER_H
 #define TRACKEXPORTWORKER_H
 
+#include <QFileInfo>
+#include <QMutex>
 #include <QObject>
 #include <QScopedPointer>
 #include <QString>
@@ -10,9 +12,13 @@
 #include "track/track.h"
 
 // A QThread class for copying a list of files to a single destination directory.
-// Currently does not preserve subdirectory relationships.  This class performs
-// all copies in a blocking style within its own thread.  May be canceled from
-// another thread.
+// Currently does not preserve subdirectory relationships.  This class first
+// decides about existing files in its own thread and then performs a bounded
+// number of copies in parallel, because all of them are written to the same
+// device.  Files that already exist with the same size and modification time
+// are skipped, which also continues an interrupted export.  Partially copied
+// files are resumed if they match the source.  May be canceled from another
+// thread.
 class TrackExportWorker : public QThread {
     Q_OBJECT
   public:
@@ -44,10 +50,18 @@ class TrackExportWorker : public QThread {
     // Calling classes can call errorMessage after a failure for a user-friendly
     // message about what happened.
     QString errorMessage() const {
+        QMutexLocker locker(&m_errorMessageMutex);
         return m_errorMessage;
     }
 
-    // Cancels the export after the current copy operation.
+    // The number of bytes that have been copied by the last export.
+    // Resumed copies only count the remaining bytes.
+    qint64 bytesCopied() const {
+        return m_bytesCopied.load();
+    }
+
+    // Cancels the export and aborts all running copy operations. Partially
+    // copied files are kept for resuming the export later.
     // May be called from another thread.
     void stop();
 
@@ -61,23 +75,40 @@ class TrackExportWorker : public QThread {
             QString filename,
             std::promise<TrackExportWorker::OverwriteAnswer>* promise);
     void progress(QString filename, int progress, int count);
+    // The average number of bytes per second that have been copied
+    void throughput(double bytesPerSecond);
     void canceled();
 
   private:
-    // Copies the file at source_fileinfo to the destination directory with the
-    // name given by dest_filename (not a full path).  If the destination file
-    // exists, will emit an overwrite request signal to ask how to proceed.
-    // On unrecoverable error, sets the error message and stops the export
-    // process entirely.
-    void copyFile(const QFileInfo& source_fileinfo,
-                  const QString& dest_filename);
+    struct CopyJob {
+        QFileInfo sourceInfo;
+        QString destPath;
+        // The size of the partially copied file that is resumed
+        qint64 offset;
+    };
+
+    // Decides how to copy the file at source_fileinfo to the destination
+    // directory with the name given by dest_filename (not a full path).  If a
+    // different destination file exists, will emit an overwrite request
+    // signal to ask how to proceed.  Returns false if the file is skipped.
+    bool prepareCopy(const QFileInfo& source_fileinfo,
+                     const QString& dest_filename,
+                     CopyJob* pJob);
+
+    // Executed in parallel.  On unrecoverable error, sets the error message
+    // and stops the export process entirely.
+    void copyFile(const CopyJob& job);
+
+    void setErrorMessage(const QString& errorMessage);
 
     // Emit a signal requesting overwrite mode, and block until we get an
     // answer.  Updates m_overwriteMode appropriately.
     OverwriteAnswer makeOverwriteRequest(QString filename);
 
     QAtomicInt m_bStop = false;
+    mutable QMutex m_errorMessageMutex;
     QString m_errorMessage;
+    QAtomicInteger<qint64> m_bytesCopied;
 
     OverwriteMode m_overwriteMode = OverwriteMode::ASK;
     const QString m_destDir;
@@ -0,0 +1,202 @@
+#include "library/externallibraryimporter.h"
+
+#include <QDateTime>
+#include <QFileInfo>
+#include <QThreadPool>
+
+#include "library/dao/settingsdao.h"
+#include "library/queryutil.h"
+#include "util/assert.h"
+#include "util/logger.h"
+#include "util/math.h"
+
+namespace {
+
+mixxx::Logger kLogger("ExternalLibraryImporter");
+
+} // anonymous namespace
+
+const int ExternalLibraryImporter::kStatementsPerTransaction = 50000;
+
+ExternalLibraryImporter::ExternalLibraryImporter(
+        QSqlDatabase database,
+        const QString& sourceName,
+        QObject* pParent)
+        : QObject(pParent),
+          m_database(database),
+          m_sourceStateKey(QString("mixxx.%1.importedsource").arg(sourceName)),
+          m_inTransaction(false),
+          m_pendingStatements(0),
+          m_totalBytes(0),
+          m_percent(-1) {
+}
+
+ExternalLibraryImporter::~ExternalLibraryImporter() {
+    if (m_inTransaction) {
+        commitTransaction();
+    }
+}
+
+// static
+QThreadPool* ExternalLibraryImporter::threadPool() {
+    static QThreadPool* s_pThreadPool = nullptr;
+    if (!s_pThreadPool) {
+        s_pThreadPool = new QThreadPool();
+        s_pThreadPool->setMaxThreadCount(1);
+        // Keep the thread for the other features that are usually
+        // activated shortly after each other
+        s_pThreadPool->setExpiryTimeout(-1);
+    }
+    return s_pThreadPool;
+}
+
+// static
+QString ExternalLibraryImporter::sourceState(const QStringList& filePaths) {
+    QStringList state;
+    for (const auto& filePath : filePaths) {
+        const QFileInfo fileInfo(filePath);
+        if (!fileInfo.exists()) {
+            return QString();
+        }
+        state << fileInfo.absoluteFilePath()
+              << QString::number(fileInfo.size())
+              << QString::number(fileInfo.lastModified().toMSecsSinceEpoch());
+    }
+    return state.join("|");
+}
+
+bool ExternalLibraryImporter::isSourceUnchanged(
+        const QStringList& filePaths,
+        const QString& tableName) const {
+    const QString state = sourceState(filePaths);
+    if (state.isEmpty()) {
+        return false;
+    }
+    SettingsDAO settings(m_database);
+    if (settings.getValue(m_sourceStateKey) != state) {
+        return false;
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QString("SELECT 1 FROM %1 LIMIT 1").arg(tableName));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return false;
+    }
+    return query.next();
+}
+
+void ExternalLibraryImporter::storeSourceState(const QStringList& filePaths) {
+    SettingsDAO settings(m_database);
+    settings.setValue(m_sourceStateKey, sourceState(filePaths));
+}
+
+void ExternalLibraryImporter::resetSourceState() {
+    SettingsDAO settings(m_database);
+    settings.setValue(m_sourceStateKey, QString());
+}
+
+bool ExternalLibraryImporter::beginTransaction() {
+    DEBUG_ASSERT(!m_inTransaction);
+    m_inTransaction = m_database.transaction();
+    if (!m_inTransaction) {
+        kLogger.warning()
+                << "Failed to start transaction on"
+                << m_database.connectionName();
+    }
+    m_pendingStatements = 0;
+    return m_inTransaction;
+}
+
+bool ExternalLibraryImporter::commitTransaction() {
+    if (!m_inTransaction) {
+        return false;
+    }
+    m_inTransaction = false;
+    if (!m_database.commit()) {
+        kLogger.warning()
+                << "Failed to commit transaction on"
+                << m_database.connectionName()
+                << m_database.lastError();
+        return false;
+    }
+    kLogger.debug()
+            << "Committed" << m_pendingStatements
+            << "statements on" << m_database.connectionName();
+    return true;
+}
+
+void ExternalLibraryImporter::clearTables(const QStringList& tableNames) {
+    for (const auto& tableName : tableNames) {
+        QSqlQuery query(m_database);
+        query.prepare("DELETE FROM " + tableName);
+        if (!query.exec()) {
+            LOG_FAILED_QUERY(query);
+        }
+    }
+    m_trackIdsByLocation.clear();
+}
+
+QSqlQuery ExternalLibraryImporter::preparedQuery(const QString& statement) {
+    auto it = m_preparedQueries.find(statement);
+    if (it == m_preparedQueries.end()) {
+        QSqlQuery query(m_database);
+        if (!query.prepare(statement)) {
+            LOG_FAILED_QUERY(query);
+        }
+        it = m_preparedQueries.insert(statement, query);
+    }
+    return it.value();
+}
+
+bool ExternalLibraryImporter::execute(QSqlQuery& query) {
+    if (!query.exec()) {
+        return false;
+    }
+    if (m_inTransaction && ++m_pendingStatements >= kStatementsPerTransaction) {
+        commitTransaction();
+        beginTransaction();
+    }
+    return true;
+}
+
+void ExternalLibraryImporter::addTrackLocation(const QString& location, int trackId) {
+    if (!m_trackIdsByLocation.contains(location)) {
+        m_trackIdsByLocation.insert(location, trackId);
+    }
+}
+
+int ExternalLibraryImporter::trackIdForLocation(const QString& location) const {
+    return m_trackIdsByLocation.value(location, -1);
+}
+
+QStringList ExternalLibraryImporter::loadPlaylistNames(const QString& tableName) const {
+    QStringList names;
+    QSqlQuery query(m_database);
+    query.prepare(QString("SELECT name FROM %1 ORDER BY id").arg(tableName));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return names;
+    }
+    while (query.next()) {
+        names << query.value(0).toString();
+    }
+    return names;
+}
+
+void ExternalLibraryImporter::startProgress(qint64 totalBytes) {
+    m_totalBytes = totalBytes;
+    m_percent = -1;
+    updateProgress(0);
+}
+
+void ExternalLibraryImporter::updateProgress(qint64 bytesRead) {
+    if (m_totalBytes <= 0) {
+        return;
+    }
+    const int percent = static_cast<int>(
+            math_clamp<qint64>(bytesRead * 100 / m_totalBytes, 0, 100));
+    if (percent != m_percent) {
+        m_percent = percent;
+        emit(progress(percent));
+    }
+}
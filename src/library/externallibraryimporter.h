@@ -0,0 +1,102 @@
+#ifndef LIBRARY_EXTERNALLIBRARYIMPORTER_H
+#define LIBRARY_EXTERNALLIBRARYIMPORTER_H
+
+#include <QHash>
+#include <QObject>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QStringList>
+
+class QThreadPool;
+
+// Shared import engine for the features that copy the library of another
+// application (iTunes, Traktor, Rhythmbox) into their shadow tables.
+//
+// The features parse their XML files in a single streaming pass on the
+// import thread. This class takes care of
+//  - executing all inserts with statements that are prepared only once
+//    inside of large transactions,
+//  - resolving the track ids of playlist entries by their location
+//    without querying the database for each entry,
+//  - detecting source files that are unchanged since the last complete
+//    import, in which case the shadow tables are reused, and
+//  - reporting the progress based on the number of bytes read.
+//
+// Except for threadPool() all methods must be called from the import
+// thread that uses the database connection.
+class ExternalLibraryImporter : public QObject {
+    Q_OBJECT
+  public:
+    // SQLite inserts about a million rows per second if they are not
+    // committed one by one. Larger transactions only grow the journal.
+    static const int kStatementsPerTransaction;
+
+    ExternalLibraryImporter(
+            QSqlDatabase database,
+            const QString& sourceName,
+            QObject* pParent = nullptr);
+    ~ExternalLibraryImporter() override;
+
+    // All external libraries are imported one after another on a single
+    // dedicated thread. The imports would only compete for the write lock
+    // of the database and must not occupy the global thread pool.
+    static QThreadPool* threadPool();
+
+    // Returns true if none of the files has been modified since the last
+    // import that has been completed with storeSourceState() and if the
+    // given table still contains the imported rows.
+    bool isSourceUnchanged(
+            const QStringList& filePaths,
+            const QString& tableName) const;
+    void storeSourceState(const QStringList& filePaths);
+    // Must be called before modifying the shadow tables, because an
+    // interrupted import leaves them incomplete.
+    void resetSourceState();
+
+    bool beginTransaction();
+    bool commitTransaction();
+
+    void clearTables(const QStringList& tableNames);
+
+    // Returns a copy of the query that has been prepared for the
+    // statement. All copies share the same prepared statement.
+    QSqlQuery preparedQuery(const QString& statement);
+    // Executes a prepared query. While a transaction is active it is
+    // committed and restarted after a large number of statements to
+    // limit the size of the journal.
+    bool execute(QSqlQuery& query);
+
+    // Remembers the id of the first track that has been imported from
+    // a location
+    void addTrackLocation(const QString& location, int trackId);
+    // Returns -1 if no track has been imported from the location
+    int trackIdForLocation(const QString& location) const;
+
+    // Returns the names of all playlists in the order of their ids
+    QStringList loadPlaylistNames(const QString& tableName) const;
+
+    // Sets the total number of bytes of all source files
+    void startProgress(qint64 totalBytes);
+    void updateProgress(qint64 bytesRead);
+
+  signals:
+    // Emitted from the import thread whenever the percentage changes
+    void progress(int percent);
+
+  private:
+    static QString sourceState(const QStringList& filePaths);
+
+    QSqlDatabase m_database;
+    const QString m_sourceStateKey;
+
+    QHash<QString, QSqlQuery> m_preparedQueries;
+    bool m_inTransaction;
+    int m_pendingStatements;
+
+    QHash<QString, int> m_trackIdsByLocation;
+
+    qint64 m_totalBytes;
+    int m_percent;
+};
+
+#endif // LIBRARY_EXTERNALLIBRARYIMPORTER_H
@@ -14,6 +14,7 @@
 #include "library/dao/settingsdao.h"
 #include "library/baseexternaltrackmodel.h"
 #include "library/baseexternalplaylistmodel.h"
+#include "library/externallibraryimporter.h"
 #include "library/queryutil.h"
 #include "util/lcs.h"
 #include "util/sandbox.h"
@@ -48,6 +49,12 @@ const QString kRating = "Rating";
 const QString kTrackType = "Track Type";
 const QString kRemote = "Remote";
 
+// The position of the parser in the XML file, i.e. the number of bytes
+// that have been read
+qint64 bytesRead(const QXmlStreamReader& xml) {
+    return xml.device() ? xml.device()->pos() : 0;
+}
+
 QString localhost_token() {
 #if defined(__WINDOWS__)
     return "//localhost/";
@@ -62,6 +69,7 @@ ITunesFeature::ITunesFeature(QObject* parent, TrackCollection* pTrackCollection)
         : BaseExternalLibraryFeature(parent, pTrackCollection),
           m_pTrackCollection(pTrackCollection),
           m_cancelImport(false),
+          m_forceReload(false),
           m_icon(":/images/library/ic_library_itunes.svg") {
     QString tableName = "itunes_library";
     QString idColumn = "id";
@@ -105,6 +113,9 @@ ITunesFeature::ITunesFeature(QObject* parent, TrackCollection* pTrackCollection)
     if (!m_database.open()) {
         qDebug() << "Failed to open database for iTunes scanner." << m_database.lastError();
     }
+    m_pImporter = new ExternalLibraryImporter(m_database, "itunesfeature", this);
+    connect(m_pImporter, SIGNAL(progress(int)),
+            this, SLOT(slotImportProgress(int)));
     connect(&m_future_watcher, SIGNAL(finished()), this, SLOT(onTrackCollectionLoaded()));
 }
 
@@ -151,14 +162,6 @@ void ITunesFeature::activate() {
 void ITunesFeature::activate(bool forceReload) {
     //qDebug("ITunesFeature::activate()");
     if (!m_isActivated || forceReload) {
-
-        //Delete all table entries of iTunes feature
-        ScopedTransaction transaction(m_database);
-        clearTable("itunes_playlist_tracks");
-        clearTable("itunes_library");
-        clearTable("itunes_playlists");
-        transaction.commit();
-
         emit(showTrackModel(m_pITunesTrackModel));
 
         SettingsDAO settings(m_pTrackCollection->database());
@@ -196,17 +199,10 @@ void ITunesFeature::activate(bool forceReload) {
             settings.setValue(ITDB_PATH_KEY, m_dbfile);
         }
         m_isActivated =  true;
-        // Usually the maximum number of threads
-        // is > 2 depending on the CPU cores
-        // Unfortunately, within VirtualBox
-        // the maximum number of allowed threads
-        // is 1 at all times We'll need to increase
-        // the number to > 1, otherwise importing the music collection
-        // takes place when the GUI threads terminates, i.e., on
-        // Mixxx shutdown.
-        QThreadPool::globalInstance()->setMaxThreadCount(4); //Tobias decided to use 4
-        // Let a worker thread do the XML parsing
-        m_future = QtConcurrent::run(this, &ITunesFeature::importLibrary);
+        m_forceReload = forceReload;
+        // Let the import thread do the XML parsing
+        m_future = QtConcurrent::run(ExternalLibraryImporter::threadPool(),
+                this, &ITunesFeature::importLibrary);
         m_future_watcher.setFuture(m_future);
         m_title = tr("(loading) iTunes");
         // calls a slot in the sidebar model such that 'iTunes (isLoading)' is displayed.
@@ -372,7 +368,14 @@ TreeItem* ITunesFeature::importLibrary() {
 
     qDebug() << "ITunesFeature::importLibrary() ";
 
-    ScopedTransaction transaction(m_database);
+    // The shadow tables still contain everything if the iTunes XML has
+    // not been modified since the last import
+    const QStringList sourceFiles(m_dbfile);
+    if (!m_forceReload &&
+            m_pImporter->isSourceUnchanged(sourceFiles, "itunes_library")) {
+        qDebug() << "iTunes library is unchanged since the last import";
+        return loadPlaylists();
+    }
 
     // By default set m_mixxxItunesRoot and m_dbItunesRoot to strip out
     // file://localhost/ from the URL. When we load the user's iTunes XML
@@ -389,6 +392,17 @@ TreeItem* ITunesFeature::importLibrary() {
         return NULL;
     }
 
+    m_pImporter->resetSourceState();
+    m_pImporter->startProgress(itunes_file.size());
+    m_pImporter->beginTransaction();
+
+    //Delete all table entries of iTunes feature
+    QStringList tables;
+    tables << "itunes_playlist_tracks"
+           << "itunes_library"
+           << "itunes_playlists";
+    m_pImporter->clearTables(tables);
+
     QXmlStreamReader xml(&itunes_file);
     TreeItem* playlist_root = NULL;
     while (!xml.atEnd() && !m_cancelImport) {
@@ -430,7 +444,7 @@ TreeItem* ITunesFeature::importLibrary() {
 
     // Even if an error occurred, commit the transaction. The file may have been
     // half-parsed.
-    transaction.commit();
+    m_pImporter->commitTransaction();
 
     if (xml.hasError()) {
         // do error handling
@@ -442,15 +456,26 @@ TreeItem* ITunesFeature::importLibrary() {
             delete playlist_root;
         }
         playlist_root = NULL;
+    } else if (playlist_root && !m_cancelImport) {
+        m_pImporter->storeSourceState(sourceFiles);
     }
     return playlist_root;
 }
 
+TreeItem* ITunesFeature::loadPlaylists() {
+    TreeItem* rootItem = new TreeItem(this);
+    const QStringList playlists =
+            m_pImporter->loadPlaylistNames("itunes_playlists");
+    for (const auto& playlist : playlists) {
+        rootItem->appendChild(playlist);
+    }
+    return rootItem;
+}
+
 void ITunesFeature::parseTracks(QXmlStreamReader& xml) {
     bool in_container_dictionary = false;
     bool in_track_dictionary = false;
-    QSqlQuery query(m_database);
-    query.prepare("INSERT INTO itunes_library (id, artist, title, album, album_artist, year, genre, grouping, comment, tracknumber,"
+    QSqlQuery query = m_pImporter->preparedQuery("INSERT INTO itunes_library (id, artist, title, album, album_artist, year, genre, grouping, comment, tracknumber,"
                   "bpm, bitrate,"
                   "duration, location,"
                   "rating ) "
@@ -474,6 +499,7 @@ void ITunesFeature::parseTracks(QXmlStreamReader& xml) {
                     in_track_dictionary = true;
                     // Parse track here
                     parseTrack(xml, query);
+                    m_pImporter->updateProgress(bytesRead(xml));
                 }
             }
         }
@@ -630,7 +656,7 @@ void ITunesFeature::parseTrack(QXmlStreamReader& xml, QSqlQuery& query) {
     query.bindValue(":bpm", bpm);
     query.bindValue(":bitrate", bitrate);
 
-    bool success = query.exec();
+    bool success = m_pImporter->execute(query);
 
     if (!success) {
         LOG_FAILED_QUERY(query);
@@ -641,12 +667,11 @@ void ITunesFeature::parseTrack(QXmlStreamReader& xml, QSqlQuery& query) {
 TreeItem* ITunesFeature::parsePlaylists(QXmlStreamReader& xml) {
     qDebug() << "Parse iTunes playlists";
     TreeItem* rootItem = new TreeItem(this);
-    QSqlQuery query_insert_to_playlists(m_database);
-    query_insert_to_playlists.prepare("INSERT INTO itunes_playlists (id, name) "
-                                      "VALUES (:id, :name)");
+    QSqlQuery query_insert_to_playlists = m_pImporter->preparedQuery(
+        "INSERT INTO itunes_playlists (id, name) "
+        "VALUES (:id, :name)");
 
-    QSqlQuery query_insert_to_playlist_tracks(m_database);
-    query_insert_to_playlist_tracks.prepare(
+    QSqlQuery query_insert_to_playlist_tracks = m_pImporter->preparedQuery(
         "INSERT INTO itunes_playlist_tracks (playlist_id, track_id, position) "
         "VALUES (:playlist_id, :track_id, :position)");
 
@@ -658,6 +683,7 @@ TreeItem* ITunesFeature::parsePlaylists(QXmlStreamReader& xml) {
                           query_insert_to_playlists,
                           query_insert_to_playlist_tracks,
                           rootItem);
+            m_pImporter->updateProgress(bytesRead(xml));
             continue;
         }
         if (xml.isEndElement()) {
@@ -733,14 +759,14 @@ void ITunesFeature::parsePlaylist(QXmlStreamReader& xml, QSqlQuery& query_insert
                     query_insert_to_playlists.bindValue(":id", playlist_id);
                     query_insert_to_playlists.bindValue(":name", playlistname);
 
-                    bool success = query_insert_to_playlists.exec();
+                    bool success = m_pImporter->execute(query_insert_to_playlists);
                     if (!success) {
                         if (query_insert_to_playlists.lastError().number() == SQLITE_CONSTRAINT) {
                             // We assume a duplicate Playlist name
                             playlistname += QString(" #%1").arg(playlist_id);
                             query_insert_to_playlists.bindValue(":name", playlistname );
 
-                            bool success = query_insert_to_playlists.exec();
+                            bool success = m_pImporter->execute(query_insert_to_playlists);
                             if (!success) {
                                 // unexpected error
                                 LOG_FAILED_QUERY(query_insert_to_playlists);
@@ -767,7 +793,7 @@ void ITunesFeature::parsePlaylist(QXmlStreamReader& xml, QSqlQuery& query_insert
                     query_insert_to_playlist_tracks.bindValue(":position", playlist_position++);
 
                     //Insert tracks if we are not in a pre-build playlist
-                    if (!isSystemPlaylist && !query_insert_to_playlist_tracks.exec()) {
+                    if (!isSystemPlaylist && !m_pImporter->execute(query_insert_to_playlist_tracks)) {
                         qDebug() << "SQL Error in ITunesFeature.cpp: line" << __LINE__ << " "
                                  << query_insert_to_playlist_tracks.lastError();
                         qDebug() << "trackid" << track_reference;
@@ -790,18 +816,13 @@ void ITunesFeature::parsePlaylist(QXmlStreamReader& xml, QSqlQuery& query_insert
     }
 }
 
-void ITunesFeature::clearTable(QString table_name) {
-    QSqlQuery query(m_database);
-    query.prepare("delete from "+table_name);
-    bool success = query.exec();
-
-    if (!success) {
-        qDebug() << "Could not delete remove old entries from table "
-                 << table_name << " : " << query.lastError();
-    } else {
-        qDebug() << "iTunes table entries of '"
-                 << table_name <<"' have been cleared.";
+void ITunesFeature::slotImportProgress(int percent) {
+    if (m_future.isFinished()) {
+        // Outdated progress of the last import
+        return;
     }
+    m_title = tr("(loading %1%) iTunes").arg(percent);
+    emit(featureIsLoading(this, false));
 }
 
 void ITunesFeature::onTrackCollectionLoaded() {
@@ -17,6 +17,7 @@
 
 class BaseExternalTrackModel;
 class BaseExternalPlaylistModel;
+class ExternalLibraryImporter;
 
 class ITunesFeature : public BaseExternalLibraryFeature {
     Q_OBJECT
@@ -37,6 +38,9 @@ class ITunesFeature : public BaseExternalLibraryFeature {
     void onRightClick(const QPoint& globalPos);
     void onTrackCollectionLoaded();
 
+  private slots:
+    void slotImportProgress(int percent);
+
   private:
     virtual BaseSqlTableModel* getPlaylistModelForPlaylist(QString playlist);
     static QString getiTunesMusicPath();
@@ -46,9 +50,10 @@ class ITunesFeature : public BaseExternalLibraryFeature {
     void parseTracks(QXmlStreamReader& xml);
     void parseTrack(QXmlStreamReader& xml, QSqlQuery& query);
     TreeItem* parsePlaylists(QXmlStreamReader &xml);
+    // Builds the sidebar from the playlists of a previous import
+    TreeItem* loadPlaylists();
     void parsePlaylist(QXmlStreamReader& xml, QSqlQuery& query1,
                        QSqlQuery &query2, TreeItem*);
-    void clearTable(QString table_name);
     bool readNextStartElement(QXmlStreamReader& xml);
 
     BaseExternalTrackModel* m_pITunesTrackModel;
@@ -58,7 +63,9 @@ class ITunesFeature : public BaseExternalLibraryFeature {
     TrackCollection* m_pTrackCollection;
     // a new DB connection for the worker thread
     QSqlDatabase m_database;
+    ExternalLibraryImporter* m_pImporter;
     bool m_cancelImport;
+    bool m_forceReload;
     bool m_isActivated;
     QString m_dbfile;
 
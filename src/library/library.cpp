@@ -91,6 +91,14 @@ Library::Library(
     kLogger.info() << "Connecting database";
     m_pTrackCollection->connectDatabase(dbConnection);
 
+    m_pTrackSaveQueue.reset(new TrackSaveQueue(
+            m_pDbConnectionPool, m_pTrackCollection, pConfig));
+
+    m_pDuplicateTrackFinder.reset(new DuplicateTrackFinder(
+            this, pConfig, m_pDbConnectionPool, m_pTrackCollection));
+    connect(m_pDuplicateTrackFinder.data(), SIGNAL(finished(int, int)),
+            this, SLOT(slotDuplicateTracksFound(int, int)));
+
     qRegisterMetaType<Library::RemovalType>("Library::RemovalType");
 
     m_pKeyNotation.reset(new ControlObject(ConfigKey(kConfigGroup, "key_notation")));
@@ -200,6 +208,10 @@ Library::~Library() {
 
     delete m_pLibraryControl;
 
+    // Save all pending tracks before disconnecting
+    m_pTrackSaveQueue.reset();
+    m_pDuplicateTrackFinder.reset();
+
     kLogger.info() << "Disconnecting database";
     m_pTrackCollection->disconnectDatabase();
 
@@ -373,6 +385,23 @@ void Library::slotCreateCrate() {
     m_pCrateFeature->slotCreateCrate();
 }
 
+void Library::slotFindDuplicateTracks() {
+    m_pDuplicateTrackFinder->findDuplicates();
+}
+
+void Library::slotDuplicateTracksFound(int playlistId, int numTracks) {
+    if (playlistId == -1) {
+        QMessageBox::information(0, tr("Find Duplicate Tracks"),
+                tr("No duplicate tracks have been found. Only tracks that "
+                    "have been fingerprinted during analysis are compared. "
+                    "Fingerprinting can be enabled in the library preferences."));
+        return;
+    }
+    kLogger.info() << "Collected" << numTracks
+                   << "duplicate tracks in playlist" << playlistId;
+    m_pPlaylistFeature->activatePlaylist(playlistId);
+}
+
 void Library::onSkinLoadFinished() {
     // Enable the default selection when a new skin is loaded.
     m_pSidebarModel->activateDefaultSelection();
@@ -487,3 +516,27 @@ void Library::saveCachedTrack(Track* pTrack) noexcept {
     // metadata that is is the database before saving is finished.
     m_pTrackCollection->saveTrack(pTrack);
 }
+
+bool Library::saveEvictedTrackLater(
+        const GlobalTrackCacheEntryPointer& cacheEntryPtr) noexcept {
+    Track* pTrack = cacheEntryPtr->getPlainPtr();
+    if (!pTrack->isDirty() && !pTrack->isMarkedForMetadataExport()) {
+        // Nothing to save
+        return false;
+    }
+    return m_pTrackSaveQueue && m_pTrackSaveQueue->enqueue(cacheEntryPtr);
+}
+
+GlobalTrackCacheEntryPointer Library::reclaimEvictedTrack(
+        const TrackRef& trackRef) noexcept {
+    if (!m_pTrackSaveQueue) {
+        return GlobalTrackCacheEntryPointer();
+    }
+    return m_pTrackSaveQueue->reclaim(trackRef);
+}
+
+void Library::saveEvictedTracks() noexcept {
+    if (m_pTrackSaveQueue) {
+        m_pTrackSaveQueue->flush();
+    }
+}
@@ -17,8 +17,10 @@
 #include "recording/recordingmanager.h"
 #include "analysisfeature.h"
 #include "library/coverartcache.h"
+#include "library/duplicatetrackfinder.h"
 #include "library/setlogfeature.h"
 #include "library/scanner/libraryscanner.h"
+#include "library/tracksavequeue.h"
 #include "util/db/dbconnectionpool.h"
 
 class TrackModel;
@@ -102,6 +104,7 @@ class Library: public QObject,
     void slotRefreshLibraryModels();
     void slotCreatePlaylist();
     void slotCreateCrate();
+    void slotFindDuplicateTracks();
     void slotRequestAddDir(QString directory);
     void slotRequestRemoveDir(QString directory, Library::RemovalType removalType);
     void slotRequestRelocateDir(QString previousDirectory, QString newDirectory);
@@ -134,10 +137,16 @@ class Library: public QObject,
   private slots:
       void onPlayerManagerTrackAnalyzerProgress(TrackId trackId, AnalyzerProgress analyzerProgress);
       void onPlayerManagerTrackAnalyzerIdle();
+      void slotDuplicateTracksFound(int playlistId, int numTracks);
 
   private:
-    // Callback for GlobalTrackCache
+    // Callbacks for GlobalTrackCache
     void saveCachedTrack(Track* pTrack) noexcept override;
+    bool saveEvictedTrackLater(
+            const GlobalTrackCacheEntryPointer& cacheEntryPtr) noexcept override;
+    GlobalTrackCacheEntryPointer reclaimEvictedTrack(
+            const TrackRef& trackRef) noexcept override;
+    void saveEvictedTracks() noexcept override;
 
     const UserSettingsPointer m_pConfig;
 
@@ -155,6 +164,8 @@ class Library: public QObject,
     CrateFeature* m_pCrateFeature;
     AnalysisFeature* m_pAnalysisFeature;
     LibraryScanner m_scanner;
+    QScopedPointer<TrackSaveQueue> m_pTrackSaveQueue;
+    QScopedPointer<DuplicateTrackFinder> m_pDuplicateTrackFinder;
     QFont m_trackTableFont;
     int m_iTrackTableRowHeight;
     bool m_editMetadataSelectedClick;
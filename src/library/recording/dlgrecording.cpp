@@ -18,6 +18,7 @@ DlgRecording::DlgRecording(QWidget* parent, UserSettingsPointer pConfig,
           m_proxyModel(&m_browseModel),
           m_bytesRecordedStr("--"),
           m_durationRecordedStr("--:--"),
+          m_overruns(0),
           m_pRecordingManager(pRecordingManager) {
     setupUi(this);
     m_pTrackTableView = new WTrackTableView(this, pConfig, m_pTrackCollection, true);
@@ -40,6 +41,8 @@ DlgRecording::DlgRecording(QWidget* parent, UserSettingsPointer pConfig,
             this, SLOT(slotBytesRecorded(int)));
     connect(m_pRecordingManager, SIGNAL(durationRecorded(QString)),
             this, SLOT(slotDurationRecorded(QString)));
+    connect(m_pRecordingManager, SIGNAL(overrunsRecorded(int)),
+            this, SLOT(slotOverrunsRecorded(int)));
 
     QBoxLayout* box = dynamic_cast<QBoxLayout*>(layout());
     VERIFY_OR_DEBUG_ASSERT(box) { //Assumes the form layout is a QVBox/QHBoxLayout!
@@ -127,6 +130,7 @@ void DlgRecording::toggleRecording(bool toggle) {
 
 void DlgRecording::slotRecordingEnabled(bool isRecording) {
     if (isRecording) {
+        m_overruns = 0;
         pushButtonRecording->setText((tr("Stop Recording")));
         label->setEnabled(true);
     } else {
@@ -151,11 +155,22 @@ void DlgRecording::slotDurationRecorded(QString durationRecorded) {
     refreshLabel();
 }
 
+// gets number of dropped writes and update label
+void DlgRecording::slotOverrunsRecorded(int overruns) {
+    m_overruns = overruns;
+    refreshLabel();
+}
+
 // update label besides start/stop button
 void DlgRecording::refreshLabel() {
     QString text = tr("Recording to file: %1 (%2 MiB written in %3)")
               .arg(m_pRecordingManager->getRecordingFile())
               .arg(m_bytesRecordedStr)
               .arg(m_durationRecordedStr);
+    if (m_overruns > 0) {
+        // Either the disk is too slow or it failed, e.g. because it is full
+        text += " - " + tr("%n write(s) dropped or failed",
+                "", m_overruns);
+    }
     label->setText(text);
  }
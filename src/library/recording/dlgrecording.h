@@ -42,6 +42,7 @@ class DlgRecording : public QWidget, public Ui::DlgRecording, public virtual Lib
     void refreshBrowseModel();
     void slotRestoreSearch();
     void slotDurationRecorded(QString durationRecorded);
+    void slotOverrunsRecorded(int overruns);
 
   signals:
     void loadTrack(TrackPointer tio);
@@ -59,6 +60,7 @@ class DlgRecording : public QWidget, public Ui::DlgRecording, public virtual Lib
     void refreshLabel();
     QString m_bytesRecordedStr;
     QString m_durationRecordedStr;
+    int m_overruns;
 
     RecordingManager* m_pRecordingManager;
 };
@@ -7,9 +7,29 @@
 
 #include "library/baseexternaltrackmodel.h"
 #include "library/baseexternalplaylistmodel.h"
+#include "library/externallibraryimporter.h"
 #include "library/treeitem.h"
 #include "library/queryutil.h"
 
+namespace {
+
+// Returns the path of a file in the current or legacy data directory of
+// Rhythmbox or an empty string if it does not exist. An API call which
+// tells us where the file is would be nice.
+QString findRhythmboxFile(const QString& fileName) {
+    QString filePath = QDir::homePath() + "/.gnome2/rhythmbox/" + fileName;
+    if (QFile::exists(filePath)) {
+        return filePath;
+    }
+    filePath = QDir::homePath() + "/.local/share/rhythmbox/" + fileName;
+    if (QFile::exists(filePath)) {
+        return filePath;
+    }
+    return QString();
+}
+
+} // anonymous namespace
+
 RhythmboxFeature::RhythmboxFeature(QObject* parent, TrackCollection* pTrackCollection)
         : BaseExternalLibraryFeature(parent, pTrackCollection),
           m_pTrackCollection(pTrackCollection),
@@ -66,6 +86,9 @@ RhythmboxFeature::RhythmboxFeature(QObject* parent, TrackCollection* pTrackColle
         qDebug() << "Failed to open database for Rhythmbox scanner."
                  << m_database.lastError();
     }
+    m_pImporter = new ExternalLibraryImporter(m_database, "rhythmboxfeature", this);
+    connect(m_pImporter, SIGNAL(progress(int)),
+            this, SLOT(slotImportProgress(int)));
     connect(&m_track_watcher, SIGNAL(finished()),
             this, SLOT(onTrackCollectionLoaded()),
             Qt::QueuedConnection);
@@ -92,8 +115,7 @@ BaseSqlTableModel* RhythmboxFeature::getPlaylistModelForPlaylist(QString playlis
 }
 
 bool RhythmboxFeature::isSupported() {
-    return (QFile::exists(QDir::homePath() + "/.gnome2/rhythmbox/rhythmdb.xml") ||
-            QFile::exists(QDir::homePath() + "/.local/share/rhythmbox/rhythmdb.xml"));
+    return !findRhythmboxFile("rhythmdb.xml").isEmpty();
 }
 
 QVariant RhythmboxFeature::title() {
@@ -113,16 +135,8 @@ void RhythmboxFeature::activate() {
 
     if (!m_isActivated) {
         m_isActivated =  true;
-        // Usually the maximum number of threads
-        // is > 2 depending on the CPU cores
-        // Unfortunately, within VirtualBox
-        // the maximum number of allowed threads
-        // is 1 at all times We'll need to increase
-        // the number to > 1, otherwise importing the music collection
-        // takes place when the GUI threads terminates, i.e., on
-        // Mixxx shutdown.
-        QThreadPool::globalInstance()->setMaxThreadCount(4); //Tobias decided to use 4
-        m_track_future = QtConcurrent::run(this, &RhythmboxFeature::importMusicCollection);
+        m_track_future = QtConcurrent::run(ExternalLibraryImporter::threadPool(),
+                this, &RhythmboxFeature::importMusicCollection);
         m_track_watcher.setFuture(m_track_future);
         m_title = "(loading) Rhythmbox";
         //calls a slot in the sidebar model such that 'Rhythmbox (isLoading)' is displayed.
@@ -144,33 +158,49 @@ void RhythmboxFeature::activateChild(const QModelIndex& index) {
 
 TreeItem* RhythmboxFeature::importMusicCollection() {
     qDebug() << "importMusicCollection Thread Id: " << QThread::currentThread();
-     // Try and open the Rhythmbox DB. An API call which tells us where
-     // the file is would be nice.
-    QFile db(QDir::homePath() + "/.gnome2/rhythmbox/rhythmdb.xml");
-    if (!db.exists()) {
-        db.setFileName(QDir::homePath() + "/.local/share/rhythmbox/rhythmdb.xml");
-        if (!db.exists()) {
-            return NULL;
-        }
+    const QString dbPath = findRhythmboxFile("rhythmdb.xml");
+    if (dbPath.isEmpty()) {
+        return NULL;
+    }
+    QStringList sourceFiles(dbPath);
+    const QString playlistsPath = findRhythmboxFile("playlists.xml");
+    if (!playlistsPath.isEmpty()) {
+        sourceFiles << playlistsPath;
     }
 
+    // The shadow tables still contain everything if neither the tracks
+    // nor the playlists have been modified since the last import
+    if (m_pImporter->isSourceUnchanged(sourceFiles, "rhythmbox_library")) {
+        qDebug() << "Rhythmbox library is unchanged since the last import";
+        return loadPlaylists();
+    }
+
+    QFile db(dbPath);
     if (!db.open(QIODevice::ReadOnly | QIODevice::Text))
         return NULL;
+    QFile playlists(playlistsPath);
+    qint64 totalBytes = db.size();
+    if (!playlistsPath.isEmpty()) {
+        totalBytes += playlists.size();
+    }
+
+    m_pImporter->resetSourceState();
+    m_pImporter->startProgress(totalBytes);
+    m_pImporter->beginTransaction();
 
-    //Delete all table entries of Traktor feature
-    ScopedTransaction transaction(m_database);
-    clearTable("rhythmbox_playlist_tracks");
-    clearTable("rhythmbox_library");
-    clearTable("rhythmbox_playlists");
-    transaction.commit();
+    //Delete all table entries of Rhythmbox feature
+    QStringList tables;
+    tables << "rhythmbox_playlist_tracks"
+           << "rhythmbox_library"
+           << "rhythmbox_playlists";
+    m_pImporter->clearTables(tables);
 
-    transaction.transaction();
-    QSqlQuery query(m_database);
-    query.prepare("INSERT INTO rhythmbox_library (artist, title, album, year, "
-                  "genre, comment, tracknumber, bpm, bitrate,"
-                  "duration, location, rating ) "
-                  "VALUES (:artist, :title, :album, :year, :genre, :comment, "
-                  ":tracknumber, :bpm, :bitrate, :duration, :location, :rating )");
+    QSqlQuery query = m_pImporter->preparedQuery(
+            "INSERT INTO rhythmbox_library (artist, title, album, year, "
+            "genre, comment, tracknumber, bpm, bitrate,"
+            "duration, location, rating ) "
+            "VALUES (:artist, :title, :album, :year, :genre, :comment, "
+            ":tracknumber, :bpm, :bitrate, :duration, :location, :rating )");
 
 
     QXmlStreamReader xml(&db);
@@ -181,49 +211,46 @@ TreeItem* RhythmboxFeature::importMusicCollection() {
             //Check if we really parse a track and not album art information
             if (attr.value("type").toString() == "song") {
                 importTrack(xml, query);
+                m_pImporter->updateProgress(db.pos());
             }
         }
     }
-    transaction.commit();
 
     if (xml.hasError()) {
+        m_pImporter->commitTransaction();
         // do error handling
         qDebug() << "Cannot process Rhythmbox music collection";
         qDebug() << "XML ERROR: " << xml.errorString();
         return NULL;
     }
 
+    const qint64 progressOffset = db.size();
     db.close();
-    if (m_cancelImport) {
+    if (m_cancelImport || playlistsPath.isEmpty() ||
+            !playlists.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        m_pImporter->commitTransaction();
         return NULL;
     }
-    return importPlaylists();
-}
-
-TreeItem* RhythmboxFeature::importPlaylists() {
-    QFile db(QDir::homePath() + "/.gnome2/rhythmbox/playlists.xml");
-    if (!db.exists()) {
-        db.setFileName(QDir::homePath() + "/.local/share/rhythmbox/playlists.xml");
-        if (!db.exists()) {
-            return NULL;
-        }
+    TreeItem* rootItem = importPlaylists(&playlists, progressOffset);
+    m_pImporter->commitTransaction();
+    if (rootItem && !m_cancelImport) {
+        m_pImporter->storeSourceState(sourceFiles);
     }
-    //Open file
-     if (!db.open(QIODevice::ReadOnly | QIODevice::Text))
-        return NULL;
+    return rootItem;
+}
 
-    QSqlQuery query_insert_to_playlists(m_database);
-    query_insert_to_playlists.prepare("INSERT INTO rhythmbox_playlists (id, name) "
-                                      "VALUES (:id, :name)");
+TreeItem* RhythmboxFeature::importPlaylists(QFile* pFile, qint64 progressOffset) {
+    QSqlQuery query_insert_to_playlists = m_pImporter->preparedQuery(
+            "INSERT INTO rhythmbox_playlists (id, name) "
+            "VALUES (:id, :name)");
 
-    QSqlQuery query_insert_to_playlist_tracks(m_database);
-    query_insert_to_playlist_tracks.prepare(
+    QSqlQuery query_insert_to_playlist_tracks = m_pImporter->preparedQuery(
             "INSERT INTO rhythmbox_playlist_tracks (playlist_id, track_id, position) "
             "VALUES (:playlist_id, :track_id, :position)");
     //The tree structure holding the playlists
     TreeItem* rootItem = new TreeItem(this);
 
-    QXmlStreamReader xml(&db);
+    QXmlStreamReader xml(pFile);
     while (!xml.atEnd() && !m_cancelImport) {
         xml.readNext();
         if (xml.isStartElement() && xml.name() == "playlist") {
@@ -239,7 +266,7 @@ TreeItem* RhythmboxFeature::importPlaylists() {
                 //Execute SQL statement
                 query_insert_to_playlists.bindValue(":name", playlist_name);
 
-                if (!query_insert_to_playlists.exec()) {
+                if (!m_pImporter->execute(query_insert_to_playlists)) {
                     LOG_FAILED_QUERY(query_insert_to_playlists)
                             << "Couldn't insert playlist:" << playlist_name;
                     continue;
@@ -250,6 +277,7 @@ TreeItem* RhythmboxFeature::importPlaylists() {
 
                 //Process playlist entries
                 importPlaylist(xml, query_insert_to_playlist_tracks, playlist_id);
+                m_pImporter->updateProgress(progressOffset + pFile->pos());
             }
         }
     }
@@ -261,12 +289,22 @@ TreeItem* RhythmboxFeature::importPlaylists() {
         delete rootItem;
         return NULL;
     }
-    db.close();
+    pFile->close();
 
     return rootItem;
 
 }
 
+TreeItem* RhythmboxFeature::loadPlaylists() {
+    TreeItem* rootItem = new TreeItem(this);
+    const QStringList playlists =
+            m_pImporter->loadPlaylistNames("rhythmbox_playlists");
+    for (const auto& playlist : playlists) {
+        rootItem->appendChild(playlist);
+    }
+    return rootItem;
+}
+
 void RhythmboxFeature::importTrack(QXmlStreamReader &xml, QSqlQuery &query) {
     QString title;
     QString artist;
@@ -357,13 +395,14 @@ void RhythmboxFeature::importTrack(QXmlStreamReader &xml, QSqlQuery &query) {
     query.bindValue(":bpm", bpm);
     query.bindValue(":bitrate", bitrate);
 
-    bool success = query.exec();
+    bool success = m_pImporter->execute(query);
 
     if (!success) {
         qDebug() << "SQL Error in rhythmboxfeature.cpp: line" << __LINE__
                  << " " << query.lastError();
         return;
     }
+    m_pImporter->addTrackLocation(location, query.lastInsertId().toInt());
 }
 
 // reads all playlist entries and executes a SQL statement
@@ -380,27 +419,12 @@ void RhythmboxFeature::importPlaylist(QXmlStreamReader &xml,
             location = locationUrl.toLocalFile();
 
             //get the ID of the file in the rhythmbox_library table
-            int track_id = -1;
-            QSqlQuery finder_query(m_database);
-            finder_query.prepare("select id from rhythmbox_library where location=:path");
-            finder_query.bindValue(":path", location);
-            bool success = finder_query.exec();
-
-
-            if (success) {
-                const int idColumn = finder_query.record().indexOf("id");
-                while (finder_query.next()) {
-                    track_id = finder_query.value(idColumn).toInt();
-                }
-             } else {
-                qDebug() << "SQL Error in RhythmboxFeature.cpp: line"
-                         << __LINE__ << " " << finder_query.lastError();
-            }
+            int track_id = m_pImporter->trackIdForLocation(location);
 
             query_insert_to_playlist_tracks.bindValue(":playlist_id", playlist_id);
             query_insert_to_playlist_tracks.bindValue(":track_id", track_id);
             query_insert_to_playlist_tracks.bindValue(":position", playlist_position++);
-            success = query_insert_to_playlist_tracks.exec();
+            bool success = m_pImporter->execute(query_insert_to_playlist_tracks);
 
             if (!success) {
                 qDebug() << "SQL Error in RhythmboxFeature.cpp: line" << __LINE__ << " "
@@ -417,19 +441,13 @@ void RhythmboxFeature::importPlaylist(QXmlStreamReader &xml,
     }
 }
 
-void RhythmboxFeature::clearTable(QString table_name) {
-    qDebug() << "clearTable Thread Id: " << QThread::currentThread();
-    QSqlQuery query(m_database);
-    query.prepare("delete from "+table_name);
-    bool success = query.exec();
-
-    if (!success) {
-        qDebug() << "Could not delete remove old entries from table "
-                 << table_name << " : " << query.lastError();
-    } else {
-        qDebug() << "Rhythmbox table entries of '" << table_name
-                 << "' have been cleared.";
+void RhythmboxFeature::slotImportProgress(int percent) {
+    if (m_track_future.isFinished()) {
+        // Outdated progress of the last import
+        return;
     }
+    m_title = tr("(loading %1%) Rhythmbox").arg(percent);
+    emit(featureIsLoading(this, false));
 }
 
 void RhythmboxFeature::onTrackCollectionLoaded() {
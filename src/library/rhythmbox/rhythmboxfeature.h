@@ -17,6 +17,7 @@
 
 class BaseExternalTrackModel;
 class BaseExternalPlaylistModel;
+class ExternalLibraryImporter;
 
 class RhythmboxFeature : public BaseExternalLibraryFeature {
     Q_OBJECT
@@ -32,17 +33,20 @@ class RhythmboxFeature : public BaseExternalLibraryFeature {
     // processes the music collection
     TreeItem* importMusicCollection();
     // processes the playlist entries
-    TreeItem* importPlaylists();
+    TreeItem* importPlaylists(QFile* pFile, qint64 progressOffset);
 
   public slots:
     void activate();
     void activateChild(const QModelIndex& index);
     void onTrackCollectionLoaded();
 
+  private slots:
+    void slotImportProgress(int percent);
+
   private:
     virtual BaseSqlTableModel* getPlaylistModelForPlaylist(QString playlist);
-    // Removes all rows from a given table
-    void clearTable(QString table_name);
+    // Builds the sidebar from the playlists of a previous import
+    TreeItem* loadPlaylists();
     // reads the properties of a track and executes a SQL statement
     void importTrack(QXmlStreamReader &xml, QSqlQuery &query);
     // reads all playlist entries and executes a SQL statement
@@ -54,6 +58,7 @@ class RhythmboxFeature : public BaseExternalLibraryFeature {
     TrackCollection* m_pTrackCollection;
     // new DB object because of threads
     QSqlDatabase m_database;
+    ExternalLibraryImporter* m_pImporter;
     bool m_isActivated;
     QString m_title;
 
@@ -5,6 +5,7 @@
 #include "library/scanner/libraryscannerdlg.h"
 #include "library/scanner/scannertask.h"
 #include "library/queryutil.h"
+#include "library/coverart.h"
 #include "library/coverartutils.h"
 #include "library/trackcollection.h"
 #include "util/logger.h"
@@ -12,8 +13,7 @@
 #include "util/file.h"
 #include "util/timer.h"
 #include "library/scanner/scannerutil.h"
-#include "util/db/dbconnectionpooler.h"
-#include "util/db/dbconnectionpooled.h"
+#include "util/db/dbwritequeue.h"
 
 namespace {
 
@@ -22,6 +22,11 @@ const int kScannerThreadPoolSize = 1;
 
 mixxx::Logger kLogger("LibraryScanner");
 
+// New tracks and directory hashes are written in batches, each within its
+// own transaction, so that other requests of the write queue don't wait
+// for the whole scan.
+const int kMaxPendingWrites = 100;
+
 QAtomicInt s_instanceCounter(0);
 
 } // anonymous namespace
@@ -77,9 +82,9 @@ LibraryScanner::LibraryScanner(
             m_pProgressDlg.data(), SLOT(slotScanFinished()));
     connect(m_pProgressDlg.data(), SIGNAL(scanCancelled()),
             this, SLOT(slotCancel()));
-    connect(&m_trackDao, SIGNAL(progressVerifyTracksOutside(QString)),
+    connect(this, SIGNAL(progressVerifyTracksOutside(QString)),
             m_pProgressDlg.data(), SLOT(slotUpdate(QString)));
-    connect(&m_trackDao, SIGNAL(progressCoverArt(QString)),
+    connect(this, SIGNAL(progressCoverArt(QString)),
             m_pProgressDlg.data(), SLOT(slotUpdateCover(QString)));
 
     start();
@@ -94,22 +99,25 @@ void LibraryScanner::run() {
     {
         Trace trace("LibraryScanner");
 
-        const mixxx::DbConnectionPooler dbConnectionPooler(m_pDbConnectionPool);
-        QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
-        if (!dbConnection.isOpen()) {
+        // The DAOs are bound to the writer connection and only used by
+        // requests that are executed by the write queue
+        const bool connected = m_pDbConnectionPool->writeQueue()->execute(
+                [this](QSqlDatabase database) {
+            m_libraryHashDao.initialize(database);
+            m_cueDao.initialize(database);
+            m_trackDao.initialize(database);
+            m_playlistDao.initialize(database);
+            m_analysisDao.initialize(database);
+            m_directoryDao.initialize(database);
+            return database.isOpen();
+        });
+        if (!connected) {
             kLogger.warning()
                     << "Failed to open database connection for library scanner";
             kLogger.debug() << "Exiting thread";
             return;
         }
 
-        m_libraryHashDao.initialize(dbConnection);
-        m_cueDao.initialize(dbConnection);
-        m_trackDao.initialize(dbConnection);
-        m_playlistDao.initialize(dbConnection);
-        m_analysisDao.initialize(dbConnection);
-        m_directoryDao.initialize(dbConnection);
-
         // Start the event loop.
         kLogger.debug() << "Event loop starting";
         exec();
@@ -123,7 +131,10 @@ void LibraryScanner::slotStartScan() {
     DEBUG_ASSERT(m_state == STARTING);
 
     // Recursively scan each directory in the directories table.
-    m_libraryRootDirs = m_directoryDao.getDirs();
+    m_pDbConnectionPool->writeQueue()->execute([this](QSqlDatabase) {
+        m_libraryRootDirs = m_directoryDao.getDirs();
+        return true;
+    });
     // If there are no directories then we have nothing to do. Cleanup and
     // finish the scan immediately.
     if (m_libraryRootDirs.isEmpty()) {
@@ -132,8 +143,14 @@ void LibraryScanner::slotStartScan() {
     }
     changeScannerState(SCANNING);
 
-    QSet<QString> trackLocations = m_trackDao.getTrackLocations();
-    QHash<QString, int> directoryHashes = m_libraryHashDao.getDirectoryHashes();
+    QSet<QString> trackLocations;
+    QHash<QString, int> directoryHashes;
+    m_pDbConnectionPool->writeQueue()->execute(
+            [this, &trackLocations, &directoryHashes](QSqlDatabase) {
+        trackLocations = m_trackDao.getTrackLocations();
+        directoryHashes = m_libraryHashDao.getDirectoryHashes();
+        return true;
+    });
     QRegExp extensionFilter(SoundSourceProxy::getSupportedFileNamesRegex());
     QRegExp coverExtensionFilter =
             QRegExp(CoverArtUtils::supportedCoverArtExtensionsRegex(),
@@ -148,22 +165,23 @@ void LibraryScanner::slotStartScan() {
 
     emit(scanStarted());
 
-    // First, we're going to mark all the directories that we've previously
-    // hashed as needing verification. As we search through the directory tree
-    // when we rescan, we'll mark any directory that does still exist as
-    // verified.
-    m_libraryHashDao.invalidateAllDirectories();
-
-    // Mark all the tracks in the library as needing verification of their
-    // existence. (ie. we want to check they're still on your hard drive where
-    // we think they are)
-    m_trackDao.invalidateTrackLocationsInLibrary();
+    m_pDbConnectionPool->writeQueue()->execute([this](QSqlDatabase) {
+        // First, we're going to mark all the directories that we've previously
+        // hashed as needing verification. As we search through the directory tree
+        // when we rescan, we'll mark any directory that does still exist as
+        // verified.
+        m_libraryHashDao.invalidateAllDirectories();
+
+        // Mark all the tracks in the library as needing verification of their
+        // existence. (ie. we want to check they're still on your hard drive where
+        // we think they are)
+        m_trackDao.invalidateTrackLocationsInLibrary();
+        return true;
+    });
 
     kLogger.debug() << "Recursively scanning library.";
-
-    // Start scanning the library. This prepares insertion queries in TrackDAO
-    // (must be called before calling addTracksAdd) and begins a transaction.
-    m_trackDao.addTracksPrepare();
+    m_pendingTrackPaths.clear();
+    m_pendingDirectoryHashes.clear();
 
     // First Scan all known directories we have a hash for.
     // In a second stage, we scan all new directories. This guarantees,
@@ -237,72 +255,239 @@ void LibraryScanner::cleanUpScan() {
     // might leave half of your library as unverified. Don't want to mark those
     // tracks/dirs as deleted in that case) :)
 
-    // Start a transaction for all the library hashing (moved file
-    // detection) stuff.
-    QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
-    ScopedTransaction transaction(dbConnection);
-
-    kLogger.debug() << "Marking tracks in changed directories as verified";
-    m_trackDao.markTrackLocationsAsVerified(m_scannerGlobal->verifiedTracks());
-
-    kLogger.debug() << "Marking unchanged directories and tracks as verified";
-    m_libraryHashDao.updateDirectoryStatuses(
-            m_scannerGlobal->verifiedDirectories(),
-            false,
-            true);
-    m_trackDao.markTracksInDirectoriesAsVerified(
-            m_scannerGlobal->verifiedDirectories());
-
-    // After verifying tracks and directories via recursive scanning of the
-    // library directories the only unverified tracks will be files that are
-    // outside of the library directories, files that have been
-    // moved/deleted/renamed and are in duplicate directories by symlinks or
-    // non normalized paths.
+    // The file system is only accessed by the scanner thread. The results
+    // are written by short requests that each run within their own
+    // transaction, so that other requests of the write queue don't wait
+    // for slow disks.
+    QStringList unverifiedTrackLocations;
+    m_pDbConnectionPool->writeQueue()->execute(
+            [this, &unverifiedTrackLocations](QSqlDatabase database) {
+        ScopedTransaction transaction(database);
+
+        kLogger.debug() << "Marking tracks in changed directories as verified";
+        m_trackDao.markTrackLocationsAsVerified(m_scannerGlobal->verifiedTracks());
+
+        kLogger.debug() << "Marking unchanged directories and tracks as verified";
+        m_libraryHashDao.updateDirectoryStatuses(
+                m_scannerGlobal->verifiedDirectories(),
+                false,
+                true);
+        m_trackDao.markTracksInDirectoriesAsVerified(
+                m_scannerGlobal->verifiedDirectories());
+
+        // After verifying tracks and directories via recursive scanning of the
+        // library directories the only unverified tracks will be files that are
+        // outside of the library directories, files that have been
+        // moved/deleted/renamed and are in duplicate directories by symlinks or
+        // non normalized paths.
+        unverifiedTrackLocations = m_trackDao.getUnverifiedTrackLocations();
+
+        transaction.commit();
+        return true;
+    });
+
     kLogger.debug() << "Checking remaining unverified tracks";
-    if (!m_trackDao.verifyRemainingTracks(
-            m_libraryRootDirs,
-            m_scannerGlobal->shouldCancelPointer())) {
+    if (!verifyRemainingTracks(unverifiedTrackLocations)) {
         // canceled
         return;
     }
 
-    kLogger.debug() << "Marking unverified tracks as deleted";
-    m_trackDao.markUnverifiedTracksAsDeleted();
+    const QStringList addedTracks = m_scannerGlobal->addedTracks();
+    QList<TrackDAO::DeletedTrackLocation> deletedTrackLocations;
+    m_pDbConnectionPool->writeQueue()->execute(
+            [this, &addedTracks, &deletedTrackLocations](QSqlDatabase database) {
+        ScopedTransaction transaction(database);
+
+        kLogger.debug() << "Marking unverified tracks as deleted";
+        m_trackDao.markUnverifiedTracksAsDeleted();
 
-    kLogger.debug() << "Marking unverified directories as deleted";
-    m_libraryHashDao.markUnverifiedDirectoriesAsDeleted();
+        kLogger.debug() << "Marking unverified directories as deleted";
+        m_libraryHashDao.markUnverifiedDirectoriesAsDeleted();
+
+        // We can only guarantee for new tracks that the user has not
+        // edited metadata, so only these are candidates for moved tracks.
+        if (!addedTracks.isEmpty()) {
+            deletedTrackLocations = m_trackDao.getDeletedTrackLocations();
+        }
+
+        transaction.commit();
+        return true;
+    });
 
     // Check to see if the "deleted" tracks showed up in another location,
     // and if so, do some magic to update all our tables.
     kLogger.debug() << "Detecting moved files";
     QSet<TrackId> tracksMovedSetOld;
     QSet<TrackId> tracksMovedSetNew;
-    if (!m_trackDao.detectMovedTracks(&tracksMovedSetOld,
-            &tracksMovedSetNew,
-            m_scannerGlobal->addedTracks(),
-            m_scannerGlobal->shouldCancelPointer())) {
-        // canceled
+    for (int i = 0; i < deletedTrackLocations.size(); i += kMaxPendingWrites) {
+        if (m_scannerGlobal->shouldCancel()) {
+            break;
+        }
+        const QList<TrackDAO::DeletedTrackLocation> batch =
+                deletedTrackLocations.mid(i, kMaxPendingWrites);
+        m_pDbConnectionPool->writeQueue()->execute(
+                [this, &batch, &addedTracks, &tracksMovedSetOld, &tracksMovedSetNew](
+                        QSqlDatabase database) {
+            ScopedTransaction transaction(database);
+            m_trackDao.detectMovedTracks(batch, addedTracks,
+                    &tracksMovedSetOld, &tracksMovedSetNew);
+            transaction.commit();
+            return true;
+        });
+    }
+    // Update BaseTrackCache via signals connected to the main TrackDAO.
+    // Moved tracks that have been committed before canceling need to be
+    // updated as well.
+    emit(tracksMoved(tracksMovedSetOld, tracksMovedSetNew));
+    if (m_scannerGlobal->shouldCancel()) {
         return;
     }
 
-    // Remove the hashes for any directories that have been marked as
-    // deleted to clean up. We need to do this otherwise we can skip over
-    // songs if you move a set of songs from directory A to B, then back to
-    // A.
-    m_libraryHashDao.removeDeletedDirectoryHashes();
+    QList<TrackDAO::TrackWithoutCover> tracksWithoutCover;
+    m_pDbConnectionPool->writeQueue()->execute(
+            [this, &tracksWithoutCover](QSqlDatabase) {
+        // Remove the hashes for any directories that have been marked as
+        // deleted to clean up. We need to do this otherwise we can skip over
+        // songs if you move a set of songs from directory A to B, then back to
+        // A.
+        m_libraryHashDao.removeDeletedDirectoryHashes();
 
-    transaction.commit();
+        tracksWithoutCover = m_trackDao.getTracksWithoutCover();
+        return true;
+    });
 
     kLogger.debug() << "Detecting cover art for unscanned files";
     QSet<TrackId> coverArtTracksChanged;
-    m_trackDao.detectCoverArtForTracksWithoutCover(
-            m_scannerGlobal->shouldCancelPointer(), &coverArtTracksChanged);
-
-    // Update BaseTrackCache via signals connected to the main TrackDAO.
-    emit(tracksMoved(tracksMovedSetOld, tracksMovedSetNew));
+    detectCoverArtForTracksWithoutCover(tracksWithoutCover, &coverArtTracksChanged);
     emit(tracksChanged(coverArtTracksChanged));
 }
 
+bool LibraryScanner::verifyRemainingTracks(const QStringList& trackLocations) {
+    QStringList existingTrackLocations;
+    QStringList deletedTrackLocations;
+    for (const auto& trackLocation : trackLocations) {
+        bool deleted = false;
+        for (const auto& dir : m_libraryRootDirs) {
+            if (trackLocation.startsWith(dir)) {
+                // Track is under the library root,
+                // but was not verified.
+                // This happens if the track was deleted
+                // a symlink duplicate or on a non normalized
+                // path like on non case sensitive file systems.
+                deleted = true;
+                break;
+            }
+        }
+        if (!deleted) {
+            deleted = !QFile::exists(trackLocation);
+        }
+        if (deleted) {
+            deletedTrackLocations.append(trackLocation);
+        } else {
+            existingTrackLocations.append(trackLocation);
+        }
+        emit(progressVerifyTracksOutside(trackLocation));
+
+        if (existingTrackLocations.size() + deletedTrackLocations.size() >=
+                kMaxPendingWrites) {
+            writeVerifiedTrackLocations(&existingTrackLocations, &deletedTrackLocations);
+        }
+        if (m_scannerGlobal->shouldCancel()) {
+            break;
+        }
+    }
+    writeVerifiedTrackLocations(&existingTrackLocations, &deletedTrackLocations);
+    return !m_scannerGlobal->shouldCancel();
+}
+
+void LibraryScanner::writeVerifiedTrackLocations(
+        QStringList* pExistingTrackLocations,
+        QStringList* pDeletedTrackLocations) {
+    if (pExistingTrackLocations->isEmpty() && pDeletedTrackLocations->isEmpty()) {
+        return;
+    }
+    m_pDbConnectionPool->writeQueue()->execute(
+            [this, pExistingTrackLocations, pDeletedTrackLocations](QSqlDatabase database) {
+        ScopedTransaction transaction(database);
+        if (!pExistingTrackLocations->isEmpty()) {
+            m_trackDao.markTrackLocationsAsVerified(*pExistingTrackLocations);
+        }
+        if (!pDeletedTrackLocations->isEmpty()) {
+            m_trackDao.markTrackLocationsAsDeleted(*pDeletedTrackLocations);
+        }
+        transaction.commit();
+        return true;
+    });
+    pExistingTrackLocations->clear();
+    pDeletedTrackLocations->clear();
+}
+
+void LibraryScanner::detectCoverArtForTracksWithoutCover(
+        const QList<TrackDAO::TrackWithoutCover>& tracksWithoutCover,
+        QSet<TrackId>* pTracksChanged) {
+    QString currentDirectoryPath;
+    MDir currentDirectory;
+    QLinkedList<QFileInfo> possibleCovers;
+    QList<QPair<TrackId, CoverInfoRelative>> coverArt;
+
+    for (const auto& track : tracksWithoutCover) {
+        if (m_scannerGlobal->shouldCancel()) {
+            break;
+        }
+
+        //qDebug() << "Searching for cover art for" << trackLocation;
+        emit(progressCoverArt(track.trackLocation));
+
+        QFileInfo trackInfo(track.trackLocation);
+        if (!trackInfo.exists()) {
+            //qDebug() << trackLocation << "does not exist";
+            continue;
+        }
+
+        CoverInfoRelative coverInfo;
+        QImage image(CoverArtUtils::extractEmbeddedCover(trackInfo));
+        if (!image.isNull()) {
+            coverInfo.type = CoverInfo::METADATA;
+            coverInfo.source = CoverInfo::GUESSED;
+            // TODO() here we may introduce a duplicate hash code
+            coverInfo.hash = CoverArtUtils::calculateHash(image);
+            coverInfo.coverLocation = QString();
+        } else {
+            if (track.directoryPath != currentDirectoryPath) {
+                possibleCovers.clear();
+                currentDirectoryPath = track.directoryPath;
+                currentDirectory = MDir(currentDirectoryPath);
+                possibleCovers = CoverArtUtils::findPossibleCoversInFolder(
+                    currentDirectoryPath);
+            }
+            coverInfo = CoverArtUtils::selectCoverArtForTrack(
+                trackInfo.baseName(), track.trackAlbum, possibleCovers);
+        }
+        coverArt.append(qMakePair(track.trackId, coverInfo));
+
+        if (coverArt.size() >= kMaxPendingWrites) {
+            writeGuessedCoverArt(coverArt, pTracksChanged);
+            coverArt.clear();
+        }
+    }
+    writeGuessedCoverArt(coverArt, pTracksChanged);
+}
+
+void LibraryScanner::writeGuessedCoverArt(
+        const QList<QPair<TrackId, CoverInfoRelative>>& coverArt,
+        QSet<TrackId>* pTracksChanged) {
+    if (coverArt.isEmpty()) {
+        return;
+    }
+    m_pDbConnectionPool->writeQueue()->execute(
+            [this, &coverArt, pTracksChanged](QSqlDatabase database) {
+        ScopedTransaction transaction(database);
+        m_trackDao.updateGuessedCoverArt(coverArt, pTracksChanged);
+        transaction.commit();
+        return true;
+    });
+}
+
 
 // is called when all tasks of the second stage are done (threads are finished)
 void LibraryScanner::slotFinishUnhashedScan() {
@@ -320,10 +505,15 @@ void LibraryScanner::slotFinishUnhashedScan() {
         kLogger.debug() << "Recursive scanning interrupted by the user";
     }
 
-    // Finish adding the tracks -- rollback the transaction if the scan did not
-    // finish cleanly and the user did not cancel the transaction.
-    m_trackDao.addTracksFinish(!m_scannerGlobal->shouldCancel() &&
-                               !bScanFinishedCleanly);
+    // Finish adding the tracks -- discard the last batch if the scan did not
+    // finish cleanly and the user did not cancel the scan. The batches that
+    // have been written before are kept.
+    if (!m_scannerGlobal->shouldCancel() && !bScanFinishedCleanly) {
+        m_pendingTrackPaths.clear();
+        m_pendingDirectoryHashes.clear();
+    } else {
+        writePendingBatch();
+    }
 
     if (!m_scannerGlobal->shouldCancel() && bScanFinishedCleanly) {
         cleanUpScan();
@@ -440,10 +630,13 @@ void LibraryScanner::slotDirectoryHashedAndScanned(const QString& directoryPath,
         m_scannerGlobal->directoryScanned();
     }
 
-    if (newDirectory) {
-        m_libraryHashDao.saveDirectoryHash(directoryPath, hash);
-    } else {
-        m_libraryHashDao.updateDirectoryHash(directoryPath, hash, 0);
+    PendingDirectoryHash directoryHash;
+    directoryHash.directoryPath = directoryPath;
+    directoryHash.newDirectory = newDirectory;
+    directoryHash.hash = hash;
+    m_pendingDirectoryHashes.append(directoryHash);
+    if (m_pendingDirectoryHashes.size() >= kMaxPendingWrites) {
+        writePendingBatch();
     }
     emit(progressHashing(directoryPath));
 }
@@ -467,31 +660,70 @@ void LibraryScanner::slotTrackExists(const QString& trackPath) {
 
 void LibraryScanner::slotAddNewTrack(const QString& trackPath) {
     //kLogger.debug() << "slotAddNewTrack" << trackPath;
-    ScopedTimer timer("LibraryScanner::addNewTrack");
-    // For statistics tracking and to detect moved tracks
-    TrackPointer pTrack(m_trackDao.addTracksAddFile(trackPath, false));
-    if (pTrack) {
-        // The track's actual location might differ from the
-        // given trackPath
-        const QString trackLocation(pTrack->getLocation());
-        // Acknowledge successful track addition
-        if (m_scannerGlobal) {
-            m_scannerGlobal->trackAdded(trackLocation);
+    m_pendingTrackPaths.append(trackPath);
+    if (m_pendingTrackPaths.size() >= kMaxPendingWrites) {
+        writePendingBatch();
+    }
+}
+
+void LibraryScanner::writePendingBatch() {
+    if (m_pendingTrackPaths.isEmpty() && m_pendingDirectoryHashes.isEmpty()) {
+        return;
+    }
+    ScopedTimer timer("LibraryScanner::writePendingBatch");
+    const QStringList trackPaths = m_pendingTrackPaths;
+    const QList<PendingDirectoryHash> directoryHashes = m_pendingDirectoryHashes;
+    m_pendingTrackPaths.clear();
+    m_pendingDirectoryHashes.clear();
+
+    QList<TrackPointer> tracks;
+    m_pDbConnectionPool->writeQueue()->execute(
+            [this, &trackPaths, &directoryHashes, &tracks](QSqlDatabase) {
+        // This prepares insertion queries in TrackDAO (must be called
+        // before calling addTracksAdd) and begins a transaction.
+        m_trackDao.addTracksPrepare();
+        for (const auto& directoryHash : directoryHashes) {
+            if (directoryHash.newDirectory) {
+                m_libraryHashDao.saveDirectoryHash(
+                        directoryHash.directoryPath, directoryHash.hash);
+            } else {
+                m_libraryHashDao.updateDirectoryHash(
+                        directoryHash.directoryPath, directoryHash.hash, 0);
+            }
         }
-        // Signal the main instance of TrackDAO, that there is
-        // a new track in the database.
-        emit(trackAdded(pTrack));
-        emit(progressLoading(trackLocation));
-    } else {
-        // Acknowledge failed track addition
-        // TODO(XXX): Is it really intended to acknowledge a failed
-        // track addition with a trackAdded() signal??
-        if (m_scannerGlobal) {
-            m_scannerGlobal->trackAdded(trackPath);
+        for (const auto& trackPath : trackPaths) {
+            tracks.append(m_trackDao.addTracksAddFile(trackPath, false));
+        }
+        m_trackDao.addTracksFinish(false);
+        return true;
+    });
+
+    for (int i = 0; i < trackPaths.size(); ++i) {
+        // Empty if the request has not been executed
+        const TrackPointer pTrack = tracks.value(i);
+        if (pTrack) {
+            // The track's actual location might differ from the
+            // given trackPath
+            const QString trackLocation(pTrack->getLocation());
+            // Acknowledge successful track addition
+            if (m_scannerGlobal) {
+                m_scannerGlobal->trackAdded(trackLocation);
+            }
+            // Signal the main instance of TrackDAO, that there is
+            // a new track in the database.
+            emit(trackAdded(pTrack));
+            emit(progressLoading(trackLocation));
+        } else {
+            // Acknowledge failed track addition
+            // TODO(XXX): Is it really intended to acknowledge a failed
+            // track addition with a trackAdded() signal??
+            if (m_scannerGlobal) {
+                m_scannerGlobal->trackAdded(trackPaths[i]);
+            }
+            kLogger.warning()
+                    << "Failed to add track to library:"
+                    << trackPaths[i];
         }
-        kLogger.warning()
-                << "Failed to add track to library:"
-                << trackPath;
     }
 }
 
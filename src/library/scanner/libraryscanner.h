@@ -47,6 +47,7 @@ class LibraryScanner : public QThread {
     void scanFinished();
     void progressHashing(QString);
     void progressLoading(QString path);
+    void progressVerifyTracksOutside(QString path);
     void progressCoverArt(QString file);
     void trackAdded(TrackPointer pTrack);
     void tracksMoved(QSet<TrackId> oldTrackIds, QSet<TrackId> newTrackIds);
@@ -98,6 +99,32 @@ class LibraryScanner : public QThread {
 
     void cleanUpScan();
 
+    // Checks whether the tracks that haven't been verified while scanning
+    // the library directories still exist and stores the results in
+    // batches. Returns false if the scan has been canceled.
+    bool verifyRemainingTracks(const QStringList& trackLocations);
+    void writeVerifiedTrackLocations(
+            QStringList* pExistingTrackLocations,
+            QStringList* pDeletedTrackLocations);
+
+    // Guesses the cover art of the tracks and stores it in batches
+    void detectCoverArtForTracksWithoutCover(
+            const QList<TrackDAO::TrackWithoutCover>& tracksWithoutCover,
+            QSet<TrackId>* pTracksChanged);
+    void writeGuessedCoverArt(
+            const QList<QPair<TrackId, CoverInfoRelative>>& coverArt,
+            QSet<TrackId>* pTracksChanged);
+
+    // Adds the pending tracks and stores the pending directory hashes
+    // within a single transaction
+    void writePendingBatch();
+
+    struct PendingDirectoryHash {
+        QString directoryPath;
+        bool newDirectory;
+        int hash;
+    };
+
     mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
 
     // The library trackcollection. Do not touch this from the library scanner
@@ -107,7 +134,8 @@ class LibraryScanner : public QThread {
     // The pool of threads used for worker tasks.
     QThreadPool m_pool;
 
-    // The library scanner thread's DAOs.
+    // The library scanner's DAOs. They are bound to the writer connection
+    // and must only be used by requests of its write queue.
     LibraryHashDAO m_libraryHashDao;
     CueDAO m_cueDao;
     PlaylistDAO m_playlistDao;
@@ -118,6 +146,10 @@ class LibraryScanner : public QThread {
     // Global scanner state for scan currently in progress.
     ScannerGlobalPointer m_scannerGlobal;
 
+    // Written by writePendingBatch()
+    QStringList m_pendingTrackPaths;
+    QList<PendingDirectoryHash> m_pendingDirectoryHashes;
+
     // The Semaphore guards the state transitions queued to the
     // Qt even Queue in the way, that you cannot start a
     // new scan while the old one is canceled
@@ -361,7 +361,7 @@ bool TrackCollection::updateAutoDjCrate(
     return updateCrate(crate);
 }
 
-void TrackCollection::exportTrackMetadata(Track* pTrack) const {
+bool TrackCollection::exportTrackMetadata(Track* pTrack) const {
     DEBUG_ASSERT(pTrack);
 
     // Write audio meta data, if explicitly requested by the user
@@ -375,7 +375,9 @@ void TrackCollection::exportTrackMetadata(Track* pTrack) const {
     if (pTrack->isMarkedForMetadataExport() ||
             (pTrack->isDirty() && m_pConfig && m_pConfig->getValueString(ConfigKey("[Library]","SyncTrackMetadataExport")).toInt() == 1)) {
         SoundSourceProxy::exportTrackMetadataBeforeSaving(pTrack);
+        return true;
     }
+    return false;
 }
 
 void TrackCollection::saveTrack(Track* pTrack) {
@@ -80,8 +80,9 @@ class TrackCollection : public QObject,
 
     bool updateAutoDjCrate(CrateId crateId, bool isAutoDjSource);
 
-    // Might be called from any thread
-    void exportTrackMetadata(Track* pTrack) const;
+    // Might be called from any thread. Returns true if the metadata
+    // has been exported into the file.
+    bool exportTrackMetadata(Track* pTrack) const;
 
     // Must be called from the main thread
     void saveTrack(Track* pTrack);
@@ -0,0 +1,207 @@
+#include "library/trackprefetcher.h"
+
+#include <QFile>
+#include <QtConcurrentRun>
+
+#include "analyzer/analyzerwaveform.h"
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "engine/cachingreader/prefetchedchunkcache.h"
+#include "sources/soundsourceproxy.h"
+#include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+#include "util/logger.h"
+#include "util/samplebuffer.h"
+#include "util/timer.h"
+
+namespace {
+
+const mixxx::Logger kLogger("TrackPrefetcher");
+
+const char* kConfigGroup = "[Auto DJ]";
+const int kMaxTracksDefault = 2;
+const int kReadAheadMBDefault = 256;
+const int kDecodedMBDefault = 16;
+
+// Files are read in blocks of this size. Cancellation is checked in
+// between.
+const qint64 kReadBlockBytes = 1024 * 1024;
+
+// The number of chunks that are decoded starting at the main cue point.
+// This is about what the CachingReader requests right after loading.
+const int kDecodeChunks = 4;
+
+} // anonymous namespace
+
+TrackPrefetcher::TrackPrefetcher(
+        QObject* pParent,
+        UserSettingsPointer pConfig,
+        mixxx::DbConnectionPoolPtr pDbConnectionPool)
+        : QObject(pParent),
+          m_pConfig(pConfig),
+          m_pDbConnectionPool(pDbConnectionPool),
+          m_generation(0),
+          m_remainingReadAheadBytes(0) {
+    // Tracks are prefetched one after another to avoid seeking between
+    // multiple files.
+    m_threadPool.setMaxThreadCount(1);
+}
+
+TrackPrefetcher::~TrackPrefetcher() {
+    cancel();
+    m_threadPool.waitForDone();
+}
+
+int TrackPrefetcher::maxTracks() const {
+    return m_pConfig->getValue(
+            ConfigKey(kConfigGroup, "PrefetchTracks"), kMaxTracksDefault);
+}
+
+void TrackPrefetcher::prefetchTracks(const QList<TrackPointer>& tracks) {
+    if (tracks == m_tracks) {
+        return;
+    }
+    const int generation = ++m_generation;
+    m_tracks = tracks;
+    m_remainingReadAheadBytes = static_cast<qint64>(m_pConfig->getValue(
+            ConfigKey(kConfigGroup, "PrefetchReadAheadMB"), kReadAheadMBDefault))
+            * 1024 * 1024;
+    // The decoded chunks of tracks that are still upcoming are kept
+    QSet<QString> trackKeys;
+    for (const auto& pTrack : tracks) {
+        if (pTrack) {
+            trackKeys.insert(PrefetchedChunkCache::trackKey(*pTrack));
+        }
+    }
+    PrefetchedChunkCache::retainTracks(trackKeys);
+    PrefetchedChunkCache::setMaxSizeInBytes(static_cast<qint64>(m_pConfig->getValue(
+            ConfigKey(kConfigGroup, "PrefetchDecodedMB"), kDecodedMBDefault))
+            * 1024 * 1024);
+    for (const auto& pTrack : tracks) {
+        if (!pTrack) {
+            continue;
+        }
+        QtConcurrent::run(&m_threadPool, [this, pTrack, generation] {
+            prefetchTrack(pTrack, generation);
+        });
+    }
+}
+
+void TrackPrefetcher::cancel() {
+    ++m_generation;
+    m_tracks.clear();
+    PrefetchedChunkCache::retainTracks(QSet<QString>());
+}
+
+void TrackPrefetcher::waitForDone() {
+    m_threadPool.waitForDone();
+}
+
+bool TrackPrefetcher::consumeReadAhead(qint64 bytes) {
+    return m_remainingReadAheadBytes.fetch_sub(bytes) > bytes;
+}
+
+void TrackPrefetcher::prefetchTrack(TrackPointer pTrack, int generation) {
+    if (isCancelled(generation) || m_remainingReadAheadBytes.load() <= 0) {
+        return;
+    }
+    ScopedTimer t("TrackPrefetcher::prefetchTrack");
+    kLogger.debug() << "Prefetching" << pTrack->getLocation();
+
+    loadStoredWaveforms(pTrack);
+    readFile(pTrack, generation);
+    decodeAroundCuePoint(pTrack, generation);
+}
+
+void TrackPrefetcher::loadStoredWaveforms(TrackPointer pTrack) const {
+    if (!m_pDbConnectionPool) {
+        return;
+    }
+    // Prefetching only reads and never competes for the write lock
+    const mixxx::DbConnectionPooler dbConnectionPooler(
+            m_pDbConnectionPool, mixxx::DbConnection::AccessMode::ReadOnly);
+    QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
+    if (!dbConnection.isOpen()) {
+        kLogger.warning()
+                << "Failed to open database connection for prefetching";
+        return;
+    }
+    // Stores the waveforms in the track exactly like the analyzer does if
+    // they are available. They are kept in memory by the track and would
+    // have been loaded anyway when loading the track.
+    AnalyzerWaveform analyzerWaveform(m_pConfig, dbConnection);
+    analyzerWaveform.isDisabledOrLoadStoredSuccess(pTrack);
+}
+
+qint64 TrackPrefetcher::readFile(const TrackPointer& pTrack, int generation) {
+    QFile file(pTrack->getLocation());
+    if (!file.open(QIODevice::ReadOnly)) {
+        kLogger.warning() << "Failed to open" << file.fileName();
+        return 0;
+    }
+    // The data is discarded. Only the page cache of the OS is filled.
+    QByteArray buffer(kReadBlockBytes, Qt::Uninitialized);
+    qint64 totalBytesRead = 0;
+    while (!isCancelled(generation)) {
+        const qint64 bytesRead = file.read(buffer.data(), buffer.size());
+        if (bytesRead <= 0) {
+            break;
+        }
+        totalBytesRead += bytesRead;
+        if (!consumeReadAhead(bytesRead)) {
+            break;
+        }
+    }
+    return totalBytesRead;
+}
+
+void TrackPrefetcher::decodeAroundCuePoint(
+        const TrackPointer& pTrack, int generation) const {
+    if (isCancelled(generation)) {
+        return;
+    }
+    const QString trackKey = PrefetchedChunkCache::trackKey(*pTrack);
+    // The cue point is stored in samples of the stereo engine signal
+    const SINT cueFrame = static_cast<SINT>(
+            pTrack->getCuePoint().getPosition()) / CachingReaderChunk::kChannels;
+    const SINT firstChunkIndex = CachingReaderChunk::indexForFrame(cueFrame);
+    int numCachedChunks = 0;
+    while (numCachedChunks < kDecodeChunks &&
+            PrefetchedChunkCache::contains(
+                    trackKey, firstChunkIndex + numCachedChunks)) {
+        ++numCachedChunks;
+    }
+    if (numCachedChunks == kDecodeChunks) {
+        return;
+    }
+
+    mixxx::AudioSource::OpenParams config;
+    config.setChannelCount(CachingReaderChunk::kChannels);
+    mixxx::AudioSourcePointer pAudioSource =
+            SoundSourceProxy(pTrack).openAudioSource(config);
+    if (!pAudioSource) {
+        kLogger.warning() << "Failed to decode" << pTrack->getLocation();
+        return;
+    }
+    // Whole chunks are read exactly like the CachingReaderWorker reads
+    // them and handed over to it when the track is loaded
+    mixxx::SampleBuffer chunkSampleBuffer(CachingReaderChunk::kSamples);
+    CachingReaderChunkForOwner chunk(
+            mixxx::SampleBuffer::WritableSlice(chunkSampleBuffer));
+    mixxx::SampleBuffer tempReadBuffer(
+            pAudioSource->frames2samples(CachingReaderChunk::kFrames));
+    for (int i = numCachedChunks; i < kDecodeChunks && !isCancelled(generation); ++i) {
+        const SINT chunkIndex = firstChunkIndex + i;
+        chunk.init(chunkIndex);
+        const auto frameIndexRange = chunk.bufferSampleFrames(
+                pAudioSource,
+                mixxx::SampleBuffer::WritableSlice(tempReadBuffer));
+        if (frameIndexRange.empty()) {
+            return;
+        }
+        mixxx::SampleBuffer sampleBuffer(
+                CachingReaderChunk::frames2samples(frameIndexRange.length()));
+        chunk.readBufferedSampleFrames(sampleBuffer.data(), frameIndexRange);
+        PrefetchedChunkCache::insert(
+                trackKey, chunkIndex, frameIndexRange, std::move(sampleBuffer));
+    }
+}
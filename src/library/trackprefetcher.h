@@ -0,0 +1,90 @@
+#ifndef TRACKPREFETCHER_H
+#define TRACKPREFETCHER_H
+
+#include <QList>
+#include <QObject>
+#include <QThreadPool>
+
+#include <atomic>
+
+#include "preferences/usersettings.h"
+#include "track/track.h"
+#include "util/db/dbconnectionpool.h"
+
+// Warms up tracks that are about to be loaded into a deck, e.g. the next
+// tracks of the Auto DJ queue, so that loading them does not stall on slow
+// disks or network mounts:
+//  - The Track objects are kept alive in the GlobalTrackCache.
+//  - The stored waveforms are loaded into the Track objects. The analyzer
+//    skips loading them again when the track is loaded into a deck.
+//  - The files are read into the page cache of the OS.
+//  - The chunks around the main cue point are decoded into the
+//    PrefetchedChunkCache. The CachingReader takes them from there
+//    instead of decoding them again when the track is loaded.
+//
+// The files are read and decoded one after another in a single worker
+// thread in the order of the tracks. The file data is not kept in memory
+// by Mixxx and the OS may evict it from the page cache at any time. The
+// number of bytes that are read ahead is limited, because reading more
+// than the page cache can hold would only evict other data. The memory of
+// the decoded chunks is limited separately.
+class TrackPrefetcher : public QObject {
+    Q_OBJECT
+  public:
+    TrackPrefetcher(
+            QObject* pParent,
+            UserSettingsPointer pConfig,
+            mixxx::DbConnectionPoolPtr pDbConnectionPool);
+    ~TrackPrefetcher() override;
+
+    // The number of upcoming tracks that should be prefetched
+    int maxTracks() const;
+
+    // Replaces the prefetched tracks. Prefetching of the previous tracks is
+    // cancelled and they are released together with their decoded chunks
+    // unless they are still upcoming. Nothing happens if the tracks have
+    // not changed.
+    void prefetchTracks(const QList<TrackPointer>& tracks);
+
+    // Cancels prefetching and releases all tracks and their decoded chunks
+    void cancel();
+
+    // Blocks until all pending tracks have been prefetched or cancelled
+    void waitForDone();
+
+    // The number of bytes that may still be read ahead for the current
+    // tracks
+    qint64 remainingReadAheadBytes() const {
+        return m_remainingReadAheadBytes.load();
+    }
+
+  protected:
+    // Returns the number of bytes that have been read
+    virtual qint64 readFile(const TrackPointer& pTrack, int generation);
+
+    bool isCancelled(int generation) const {
+        return m_generation.load() != generation;
+    }
+
+  private:
+    void prefetchTrack(TrackPointer pTrack, int generation);
+    void loadStoredWaveforms(TrackPointer pTrack) const;
+    void decodeAroundCuePoint(const TrackPointer& pTrack, int generation) const;
+
+    // Returns false if the read-ahead limit has been reached
+    bool consumeReadAhead(qint64 bytes);
+
+    const UserSettingsPointer m_pConfig;
+    const mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+
+    QList<TrackPointer> m_tracks;
+
+    // Incremented whenever the prefetched tracks change. Pending tasks of
+    // a previous generation are cancelled.
+    std::atomic<int> m_generation;
+    std::atomic<qint64> m_remainingReadAheadBytes;
+
+    QThreadPool m_threadPool;
+};
+
+#endif // TRACKPREFETCHER_H
@@ -0,0 +1,306 @@
+#include "library/tracksavequeue.h"
+
+#include <algorithm>
+
+#include "library/trackcollection.h"
+#include "util/assert.h"
+#include "util/db/dbwritequeue.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("TrackSaveQueue");
+
+// Evicted tracks are kept for this time before saving them in case
+// they are requested again
+constexpr qint64 kSaveDelayMillis = 1000;
+
+bool matchesTrackRef(const TrackRef& pendingTrackRef, const TrackRef& trackRef) {
+    if (trackRef.hasId() && pendingTrackRef.getId() == trackRef.getId()) {
+        return true;
+    }
+    return trackRef.hasCanonicalLocation() &&
+            pendingTrackRef.getCanonicalLocation() == trackRef.getCanonicalLocation();
+}
+
+} // anonymous namespace
+
+const int TrackSaveQueue::kMaxTracksPerBatch = 4;
+
+const qint64 TrackSaveQueue::kMinMetadataExportIntervalMillis = 100;
+
+TrackSaveQueue::TrackSaveQueue(
+        mixxx::DbConnectionPoolPtr pDbConnectionPool,
+        TrackCollection* pTrackCollection,
+        const UserSettingsPointer& pConfig)
+        : m_pDbConnectionPool(std::move(pDbConnectionPool)),
+          m_pTrackCollection(pTrackCollection),
+          m_analysisDao(pConfig),
+          m_trackDao(m_cueDao, m_playlistDao,
+                  m_analysisDao, m_libraryHashDao,
+                  pConfig),
+          m_accepting(false),
+          m_quit(false),
+          m_flushRequests(0) {
+    setObjectName("TrackSaveQueue");
+    m_clock.start();
+
+    // BaseTrackCache and all other listeners are connected to the
+    // main instance of TrackDAO.
+    connect(&m_trackDao, SIGNAL(trackClean(TrackId)),
+            &m_pTrackCollection->getTrackDAO(), SIGNAL(trackClean(TrackId)));
+    connect(this, SIGNAL(trackDirty(TrackId)),
+            &m_pTrackCollection->getTrackDAO(), SIGNAL(trackDirty(TrackId)));
+
+    // Reclaimed tracks are handed back to the owning thread after saving
+    qRegisterMetaType<GlobalTrackCacheEntryPointer>("GlobalTrackCacheEntryPointer");
+
+    start(QThread::LowPriority);
+}
+
+TrackSaveQueue::~TrackSaveQueue() {
+    {
+        QMutexLocker locker(&m_mutex);
+        m_quit = true;
+        m_pendingChanged.wakeAll();
+    }
+    // All pending tracks are saved before the thread exits
+    wait();
+    DEBUG_ASSERT(m_pendingTracks.isEmpty());
+}
+
+bool TrackSaveQueue::enqueue(GlobalTrackCacheEntryPointer cacheEntryPtr) {
+    DEBUG_ASSERT(cacheEntryPtr);
+    Track* pTrack = cacheEntryPtr->getPlainPtr();
+    TrackRef trackRef = TrackRef::fromFileInfo(
+            pTrack->getFileInfo(),
+            pTrack->getId());
+    if (!trackRef.hasId()) {
+        // Tracks that have not been added to the library are not
+        // stored in the database
+        return false;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_accepting || m_quit) {
+        return false;
+    }
+    for (auto& savingTrack : m_savingTracks) {
+        if (savingTrack.reclaimed &&
+                savingTrack.trackRef.getId() == trackRef.getId()) {
+            // Evicted again while the previous save is still running.
+            // The signals must remain blocked after that save.
+            savingTrack.reclaimed = false;
+        }
+    }
+    DEBUG_ASSERT(std::none_of(
+            m_pendingTracks.constBegin(),
+            m_pendingTracks.constEnd(),
+            [&trackRef](const PendingTrack& pendingTrack) {
+                return pendingTrack.trackRef.getId() == trackRef.getId();
+            }));
+    // It can produce dangerous signal loops if the track is still
+    // sending signals while being saved!
+    // See also: Library::saveCachedTrack()
+    pTrack->blockSignals(true);
+    m_pendingTracks.append(PendingTrack{
+            std::move(cacheEntryPtr),
+            std::move(trackRef),
+            m_clock.elapsed() + kSaveDelayMillis,
+            false,
+            0});
+    m_pendingChanged.wakeOne();
+    return true;
+}
+
+GlobalTrackCacheEntryPointer TrackSaveQueue::reclaim(const TrackRef& trackRef) {
+    QMutexLocker locker(&m_mutex);
+    for (auto i = m_pendingTracks.begin(); i != m_pendingTracks.end(); ++i) {
+        if (matchesTrackRef(i->trackRef, trackRef)) {
+            GlobalTrackCacheEntryPointer cacheEntryPtr =
+                    std::move(i->cacheEntryPtr);
+            m_pendingTracks.erase(i);
+            cacheEntryPtr->getPlainPtr()->blockSignals(false);
+            return cacheEntryPtr;
+        }
+    }
+    // The caller must not load the track from the database before it
+    // has been saved. Instead of waiting for the save thread the track
+    // object is handed back while it is still being saved. Its signals
+    // are unblocked by the save thread afterwards.
+    for (auto& savingTrack : m_savingTracks) {
+        if (!savingTrack.reclaimed &&
+                matchesTrackRef(savingTrack.trackRef, trackRef)) {
+            savingTrack.reclaimed = true;
+            return savingTrack.cacheEntryPtr;
+        }
+    }
+    return GlobalTrackCacheEntryPointer();
+}
+
+void TrackSaveQueue::flush() {
+    m_flushRequests.fetch_add(1);
+    QMutexLocker locker(&m_mutex);
+    m_pendingChanged.wakeAll();
+    while (!m_pendingTracks.isEmpty() || !m_savingTracks.isEmpty()) {
+        m_savingFinished.wait(&m_mutex);
+    }
+    m_flushRequests.fetch_sub(1);
+}
+
+void TrackSaveQueue::run() {
+    kLogger.debug() << "Entering thread";
+
+    // The DAOs are bound to the writer connection and only used by
+    // requests that are executed by the write queue
+    const bool connected = m_pDbConnectionPool->writeQueue()->execute(
+            [this](QSqlDatabase database) {
+        m_libraryHashDao.initialize(database);
+        m_cueDao.initialize(database);
+        m_playlistDao.initialize(database);
+        m_analysisDao.initialize(database);
+        m_trackDao.initialize(database);
+        return database.isOpen();
+    });
+    if (!connected) {
+        // Evicted tracks will be saved synchronously
+        kLogger.warning()
+                << "Failed to open database connection for saving tracks";
+        kLogger.debug() << "Exiting thread";
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    m_accepting = true;
+    qint64 nextBatchMillis = 0;
+    while (!m_quit || !m_pendingTracks.isEmpty()) {
+        if (m_pendingTracks.isEmpty()) {
+            m_pendingChanged.wait(&m_mutex);
+            continue;
+        }
+        const bool flushing = m_quit || m_flushRequests.load() > 0;
+        const qint64 nowMillis = m_clock.elapsed();
+        int numDueTracks = 0;
+        if (flushing) {
+            numDueTracks = m_pendingTracks.size();
+        } else {
+            if (nextBatchMillis > nowMillis) {
+                // Throttle metadata exports. The waiting tracks are
+                // still pending and can be reclaimed.
+                m_pendingChanged.wait(&m_mutex, nextBatchMillis - nowMillis);
+                continue;
+            }
+            while (numDueTracks < m_pendingTracks.size() &&
+                    numDueTracks < kMaxTracksPerBatch &&
+                    m_pendingTracks.at(numDueTracks).dueMillis <= nowMillis) {
+                ++numDueTracks;
+            }
+        }
+        if (numDueTracks == 0) {
+            m_pendingChanged.wait(&m_mutex,
+                    m_pendingTracks.first().dueMillis - nowMillis);
+            continue;
+        }
+
+        m_savingTracks = m_pendingTracks.mid(0, numDueTracks);
+        m_pendingTracks.erase(
+                m_pendingTracks.begin(),
+                m_pendingTracks.begin() + numDueTracks);
+        QList<Track*> plainPtrs;
+        QList<int> dirtyRevisions;
+        plainPtrs.reserve(m_savingTracks.size());
+        dirtyRevisions.reserve(m_savingTracks.size());
+        for (auto& savingTrack : m_savingTracks) {
+            // None of the tracks can be modified before it is reclaimed
+            savingTrack.dirtyRevision =
+                    savingTrack.cacheEntryPtr->getPlainPtr()->getDirtyRevision();
+            plainPtrs.append(savingTrack.cacheEntryPtr->getPlainPtr());
+            dirtyRevisions.append(savingTrack.dirtyRevision);
+        }
+        locker.unlock();
+        const int numExportedFiles = saveTracks(plainPtrs, dirtyRevisions);
+        locker.relock();
+        nextBatchMillis = m_clock.elapsed() +
+                numExportedFiles * kMinMetadataExportIntervalMillis;
+        for (const auto& savedTrack : m_savingTracks) {
+            if (savedTrack.reclaimed) {
+                // The track might be modified concurrently by the thread
+                // that owns it and must only be unblocked there
+                QMetaObject::invokeMethod(
+                        this,
+                        "slotReclaimedTrackSaved",
+                        Qt::QueuedConnection,
+                        Q_ARG(GlobalTrackCacheEntryPointer, savedTrack.cacheEntryPtr),
+                        Q_ARG(int, savedTrack.dirtyRevision));
+            }
+        }
+        // The evicted tracks are deleted when the last reference
+        // has been released
+        m_savingTracks.clear();
+        m_savingFinished.wakeAll();
+    }
+    m_accepting = false;
+    locker.unlock();
+
+    kLogger.debug() << "Exiting thread";
+}
+
+void TrackSaveQueue::slotReclaimedTrackSaved(
+        GlobalTrackCacheEntryPointer cacheEntryPtr,
+        int dirtyRevision) {
+    Track* pTrack = cacheEntryPtr->getPlainPtr();
+    {
+        QMutexLocker locker(&m_mutex);
+        const auto isEvictedAgain =
+                [pTrack](const PendingTrack& pendingTrack) {
+                    return pendingTrack.cacheEntryPtr->getPlainPtr() == pTrack;
+                };
+        if (std::any_of(
+                    m_pendingTracks.constBegin(),
+                    m_pendingTracks.constEnd(),
+                    isEvictedAgain) ||
+                std::any_of(
+                    m_savingTracks.constBegin(),
+                    m_savingTracks.constEnd(),
+                    isEvictedAgain)) {
+            // Queued again for saving with blocked signals
+            return;
+        }
+    }
+    pTrack->blockSignals(false);
+    if (pTrack->getDirtyRevision() != dirtyRevision) {
+        // The track has been modified while it was being saved and
+        // remains dirty. Send the notifications that have been blocked.
+        emit(trackDirty(pTrack->getId()));
+        pTrack->markDirty();
+    }
+}
+
+int TrackSaveQueue::saveTracks(
+        const QList<Track*>& tracks,
+        const QList<int>& dirtyRevisions) {
+    int numExportedFiles = 0;
+    for (Track* pTrack : tracks) {
+        // Metadata must be exported before updating the database,
+        // because exporting updates the synchronization time stamp
+        // of the track.
+        if (m_pTrackCollection->exportTrackMetadata(pTrack)) {
+            ++numExportedFiles;
+        }
+    }
+    QList<TrackId> savedTrackIds;
+    m_pDbConnectionPool->writeQueue()->execute(
+            [this, &tracks, &dirtyRevisions, &savedTrackIds](QSqlDatabase) {
+        savedTrackIds = m_trackDao.saveTracks(tracks, dirtyRevisions);
+        return true;
+    });
+    if (kLogger.debugEnabled()) {
+        kLogger.debug()
+                << "Saved"
+                << savedTrackIds.size()
+                << "of"
+                << tracks.size()
+                << "evicted tracks";
+    }
+    return numExportedFiles;
+}
@@ -0,0 +1,136 @@
+#ifndef MIXXX_TRACKSAVEQUEUE_H
+#define MIXXX_TRACKSAVEQUEUE_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+
+#include <atomic>
+
+#include "library/dao/analysisdao.h"
+#include "library/dao/cuedao.h"
+#include "library/dao/libraryhashdao.h"
+#include "library/dao/playlistdao.h"
+#include "library/dao/trackdao.h"
+#include "track/globaltrackcache.h"
+#include "util/db/dbconnectionpool.h"
+
+class TrackCollection;
+
+// Saves tracks that have been evicted from the GlobalTrackCache on a
+// separate thread instead of blocking the main thread with database
+// updates and tag exports. The database updates are executed by the
+// write queue of the connection pool.
+//
+// Evicted tracks are kept in a write-behind queue for a short delay.
+// A track that is requested again during this time is handed back to
+// the cache unmodified, i.e. repeated evictions of the same track are
+// coalesced into a single save. All due tracks are saved within a single
+// database transaction. Due tracks are saved in small batches and
+// exporting metadata into files is throttled between those batches to
+// not compete with the audio file reads of the decks. Tracks that wait
+// for the next batch are still pending and can be reclaimed.
+//
+// A track that is requested while being saved is handed back to the
+// cache immediately instead of waiting for the save to finish. Its
+// signals remain blocked until the save thread has finished saving it
+// and are unblocked on the thread that owns the track. Modifications in
+// the meantime keep the track dirty and their notifications are sent
+// afterwards.
+//
+// The queue is flushed when the cache is deactivated on shutdown and
+// by the destructor.
+class TrackSaveQueue : public QThread {
+    Q_OBJECT
+  public:
+    // The maximum number of tracks that are saved together while
+    // throttling
+    static const int kMaxTracksPerBatch;
+    // Minimum time between exporting metadata into two files
+    static const qint64 kMinMetadataExportIntervalMillis;
+
+    TrackSaveQueue(
+            mixxx::DbConnectionPoolPtr pDbConnectionPool,
+            TrackCollection* pTrackCollection,
+            const UserSettingsPointer& pConfig);
+    ~TrackSaveQueue() override;
+
+    // Takes over an evicted track for saving it later. Returns false if
+    // the track has not been accepted and needs to be saved immediately.
+    // Must be called while the GlobalTrackCache is locked.
+    bool enqueue(GlobalTrackCacheEntryPointer cacheEntryPtr);
+
+    // Removes and returns a pending track or a track that is currently
+    // being saved and matches the reference. Never blocks. Returns a
+    // null pointer if no matching track is found. Must be called while
+    // the GlobalTrackCache is locked.
+    GlobalTrackCacheEntryPointer reclaim(const TrackRef& trackRef);
+
+    // Saves all pending tracks without throttling and blocks until all
+    // of them have been saved.
+    void flush();
+
+  signals:
+    void trackDirty(TrackId trackId);
+
+  protected:
+    void run() override;
+
+    // Exports the metadata and saves a batch of tracks within a single
+    // transaction. Tracks that have been modified after their dirty
+    // revision had been obtained are not marked clean. Returns the number
+    // of files into which metadata has been exported. Invoked by the save
+    // thread without holding any locks.
+    virtual int saveTracks(
+            const QList<Track*>& tracks,
+            const QList<int>& dirtyRevisions);
+
+  private slots:
+    void slotReclaimedTrackSaved(
+            GlobalTrackCacheEntryPointer cacheEntryPtr,
+            int dirtyRevision);
+
+  private:
+    struct PendingTrack {
+        GlobalTrackCacheEntryPointer cacheEntryPtr;
+        TrackRef trackRef;
+        qint64 dueMillis;
+        // Handed back to the cache while being saved
+        bool reclaimed;
+        // Obtained when saving starts
+        int dirtyRevision;
+    };
+
+    const mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+
+    // Only used for exporting metadata which might be called from
+    // any thread.
+    TrackCollection* const m_pTrackCollection;
+
+    // The DAOs of the save thread. They are bound to the writer connection
+    // and must only be used by requests of its write queue.
+    LibraryHashDAO m_libraryHashDao;
+    CueDAO m_cueDao;
+    PlaylistDAO m_playlistDao;
+    AnalysisDao m_analysisDao;
+    TrackDAO m_trackDao;
+
+    // Guards all following members
+    QMutex m_mutex;
+    QWaitCondition m_pendingChanged;
+    QWaitCondition m_savingFinished;
+    bool m_accepting;
+    bool m_quit;
+    // Ordered by their due time
+    QList<PendingTrack> m_pendingTracks;
+    // Tracks that are currently being saved by the save thread
+    QList<PendingTrack> m_savingTracks;
+    QElapsedTimer m_clock;
+
+    // Disables throttling while waiting for the queue to become empty
+    std::atomic<int> m_flushRequests;
+};
+
+#endif // MIXXX_TRACKSAVEQUEUE_H
@@ -4,12 +4,14 @@
 #include <QtDebug>
 #include <QMessageBox>
 #include <QXmlStreamReader>
+#include <QHash>
 #include <QMap>
 #include <QSettings>
 #include <QStandardPaths>
 
 #include "library/traktor/traktorfeature.h"
 
+#include "library/externallibraryimporter.h"
 #include "library/librarytablemodel.h"
 #include "library/missingtablemodel.h"
 #include "library/queryutil.h"
@@ -24,6 +26,10 @@ QString fromTraktorSeparators(QString path) {
     return path.replace("/:", "/");
 }
 
+// Folders and playlists are identified by their path in the tree, e.g.
+// "-->someFolderA-->someFolderB-->playlistA"
+const QString kPathDelimiter = "-->";
+
 
 } // anonymous namespace 
 
@@ -109,6 +115,9 @@ TraktorFeature::TraktorFeature(QObject* parent, TrackCollection* pTrackCollectio
         qDebug() << "Failed to open database for iTunes scanner."
                  << m_database.lastError();
     }
+    m_pImporter = new ExternalLibraryImporter(m_database, "traktorfeature", this);
+    connect(m_pImporter, SIGNAL(progress(int)),
+            this, SLOT(slotImportProgress(int)));
     connect(&m_future_watcher, SIGNAL(finished()),
             this, SLOT(onTrackCollectionLoaded()));
 }
@@ -151,18 +160,10 @@ void TraktorFeature::activate() {
 
     if (!m_isActivated) {
         m_isActivated =  true;
-        // Usually the maximum number of threads
-        // is > 2 depending on the CPU cores
-        // Unfortunately, within VirtualBox
-        // the maximum number of allowed threads
-        // is 1 at all times We'll need to increase
-        // the number to > 1, otherwise importing the music collection
-        // takes place when the GUI threads terminates, i.e., on
-        // Mixxx shutdown.
-        QThreadPool::globalInstance()->setMaxThreadCount(4); //Tobias decided to use 4
-        // Let a worker thread do the XML parsing
-        m_future = QtConcurrent::run(this, &TraktorFeature::importLibrary,
-                                     getTraktorMusicDatabase());
+        // Let the import thread do the XML parsing
+        m_future = QtConcurrent::run(ExternalLibraryImporter::threadPool(),
+                this, &TraktorFeature::importLibrary,
+                getTraktorMusicDatabase());
         m_future_watcher.setFuture(m_future);
         m_title = tr("(loading) Traktor");
         //calls a slot in the sidebar model such that 'iTunes (isLoading)' is displayed.
@@ -194,20 +195,14 @@ TreeItem* TraktorFeature::importLibrary(QString file) {
     thisThread->setPriority(QThread::LowPriority);
     //Invisible root item of Traktor's child model
     TreeItem* root = NULL;
-    //Delete all table entries of Traktor feature
-    ScopedTransaction transaction(m_database);
-    clearTable("traktor_playlist_tracks");
-    clearTable("traktor_library");
-    clearTable("traktor_playlists");
-    transaction.commit();
-
-    transaction.transaction();
-    QSqlQuery query(m_database);
-    query.prepare("INSERT INTO traktor_library (artist, title, album, year,"
-                  "genre,comment,tracknumber,bpm, bitrate,duration, location,"
-                  "rating,key) VALUES (:artist, :title, :album, :year,:genre,"
-                  ":comment, :tracknumber,:bpm, :bitrate,:duration, :location,"
-                  ":rating,:key)");
+
+    // The shadow tables still contain everything if the collection has
+    // not been modified since the last import
+    const QStringList sourceFiles(file);
+    if (m_pImporter->isSourceUnchanged(sourceFiles, "traktor_library")) {
+        qDebug() << "Traktor library is unchanged since the last import";
+        return loadPlaylists();
+    }
 
     //Parse Trakor XML file using SAX (for performance)
     QFile traktor_file(file);
@@ -215,6 +210,25 @@ TreeItem* TraktorFeature::importLibrary(QString file) {
         qDebug() << "Cannot open Traktor music collection";
         return NULL;
     }
+
+    m_pImporter->resetSourceState();
+    m_pImporter->startProgress(traktor_file.size());
+    m_pImporter->beginTransaction();
+
+    //Delete all table entries of Traktor feature
+    QStringList tables;
+    tables << "traktor_playlist_tracks"
+           << "traktor_library"
+           << "traktor_playlists";
+    m_pImporter->clearTables(tables);
+
+    QSqlQuery query = m_pImporter->preparedQuery(
+            "INSERT INTO traktor_library (artist, title, album, year,"
+            "genre,comment,tracknumber,bpm, bitrate,duration, location,"
+            "rating,key) VALUES (:artist, :title, :album, :year,:genre,"
+            ":comment, :tracknumber,:bpm, :bitrate,:duration, :location,"
+            ":rating,:key)");
+
     QXmlStreamReader xml(&traktor_file);
     bool inCollectionTag = false;
     bool inPlaylistsTag = false;
@@ -232,6 +246,7 @@ TreeItem* TraktorFeature::importLibrary(QString file) {
                 //parse track
                 parseTrack(xml, query);
                 ++nAudioFiles; //increment number of files in the music collection
+                m_pImporter->updateProgress(traktor_file.pos());
             }
             if (xml.name() == "PLAYLISTS") {
                 inPlaylistsTag = true;
@@ -256,6 +271,10 @@ TreeItem* TraktorFeature::importLibrary(QString file) {
             }
         }
     }
+    // Even if an error occurred, commit the transaction. The file may have been
+    // half-parsed.
+    m_pImporter->commitTransaction();
+
     if (xml.hasError()) {
          // do error handling
          qDebug() << "Cannot process Traktor music collection";
@@ -265,12 +284,48 @@ TreeItem* TraktorFeature::importLibrary(QString file) {
     }
 
     qDebug() << "Found: " << nAudioFiles << " audio files in Traktor";
-    //initialize TraktorTableModel
-    transaction.commit();
-
+    if (root && !m_cancelImport) {
+        m_pImporter->storeSourceState(sourceFiles);
+    }
     return root;
 }
 
+TreeItem* TraktorFeature::loadPlaylists() {
+    return buildPlaylistTree(this,
+            m_pImporter->loadPlaylistNames("traktor_playlists"));
+}
+
+// static
+TreeItem* TraktorFeature::buildPlaylistTree(
+        LibraryFeature* pFeature,
+        const QStringList& playlistPaths) {
+    TreeItem* rootItem = new TreeItem(pFeature);
+    QHash<QString, TreeItem*> folders;
+    for (const auto& playlist_path : playlistPaths) {
+        // Only playlists are stored, their folders are restored from
+        // the path
+        const QStringList names =
+                playlist_path.split(kPathDelimiter, QString::SkipEmptyParts);
+        if (names.isEmpty()) {
+            continue;
+        }
+        TreeItem* parent = rootItem;
+        QString current_path;
+        for (int i = 0; i < names.size() - 1; ++i) {
+            current_path += kPathDelimiter;
+            current_path += names[i];
+            TreeItem* folder = folders.value(current_path);
+            if (!folder) {
+                folder = parent->appendChild(names[i], current_path);
+                folders.insert(current_path, folder);
+            }
+            parent = folder;
+        }
+        parent->appendChild(names.last(), playlist_path);
+    }
+    return rootItem;
+}
+
 void TraktorFeature::parseTrack(QXmlStreamReader &xml, QSqlQuery &query) {
     QString title;
     QString artist;
@@ -374,12 +429,13 @@ void TraktorFeature::parseTrack(QXmlStreamReader &xml, QSqlQuery &query) {
     query.bindValue(":bpm", bpm);
     query.bindValue(":bitrate", bitrate);
 
-    bool success = query.exec();
+    bool success = m_pImporter->execute(query);
     if (!success) {
         qDebug() << "SQL Error in TraktorTableModel.cpp: line"
                  << __LINE__ << " " << query.lastError();
         return;
     }
+    m_pImporter->addTrackLocation(location, query.lastInsertId().toInt());
 }
 
 // Purpose: Parsing all the folder and playlists of Traktor
@@ -394,17 +450,14 @@ TreeItem* TraktorFeature::parsePlaylists(QXmlStreamReader &xml) {
     QString current_path = "";
     QMap<QString,QString> map;
 
-    QString delimiter = "-->";
-
     TreeItem *rootItem = new TreeItem(this);
     TreeItem * parent = rootItem;
 
-    QSqlQuery query_insert_to_playlists(m_database);
-    query_insert_to_playlists.prepare("INSERT INTO traktor_playlists (name) "
-                  "VALUES (:name)");
+    QSqlQuery query_insert_to_playlists = m_pImporter->preparedQuery(
+        "INSERT INTO traktor_playlists (name) "
+        "VALUES (:name)");
 
-    QSqlQuery query_insert_to_playlist_tracks(m_database);
-    query_insert_to_playlist_tracks.prepare(
+    QSqlQuery query_insert_to_playlist_tracks = m_pImporter->preparedQuery(
         "INSERT INTO traktor_playlist_tracks (playlist_id, track_id, position) "
         "VALUES (:playlist_id, :track_id, :position)");
 
@@ -420,13 +473,13 @@ TreeItem* TraktorFeature::parsePlaylists(QXmlStreamReader &xml) {
                //TODO: What happens if the folder node is a leaf (empty folder)
                // Idea: Hide empty folders :-)
                if (type == "FOLDER") {
-                    current_path += delimiter;
+                    current_path += kPathDelimiter;
                     current_path += name;
                     //qDebug() << "Folder: " +current_path << " has parent " << parent->getData().toString();
                     map.insert(current_path, "FOLDER");
                     parent = parent->appendChild(name, current_path);
                } else if (type == "PLAYLIST") {
-                    current_path += delimiter;
+                    current_path += kPathDelimiter;
                     current_path += name;
                     //qDebug() << "Playlist: " +current_path << " has parent " << parent->getData().toString();
                     map.insert(current_path, "PLAYLIST");
@@ -436,6 +489,7 @@ TreeItem* TraktorFeature::parsePlaylists(QXmlStreamReader &xml) {
                     parsePlaylistEntries(xml, current_path,
                                          query_insert_to_playlists,
                                          query_insert_to_playlist_tracks);
+                    m_pImporter->updateProgress(xml.device()->pos());
                 }
             }
         }
@@ -447,7 +501,7 @@ TreeItem* TraktorFeature::parsePlaylists(QXmlStreamReader &xml) {
                 }
 
                 //Whenever we find a closing NODE, remove the last component of the path
-                int lastSlash = current_path.lastIndexOf (delimiter);
+                int lastSlash = current_path.lastIndexOf (kPathDelimiter);
                 int path_length = current_path.size();
 
                 current_path.remove(lastSlash, path_length - lastSlash);
@@ -470,7 +524,7 @@ void TraktorFeature::parsePlaylistEntries(
     // e.g., /someFolderA/someFolderB/playlistA"
     query_insert_into_playlist.bindValue(":name", playlist_path);
 
-    if (!query_insert_into_playlist.exec()) {
+    if (!m_pImporter->execute(query_insert_into_playlist)) {
         LOG_FAILED_QUERY(query_insert_into_playlist)
                 << "Failed to insert playlist in TraktorTableModel:"
                 << playlist_path;
@@ -478,22 +532,7 @@ void TraktorFeature::parsePlaylistEntries(
     }
 
     // Get playlist id
-    QSqlQuery id_query(m_database);
-    id_query.prepare("select id from traktor_playlists where name=:path");
-    id_query.bindValue(":path", playlist_path);
-
-    if (!id_query.exec()) {
-        LOG_FAILED_QUERY(id_query) << "Could not get inserted playlist id for Traktor playlist::"
-                                   << playlist_path;
-        return;
-    }
-
-    //playlist_id = id_query.lastInsertId().toInt();
-    int playlist_id = -1;
-    const int idColumn = id_query.record().indexOf("id");
-    while (id_query.next()) {
-        playlist_id = id_query.value(idColumn).toInt();
-    }
+    int playlist_id = query_insert_into_playlist.lastInsertId().toInt();
 
     int playlist_position = 1;
     while (!xml.atEnd() && !m_cancelImport) {
@@ -511,24 +550,12 @@ void TraktorFeature::parsePlaylistEntries(
                     #endif
 
                     //insert to database
-                    int track_id = -1;
-                    QSqlQuery finder_query(m_database);
-                    finder_query.prepare("select id from traktor_library where location=:path");
-                    finder_query.bindValue(":path", key);
-
-                    if (!finder_query.exec()) {
-                        LOG_FAILED_QUERY(finder_query) << "Could not get track id:" << key;
-                        continue;
-                    }
-
-                    if (finder_query.next()) {
-                        track_id = finder_query.value(finder_query.record().indexOf("id")).toInt();
-                    }
+                    int track_id = m_pImporter->trackIdForLocation(key);
 
                     query_insert_into_playlisttracks.bindValue(":playlist_id", playlist_id);
                     query_insert_into_playlisttracks.bindValue(":track_id", track_id);
                     query_insert_into_playlisttracks.bindValue(":position", playlist_position++);
-                    if (!query_insert_into_playlisttracks.exec()) {
+                    if (!m_pImporter->execute(query_insert_into_playlisttracks)) {
                         LOG_FAILED_QUERY(query_insert_into_playlisttracks)
                                 << "trackid" << track_id << " with path " << key
                                 << "playlistname; " << playlist_path <<" with ID " << playlist_id;
@@ -545,17 +572,6 @@ void TraktorFeature::parsePlaylistEntries(
     }
 }
 
-void TraktorFeature::clearTable(QString table_name) {
-    QSqlQuery query(m_database);
-    query.prepare("delete from "+table_name);
-
-    if (!query.exec())
-        qDebug() << "Could not delete remove old entries from table "
-                 << table_name << " : " << query.lastError();
-    else
-        qDebug() << "Traktor table entries of '" << table_name << "' have been cleared.";
-}
-
 QString TraktorFeature::getTraktorMusicDatabase() {
     QString musicFolder = "";
 
@@ -608,6 +624,15 @@ QString TraktorFeature::getTraktorMusicDatabase() {
     return musicFolder;
 }
 
+void TraktorFeature::slotImportProgress(int percent) {
+    if (m_future.isFinished()) {
+        // Outdated progress of the last import
+        return;
+    }
+    m_title = tr("(loading %1%) Traktor").arg(percent);
+    emit(featureIsLoading(this, false));
+}
+
 void TraktorFeature::onTrackCollectionLoaded() {
     std::unique_ptr<TreeItem> root(m_future.result());
     if (root) {
@@ -18,6 +18,7 @@
 
 class TrackCollection;
 class BaseExternalPlaylistModel;
+class ExternalLibraryImporter;
 
 class TraktorTrackModel : public BaseExternalTrackModel {
   public:
@@ -47,12 +48,21 @@ class TraktorFeature : public BaseExternalLibraryFeature {
 
     TreeItemModel* getChildModel();
 
+    // Restores the folders of the playlists from their paths, e.g.
+    // "-->someFolderA-->playlistA". Empty folders are omitted.
+    static TreeItem* buildPlaylistTree(
+            LibraryFeature* pFeature,
+            const QStringList& playlistPaths);
+
   public slots:
     void activate();
     void activateChild(const QModelIndex& index);
     void refreshLibraryModels();
     void onTrackCollectionLoaded();
 
+  private slots:
+    void slotImportProgress(int percent);
+
   private:
     virtual BaseSqlTableModel* getPlaylistModelForPlaylist(QString playlist);
     TreeItem* importLibrary(QString file);
@@ -60,16 +70,18 @@ class TraktorFeature : public BaseExternalLibraryFeature {
     void parseTrack(QXmlStreamReader &xml, QSqlQuery &query);
     // Iterates over all playliost and folders and constructs the childmodel
     TreeItem* parsePlaylists(QXmlStreamReader &xml);
+    // Builds the folders and playlists of a previous import
+    TreeItem* loadPlaylists();
     // processes a particular playlist
     void parsePlaylistEntries(QXmlStreamReader &xml, QString playlist_path,
     QSqlQuery query_insert_into_playlist, QSqlQuery query_insert_into_playlisttracks);
-    void clearTable(QString table_name);
     static QString getTraktorMusicDatabase();
     // private fields
     TreeItemModel m_childModel;
     TrackCollection* m_pTrackCollection;
     // A separate db connection for the worker parsing thread
     QSqlDatabase m_database;
+    ExternalLibraryImporter* m_pImporter;
     TraktorTrackModel* m_pTraktorTableModel;
     TraktorPlaylistModel* m_pTraktorPlaylistModel;
 
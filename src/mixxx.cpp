@@ -28,6 +28,8 @@
 #include <QGuiApplication>
 #include <QInputMethod>
 #include <QGLFormat>
+#include <QTimer>
+#include <QtConcurrentRun>
 
 #include "dialog/dlgabout.h"
 #include "preferences/dialog/dlgpreferences.h"
@@ -62,6 +64,7 @@
 #include "util/timer.h"
 #include "util/time.h"
 #include "util/version.h"
+#include "control/controlnotifier.h"
 #include "control/controlpushbutton.h"
 #include "util/sandbox.h"
 #include "mixer/playerinfo.h"
@@ -99,6 +102,10 @@ namespace {
 
 const mixxx::Logger kLogger("MixxxMainWindow");
 
+// Upper bound for postponing the deferred startup work if the main window
+// is not painted, e.g. because it has been started minimized.
+const int kDeferredStartupTimeoutMillis = 2000;
+
 // hack around https://gitlab.freedesktop.org/xorg/lib/libx11/issues/25
 // https://bugs.launchpad.net/mixxx/+bug/1805559
 #if defined(Q_OS_LINUX)
@@ -163,10 +170,13 @@ MixxxMainWindow::MixxxMainWindow(QApplication* pApp, const CmdlineArgs& args)
           m_toolTipsCfg(mixxx::TooltipsPreference::TOOLTIPS_ON),
           m_runtime_timer("MixxxMainWindow::runtime"),
           m_cmdLineArgs(args),
-          m_pTouchShift(nullptr) {
+          m_pTouchShift(nullptr),
+          m_deferredStartupPending(false) {
     m_runtime_timer.start();
     mixxx::Time::start();
 
+    m_startupProfile.beginPhase("main window");
+
     Version::logBuildDetails();
 
     // Only record stats in developer mode.
@@ -215,16 +225,43 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
     }
 #endif
 
+    m_startupProfile.beginPhase("initialize");
+
     UserSettingsPointer pConfig = m_pSettingsManager->settings();
 
     Sandbox::initialize(QDir(pConfig->getSettingsPath()).filePath("sandbox.cfg"));
 
+    SoundSourceProxy::setSeekIndexCacheDirectory(
+            QDir(pConfig->getSettingsPath()).filePath("seekindex"));
+
     QString resourcePath = pConfig->getResourcePath();
 
-    FontUtils::initializeFonts(resourcePath); // takes a long time
+    // Independent startup steps that don't create any QObjects are
+    // executed concurrently on worker threads while the GUI thread sets
+    // up the engine and the players. Each of them is joined right before
+    // its result is needed.
+    QFuture<mixxx::Duration> fontsLoaded = QtConcurrent::run([resourcePath] {
+        PerformanceTimer timer;
+        timer.start();
+        // QFontDatabase::addApplicationFont() is thread-safe
+        FontUtils::initializeFonts(resourcePath); // takes a long time
+        return timer.elapsed();
+    });
+#ifdef __LILV__
+    mixxx::Duration lv2WorldLoadDuration;
+    QFuture<LilvWorld*> lv2WorldLoaded = QtConcurrent::run([&lv2WorldLoadDuration] {
+        PerformanceTimer timer;
+        timer.start();
+        LilvWorld* pWorld = LV2Backend::loadWorld();
+        lv2WorldLoadDuration = timer.elapsed();
+        return pWorld;
+    });
+#endif
 
     launchProgress(2);
 
+    m_startupProfile.beginPhase("effects and engine");
+
     // Set the visibility of tooltips, default "1" = ON
     m_toolTipsCfg = static_cast<mixxx::TooltipsPreference>(
         pConfig->getValue(ConfigKey("[Controls]", "Tooltips"),
@@ -241,13 +278,19 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
     // Starting the master (mixing of the channels and effects):
     m_pEngine = new EngineMaster(pConfig, "[Master]", m_pEffectsManager,
                                  m_pChannelHandleFactory, true);
+    // Deliver the control changes of the engine to the other threads,
+    // independent of whether any waveforms are rendered
+    ControlNotifier::startDeliveryTimer(this);
 
     // Create effect backends. We do this after creating EngineMaster to allow
     // effect backends to refer to controls that are produced by the engine.
     BuiltInBackend* pBuiltInBackend = new BuiltInBackend(m_pEffectsManager);
     m_pEffectsManager->addEffectsBackend(pBuiltInBackend);
 #ifdef __LILV__
-    LV2Backend* pLV2Backend = new LV2Backend(m_pEffectsManager);
+    // Plugin discovery has been started concurrently above
+    LilvWorld* pLV2World = lv2WorldLoaded.result();
+    m_startupProfile.addConcurrentPhase("LV2 plugin discovery", lv2WorldLoadDuration);
+    LV2Backend* pLV2Backend = new LV2Backend(m_pEffectsManager, pLV2World);
     m_pEffectsManager->addEffectsBackend(pLV2Backend);
 #else
     LV2Backend* pLV2Backend = nullptr;
@@ -258,6 +301,8 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
 
     launchProgress(8);
 
+    m_startupProfile.beginPhase("sound manager");
+
     // Although m_pSoundManager is created here, m_pSoundManager->setupDevices()
     // needs to be called after m_pPlayerManager registers sound IO for each EngineChannel.
     m_pSoundManager = new SoundManager(pConfig, m_pEngine);
@@ -273,6 +318,8 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
 
     launchProgress(11);
 
+    m_startupProfile.beginPhase("players");
+
     // Needs to be created before CueControl (decks) and WTrackTableView.
     m_pGuiTick = new GuiTick();
     m_pVisualsManager = new VisualsManager();
@@ -310,6 +357,8 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
 
     launchProgress(30);
 
+    m_startupProfile.beginPhase("effect chains");
+
     m_pEffectsManager->loadEffectChains();
 
 #ifdef __VINYLCONTROL__
@@ -326,6 +375,8 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
 
     CoverArtCache::createInstance();
 
+    m_startupProfile.beginPhase("database");
+
     m_pDbConnectionPool = MixxxDb(pConfig).connectionPool();
     if (!m_pDbConnectionPool) {
         // TODO(XXX) something a little more elegant
@@ -340,6 +391,8 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
 
     launchProgress(35);
 
+    m_startupProfile.beginPhase("library");
+
     m_pLibrary = new Library(
             this,
             pConfig,
@@ -386,11 +439,14 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
     // Initialize controller sub-system,
     // but do not set up controllers until the end of the application startup
     // (long)
+    m_startupProfile.beginPhase("controller manager");
     qDebug() << "Creating ControllerManager";
     m_pControllerManager = new ControllerManager(pConfig);
 
     launchProgress(47);
 
+    m_startupProfile.beginPhase("waveforms");
+
     // Before creating the first skin we need to create a QGLWidget so that all
     // the QGLWidget's we create can use it as a shared QGLContext.
     if (!CmdlineArgs::Instance().getSafeMode() && QGLFormat::hasOpenGL()) {
@@ -427,8 +483,8 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
 
     launchProgress(52);
 
-    connect(this, SIGNAL(newSkinLoaded()),
-            m_pLibrary, SLOT(onSkinLoadFinished()));
+    // The library is connected to newSkinLoaded() in
+    // slotDeferredStartup(), after the skin has been painted.
 
     // Inhibit the screensaver if the option is set. (Do it before creating the preferences dialog)
     int inhibit = pConfig->getValue<int>(ConfigKey("[Config]","InhibitScreensaver"),-1);
@@ -441,6 +497,12 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
         mixxx::ScreenSaverHelper::inhibit();
     }
 
+    m_startupProfile.beginPhase("fonts (waiting)");
+    // The preferences and the skin need all fonts
+    m_startupProfile.addConcurrentPhase("fonts", fontsLoaded.result());
+
+    m_startupProfile.beginPhase("preferences");
+
     // Initialize preference dialog
     m_pPrefDlg = new DlgPreferences(this, m_pSkinLoader, m_pSoundManager, m_pPlayerManager,
                                     m_pControllerManager, m_pVCManager, pLV2Backend, m_pEffectsManager,
@@ -456,6 +518,8 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
 
     launchProgress(63);
 
+    m_startupProfile.beginPhase("skin");
+
     QWidget* oldWidget = m_pWidgetParent;
 
     // Load skin to a QWidget that we set as the central widget. Assignment
@@ -499,10 +563,7 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
     }
     emit(newSkinLoaded());
 
-
-    // Wait until all other ControlObjects are set up before initializing
-    // controllers
-    m_pControllerManager->setUpDevices();
+    m_startupProfile.beginPhase("sound devices");
 
     // Scan the library for new files and directories
     bool rescan = pConfig->getValue<bool>(
@@ -528,6 +589,14 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
     // https://bugs.launchpad.net/mixxx/+bug/1758189
     m_pPlayerManager->loadSamplers();
 
+    if (args.getRenderMode()) {
+        // The engine starts rendering as soon as the render device has
+        // been set up
+        m_pRecordingManager->startRecordingTo(args.getRenderFile());
+        connect(m_pSoundManager, SIGNAL(renderFinished()),
+                this, SLOT(slotRenderFinished()));
+    }
+
     // Try open player device If that fails, the preference panel is opened.
     bool retryClicked;
     do {
@@ -551,7 +620,8 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
     // In case persisting errors, the user has already received a message
     // box from the preferences dialog above. So we can watch here just the
     // output count.
-    while (m_pSoundManager->getConfig().getOutputs().count() == 0) {
+    while (!args.getRenderMode() &&
+            m_pSoundManager->getConfig().getOutputs().count() == 0) {
         // Exit when we press the Exit button in the noSoundDlg dialog
         // only call it if result != OK
         bool continueClicked = false;
@@ -586,12 +656,54 @@ void MixxxMainWindow::initialize(QApplication* pApp, const CmdlineArgs& args) {
     // The launch image widget is automatically disposed, but we still have a
     // pointer to it.
     m_pLaunchImage = nullptr;
+
+    m_startupProfile.endPhase();
+
+    // Work that is not needed for the first frame is postponed until the
+    // main window has been painted, see eventFilter().
+    m_deferredStartupPending = true;
+    QTimer::singleShot(kDeferredStartupTimeoutMillis,
+            this, SLOT(slotDeferredStartup()));
+}
+
+void MixxxMainWindow::slotDeferredStartup() {
+    if (!m_deferredStartupPending) {
+        return;
+    }
+    m_deferredStartupPending = false;
+    m_startupProfile.markInteractive();
+
+    // Warm up the library track cache by activating the default
+    // sidebar selection (long for large libraries).
+    m_startupProfile.beginPhase("library track cache");
+    connect(this, SIGNAL(newSkinLoaded()),
+            m_pLibrary, SLOT(onSkinLoadFinished()));
+    m_pLibrary->onSkinLoadFinished();
+
+    // Wait until all other ControlObjects are set up before initializing
+    // controllers. This enumerates all controller presets on the
+    // controller thread.
+    m_startupProfile.beginPhase("controller devices");
+    m_pControllerManager->setUpDevices();
+
+    m_startupProfile.finish(QDir(
+            m_pSettingsManager->settings()->getSettingsPath()).filePath(
+                    "startup_profile.txt"));
+}
+
+void MixxxMainWindow::slotRenderFinished() {
+    // Closing the window finalizes the recorded file
+    close();
 }
 
 void MixxxMainWindow::finalize() {
     Timer t("MixxxMainWindow::~finalize");
     t.start();
 
+    // A deferred startup that is still queued must not touch the
+    // objects that are deleted below
+    m_deferredStartupPending = false;
+
     if (m_inhibitScreensaver != mixxx::ScreenSaverPreference::PREVENT_OFF) {
         mixxx::ScreenSaverHelper::uninhibit();
     }
@@ -1109,6 +1221,8 @@ void MixxxMainWindow::connectMenuBar() {
                 m_pLibrary, SLOT(slotCreateCrate()));
         connect(m_pMenuBar, SIGNAL(createPlaylist()),
                 m_pLibrary, SLOT(slotCreatePlaylist()));
+        connect(m_pMenuBar, SIGNAL(findDuplicateTracks()),
+                m_pLibrary, SLOT(slotFindDuplicateTracks()));
         connect(m_pLibrary, SIGNAL(scanStarted()),
                 m_pMenuBar, SLOT(onLibraryScanStarted()));
         connect(m_pLibrary, SIGNAL(scanFinished()),
@@ -1363,7 +1477,14 @@ void MixxxMainWindow::rebootMixxxView() {
 }
 
 bool MixxxMainWindow::eventFilter(QObject* obj, QEvent* event) {
-    if (event->type() == QEvent::ToolTip) {
+    if (event->type() == QEvent::Paint && m_deferredStartupPending) {
+        // The first paint of the main window after startup. Defer the
+        // remaining work until this paint event has been processed.
+        QWidget* pWidget = qobject_cast<QWidget*>(obj);
+        if (pWidget && pWidget->window() == this) {
+            QTimer::singleShot(0, this, SLOT(slotDeferredStartup()));
+        }
+    } else if (event->type() == QEvent::ToolTip) {
         // return true for no tool tips
         switch (m_toolTipsCfg) {
             case mixxx::TooltipsPreference::TOOLTIPS_ONLY_IN_LIBRARY:
@@ -1405,7 +1526,7 @@ void MixxxMainWindow::closeEvent(QCloseEvent *event) {
     // WARNING: We can receive a CloseEvent while only partially
     // initialized. This is because we call QApplication::processEvents to
     // render LaunchImage progress in the constructor.
-    if (!confirmExit()) {
+    if (!CmdlineArgs::Instance().getRenderMode() && !confirmExit()) {
         event->ignore();
         return;
     }
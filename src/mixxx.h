@@ -28,6 +28,7 @@
 #include "track/track.h"
 #include "util/cmdlineargs.h"
 #include "util/timer.h"
+#include "util/startupprofile.h"
 #include "util/db/dbconnectionpool.h"
 #include "soundio/sounddeviceerror.h"
 
@@ -102,6 +103,13 @@ class MixxxMainWindow : public QMainWindow {
     void slotNoDeckPassthroughInputConfigured();
     void slotNoVinylControlInputConfigured();
 
+  private slots:
+    // Performs the startup work that is not needed to display and
+    // operate the main window. Invoked once after the first paint.
+    void slotDeferredStartup();
+    // Exits after rendering offline has finished
+    void slotRenderFinished();
+
   signals:
     void newSkinLoaded();
     // used to uncheck the menu when the dialog of develeoper tools is closed
@@ -198,6 +206,9 @@ class MixxxMainWindow : public QMainWindow {
     ControlPushButton* m_pTouchShift;
     mixxx::ScreenSaverPreference m_inhibitScreensaver;
 
+    mixxx::StartupProfile m_startupProfile;
+    bool m_deferredStartupPending;
+
     static const int kMicrophoneCount;
     static const int kAuxiliaryCount;
 };
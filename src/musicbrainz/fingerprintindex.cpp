@@ -0,0 +1,238 @@
+#include "musicbrainz/fingerprintindex.h"
+
+#include <QSet>
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+
+#include "util/assert.h"
+#include "util/math.h"
+
+namespace {
+
+// Different encodings of the same audio rarely produce bit-identical
+// sub-fingerprints. Ignoring the lowest bits makes equal terms more
+// likely, but the remaining bits must be specific enough for not
+// matching the terms of unrelated tracks.
+const int kTermShift = 8;
+const int kTermBits = 32 - kTermShift;
+
+// Two tracks become candidates if the values of one band are equal. With
+// 95% equal bits only ~30% of all terms are equal and ~17% of the
+// signature values. Bands with more than one row would miss most of
+// them. Only the first half of the signature is split into bands for
+// saving memory. Tracks with 95% equal bits are still found with a
+// probability of more than 99%.
+const int kRowsPerBand = 1;
+const int kBands = FingerprintIndex::kSignatureSize / 2 / kRowsPerBand;
+
+// Tracks that consist mostly of silence or other trivial signals end up
+// in the same huge buckets. Only the first tracks of a bucket are
+// considered to keep the search linear.
+const int kMaxBucketSize = 256;
+
+const quint32 kEmptySlot = 0xFFFFFFFF;
+
+// About +/- 10 s for aligning raw fingerprints
+const int kMaxAlignmentOffset = 80;
+// At least about 5 s of raw fingerprints need to overlap
+const int kMinOverlap = 40;
+
+// Finalizer of MurmurHash3
+inline quint32 mixHash(quint32 h) {
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+}
+
+} // anonymous namespace
+
+// static
+bool FingerprintIndex::calculateSignature(
+        const RawFingerprint& fingerprint,
+        Signature* pSignature) {
+    DEBUG_ASSERT(pSignature);
+    // One permutation hashing: A single hash of each term selects the slot
+    // and the value that is kept if it is the minimum of that slot.
+    Signature signature;
+    signature.fill(kEmptySlot);
+    for (quint32 subFingerprint : fingerprint) {
+        const quint32 hash = mixHash(subFingerprint >> kTermShift);
+        const int slot = hash % kSignatureSize;
+        signature[slot] = math_min(signature[slot], hash / kSignatureSize);
+    }
+    // Densification: Empty slots borrow the value of the next non-empty
+    // slot, which is marked with the distance to distinguish it from the
+    // original.
+    for (int i = 0; i < kSignatureSize; ++i) {
+        for (int distance = 0; distance < kSignatureSize; ++distance) {
+            const quint32 value = signature[(i + distance) % kSignatureSize];
+            if (value != kEmptySlot) {
+                (*pSignature)[i] = value + (static_cast<quint32>(distance) << 26);
+                break;
+            }
+            if (distance == kSignatureSize - 1) {
+                // No terms at all
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// static
+double FingerprintIndex::estimateSimilarity(
+        const Signature& signature,
+        const Signature& otherSignature) {
+    int equalSlots = 0;
+    for (int i = 0; i < kSignatureSize; ++i) {
+        if (signature[i] == otherSignature[i]) {
+            ++equalSlots;
+        }
+    }
+    if (equalSlots == 0) {
+        return 0.0;
+    }
+    // The fraction of equal values estimates the Jaccard index J of both
+    // sets of terms. A term is equal if all of its bits are equal, i.e.
+    // with 2J / (1 + J) = p^kTermBits for a fraction p of equal bits.
+    const double jaccard = static_cast<double>(equalSlots) / kSignatureSize;
+    return std::pow(2.0 * jaccard / (1.0 + jaccard), 1.0 / kTermBits);
+}
+
+// static
+quint32 FingerprintIndex::bucketKey(const Signature& signature, int band) {
+    // FNV-1a over the rows of the band
+    quint32 key = 2166136261u ^ static_cast<quint32>(band);
+    for (int row = 0; row < kRowsPerBand; ++row) {
+        key ^= signature[band * kRowsPerBand + row];
+        key *= 16777619u;
+    }
+    return mixHash(key);
+}
+
+void FingerprintIndex::insert(TrackId trackId, const RawFingerprint& fingerprint) {
+    DEBUG_ASSERT(trackId.isValid());
+    remove(trackId);
+    Signature signature;
+    if (!calculateSignature(fingerprint, &signature)) {
+        return;
+    }
+    m_signatures.insert(trackId, signature);
+    for (int band = 0; band < kBands; ++band) {
+        m_buckets.push_back(BucketEntry{bucketKey(signature, band), trackId});
+    }
+    m_bucketsSorted = false;
+}
+
+void FingerprintIndex::remove(TrackId trackId) {
+    const auto it = m_signatures.find(trackId);
+    if (it == m_signatures.end()) {
+        return;
+    }
+    m_buckets.erase(
+            std::remove_if(m_buckets.begin(), m_buckets.end(),
+                    [trackId](const BucketEntry& entry) {
+                        return entry.trackId == trackId;
+                    }),
+            m_buckets.end());
+    m_signatures.erase(it);
+}
+
+void FingerprintIndex::sortBuckets() const {
+    if (m_bucketsSorted) {
+        return;
+    }
+    std::sort(m_buckets.begin(), m_buckets.end());
+    m_bucketsSorted = true;
+}
+
+QList<FingerprintIndex::Match> FingerprintIndex::findCandidates(
+        const Signature& signature,
+        TrackId trackId,
+        double minSimilarity) const {
+    sortBuckets();
+    QList<Match> matches;
+    QSet<TrackId> visited;
+    for (int band = 0; band < kBands; ++band) {
+        const quint32 key = bucketKey(signature, band);
+        // The entries of a bucket are sorted by track id
+        auto it = std::lower_bound(
+                m_buckets.cbegin(), m_buckets.cend(),
+                BucketEntry{key, trackId});
+        if (trackId.isValid() && it != m_buckets.cend() &&
+                it->key == key && it->trackId == trackId) {
+            ++it;
+        }
+        for (int bucketSize = 0;
+                it != m_buckets.cend() && it->key == key &&
+                        bucketSize < kMaxBucketSize;
+                ++it, ++bucketSize) {
+            const TrackId candidateId = it->trackId;
+            if (visited.contains(candidateId)) {
+                continue;
+            }
+            visited.insert(candidateId);
+            const double similarity = estimateSimilarity(
+                    signature, m_signatures.value(candidateId));
+            if (similarity >= minSimilarity) {
+                matches.append(Match{candidateId, similarity});
+            }
+        }
+    }
+    return matches;
+}
+
+QList<FingerprintIndex::Match> FingerprintIndex::findSimilar(
+        const RawFingerprint& fingerprint,
+        double minSimilarity) const {
+    Signature signature;
+    if (!calculateSignature(fingerprint, &signature)) {
+        return QList<Match>();
+    }
+    return findCandidates(signature, TrackId(), minSimilarity);
+}
+
+QList<FingerprintIndex::Duplicate> FingerprintIndex::findDuplicates(
+        double minSimilarity) const {
+    QList<Duplicate> duplicates;
+    for (auto it = m_signatures.constBegin(); it != m_signatures.constEnd(); ++it) {
+        // Both tracks of a pair would find each other
+        const QList<Match> matches = findCandidates(
+                it.value(), it.key(), minSimilarity);
+        for (const auto& match : matches) {
+            duplicates.append(Duplicate{it.key(), match.trackId, match.similarity});
+        }
+    }
+    return duplicates;
+}
+
+// static
+double FingerprintIndex::compareFingerprints(
+        const RawFingerprint& fingerprint,
+        const RawFingerprint& otherFingerprint) {
+    const int size = static_cast<int>(fingerprint.size());
+    const int otherSize = static_cast<int>(otherFingerprint.size());
+    double bestSimilarity = 0.0;
+    for (int offset = -kMaxAlignmentOffset; offset <= kMaxAlignmentOffset; ++offset) {
+        const int start = math_max(0, offset);
+        const int otherStart = math_max(0, -offset);
+        const int overlap = math_min(size - start, otherSize - otherStart);
+        if (overlap < math_min(kMinOverlap, math_min(size, otherSize)) ||
+                overlap <= 0) {
+            continue;
+        }
+        int bitErrors = 0;
+        for (int i = 0; i < overlap; ++i) {
+            bitErrors += static_cast<int>(std::bitset<32>(
+                    fingerprint[start + i] ^ otherFingerprint[otherStart + i]).count());
+        }
+        const double similarity = 1.0 - static_cast<double>(bitErrors) / (32.0 * overlap);
+        bestSimilarity = math_max(bestSimilarity, similarity);
+    }
+    return bestSimilarity;
+}
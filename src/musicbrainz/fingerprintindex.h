@@ -0,0 +1,110 @@
+#ifndef MUSICBRAINZ_FINGERPRINTINDEX_H
+#define MUSICBRAINZ_FINGERPRINTINDEX_H
+
+#include <QHash>
+#include <QList>
+
+#include <array>
+#include <vector>
+
+#include "track/trackid.h"
+
+// A raw Chromaprint fingerprint, i.e. one 32-bit sub-fingerprint for
+// every ~0.12 s of audio.
+typedef std::vector<quint32> RawFingerprint;
+
+// A local index over the fingerprints of the library for finding
+// duplicate and near-duplicate tracks without comparing all pairs.
+//
+// Each fingerprint is reduced to a MinHash signature of its (masked)
+// sub-fingerprints. The values of the signature are hashed into buckets
+// (locality-sensitive hashing). Only tracks that share at least one
+// bucket are compared. Different encodings of the same audio differ in
+// a few percent of all bits, so only a small fraction of the masked
+// sub-fingerprints are equal and a single equal value is already
+// significant. The fraction of equal bits is estimated from the fraction
+// of equal signature values. Tracks with more than ~90% equal bits are
+// found reliably. The raw fingerprints are not kept in memory.
+//
+// Not thread-safe.
+class FingerprintIndex {
+  public:
+    struct Match {
+        TrackId trackId;
+        // Estimated fraction of equal bits in the range [0, 1] like
+        // compareFingerprints()
+        double similarity;
+    };
+
+    struct Duplicate {
+        TrackId trackId;
+        TrackId otherTrackId;
+        double similarity;
+    };
+
+    // Replaces the fingerprint of a track that has already been indexed
+    void insert(TrackId trackId, const RawFingerprint& fingerprint);
+    void remove(TrackId trackId);
+
+    int size() const {
+        return m_signatures.size();
+    }
+
+    // Finds all indexed tracks that are similar to the given fingerprint
+    QList<Match> findSimilar(
+            const RawFingerprint& fingerprint,
+            double minSimilarity) const;
+
+    // Finds all pairs of similar tracks in the index. Each pair is
+    // reported only once.
+    QList<Duplicate> findDuplicates(double minSimilarity) const;
+
+    // Compares two raw fingerprints bit by bit. The fingerprints are
+    // aligned at the offset that matches best, e.g. for tracks with a
+    // different amount of silence at the start. Returns the fraction of
+    // equal bits in the range [0, 1]. Can be used for verifying the
+    // estimated matches if the raw fingerprints are available.
+    static double compareFingerprints(
+            const RawFingerprint& fingerprint,
+            const RawFingerprint& otherFingerprint);
+
+    static constexpr int kSignatureSize = 64;
+    typedef std::array<quint32, kSignatureSize> Signature;
+
+  private:
+    static bool calculateSignature(
+            const RawFingerprint& fingerprint,
+            Signature* pSignature);
+    static double estimateSimilarity(
+            const Signature& signature,
+            const Signature& otherSignature);
+    static quint32 bucketKey(const Signature& signature, int band);
+
+    // The buckets are only sorted before searching them
+    void sortBuckets() const;
+
+    // Only returns tracks with a greater id than a valid trackId, i.e.
+    // each pair of tracks is found only once
+    QList<Match> findCandidates(
+            const Signature& signature,
+            TrackId trackId,
+            double minSimilarity) const;
+
+    // Entries with the same key form a bucket. A flat vector needs far
+    // less memory than a hash with one node per entry.
+    struct BucketEntry {
+        quint32 key;
+        TrackId trackId;
+
+        bool operator<(const BucketEntry& other) const {
+            return key < other.key ||
+                    (key == other.key && trackId < other.trackId);
+        }
+    };
+
+    QHash<TrackId, Signature> m_signatures;
+    mutable std::vector<BucketEntry> m_buckets;
+    mutable bool m_bucketsSorted = true;
+};
+
+#endif // MUSICBRAINZ_FINGERPRINTINDEX_H
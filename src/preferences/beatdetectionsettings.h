@@ -18,6 +18,7 @@
 #define BPM_FIXED_TEMPO_OFFSET_CORRECTION "FixedTempoOffsetCorrection"
 #define BPM_REANALYZE_WHEN_SETTINGS_CHANGE "ReanalyzeWhenSettingsChange"
 #define BPM_FAST_ANALYSIS_ENABLED "FastAnalysisEnabled"
+#define BPM_PARALLEL_ANALYSIS_ENABLED "ParallelAnalysisEnabled"
 
 #define BPM_RANGE_START "BPMRangeStart"
 #define BPM_RANGE_END "BPMRangeEnd"
@@ -49,6 +50,11 @@ class BeatDetectionSettings {
     DEFINE_PREFERENCE_HELPERS(FastAnalysis, bool,
                               BPM_CONFIG_KEY, BPM_FAST_ANALYSIS_ENABLED, false);
 
+    // Splits long tracks into segments that are analyzed in parallel. The
+    // results are identical, so there is no need to re-analyze tracks.
+    DEFINE_PREFERENCE_HELPERS(ParallelAnalysis, bool,
+                              BPM_CONFIG_KEY, BPM_PARALLEL_ANALYSIS_ENABLED, true);
+
     QString getBeatPluginId() const {
         QString plugin_id = m_pConfig->getValue<QString>(ConfigKey(
             VAMP_CONFIG_KEY, VAMP_ANALYZER_BEAT_PLUGIN_ID));
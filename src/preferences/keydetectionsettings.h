@@ -16,6 +16,7 @@
 // KEY_CONFIG_KEY Preferences
 #define KEY_DETECTION_ENABLED "KeyDetectionEnabled"
 #define KEY_FAST_ANALYSIS "FastAnalysisEnabled"
+#define KEY_PARALLEL_ANALYSIS "ParallelAnalysisEnabled"
 #define KEY_REANALYZE_WHEN_SETTINGS_CHANGE "ReanalyzeWhenSettingsChange"
 
 #define KEY_NOTATION "KeyNotation"
@@ -35,6 +36,13 @@ class KeyDetectionSettings {
     DEFINE_PREFERENCE_HELPERS(FastAnalysis, bool,
                               KEY_CONFIG_KEY, KEY_FAST_ANALYSIS, false);
 
+    // Calculates the chromagram of long tracks in segments that are
+    // analyzed in parallel. The decimation filter of each segment is warmed
+    // up with the preceding window, so the results only differ by rounding
+    // errors and there is no need to re-analyze tracks.
+    DEFINE_PREFERENCE_HELPERS(ParallelAnalysis, bool,
+                              KEY_CONFIG_KEY, KEY_PARALLEL_ANALYSIS, true);
+
     DEFINE_PREFERENCE_HELPERS(ReanalyzeWhenSettingsChange, bool,
                               KEY_CONFIG_KEY, KEY_REANALYZE_WHEN_SETTINGS_CHANGE, false);
 
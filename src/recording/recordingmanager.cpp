@@ -2,6 +2,7 @@
 
 #include <QMutex>
 #include <QDir>
+#include <QFileInfo>
 #include <QtDebug>
 #include <QDebug>
 #include <QMessageBox>
@@ -39,7 +40,8 @@ RecordingManager::RecordingManager(UserSettingsPointer pConfig, EngineMaster* pE
           m_split_time(0),
           m_iNumberSplits(0),
           m_secondsRecorded(0),
-          m_secondsRecordedSplit(0) {
+          m_secondsRecordedSplit(0),
+          m_iNumberOfOverruns(0) {
     m_pToggleRecording = new ControlPushButton(ConfigKey(RECORDING_PREF_KEY, "toggle_recording"));
     connect(m_pToggleRecording, SIGNAL(valueChanged(double)),
             this, SLOT(slotToggleRecording(double)));
@@ -60,6 +62,8 @@ RecordingManager::RecordingManager(UserSettingsPointer pConfig, EngineMaster* pE
                 this, SLOT(slotBytesRecorded(int)));
         connect(pEngineRecord, SIGNAL(durationRecorded(quint64)),
                 this, SLOT(slotDurationRecorded(quint64)));
+        connect(pEngineRecord, SIGNAL(bufferOverruns(int)),
+                this, SLOT(slotBufferOverruns(int)));
         pSidechain->addSideChainWorker(pEngineRecord);
     }
 }
@@ -123,6 +127,7 @@ void RecordingManager::startRecording() {
     m_secondsRecordedSplit=0;
     m_iNumberOfBytesRecorded = 0;
     m_secondsRecorded=0;
+    m_iNumberOfOverruns = 0;
     m_dfSilence=0;
     m_dfCounter=0;
     m_split_size = getFileSplitSize();
@@ -151,6 +156,32 @@ void RecordingManager::startRecording() {
     m_recReady->set(RECORD_READY);
 }
 
+void RecordingManager::startRecordingTo(const QString& recordingLocation) {
+    // EngineRecord chooses the encoding by the file extension. The
+    // encoding in the preferences is left untouched.
+    const QFileInfo fileInfo(recordingLocation);
+
+    m_iNumberOfBytesRecordedSplit = 0;
+    m_secondsRecordedSplit=0;
+    m_iNumberOfBytesRecorded = 0;
+    m_secondsRecorded=0;
+    m_iNumberOfOverruns = 0;
+    m_dfSilence=0;
+    m_dfCounter=0;
+    m_split_size = ULLONG_MAX;
+    m_split_time = UINT_MAX;
+
+    m_iNumberSplits = 1;
+    m_recordingFile = fileInfo.fileName();
+    m_recording_base_file = fileInfo.absoluteDir().filePath(
+            fileInfo.completeBaseName());
+    m_recordingLocation = fileInfo.absoluteFilePath();
+    m_pConfig->set(ConfigKey(RECORDING_PREF_KEY, "Path"), m_recordingLocation);
+    m_pConfig->set(ConfigKey(RECORDING_PREF_KEY, "CuePath"), m_recording_base_file +".cue");
+
+    m_recReady->set(RECORD_READY);
+}
+
 void RecordingManager::splitContinueRecording()
 {
     ++m_iNumberSplits;
@@ -179,6 +210,7 @@ void RecordingManager::stopRecording()
     m_recordingLocation = "";
     m_iNumberOfBytesRecorded = 0;
     m_secondsRecorded = 0;
+    m_iNumberOfOverruns = 0;
 }
 
 void RecordingManager::setRecordingDir() {
@@ -225,6 +257,12 @@ QString RecordingManager::getRecordedDurationStr(unsigned int duration) {
                  .arg(duration % 60, 2, 'f', 0, '0');  // seconds
 }
 
+// Only called when recording is active.
+void RecordingManager::slotBufferOverruns(int overruns) {
+    m_iNumberOfOverruns += overruns;
+    emit(overrunsRecorded(m_iNumberOfOverruns));
+}
+
 // Only called when recording is active.
 void RecordingManager::slotBytesRecorded(int bytes)
 {
@@ -37,6 +37,11 @@ class RecordingManager : public QObject
     // called and a signal isRecording will be emitted.
     // The method computes the filename based on date/time information.
     void startRecording();
+    // Records into the given file instead of a new file in the recording
+    // directory. The encoding is chosen by the file extension without
+    // changing the encoding in the preferences, and the recording is
+    // never split into multiple files.
+    void startRecordingTo(const QString& recordingLocation);
     void stopRecording();
     bool isRecordingActive() const;
     void setRecordingDir();
@@ -50,11 +55,15 @@ class RecordingManager : public QObject
     void bytesRecorded(int);
     void isRecording(bool);
     void durationRecorded(QString);
+    // Emits the cumulative number of writes that have been dropped,
+    // because the disk was too slow.
+    void overrunsRecorded(int);
 
   public slots:
     void slotIsRecording(bool recording, bool error);
     void slotBytesRecorded(int);
     void slotDurationRecorded(quint64);
+    void slotBufferOverruns(int);
 
   private slots:
     void slotSetRecording(bool recording);
@@ -96,6 +105,7 @@ class RecordingManager : public QObject
     int m_iNumberSplits;
     unsigned int m_secondsRecorded;
     unsigned int m_secondsRecordedSplit;
+    int m_iNumberOfOverruns;
     QString getRecordedDurationStr(unsigned int duration);
 };
 
@@ -25,6 +25,7 @@
 #include "controllers/controllermanager.h"
 
 #include "skin/colorschemeparser.h"
+#include "skin/skincache.h"
 #include "skin/skincontext.h"
 #include "skin/launchimage.h"
 
@@ -200,28 +201,12 @@ QDomElement LegacySkinParser::openSkin(const QString& skinPath) {
     }
 
     QString skinXmlPath = skinDir.filePath("skin.xml");
-    QFile skinXmlFile(skinXmlPath);
-
-    if (!skinXmlFile.open(QIODevice::ReadOnly)) {
-        qDebug() << "LegacySkinParser::openSkin - can't open file:" << skinXmlPath
+    QDomDocument skin = SkinCache::openDocument(skinXmlPath);
+    if (skin.isNull()) {
+        qDebug() << "LegacySkinParser::openSkin - failed to parse:" << skinXmlPath
                  << "in directory:" << skinDir.path();
         return QDomElement();
     }
-
-    QDomDocument skin("skin");
-
-    QString errorMessage;
-    int errorLine;
-    int errorColumn;
-
-    if (!skin.setContent(&skinXmlFile,&errorMessage,&errorLine,&errorColumn)) {
-        qDebug() << "LegacySkinParser::openSkin - setContent failed see"
-                 << "line:" << errorLine << "column:" << errorColumn;
-        qDebug() << "LegacySkinParser::openSkin - message:" << errorMessage;
-        return QDomElement();
-    }
-
-    skinXmlFile.close();
     return skin.documentElement();
 }
 
@@ -1483,22 +1468,10 @@ QDomElement LegacySkinParser::loadTemplate(const QString& path) {
         return it.value();
     }
 
-    QFile templateFile(absolutePath);
-
-    if (!templateFile.open(QIODevice::ReadOnly)) {
-        qWarning() << "Could not open template file:" << absolutePath;
-    }
-
-    QDomDocument tmpl("template");
-    QString errorMessage;
-    int errorLine;
-    int errorColumn;
-
-    if (!tmpl.setContent(&templateFile, &errorMessage,
-                         &errorLine, &errorColumn)) {
-        qWarning() << "LegacySkinParser::loadTemplate - setContent failed see"
-                   << absolutePath << "line:" << errorLine << "column:" << errorColumn;
-        qWarning() << "LegacySkinParser::loadTemplate - message:" << errorMessage;
+    QDomDocument tmpl = SkinCache::openDocument(absolutePath);
+    if (tmpl.isNull()) {
+        qWarning() << "LegacySkinParser::loadTemplate - failed to load template:"
+                   << absolutePath;
         return QDomElement();
     }
 
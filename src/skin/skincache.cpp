@@ -0,0 +1,187 @@
+#include "skin/skincache.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QtDebug>
+
+#include "util/cachedirectory.h"
+#include "util/timer.h"
+
+namespace {
+
+// Header of the rasterized image files. Increment the version whenever
+// the file layout changes to invalidate all existing files.
+const quint32 kRasterizedSvgMagic = 0x4d585353; // "MXSS"
+const quint32 kRasterizedSvgVersion = 1;
+
+const QString kRasterizedSvgSuffix = QStringLiteral(".img");
+
+// Large enough for the images of a few skins at high scale factors.
+// Images of skins, scale factors or Mixxx versions that are no longer
+// used are evicted on startup when the cache exceeds this size.
+const qint64 kRasterizedSvgMaxTotalSize = 128 * 1024 * 1024;
+
+} // anonymous namespace
+
+// static
+QHash<QString, SkinCache::CachedDocument> SkinCache::s_documents;
+// static
+QString SkinCache::s_cacheDirectory;
+
+// static
+void SkinCache::setCacheDirectory(const QString& path) {
+    if (path.isEmpty()) {
+        s_cacheDirectory.clear();
+        return;
+    }
+    if (!QDir().mkpath(path)) {
+        qWarning() << "SkinCache: Failed to create cache directory" << path;
+        s_cacheDirectory.clear();
+        return;
+    }
+    CacheDirectory::prune(path, kRasterizedSvgMaxTotalSize,
+            QStringList{QStringLiteral("*") + kRasterizedSvgSuffix});
+    s_cacheDirectory = path;
+}
+
+// static
+QDomDocument SkinCache::openDocument(const QString& path) {
+    QFileInfo fileInfo(path);
+    const QString absolutePath = fileInfo.absoluteFilePath();
+
+    auto it = s_documents.constFind(absolutePath);
+    if (it != s_documents.constEnd() &&
+            it.value().size == fileInfo.size() &&
+            it.value().lastModified == fileInfo.lastModified()) {
+        return it.value().document;
+    }
+
+    ScopedTimer timer("SkinCache::openDocument");
+    QFile file(absolutePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "SkinCache: Could not open file:" << absolutePath;
+        return QDomDocument();
+    }
+
+    QDomDocument document;
+    QString errorMessage;
+    int errorLine;
+    int errorColumn;
+    if (!document.setContent(&file, &errorMessage, &errorLine, &errorColumn)) {
+        qWarning() << "SkinCache: setContent failed see"
+                   << absolutePath << "line:" << errorLine << "column:" << errorColumn;
+        qWarning() << "SkinCache: message:" << errorMessage;
+        s_documents.remove(absolutePath);
+        return QDomDocument();
+    }
+
+    s_documents.insert(absolutePath, CachedDocument{
+            fileInfo.size(),
+            fileInfo.lastModified(),
+            document});
+    return document;
+}
+
+// static
+QString SkinCache::rasterizedSvgFilePath(const PixmapSource& source,
+        double scaleFactor) {
+    if (s_cacheDirectory.isEmpty()) {
+        return QString();
+    }
+    // The id of inline SVGs is already a hash of their content. The
+    // modification time is needed to detect changes of SVG files.
+    QString key = source.getId();
+    if (source.getSvgSourceData().isEmpty()) {
+        QFileInfo fileInfo(source.getPath());
+        if (!fileInfo.exists()) {
+            return QString();
+        }
+        key += QString::number(fileInfo.lastModified().toMSecsSinceEpoch());
+        key += QString::number(fileInfo.size());
+    }
+    key += QString::number(scaleFactor);
+    const QByteArray hash = QCryptographicHash::hash(
+            key.toUtf8(), QCryptographicHash::Sha1).toHex();
+    return QDir(s_cacheDirectory).filePath(
+            QString::fromLatin1(hash) + kRasterizedSvgSuffix);
+}
+
+// static
+QImage SkinCache::loadRasterizedSvg(const PixmapSource& source,
+        double scaleFactor) {
+    const QString filePath = rasterizedSvgFilePath(source, scaleFactor);
+    if (filePath.isEmpty()) {
+        return QImage();
+    }
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        // Not cached yet
+        return QImage();
+    }
+
+    QDataStream stream(&file);
+    quint32 magic;
+    quint32 version;
+    qint32 width;
+    qint32 height;
+    qint32 format;
+    qint32 bytesPerLine;
+    stream >> magic >> version >> width >> height >> format >> bytesPerLine;
+    if (stream.status() != QDataStream::Ok ||
+            magic != kRasterizedSvgMagic ||
+            version != kRasterizedSvgVersion ||
+            width <= 0 || height <= 0) {
+        qWarning() << "SkinCache: Discarding invalid file" << filePath;
+        file.remove();
+        return QImage();
+    }
+
+    QImage image(width, height, static_cast<QImage::Format>(format));
+    if (image.isNull() || image.bytesPerLine() != bytesPerLine) {
+        qWarning() << "SkinCache: Discarding incompatible file" << filePath;
+        file.remove();
+        return QImage();
+    }
+    const int byteCount = bytesPerLine * height;
+    if (stream.readRawData(reinterpret_cast<char*>(image.bits()), byteCount) !=
+            byteCount) {
+        qWarning() << "SkinCache: Discarding truncated file" << filePath;
+        file.remove();
+        return QImage();
+    }
+    return image;
+}
+
+// static
+void SkinCache::storeRasterizedSvg(const PixmapSource& source,
+        double scaleFactor, const QImage& image) {
+    const QString filePath = rasterizedSvgFilePath(source, scaleFactor);
+    if (filePath.isEmpty() || image.isNull()) {
+        return;
+    }
+    // Write to a temporary file first to never leave partially written
+    // files behind.
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "SkinCache: Failed to create file" << filePath;
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << kRasterizedSvgMagic
+           << kRasterizedSvgVersion
+           << static_cast<qint32>(image.width())
+           << static_cast<qint32>(image.height())
+           << static_cast<qint32>(image.format())
+           << static_cast<qint32>(image.bytesPerLine());
+    const int byteCount = image.bytesPerLine() * image.height();
+    if (stream.writeRawData(reinterpret_cast<const char*>(image.constBits()),
+                byteCount) != byteCount ||
+            !file.commit()) {
+        qWarning() << "SkinCache: Failed to write file" << filePath;
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef SKINCACHE_H
+#define SKINCACHE_H
+
+#include <QDateTime>
+#include <QDomDocument>
+#include <QHash>
+#include <QImage>
+#include <QString>
+
+#include "skin/pixmapsource.h"
+
+// Caches the expensive intermediate results of loading a skin so that
+// reloading a skin, switching between skins and warm starts can skip them.
+//
+// - Parsed XML documents (skin.xml and templates) are kept in memory for
+//   the lifetime of the process. They are keyed by their absolute path and
+//   revalidated against the size and modification time of the file.
+// - SVG images that are rasterized for drawing are stored on disk, keyed
+//   by their source (path and modification time or inline content) and the
+//   scale factor. The images are stored before applying the color scheme so
+//   they can be shared between all schemes of a skin.
+//
+// The documents are shared with all callers and must not be modified.
+// Clone them first if modifications are needed, as SvgParser does.
+//
+// This class must only be used from the GUI thread.
+class SkinCache {
+  public:
+    // Sets the directory for the rasterized SVG images. Disk caching is
+    // disabled until a directory has been set or if the path is empty.
+    // The least recently used images are deleted if the directory has
+    // grown too large.
+    static void setCacheDirectory(const QString& path);
+
+    // Returns the parsed document for the XML file at the given path.
+    // The file is only parsed if it is not cached or has changed since it
+    // was parsed. Returns a null document and logs the parser error if
+    // the file could not be parsed.
+    static QDomDocument openDocument(const QString& path);
+
+    // Returns a previously stored rasterized image for the SVG source or
+    // a null image if none is available.
+    static QImage loadRasterizedSvg(const PixmapSource& source, double scaleFactor);
+    static void storeRasterizedSvg(const PixmapSource& source, double scaleFactor,
+            const QImage& image);
+
+  private:
+    SkinCache() = delete;
+
+    static QString rasterizedSvgFilePath(const PixmapSource& source, double scaleFactor);
+
+    struct CachedDocument {
+        qint64 size;
+        QDateTime lastModified;
+        QDomDocument document;
+    };
+    static QHash<QString, CachedDocument> s_documents;
+    static QString s_cacheDirectory;
+};
+
+#endif /* SKINCACHE_H */
@@ -17,11 +17,14 @@
 #include "mixer/playermanager.h"
 #include "util/debug.h"
 #include "skin/launchimage.h"
+#include "skin/skincache.h"
 #include "util/timer.h"
 #include "recording/recordingmanager.h"
 
 SkinLoader::SkinLoader(UserSettingsPointer pConfig) :
         m_pConfig(pConfig) {
+    SkinCache::setCacheDirectory(
+            QDir(m_pConfig->getSettingsPath()).filePath("skincache"));
 }
 
 SkinLoader::~SkinLoader() {
@@ -0,0 +1,156 @@
+#include "soundio/driftcorrector.h"
+
+#include "util/assert.h"
+#include "util/math.h"
+
+namespace {
+
+// The bandwidth of the DLL. It starts wide to lock quickly and is
+// narrowed afterwards to filter out the callback jitter of all common
+// drivers while still following the slow temperature dependent drift
+// of the crystals.
+const double kLockBandwidthHz = 1.0;
+const double kBandwidthHz = 0.1;
+const double kLockSecs = 2.0;
+
+// A callback that is late by more than this number of buffers is
+// considered as an xrun and restarts the DLL.
+const double kMaxCallbackErrorBuffers = 4;
+
+// Crystals of sound cards are usually within 100 ppm, cheap ones are
+// off by a few 100 ppm. A larger deviation is caused by a wrong
+// estimation and ignored.
+const double kMaxDrift = 0.002;
+
+// The gains of the PI controller for the fill level error per callback.
+// The fill level error jumps by up to a buffer depending on the phase
+// between the callbacks of both devices. The proportional gain must be
+// low enough that this does not modulate the pitch audibly.
+// The integral gain is chosen for a critically damped loop.
+const double kProportionalGain = 0.0005;
+const double kIntegralGain = kProportionalGain * kProportionalGain / 4;
+
+// Limits the correction by the fill level if the frame rate estimation
+// is not available.
+const double kMaxCorrection = 0.002;
+
+} // anonymous namespace
+
+FrameRateEstimator::FrameRateEstimator()
+        : m_nominalFrameRate(0),
+          m_b(0),
+          m_c(0),
+          m_nextTimeSecs(0),
+          m_secsPerFrame(0),
+          m_lastFrames(0),
+          m_updateCount(0),
+          m_settledUpdateCount(0) {
+}
+
+void FrameRateEstimator::reset(double nominalFrameRate) {
+    m_nominalFrameRate = nominalFrameRate;
+    m_updateCount = 0;
+}
+
+void FrameRateEstimator::update(double timeSecs, SINT frames) {
+    if (frames <= 0 || m_nominalFrameRate <= 0) {
+        return;
+    }
+    if (m_updateCount > 0) {
+        const double error = timeSecs - m_nextTimeSecs;
+        if (fabs(error) <= kMaxCallbackErrorBuffers * m_lastFrames * m_secsPerFrame) {
+            m_nextTimeSecs += m_b * error + frames * m_secsPerFrame;
+            m_secsPerFrame += m_c * error / m_lastFrames;
+            m_lastFrames = frames;
+            if (++m_updateCount == m_settledUpdateCount) {
+                setBandwidth(kBandwidthHz, frames / m_nominalFrameRate);
+            }
+            return;
+        }
+        // Restart after an xrun
+    }
+    const double bufferSecs = frames / m_nominalFrameRate;
+    setBandwidth(kLockBandwidthHz, bufferSecs);
+    m_secsPerFrame = 1 / m_nominalFrameRate;
+    m_nextTimeSecs = timeSecs + bufferSecs;
+    m_lastFrames = frames;
+    m_updateCount = 1;
+    m_settledUpdateCount = static_cast<int>(kLockSecs / bufferSecs);
+}
+
+void FrameRateEstimator::setBandwidth(double bandwidthHz, double bufferSecs) {
+    const double omega = 2 * M_PI * bandwidthHz * bufferSecs;
+    m_b = sqrt(2) * omega;
+    m_c = omega * omega;
+}
+
+double FrameRateEstimator::getFrameRate() const {
+    if (m_updateCount < m_settledUpdateCount || m_updateCount == 0) {
+        return 0;
+    }
+    return 1 / m_secsPerFrame;
+}
+
+DriftCorrector::DriftCorrector()
+        : m_channelCount(0),
+          m_ratio(1),
+          m_integral(0),
+          m_position(1) {
+}
+
+void DriftCorrector::reset(int channelCount) {
+    m_channelCount = channelCount;
+    m_ratio = 1;
+    m_integral = 0;
+    // The first destination frame is the first source frame
+    m_position = 1;
+    m_lastFrame.assign(channelCount, CSAMPLE_ZERO);
+}
+
+void DriftCorrector::updateRatio(double sourceFrameRate, double destFrameRate,
+        double fillLevelError) {
+    double ratio = 1;
+    if (sourceFrameRate > 0 && destFrameRate > 0) {
+        ratio = sourceFrameRate / destFrameRate;
+        if (fabs(ratio - 1) > kMaxDrift) {
+            ratio = 1;
+        }
+    }
+    m_integral = math_clamp(m_integral + kIntegralGain * fillLevelError,
+            -kMaxCorrection, kMaxCorrection);
+    const double correction = math_clamp(
+            kProportionalGain * fillLevelError + m_integral,
+            -kMaxCorrection, kMaxCorrection);
+    m_ratio = ratio * (1 + correction);
+}
+
+DriftCorrector::Result DriftCorrector::process(
+        const CSAMPLE* pSource, SINT sourceFrames,
+        CSAMPLE* pDest, SINT destFrames) {
+    DEBUG_ASSERT(m_channelCount > 0);
+    DEBUG_ASSERT(m_position >= 0);
+    // Position -1 is the last consumed source frame
+    double position = m_position - 1;
+    SINT destFrame = 0;
+    while (destFrame < destFrames && position < sourceFrames - 1) {
+        const SINT index = static_cast<SINT>(floor(position));
+        const CSAMPLE fraction = static_cast<CSAMPLE>(position - index);
+        const CSAMPLE* pFrame = (index < 0) ?
+                m_lastFrame.data() : &pSource[index * m_channelCount];
+        const CSAMPLE* pNextFrame = &pSource[(index + 1) * m_channelCount];
+        CSAMPLE* pDestFrame = &pDest[destFrame * m_channelCount];
+        for (int i = 0; i < m_channelCount; ++i) {
+            pDestFrame[i] = pFrame[i] + fraction * (pNextFrame[i] - pFrame[i]);
+        }
+        ++destFrame;
+        position += m_ratio;
+    }
+    const SINT consumedFrames = math_min(sourceFrames,
+            static_cast<SINT>(floor(position)) + 1);
+    if (consumedFrames > 0) {
+        const CSAMPLE* pFrame = &pSource[(consumedFrames - 1) * m_channelCount];
+        std::copy(pFrame, pFrame + m_channelCount, m_lastFrame.begin());
+    }
+    m_position = position - (consumedFrames - 1);
+    return Result{consumedFrames, destFrame};
+}
@@ -0,0 +1,98 @@
+#ifndef DRIFTCORRECTOR_H
+#define DRIFTCORRECTOR_H
+
+#include <vector>
+
+#include "util/types.h"
+
+// Estimates the actual frame rate of a sound device from the time stamps
+// of its callbacks with a delay-locked loop (DLL), which filters out the
+// jitter of the callbacks. See: Fons Adriaensen, "Using a DLL to filter
+// time", 2005.
+//
+// All devices take their time stamps from the same CPU clock. The ratio
+// between the estimated frame rates of two devices is their clock drift,
+// no matter how far the CPU clock itself is off.
+class FrameRateEstimator {
+  public:
+    FrameRateEstimator();
+
+    void reset(double nominalFrameRate);
+
+    // Must be called on entry of each callback with the current CPU time
+    // and the number of frames that are processed by this callback.
+    void update(double timeSecs, SINT frames);
+
+    // Returns 0 until the loop has settled.
+    double getFrameRate() const;
+
+  private:
+    void setBandwidth(double bandwidthHz, double bufferSecs);
+
+    double m_nominalFrameRate;
+    // Loop filter coefficients
+    double m_b;
+    double m_c;
+    // The filtered time of the next callback
+    double m_nextTimeSecs;
+    // The filtered duration of a frame
+    double m_secsPerFrame;
+    SINT m_lastFrames;
+    int m_updateCount;
+    int m_settledUpdateCount;
+};
+
+// Adapts the audio stream of a sound device to the clock of the clock
+// reference device by resampling it with a slowly varying ratio instead
+// of dropping or duplicating frames when the clocks have drifted apart.
+//
+// The ratio is the number of source frames consumed per destination
+// frame. It follows the ratio of the estimated frame rates of both
+// devices and is fine tuned by the fill level of the FIFO between them,
+// which would otherwise run away because of the remaining estimation
+// error.
+//
+// Frames are interpolated linearly. The ratio stays within a few hundred
+// ppm of 1, where the interpolation does not produce audible artifacts.
+class DriftCorrector {
+  public:
+    struct Result {
+        SINT sourceFrames;
+        SINT destFrames;
+    };
+
+    DriftCorrector();
+
+    // Must not be called while processing, because it allocates memory.
+    void reset(int channelCount);
+
+    // The fill level error is the difference between the actual and the
+    // desired number of frames in the FIFO in multiples of a buffer. It
+    // is positive if the FIFO holds too many frames. Frame rates of 0 are
+    // ignored.
+    void updateRatio(double sourceFrameRate, double destFrameRate,
+            double fillLevelError);
+
+    double getRatio() const {
+        return m_ratio;
+    }
+
+    // Resamples interleaved frames until either all source frames have
+    // been consumed or all destination frames have been written. Source
+    // frames are consumed only if they are no longer needed, i.e. the
+    // remaining ones must be passed again in the next call. Returns the
+    // number of frames consumed and written.
+    Result process(const CSAMPLE* pSource, SINT sourceFrames,
+            CSAMPLE* pDest, SINT destFrames);
+
+  private:
+    int m_channelCount;
+    double m_ratio;
+    double m_integral;
+    // The position of the next destination frame relative to the
+    // last consumed source frame
+    double m_position;
+    std::vector<CSAMPLE> m_lastFrame;
+};
+
+#endif // DRIFTCORRECTOR_H
@@ -34,6 +34,7 @@
 #include "soundio/soundmanagerutil.h"
 #include "util/denormalsarezero.h"
 #include "util/sample.h"
+#include "util/time.h"
 #include "util/timer.h"
 #include "util/trace.h"
 #include "util/math.h"
@@ -243,6 +244,8 @@ SoundDeviceError SoundDevicePortAudio::open(bool isClkRefDevice, int syncBuffers
 
     m_syncBuffers = syncBuffers;
 
+    m_frameRateEstimator.reset(m_dSampleRate);
+
     // Create the callback function pointer.
     PaStreamCallback* callback = NULL;
     if (isClkRefDevice) {
@@ -263,6 +266,7 @@ SoundDeviceError SoundDevicePortAudio::open(bool isClkRefDevice, int syncBuffers
             m_outputFifo->releaseWriteRegions(
                     m_outputParams.channelCount * m_framesPerBuffer * kFifoSize
                             / 2);
+            m_outputDriftCorrector.reset(m_outputParams.channelCount);
         }
         if (m_inputParams.channelCount) {
             m_inputFifo = new FIFO<CSAMPLE>(
@@ -271,6 +275,7 @@ SoundDeviceError SoundDevicePortAudio::open(bool isClkRefDevice, int syncBuffers
             m_inputFifo->releaseWriteRegions(
                     m_inputParams.channelCount * m_framesPerBuffer * kFifoSize
                             / 2);
+            m_inputDriftCorrector.reset(m_inputParams.channelCount);
         }
     } else if (m_syncBuffers == 1) { // "Disabled (short delay)"
         // this can be used on a second device when it is driven by the Clock
@@ -681,6 +686,11 @@ int SoundDevicePortAudio::callbackProcessDrift(
         m_pSoundManager->underflowHappened(7);
     }
 
+    m_frameRateEstimator.update(
+            mixxx::Time::elapsed().toDoubleSeconds(), framesPerBuffer);
+    const double frameRate = m_frameRateEstimator.getFrameRate();
+    const double clkRefFrameRate = m_pSoundManager->getClkRefFrameRate();
+
     // Since we are on the non Clock reference device and may have an independent
     // Crystal clock, a drift correction is required
     //
@@ -689,116 +699,84 @@ int SoundDevicePortAudio::callbackProcessDrift(
     // Unfortunately this delay is somehow random, an WILL produce a delay slow
     // shift without we can avoid it. (That's the price for using a cheap USB soundcard).
     //
-    // Additional we need an filled chunk and an empty chunk. These are used when on
-    // sound card overtakes the other. This always happens, if they are driven form
-    // two crystals. In a test case every 30 s @ 23 ms. After they are consumed,
-    // the drift correction takes place and fills or clears the reserve buffers.
-    // If this is finished before another overtake happens, we do not face any
-    // dropouts or clicks.
-    // So that's why we need a Fifo of 3 chunks.
+    // Instead of dropping or duplicating frames when one sound card overtakes
+    // the other, the stream is resampled with the ratio between the frame
+    // rates of both devices. The frame rates are estimated from the callback
+    // times, and the ratio is fine tuned to keep the fill level of the Fifo
+    // at one chunk plus the chunk for r/w.
     //
     // In addition there is a jitter effect. It happens that one callback is delayed,
     // in this case the second one fires two times and then the first one fires two
-    // time as well to catch up. This is also fixed by the additional buffers. If this
-    // happens just after an regular overtake, we will have clicks again.
-    //
-    // I the tests it turns out that it only happens in the opposite direction, so
-    // 3 chunks are just fine.
+    // time as well to catch up. This is fixed by the additional chunk in the
+    // Fifo, so 3 chunks are just fine.
 
     if (m_inputParams.channelCount) {
-        int inChunkSize = framesPerBuffer * m_inputParams.channelCount;
-        int readAvailable = m_inputFifo->readAvailable();
-        int writeAvailable = m_inputFifo->writeAvailable();
-        if (readAvailable < inChunkSize * kDriftReserve) {
-            // risk of an underflow, duplicate one frame
-            m_inputFifo->write(in, inChunkSize);
-            if (m_inputDrift) {
-                // Do not compensate the first delay, because it is likely a jitter
-                // corrected in the next cycle
-                // Duplicate one frame
-                m_inputFifo->write(
-                        &in[inChunkSize - m_inputParams.channelCount],
-                        m_inputParams.channelCount);
-                //qDebug() << "callbackProcessDrift write:" << (float)readAvailable / inChunkSize << "Skip";
-            } else {
-                m_inputDrift = true;
-                //qDebug() << "callbackProcessDrift write:" << (float)readAvailable / inChunkSize << "Jitter Skip";
-            }
-        } else if (readAvailable == inChunkSize * kDriftReserve) {
-            // Everything Ok
-            m_inputFifo->write(in, inChunkSize);
-            m_inputDrift = false;
-            //qDebug() << "callbackProcess write:" << (float) readAvailable / inChunkSize << "Normal";
-        } else if (writeAvailable >= inChunkSize) {
-            // Risk of overflow, skip one frame
-            if (m_inputDrift) {
-                m_inputFifo->write(in, inChunkSize - m_inputParams.channelCount);
-                //qDebug() << "callbackProcessDrift write:" << (float)readAvailable / inChunkSize << "Skip";
-            } else {
-                m_inputFifo->write(in, inChunkSize);
-                m_inputDrift = true;
-                //qDebug() << "callbackProcessDrift write:" << (float)readAvailable / inChunkSize << "Jitter Skip";
-            }
-        } else if (writeAvailable) {
+        const int channelCount = m_inputParams.channelCount;
+        const int inChunkSize = framesPerBuffer * channelCount;
+        const int readAvailable = m_inputFifo->readAvailable();
+        m_inputDriftCorrector.updateRatio(frameRate, clkRefFrameRate,
+                static_cast<double>(readAvailable - inChunkSize * kDriftReserve)
+                        / inChunkSize);
+        CSAMPLE* dataPtr1;
+        ring_buffer_size_t size1;
+        CSAMPLE* dataPtr2;
+        ring_buffer_size_t size2;
+        (void)m_inputFifo->aquireWriteRegions(m_inputFifo->writeAvailable(),
+                &dataPtr1, &size1, &dataPtr2, &size2);
+        DriftCorrector::Result result = m_inputDriftCorrector.process(
+                in, framesPerBuffer, dataPtr1, size1 / channelCount);
+        SINT sourceFrames = result.sourceFrames;
+        SINT destFrames = result.destFrames;
+        if (sourceFrames < framesPerBuffer && size2 > 0) {
+            result = m_inputDriftCorrector.process(
+                    &in[sourceFrames * channelCount],
+                    framesPerBuffer - sourceFrames,
+                    dataPtr2, size2 / channelCount);
+            sourceFrames += result.sourceFrames;
+            destFrames += result.destFrames;
+        }
+        m_inputFifo->releaseWriteRegions(destFrames * channelCount);
+        if (sourceFrames < framesPerBuffer) {
             // Fifo Overflow
-            m_inputFifo->write(in, writeAvailable);
             m_pSoundManager->underflowHappened(8);
             //qDebug() << "callbackProcessDrift write:" << (float) readAvailable / inChunkSize << "Overflow";
-        } else {
-            // Buffer full
-            m_pSoundManager->underflowHappened(9);
-            //qDebug() << "callbackProcessDrift write:" << (float) readAvailable / inChunkSize << "Buffer full";
         }
     }
 
     if (m_outputParams.channelCount) {
-        int outChunkSize = framesPerBuffer * m_outputParams.channelCount;
-        int readAvailable = m_outputFifo->readAvailable();
-
-        if (readAvailable > outChunkSize * (kDriftReserve + 1)) {
-            m_outputFifo->read(out, outChunkSize);
-            if (m_outputDrift) {
-                // Risk of overflow, skip one frame
-                m_outputFifo->releaseReadRegions(m_outputParams.channelCount);
-                //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Skip";
-            } else {
-                m_outputDrift = true;
-                //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Jitter Skip";
-            }
-        } else if (readAvailable == outChunkSize * (kDriftReserve + 1)) {
-            m_outputFifo->read(out, outChunkSize);
-            m_outputDrift = false;
-            //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Normal";
-        } else if (readAvailable >= outChunkSize) {
-            if (m_outputDrift) {
-                // Risk of underflow, duplicate one frame
-                m_outputFifo->read(out,
-                        outChunkSize - m_outputParams.channelCount);
-                SampleUtil::copy(
-                        &out[outChunkSize - m_outputParams.channelCount],
-                        &out[outChunkSize - (2 * m_outputParams.channelCount)],
-                        m_outputParams.channelCount);
-                //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Save";
-            } else {
-                m_outputFifo->read(out, outChunkSize);
-                m_outputDrift = true;
-                //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Jitter Save";
-            }
-        } else if (readAvailable) {
-            m_outputFifo->read(out,
-                    readAvailable);
+        const int channelCount = m_outputParams.channelCount;
+        const int outChunkSize = framesPerBuffer * channelCount;
+        const int readAvailable = m_outputFifo->readAvailable();
+        m_outputDriftCorrector.updateRatio(clkRefFrameRate, frameRate,
+                static_cast<double>(readAvailable - outChunkSize * (kDriftReserve + 1))
+                        / outChunkSize);
+        CSAMPLE* dataPtr1;
+        ring_buffer_size_t size1;
+        CSAMPLE* dataPtr2;
+        ring_buffer_size_t size2;
+        (void)m_outputFifo->aquireReadRegions(readAvailable,
+                &dataPtr1, &size1, &dataPtr2, &size2);
+        DriftCorrector::Result result = m_outputDriftCorrector.process(
+                dataPtr1, size1 / channelCount, out, framesPerBuffer);
+        SINT sourceFrames = result.sourceFrames;
+        SINT destFrames = result.destFrames;
+        if (destFrames < framesPerBuffer && size2 > 0) {
+            result = m_outputDriftCorrector.process(
+                    dataPtr2, size2 / channelCount,
+                    &out[destFrames * channelCount],
+                    framesPerBuffer - destFrames);
+            sourceFrames += result.sourceFrames;
+            destFrames += result.destFrames;
+        }
+        m_outputFifo->releaseReadRegions(sourceFrames * channelCount);
+        if (destFrames < framesPerBuffer) {
             // underflow
-            SampleUtil::clear(&out[readAvailable],
-                    outChunkSize - readAvailable);
+            SampleUtil::clear(&out[destFrames * channelCount],
+                    (framesPerBuffer - destFrames) * channelCount);
             m_pSoundManager->underflowHappened(10);
             //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Underflow";
-        } else {
-            // underflow
-            SampleUtil::clear(out, outChunkSize);
-            m_pSoundManager->underflowHappened(11);
-            //qDebug() << "callbackProcess read:" << (float)readAvailable / outChunkSize << "Buffer empty";
         }
-     }
+    }
     return paContinue;
 }
 
@@ -861,6 +839,11 @@ int SoundDevicePortAudio::callbackProcessClkRef(
     // This must be the very first call, else timeInfo becomes invalid
     updateCallbackEntryToDacTime(timeInfo);
 
+    // Publish the frame rate for the drift correction of the other devices
+    m_frameRateEstimator.update(
+            mixxx::Time::elapsed().toDoubleSeconds(), framesPerBuffer);
+    m_pSoundManager->setClkRefFrameRate(m_frameRateEstimator.getFrameRate());
+
     Trace trace("SoundDevicePortAudio::callbackProcessClkRef %1",
                 getInternalName());
 
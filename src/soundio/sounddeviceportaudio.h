@@ -23,6 +23,7 @@
 #include <QString>
 #include "util/performancetimer.h"
 
+#include "soundio/driftcorrector.h"
 #include "soundio/sounddevice.h"
 #include "util/duration.h"
 #include "util/fifo.h"
@@ -92,6 +93,12 @@ class SoundDevicePortAudio : public SoundDevice {
     FIFO<CSAMPLE>* m_inputFifo;
     bool m_outputDrift;
     bool m_inputDrift;
+    // Estimates the frame rate of this device for the drift correction
+    FrameRateEstimator m_frameRateEstimator;
+    // Adapts the Fifos to the clock reference if this device is not the
+    // clock reference.
+    DriftCorrector m_outputDriftCorrector;
+    DriftCorrector m_inputDriftCorrector;
 
     // A string describing the last PortAudio error to occur.
     QString m_lastError;
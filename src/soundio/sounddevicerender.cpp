@@ -0,0 +1,151 @@
+#include "soundio/sounddevicerender.h"
+
+#include <QtDebug>
+
+#include "control/controlobject.h"
+#include "engine/sidechain/enginesidechain.h"
+#include "soundio/soundmanager.h"
+#include "util/denormalsarezero.h"
+#include "util/logger.h"
+#include "util/math.h"
+
+namespace {
+
+const mixxx::Logger kLogger("SoundDeviceRender");
+
+// The render thread polls while waiting for the GUI thread so that it can
+// be stopped from the GUI thread at any time.
+const int kSyncTimeoutMillis = 10;
+
+} // anonymous namespace
+
+SoundDeviceRender::SoundDeviceRender(UserSettingsPointer config,
+                                     SoundManager* sm,
+                                     EngineSideChain* pSideChain,
+                                     double lengthSeconds)
+        : SoundDevice(config, sm),
+          m_pSideChain(pSideChain),
+          m_lengthSeconds(lengthSeconds),
+          m_framesRemaining(-1),
+          m_bOpen(false) {
+    // Setting parent class members:
+    m_hostAPI = "Render";
+    m_dSampleRate = 44100.0;
+    m_strInternalName = kRenderDeviceInternalName;
+    m_strDisplayName = QObject::tr("Offline render");
+    m_iNumInputChannels = 0;
+    m_iNumOutputChannels = 2;
+}
+
+SoundDeviceRender::~SoundDeviceRender() {
+}
+
+SoundDeviceError SoundDeviceRender::open(bool isClkRefDevice, int syncBuffers) {
+    Q_UNUSED(syncBuffers);
+    kLogger.debug() << "open:" << getInternalName();
+
+    if (m_dSampleRate <= 0) {
+        m_dSampleRate = 44100.0;
+    }
+    if (m_lengthSeconds > 0) {
+        m_framesRemaining = static_cast<SINT>(m_lengthSeconds * m_dSampleRate);
+    } else {
+        m_framesRemaining = -1;
+    }
+    m_bOpen = true;
+
+    if (isClkRefDevice) {
+        const double bufferMillis = m_framesPerBuffer * 1000.0 / m_dSampleRate;
+        ControlObject::set(ConfigKey("[Master]", "latency"), bufferMillis);
+        ControlObject::set(ConfigKey("[Master]", "samplerate"), m_dSampleRate);
+        ControlObject::set(ConfigKey("[Master]", "audio_buffer_size"), bufferMillis);
+
+        kLogger.info()
+                << "Rendering"
+                << (m_framesRemaining < 0 ? QString("until closed") :
+                        QString("%1 s").arg(m_lengthSeconds))
+                << "at" << m_dSampleRate << "Hz";
+
+        m_pThread = std::make_unique<SoundDeviceRenderThread>(this);
+        m_pThread->start(QThread::HighPriority);
+    } else {
+        kLogger.warning()
+                << "Nothing is rendered unless this is the clock reference";
+    }
+
+    return SOUNDDEVICE_ERROR_OK;
+}
+
+bool SoundDeviceRender::isOpen() const {
+    return m_bOpen;
+}
+
+SoundDeviceError SoundDeviceRender::close() {
+    if (m_pThread) {
+        m_pThread->stop();
+        m_pThread->wait();
+        m_pThread.reset();
+    }
+    m_bOpen = false;
+    return SOUNDDEVICE_ERROR_OK;
+}
+
+QString SoundDeviceRender::getError() const {
+    return QString();
+}
+
+bool SoundDeviceRender::callbackProcessClkRef() {
+    if (m_framesRemaining == 0) {
+        return false;
+    }
+
+    // The sidechain must keep up with the engine, because it would
+    // drop samples otherwise.
+    if (m_pSideChain) {
+        m_pSideChain->waitForWriteAvailable(m_framesPerBuffer);
+    }
+
+    m_pSoundManager->readProcess();
+    m_pSoundManager->onDeviceOutputCallback(m_framesPerBuffer);
+    m_pSoundManager->writeProcess();
+
+    if (m_framesRemaining > 0) {
+        // The last buffer is rendered completely
+        m_framesRemaining = math_max(
+                m_framesRemaining - m_framesPerBuffer, static_cast<SINT>(0));
+    }
+    return true;
+}
+
+void SoundDeviceRender::finishRender() {
+    if (m_pSideChain) {
+        m_pSideChain->waitUntilDrained();
+    }
+    kLogger.info() << "Finished rendering";
+    emit(m_pSoundManager->renderFinished());
+}
+
+void SoundDeviceRenderThread::run() {
+    // Same as for the real-time sound devices, the engine relies on
+    // denormals being flushed to zero for performance.
+#ifdef __SSE__
+    _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+#endif
+
+    while (!m_stop) {
+        if (!m_pParent->callbackProcessClkRef()) {
+            m_pParent->finishRender();
+            return;
+        }
+
+        // Wait until the GUI thread has processed all events that have
+        // been posted while processing the last buffer.
+        QMetaObject::invokeMethod(this, "slotSync", Qt::QueuedConnection);
+        while (!m_synced.tryAcquire(1, kSyncTimeoutMillis)) {
+            if (m_stop) {
+                return;
+            }
+        }
+    }
+}
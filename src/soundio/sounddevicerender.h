@@ -0,0 +1,96 @@
+#ifndef SOUNDDEVICERENDER_H
+#define SOUNDDEVICERENDER_H
+
+#include <QSemaphore>
+#include <QString>
+#include <QThread>
+
+#include "soundio/sounddevice.h"
+#include "util/memory.h"
+
+class SoundManager;
+class EngineSideChain;
+class SoundDeviceRenderThread;
+
+const QString kRenderDeviceInternalName = "Render";
+
+// A sound device without any hardware that drives the engine in a tight
+// loop for rendering the mix offline faster than real time. The rendered
+// audio is only consumed by the sidechain, i.e. by recording.
+//
+// The engine time advances by exactly one buffer per callback. After each
+// callback the render thread waits until the GUI thread has processed all
+// pending events. Control changes from controllers, scripts and Auto DJ
+// thus take effect at deterministic buffer boundaries independent of the
+// rendering speed.
+//
+// Some sources of nondeterminism remain, because they still depend on
+// the wall-clock time instead of the engine time:
+// - Timers of controller scripts fire after a number of milliseconds
+//   regardless of how many buffers have been rendered meanwhile.
+// - Tracks are loaded and read ahead on worker threads. A deck that
+//   starts playing before its track has been loaded or cached only
+//   renders silence until the samples have become available.
+class SoundDeviceRender : public SoundDevice {
+  public:
+    // A length of 0 renders until the device is closed.
+    SoundDeviceRender(UserSettingsPointer config,
+                      SoundManager* sm,
+                      EngineSideChain* pSideChain,
+                      double lengthSeconds);
+    ~SoundDeviceRender() override;
+
+    SoundDeviceError open(bool isClkRefDevice, int syncBuffers) override;
+    bool isOpen() const override;
+    SoundDeviceError close() override;
+    void readProcess() override {
+    }
+    void writeProcess() override {
+    }
+    QString getError() const override;
+
+    unsigned int getDefaultSampleRate() const override {
+        return 44100;
+    }
+
+    // Processes a single buffer of the engine. Returns false after the
+    // requested length has been rendered.
+    bool callbackProcessClkRef();
+    // Waits until all rendered samples have been recorded.
+    void finishRender();
+
+  private:
+    EngineSideChain* const m_pSideChain;
+    const double m_lengthSeconds;
+    SINT m_framesRemaining;
+    bool m_bOpen;
+    std::unique_ptr<SoundDeviceRenderThread> m_pThread;
+};
+
+class SoundDeviceRenderThread : public QThread {
+    Q_OBJECT
+  public:
+    SoundDeviceRenderThread(SoundDeviceRender* pParent)
+        : m_pParent(pParent),
+          m_stop(false) {
+    }
+
+    void stop() {
+        m_stop = true;
+    }
+
+  private slots:
+    // Invoked on the GUI thread after all previously posted events
+    void slotSync() {
+        m_synced.release();
+    }
+
+  private:
+    void run() override;
+
+    SoundDeviceRender* m_pParent;
+    volatile bool m_stop;
+    QSemaphore m_synced;
+};
+
+#endif // SOUNDDEVICERENDER_H
@@ -32,6 +32,7 @@
 #include "soundio/sounddevicenetwork.h"
 #include "soundio/sounddevicenotfound.h"
 #include "soundio/sounddeviceportaudio.h"
+#include "soundio/sounddevicerender.h"
 #include "soundio/soundmanagerutil.h"
 #include "util/compatibility.h"
 #include "util/cmdlineargs.h"
@@ -65,7 +66,8 @@ SoundManager::SoundManager(UserSettingsPointer pConfig,
           m_paInitialized(false),
           m_jackSampleRate(-1),
           m_pErrorDevice(NULL),
-          m_underflowHappened(0) {
+          m_underflowHappened(0),
+          m_clkRefFrameRate(0) {
     // TODO(xxx) some of these ControlObject are not needed by soundmanager, or are unused here.
     // It is possible to take them out?
     m_pControlObjectSoundStatusCO = new ControlObject(
@@ -94,8 +96,12 @@ SoundManager::SoundManager(UserSettingsPointer pConfig,
     if (!m_config.readFromDisk()) {
         m_config.loadDefaults(this, SoundManagerConfig::ALL);
     }
-    checkConfig();
-    m_config.writeToDisk(); // in case anything changed by applying defaults
+    // The configured sound hardware is not available when rendering
+    // offline and the configuration must not be reset
+    if (!CmdlineArgs::Instance().getRenderMode()) {
+        checkConfig();
+        m_config.writeToDisk(); // in case anything changed by applying defaults
+    }
 }
 
 SoundManager::~SoundManager() {
@@ -167,6 +173,7 @@ void SoundManager::closeDevices(bool sleepAfterClosing) {
             closed = true;
         }
     }
+    m_clkRefFrameRate.store(0);
 
     if (closed && sleepAfterClosing) {
 #ifdef __LINUX__
@@ -244,8 +251,13 @@ QList<unsigned int> SoundManager::getSampleRates() const {
 
 void SoundManager::queryDevices() {
     //qDebug() << "SoundManager::queryDevices()";
-    queryDevicesPortaudio();
-    queryDevicesMixxx();
+    if (CmdlineArgs::Instance().getRenderMode()) {
+        // Rendering offline does not use any sound hardware
+        queryDevicesRender();
+    } else {
+        queryDevicesPortaudio();
+        queryDevicesMixxx();
+    }
 
     // now tell the prefs that we updated the device list -- bkgood
     emit(devicesUpdated());
@@ -312,6 +324,13 @@ void SoundManager::queryDevicesMixxx() {
     m_devices.append(currentDevice);
 }
 
+void SoundManager::queryDevicesRender() {
+    auto currentDevice = SoundDevicePointer(new SoundDeviceRender(
+            m_pConfig, this, m_pMaster->getSideChain(),
+            CmdlineArgs::Instance().getRenderLength()));
+    m_devices.append(currentDevice);
+}
+
 SoundDeviceError SoundManager::setupDevices() {
     // NOTE(rryan): Big warning: This function is concurrent with calls to
     // pushBuffer and onDeviceOutputCallback until closeDevices() below.
@@ -350,7 +369,11 @@ SoundDeviceError SoundManager::setupDevices() {
 
     // load with all configured devices.
     // all found devices are removed below
-    QSet<QString> devicesNotFound = m_config.getDevices();
+    // The configured devices are not used when rendering offline
+    QSet<QString> devicesNotFound;
+    if (!CmdlineArgs::Instance().getRenderMode()) {
+        devicesNotFound = m_config.getDevices();
+    }
 
     // pair is isInput, isOutput
     QVector<DeviceMode> toOpen;
@@ -387,6 +410,12 @@ SoundDeviceError SoundManager::setupDevices() {
         QList<AudioOutput> outputs =
                 m_config.getOutputs().values(pDevice->getInternalName());
 
+        // The render device drives the engine without any outputs
+        if (pDevice->getInternalName() == kRenderDeviceInternalName) {
+            mode.isOutput = true;
+            pNewMasterClockRef = pDevice;
+        }
+
         // Statically connect the Network Device to the Sidechain
         if (pDevice->getInternalName() == kNetworkDeviceInternalName) {
             AudioOutput out(AudioPath::RECORD_BROADCAST, 0, 2, 0);
@@ -17,6 +17,7 @@
 #ifndef SOUNDMANAGER_H
 #define SOUNDMANAGER_H
 
+#include <atomic>
 #include <memory>
 
 #include <QObject>
@@ -71,6 +72,7 @@ class SoundManager : public QObject {
     void queryDevices();
     void queryDevicesPortaudio();
     void queryDevicesMixxx();
+    void queryDevicesRender();
 
     // Opens all the devices chosen by the user in the preferences dialog, and
     // establishes the proper connections between them and the mixing engine.
@@ -127,9 +129,21 @@ class SoundManager : public QObject {
 
     void processUnderflowHappened();
 
+    // The frame rate of the clock reference device measured with the CPU
+    // clock. The other devices correct their clock drift against it.
+    // Returns 0 if the frame rate has not been measured (yet).
+    void setClkRefFrameRate(double frameRate) {
+        m_clkRefFrameRate.store(frameRate);
+    }
+    double getClkRefFrameRate() const {
+        return m_clkRefFrameRate.load();
+    }
+
   signals:
     void devicesUpdated(); // emitted when pointers to SoundDevices go stale
     void devicesSetup(); // emitted when the sound devices have been set up
+    // emitted from the render thread when rendering offline has finished
+    void renderFinished();
     void outputRegistered(AudioOutput output, AudioSource *src);
     void inputRegistered(AudioInput input, AudioDestination *dest);
 
@@ -163,6 +177,7 @@ class SoundManager : public QObject {
     QSharedPointer<EngineNetworkStream> m_pNetworkStream;
 
     QAtomicInt m_underflowHappened;
+    std::atomic<double> m_clkRefFrameRate;
     int m_underflowUpdateCount;
     ControlProxy* m_pMasterAudioLatencyOverloadCount;
     ControlProxy* m_pMasterAudioLatencyOverload;
@@ -0,0 +1,71 @@
+#include "sources/seekindexcache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+#include <algorithm>
+
+#include "util/cachedirectory.h"
+#include "util/logger.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("SeekIndexCache");
+
+const qint64 kHashedBytes = 64 * 1024;
+
+} // anonymous namespace
+
+// Each index only needs a few hundred KB even for long tracks
+//static
+const qint64 SeekIndexCache::kDefaultMaxTotalSize = 64 * 1024 * 1024;
+
+//static
+QString SeekIndexCache::s_directory;
+
+//static
+void SeekIndexCache::setDirectory(const QString& path, qint64 maxTotalSize) {
+    if (!path.isEmpty()) {
+        if (!QDir().mkpath(path)) {
+            kLogger.warning()
+                    << "Failed to create seek index cache directory"
+                    << path;
+            s_directory.clear();
+            return;
+        }
+        // The directory only contains the cache files of all SoundSources
+        CacheDirectory::prune(path, maxTotalSize);
+    }
+    s_directory = path;
+}
+
+//static
+QString SeekIndexCache::filePath(const QString& audioFilePath, const QString& suffix) {
+    if (s_directory.isEmpty()) {
+        return QString();
+    }
+    QFile file(audioFilePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+    const qint64 fileSize = file.size();
+    const qint64 hashedBytes = std::min(fileSize, kHashedBytes);
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(file.read(hashedBytes));
+    if (!file.seek(fileSize - hashedBytes)) {
+        return QString();
+    }
+    hash.addData(file.read(hashedBytes));
+    hash.addData(QByteArray::number(fileSize));
+    hash.addData(QByteArray::number(
+            QFileInfo(file).lastModified().toMSecsSinceEpoch()));
+    return QDir(s_directory).filePath(
+            QString::fromLatin1(hash.result().toHex()) + suffix);
+}
+
+} // namespace mixxx
@@ -0,0 +1,41 @@
+#ifndef MIXXX_SEEKINDEXCACHE_H
+#define MIXXX_SEEKINDEXCACHE_H
+
+#include <QString>
+
+namespace mixxx {
+
+// Locates the files in which SoundSources cache the seek indices that
+// they have built for audio files, e.g. by scanning all frame headers.
+//
+// The cache files are keyed by the size, modification time and content
+// of the audio file. Only the beginning and the end of the audio file
+// are hashed, because reading the whole file would defeat the purpose
+// of the cache.
+class SeekIndexCache {
+  public:
+    // The default size limit of all cache files
+    static const qint64 kDefaultMaxTotalSize;
+
+    // Sets the directory for the cache files. Caching is disabled if
+    // the path is empty. Must be called upon startup before opening
+    // any files. Cache files that have not been used recently are
+    // deleted until the total size doesn't exceed the limit.
+    static void setDirectory(
+            const QString& path,
+            qint64 maxTotalSize = kDefaultMaxTotalSize);
+
+    // Returns the path of the cache file with the given suffix for the
+    // audio file or an empty string if caching is disabled or the audio
+    // file could not be read.
+    static QString filePath(const QString& audioFilePath, const QString& suffix);
+
+  private:
+    SeekIndexCache() = delete;
+
+    static QString s_directory;
+};
+
+} // namespace mixxx
+
+#endif // MIXXX_SEEKINDEXCACHE_H
@@ -1,9 +1,15 @@
 #include "sources/soundsourceffmpeg.h"
 
 #include "encoder/encoderffmpegresample.h"
+#include "sources/seekindexcache.h"
 
 #include "util/logger.h"
 
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+
+#include <algorithm>
 #include <mutex>
 #include <vector>
 
@@ -32,6 +38,20 @@ void initFFmpegLib() {
 // More than 2 channels are currently not supported
 const SINT kMaxChannelCount = 2;
 
+// Header of the jump point cache files. Increment the version whenever
+// the file layout or the collection of jump points changes to invalidate
+// all existing files.
+const quint32 kSeekIndexMagic = 0x4d584653; // "MXFS"
+const quint32 kSeekIndexVersion = 2;
+
+const QString kSeekIndexSuffix = QStringLiteral(".ffidx");
+
+// Decoding is resumed at a jump point at least this number of frames in
+// front of the seek position. The packets that are decoded first after
+// seeking might be incomplete (e.g. MP3 bit reservoir, MDCT overlap)
+// and are discarded. This spans multiple packets of all common codecs.
+const SINT kSeekPrerollFrameCount = 4096;
+
 inline AVMediaType getMediaTypeOfStream(AVStream* pStream) {
     return m_pAVStreamWrapper.getMediaTypeOfStream(pStream);
 }
@@ -295,7 +315,10 @@ SoundSourceFFmpeg::SoundSourceFFmpeg(const QUrl& url)
           m_lLastStoredPos(0),
           m_lStoreCount(0),
           m_lStoredSeekPoint(-1),
-          m_SStoredJumpPoint(nullptr) {
+          m_SStoredJumpPoint(nullptr),
+          m_lPrerollEndFrame(0),
+          m_bJumpPointsStorable(false),
+          m_bJumpPointsComplete(false) {
 }
 
 SoundSourceFFmpeg::~SoundSourceFFmpeg() {
@@ -418,6 +441,13 @@ SoundSource::OpenResult SoundSourceFFmpeg::tryOpen(
 #endif
     m_pResample->openMixxx(getSampleFormatOfStream(m_pAudioStream), AV_SAMPLE_FMT_FLT);
 
+    DEBUG_ASSERT(m_SJumpPoints.isEmpty());
+    m_seekIndexCacheFile =
+            SeekIndexCache::filePath(getLocalFileName(), kSeekIndexSuffix);
+    m_bJumpPointsStorable = !m_seekIndexCacheFile.isEmpty() &&
+            !loadJumpPoints(m_seekIndexCacheFile);
+    m_bJumpPointsComplete = false;
+
     return OpenResult::Succeeded;
 }
 
@@ -426,17 +456,172 @@ void SoundSourceFFmpeg::close() {
 
     m_pResample.reset();
 
+    if (m_bJumpPointsComplete && !m_SJumpPoints.isEmpty()) {
+        storeJumpPoints(m_seekIndexCacheFile);
+    }
+    m_bJumpPointsStorable = false;
+    m_bJumpPointsComplete = false;
+    freeJumpPoints();
+
+#if AVSTREAM_FROM_API_VERSION_3_1
+    m_pAudioContext.close();
+#endif
+    m_pAudioStream.close();
+    m_pInputFormatContext.close();
+}
+
+void SoundSourceFFmpeg::freeJumpPoints() {
     while (m_SJumpPoints.size() > 0) {
         ffmpegLocationObject* l_SRmJmp = m_SJumpPoints[0];
         m_SJumpPoints.remove(0);
         free(l_SRmJmp);
     }
+    m_SStoredJumpPoint = nullptr;
+}
 
+bool SoundSourceFFmpeg::loadJumpPoints(const QString& cacheFilePath) {
+    DEBUG_ASSERT(m_SJumpPoints.isEmpty());
+    QFile file(cacheFilePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        // Not cached yet
+        return false;
+    }
+
+    QDataStream stream(&file);
+    quint32 magic;
+    quint32 version;
+    quint32 jumpPointCount;
+    stream >> magic >> version >> jumpPointCount;
+    if ((stream.status() != QDataStream::Ok) ||
+            (magic != kSeekIndexMagic) ||
+            (version != kSeekIndexVersion)) {
+        kLogger.warning()
+                << "Discarding outdated or invalid seek index"
+                << cacheFilePath;
+        file.remove();
+        return false;
+    }
+
+    // Jump points are ordered by both their position and frame
+    SINT minPos = -1;
+    SINT minStartFrame = 0;
+    for (quint32 i = 0; i < jumpPointCount; ++i) {
+        qint64 pos;
+        qint64 pts;
+        qint64 startFrame;
+        stream >> pos >> pts >> startFrame;
+        if ((stream.status() != QDataStream::Ok) ||
+                (pos <= minPos) ||
+                (startFrame < minStartFrame)) {
+            kLogger.warning()
+                    << "Discarding corrupt seek index"
+                    << cacheFilePath;
+            freeJumpPoints();
+            file.remove();
+            return false;
+        }
+        struct ffmpegLocationObject* l_SJmp = (struct ffmpegLocationObject*)malloc(
+                sizeof(struct ffmpegLocationObject));
+        l_SJmp->pos = pos;
+        l_SJmp->pts = pts;
+        l_SJmp->startFrame = startFrame;
+        m_SJumpPoints.append(l_SJmp);
+        minPos = pos;
+        minStartFrame = startFrame;
+    }
+    return true;
+}
+
+void SoundSourceFFmpeg::storeJumpPoints(const QString& cacheFilePath) const {
+    QSaveFile file(cacheFilePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        kLogger.warning()
+                << "Failed to create seek index"
+                << cacheFilePath;
+        return;
+    }
+    QDataStream stream(&file);
+    stream << kSeekIndexMagic
+           << kSeekIndexVersion
+           << static_cast<quint32>(m_SJumpPoints.size());
+    for (const auto* pJumpPoint : m_SJumpPoints) {
+        stream << static_cast<qint64>(pJumpPoint->pos)
+               << static_cast<qint64>(pJumpPoint->pts)
+               << static_cast<qint64>(pJumpPoint->startFrame);
+    }
+    if ((stream.status() != QDataStream::Ok) || !file.commit()) {
+        kLogger.warning()
+                << "Failed to write seek index"
+                << cacheFilePath;
+    }
+}
+
+struct ffmpegLocationObject* SoundSourceFFmpeg::findJumpPoint(SINT frameIndex) const {
+    // The last jump point in front of the frame that leaves enough
+    // room for pre-rolling the decoder
+    auto i = std::lower_bound(
+            m_SJumpPoints.constBegin(),
+            m_SJumpPoints.constEnd(),
+            frameIndex - kSeekPrerollFrameCount,
+            [](const ffmpegLocationObject* pJumpPoint, SINT frameIndex) {
+                return pJumpPoint->startFrame < frameIndex;
+            });
+    if (i == m_SJumpPoints.constBegin()) {
+        return nullptr;
+    }
+    return *(i - 1);
+}
+
+bool SoundSourceFFmpeg::seekToJumpPoint(const ffmpegLocationObject* pJumpPoint) {
+    int ret = -1;
+    if ((pJumpPoint != nullptr) &&
+            (static_cast<int64_t>(pJumpPoint->pts) != AV_NOPTS_VALUE)) {
+        // Let the demuxer seek to the packet of the jump point instead
+        // of reading and discarding all packets before it. The packets
+        // in front of the jump point are still skipped while filling
+        // the cache if the demuxer ends up earlier.
+        ret = avformat_seek_file(m_pInputFormatContext,
+                m_pAudioStream->index,
+                INT64_MIN,
+                pJumpPoint->pts,
+                pJumpPoint->pts,
+                0);
+        if (ret < 0) {
+            kLogger.debug()
+                    << "seek: Can't seek to jump point"
+                    << pJumpPoint->pts;
+        }
+    }
+    if (ret < 0) {
+        // Seek to set (start of the stream which is FFmpeg frame 0)
+        // because we are dealing with compressed audio FFmpeg takes
+        // best of to seek that point (in this case 0 Is always there)
+        // in every other case we should provide MIN and MAX tolerance
+        // which we can take.
+        // FFmpeg just just can't take zero as MAX tolerance so we try to
+        // just make some tolerable (which is never used because zero point
+        // should always be there) some number (which is 0xffff 65535)
+        // that is chosen because in WMA frames can be that big and if it's
+        // smaller than the frame we are seeking we can get into error
+        ret = avformat_seek_file(m_pInputFormatContext,
+                m_pAudioStream->index,
+                0,
+                0,
+                0xffff,
+                AVSEEK_FLAG_BACKWARD);
+        if (ret < 0) {
+            kLogger.warning() << "seek: Can't seek to 0 byte!";
+            return false;
+        }
+    }
+
+    // Discard the state of the decoder from the previous position
 #if AVSTREAM_FROM_API_VERSION_3_1
-    m_pAudioContext.close();
+    avcodec_flush_buffers(m_pAudioContext);
+#else
+    avcodec_flush_buffers(m_pAudioStream->codec);
 #endif
-    m_pAudioStream.close();
-    m_pInputFormatContext.close();
+    return true;
 }
 
 void SoundSourceFFmpeg::clearCache() {
@@ -499,7 +684,8 @@ bool SoundSourceFFmpeg::readFramesToCache(unsigned int count, SINT offset) {
 
         // Read one frame (which has nothing to do with Mixxx Frame)
         // it's some packed audio data from container like MP3, Ogg or MP4
-        if (av_read_frame(m_pInputFormatContext, &l_SPacket) >= 0) {
+        const int l_iReadResult = av_read_frame(m_pInputFormatContext, &l_SPacket);
+        if (l_iReadResult >= 0) {
             // Are we on correct audio stream. Currently we are always
             // Using first audio stream but in future there should be
             // possibility to choose which to use
@@ -589,7 +775,19 @@ bool SoundSourceFFmpeg::readFramesToCache(unsigned int count, SINT offset) {
                     // which is pure Stereo Float
                     l_iRet = m_pResample->reSampleMixxx(l_pFrame, &l_SObj->bytes);
 
-                    if (l_iRet > 0) {
+                    const SINT l_lPacketFrameCount =
+                            AUDIOSOURCEFFMPEG_BYTEOFFSET_TO_MIXXXFRAME(l_iRet);
+                    // The pre-roll never contains any requested frames,
+                    // see findJumpPoint()
+                    const bool l_bPreroll = l_iRet > 0 &&
+                            (m_lCacheFramePos + l_lPacketFrameCount) <= m_lPrerollEndFrame;
+
+                    if (l_bPreroll) {
+                        free(l_SObj->bytes);
+                        free(l_SObj);
+                        l_SObj = nullptr;
+                        m_lCacheFramePos += l_lPacketFrameCount;
+                    } else if (l_iRet > 0) {
                         // Remove from cache
                         if (m_SCache.size() >= (AUDIOSOURCEFFMPEG_CACHESIZE - 10)) {
                             l_SRmObj = m_SCache[0];
@@ -602,7 +800,7 @@ bool SoundSourceFFmpeg::readFramesToCache(unsigned int count, SINT offset) {
                         m_SCache.append(l_SObj);
                         l_SObj->startFrame = m_lCacheFramePos;
                         l_SObj->length = l_iRet;
-                        m_lCacheFramePos += AUDIOSOURCEFFMPEG_BYTEOFFSET_TO_MIXXXFRAME(l_iRet);
+                        m_lCacheFramePos += l_lPacketFrameCount;
 
                         // Ogg/Opus have packages pos that have many
                         // audio frames so seek next unique pos..
@@ -630,7 +828,8 @@ bool SoundSourceFFmpeg::readFramesToCache(unsigned int count, SINT offset) {
                                 struct ffmpegLocationObject* l_SJmp = (struct ffmpegLocationObject*)malloc(
                                         sizeof(struct ffmpegLocationObject));
                                 m_lLastStoredPos = m_lCacheFramePos;
-                                l_SJmp->startFrame = m_lCacheFramePos;
+                                // Decoding resumes with this packet
+                                l_SJmp->startFrame = l_SObj->startFrame;
                                 l_SJmp->pos = l_SPacket.pos;
                                 l_SJmp->pts = l_SPacket.pts;
                                 m_SJumpPoints.append(l_SJmp);
@@ -666,6 +865,10 @@ bool SoundSourceFFmpeg::readFramesToCache(unsigned int count, SINT offset) {
 
         } else {
             kLogger.debug() << "readFramesToCache: Packet too big or File end";
+            if (l_iReadResult == AVERROR_EOF && m_bJumpPointsStorable) {
+                // The jump points of the whole stream have been collected
+                m_bJumpPointsComplete = true;
+            }
             l_bStop = true;
         }
     }
@@ -874,60 +1077,39 @@ ReadableSampleFrames SoundSourceFFmpeg::readSampleFramesClamped(
 
     const SINT seekFrameIndex = firstFrameIndex;
     if ((m_currentMixxxFrameIndex != seekFrameIndex) || (m_SCache.size() == 0)) {
-        int ret = 0;
-        qint64 i = 0;
-        struct ffmpegLocationObject* l_STestObj = nullptr;
-
-        if (seekFrameIndex < m_lCacheStartFrame) {
-            // Seek to set (start of the stream which is FFmpeg frame 0)
-            // because we are dealing with compressed audio FFmpeg takes
-            // best of to seek that point (in this case 0 Is always there)
-            // in every other case we should provide MIN and MAX tolerance
-            // which we can take.
-            // FFmpeg just just can't take zero as MAX tolerance so we try to
-            // just make some tolerable (which is never used because zero point
-            // should always be there) some number (which is 0xffff 65535)
-            // that is chosen because in WMA frames can be that big and if it's
-            // smaller than the frame we are seeking we can get into error
-            ret = avformat_seek_file(m_pInputFormatContext,
-                    m_pAudioStream->index,
-                    0,
-                    0,
-                    0xffff,
-                    AVSEEK_FLAG_BACKWARD);
-
-            if (ret < 0) {
-                kLogger.warning() << "seek: Can't seek to 0 byte!";
-                return ReadableSampleFrames();
-            }
-
+        // Try to find some jump point near to
+        // where we are located so we don't needed
+        // to try guess it
+        struct ffmpegLocationObject* l_SJumpPoint =
+                findJumpPoint(seekFrameIndex);
+
+        // Seeking forward to a jump point is faster than decoding
+        // all packets up to the requested position
+        if (seekFrameIndex < m_lCacheStartFrame ||
+                (l_SJumpPoint != nullptr &&
+                        l_SJumpPoint->startFrame > m_lCacheEndFrame)) {
             clearCache();
             m_lCacheStartFrame = 0;
             m_lCacheEndFrame = 0;
             m_lCacheLastPos = 0;
             m_lCacheFramePos = 0;
             m_lStoredSeekPoint = -1;
+            m_SStoredJumpPoint = nullptr;
+            m_lPrerollEndFrame = 0;
+
+            if (l_SJumpPoint != nullptr) {
+                m_lCacheFramePos = l_SJumpPoint->startFrame;
+                m_lStoredSeekPoint = l_SJumpPoint->pos;
+                m_SStoredJumpPoint = l_SJumpPoint;
+                m_lPrerollEndFrame =
+                        l_SJumpPoint->startFrame + kSeekPrerollFrameCount;
+                // The jump points that are collected after
+                // resuming here are not stored
+                m_bJumpPointsStorable = false;
+            }
 
-            // Try to find some jump point near to
-            // where we are located so we don't needed
-            // to try guess it
-            if (m_SJumpPoints.size() > 0) {
-                l_STestObj = m_SJumpPoints.first();
-
-                if (seekFrameIndex > l_STestObj->startFrame) {
-                    for (i = 0; i < m_SJumpPoints.size(); i++) {
-                        if (m_SJumpPoints[i]->startFrame >= seekFrameIndex) {
-                            if (i > 0) {
-                                i--;
-                            }
-
-                            m_lCacheFramePos = m_SJumpPoints[i]->startFrame;
-                            m_lStoredSeekPoint = m_SJumpPoints[i]->pos;
-                            m_SStoredJumpPoint = m_SJumpPoints[i];
-                            break;
-                        }
-                    }
-                }
+            if (!seekToJumpPoint(m_SStoredJumpPoint)) {
+                return ReadableSampleFrames();
             }
 
             if (seekFrameIndex == frameIndexMin()) {
@@ -131,6 +131,20 @@ class SoundSourceFFmpeg : public SoundSource {
     SINT getSizeofCache();
     void clearCache();
 
+    // Returns the last jump point that starts at least one packet in
+    // front of the frame or nullptr if there is none.
+    struct ffmpegLocationObject* findJumpPoint(SINT frameIndex) const;
+    // Restarts demuxing and decoding at the jump point or at the
+    // beginning of the stream if no jump point is given.
+    bool seekToJumpPoint(const ffmpegLocationObject* pJumpPoint);
+
+    // The jump points are cached on disk after the whole stream has been
+    // decoded once, e.g. during analysis, to allow seeking directly into
+    // the stream after reopening the file.
+    bool loadJumpPoints(const QString& cacheFilePath);
+    void storeJumpPoints(const QString& cacheFilePath) const;
+    void freeJumpPoints();
+
     unsigned int read(unsigned long size, SAMPLE*);
 
     static AVFormatContext* openInputFile(const QString& fileName);
@@ -279,6 +293,15 @@ class SoundSourceFFmpeg : public SoundSource {
     SINT m_lStoreCount;
     SINT m_lStoredSeekPoint;
     struct ffmpegLocationObject* m_SStoredJumpPoint;
+    // Packets that end before this frame are only decoded to restore
+    // the state of the decoder after seeking to a jump point
+    SINT m_lPrerollEndFrame;
+
+    QString m_seekIndexCacheFile;
+    // Only jump points that have been collected while decoding the
+    // stream contiguously from the beginning are stored
+    bool m_bJumpPointsStorable;
+    bool m_bJumpPointsComplete;
 };
 
 class SoundSourceProviderFFmpeg : public SoundSourceProvider {
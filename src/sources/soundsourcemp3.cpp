@@ -1,11 +1,17 @@
 #include "sources/soundsourcemp3.h"
 #include "sources/mp3decoding.h"
+#include "sources/seekindexcache.h"
 
 #include "util/logger.h"
 #include "util/math.h"
 
 #include <id3tag.h>
 
+#include <algorithm>
+
+#include <QDataStream>
+#include <QSaveFile>
+
 namespace mixxx {
 
 namespace {
@@ -156,6 +162,47 @@ bool decodeFrameHeader(
     return true;
 }
 
+// Header of the seek index cache files. Increment the version whenever
+// the file layout changes to invalidate all existing files.
+const quint32 kSeekIndexMagic = 0x4d584d53; // "MXMS"
+const quint32 kSeekIndexVersion = 1;
+
+const QString kSeekIndexSuffix = QStringLiteral(".mp3idx");
+
+// Number of seek frames that are checked to still point to a frame
+// header when loading a cached seek frame list
+const SINT kSeekIndexVerifiedFrameCount = 16;
+
+// The offsets and lengths of consecutive MP3 frames differ only
+// slightly and are stored as variable length integers.
+void appendVarUInt(QByteArray* pData, quint64 value) {
+    while (value >= 0x80) {
+        pData->append(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    pData->append(static_cast<char>(value));
+}
+
+bool readVarUInt(const QByteArray& data, int* pPos, quint64* pValue) {
+    quint64 value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (*pPos >= data.size()) {
+            return false;
+        }
+        const quint8 byte = static_cast<quint8>(data.at((*pPos)++));
+        value |= static_cast<quint64>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *pValue = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool isFrameSync(const unsigned char* pInputData) {
+    return (pInputData[0] == 0xFF) && ((pInputData[1] & 0xE0) == 0xE0);
+}
+
 } // anonymous namespace
 
 SoundSourceMp3::SoundSourceMp3(const QUrl& url)
@@ -219,6 +266,32 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
     DEBUG_ASSERT(m_seekFrameList.empty());
     m_avgSeekFrameCount = 0;
     m_curFrameIndex = 0;
+
+    const QString seekIndexCacheFile =
+            SeekIndexCache::filePath(m_file.fileName(), kSeekIndexSuffix);
+    if (seekIndexCacheFile.isEmpty() || !loadSeekFrameList(seekIndexCacheFile)) {
+        const OpenResult scanResult = scanSeekFrameList();
+        if (scanResult != OpenResult::Succeeded) {
+            return scanResult;
+        }
+        if (!seekIndexCacheFile.isEmpty()) {
+            storeSeekFrameList(seekIndexCacheFile);
+        }
+    }
+
+    // Restart decoding at the beginning of the audio stream
+    restartDecoding(m_seekFrameList.front());
+
+    if (m_curFrameIndex != frameIndexMin()) {
+        kLogger.warning() << "Failed to start decoding:" << m_file.fileName();
+        // Abort
+        return OpenResult::Failed;
+    }
+
+    return OpenResult::Succeeded;
+}
+
+SoundSource::OpenResult SoundSourceMp3::scanSeekFrameList() {
     int headerPerSampleRate[kSampleRateCount];
     for (int i = 0; i < kSampleRateCount; ++i) {
         headerPerSampleRate[i] = 0;
@@ -394,16 +467,150 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
     addSeekFrame(m_curFrameIndex, 0);
     DEBUG_ASSERT(m_seekFrameList.back().frameIndex == frameIndexMax());
 
-    // Restart decoding at the beginning of the audio stream
-    restartDecoding(m_seekFrameList.front());
+    return OpenResult::Succeeded;
+}
 
-    if (m_curFrameIndex != frameIndexMin()) {
-        kLogger.warning() << "Failed to start decoding:" << m_file.fileName();
-        // Abort
-        return OpenResult::Failed;
+bool SoundSourceMp3::loadSeekFrameList(const QString& cacheFilePath) {
+    DEBUG_ASSERT(m_seekFrameList.empty());
+    QFile file(cacheFilePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        // Not cached yet
+        return false;
     }
 
-    return OpenResult::Succeeded;
+    QDataStream stream(&file);
+    quint32 magic;
+    quint32 version;
+    quint64 fileSize;
+    qint32 sampleRateValue;
+    qint32 channelCountValue;
+    qint32 bitrateValue;
+    qint64 frameCount;
+    quint32 seekFrameCount;
+    QByteArray compressedSeekFrames;
+    stream >> magic >> version >> fileSize
+           >> sampleRateValue >> channelCountValue >> bitrateValue
+           >> frameCount >> seekFrameCount >> compressedSeekFrames;
+    const SampleRate cachedSampleRate(sampleRateValue);
+    const ChannelCount cachedChannelCount(channelCountValue);
+    if (stream.status() != QDataStream::Ok ||
+            magic != kSeekIndexMagic ||
+            version != kSeekIndexVersion ||
+            fileSize != m_fileSize ||
+            sampleRateValue <= 0 ||
+            channelCountValue <= 0 ||
+            getIndexBySampleRate(cachedSampleRate) >= kSampleRateCount ||
+            !cachedChannelCount.valid() ||
+            cachedChannelCount > kChannelCountMax ||
+            bitrateValue < 0 ||
+            frameCount <= 0 ||
+            seekFrameCount == 0) {
+        kLogger.warning() << "Discarding invalid seek index" << cacheFilePath;
+        file.remove();
+        return false;
+    }
+
+    const QByteArray seekFrames = qUncompress(compressedSeekFrames);
+    SeekFrameList seekFrameList;
+    // Each seek frame occupies at least 2 bytes
+    seekFrameList.reserve(
+            std::min(static_cast<int>(seekFrameCount), seekFrames.size() / 2) + 1);
+    int pos = 0;
+    quint64 frameIndex = 0;
+    quint64 inputOffset = 0;
+    for (quint32 i = 0; i < seekFrameCount; ++i) {
+        quint64 frameIndexDelta;
+        quint64 inputOffsetDelta;
+        if (!readVarUInt(seekFrames, &pos, &frameIndexDelta) ||
+                !readVarUInt(seekFrames, &pos, &inputOffsetDelta) ||
+                ((i > 0) && ((frameIndexDelta == 0) || (inputOffsetDelta == 0)))) {
+            break;
+        }
+        frameIndex += frameIndexDelta;
+        inputOffset += inputOffsetDelta;
+        if ((frameIndex >= static_cast<quint64>(frameCount)) ||
+                (inputOffset + 1 >= m_fileSize)) {
+            break;
+        }
+        SeekFrameType seekFrame;
+        seekFrame.frameIndex = frameIndex;
+        seekFrame.pInputData = m_pFileData + inputOffset;
+        seekFrameList.push_back(seekFrame);
+    }
+    if ((seekFrameList.size() != seekFrameCount) ||
+            (pos != seekFrames.size()) ||
+            (seekFrameList.front().frameIndex != 0)) {
+        kLogger.warning() << "Discarding corrupt seek index" << cacheFilePath;
+        file.remove();
+        return false;
+    }
+
+    // Verify a few samples instead of all frames to avoid reading the
+    // whole file
+    const SINT verifyStride = math_max(
+            SINT(1), SINT(seekFrameList.size()) / kSeekIndexVerifiedFrameCount);
+    for (SINT i = 0; i < SINT(seekFrameList.size()); i += verifyStride) {
+        if (!isFrameSync(seekFrameList[i].pInputData)) {
+            kLogger.warning() << "Discarding mismatching seek index" << cacheFilePath;
+            file.remove();
+            return false;
+        }
+    }
+
+    m_seekFrameList = std::move(seekFrameList);
+    m_curFrameIndex = frameCount;
+    // Terminate m_seekFrameList
+    addSeekFrame(m_curFrameIndex, 0);
+
+    setSampleRate(cachedSampleRate);
+    setChannelCount(cachedChannelCount);
+    initFrameIndexRangeOnce(IndexRange::forward(0, m_curFrameIndex));
+    m_avgSeekFrameCount = frameLength() / seekFrameCount;
+    if (bitrateValue > 0) {
+        initBitrateOnce(bitrateValue);
+    }
+    DEBUG_ASSERT(m_seekFrameList.back().frameIndex == frameIndexMax());
+    return true;
+}
+
+void SoundSourceMp3::storeSeekFrameList(const QString& cacheFilePath) const {
+    // The terminating seek frame is restored from the frame count
+    DEBUG_ASSERT(m_seekFrameList.size() > 1);
+    const SINT seekFrameCount = m_seekFrameList.size() - 1;
+
+    QByteArray seekFrames;
+    // ~2 bytes per value for typical MP3 frames
+    seekFrames.reserve(seekFrameCount * 4);
+    SINT frameIndex = 0;
+    const unsigned char* pInputData = m_pFileData;
+    for (SINT i = 0; i < seekFrameCount; ++i) {
+        const SeekFrameType& seekFrame = m_seekFrameList[i];
+        appendVarUInt(&seekFrames, seekFrame.frameIndex - frameIndex);
+        appendVarUInt(&seekFrames, seekFrame.pInputData - pInputData);
+        frameIndex = seekFrame.frameIndex;
+        pInputData = seekFrame.pInputData;
+    }
+
+    // Write to a temporary file first to never leave partially written
+    // files behind.
+    QSaveFile file(cacheFilePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        kLogger.warning() << "Failed to create seek index" << cacheFilePath;
+        return;
+    }
+    QDataStream stream(&file);
+    stream << kSeekIndexMagic
+           << kSeekIndexVersion
+           << static_cast<quint64>(m_fileSize)
+           << static_cast<qint32>(sampleRate())
+           << static_cast<qint32>(channelCount())
+           << static_cast<qint32>(bitrate())
+           << static_cast<qint64>(frameIndexMax())
+           << static_cast<quint32>(seekFrameCount)
+           << qCompress(seekFrames);
+    if (stream.status() != QDataStream::Ok || !file.commit()) {
+        kLogger.warning() << "Failed to write seek index" << cacheFilePath;
+    }
 }
 
 void SoundSourceMp3::close() {
@@ -54,6 +54,15 @@ class SoundSourceMp3 final : public SoundSource {
 
     void addSeekFrame(SINT frameIndex, const unsigned char* pInputData);
 
+    // Decodes all frame headers to build the seek frame list and
+    // initializes the properties of the audio stream.
+    OpenResult scanSeekFrameList();
+
+    // The seek frame list is cached on disk, because scanning all frame
+    // headers of long files takes noticeable time.
+    bool loadSeekFrameList(const QString& cacheFilePath);
+    void storeSeekFrameList(const QString& cacheFilePath) const;
+
     /** Returns the position in m_seekFrameList of the requested frame index. */
     SINT findSeekFrameIndex(SINT frameIndex) const;
 
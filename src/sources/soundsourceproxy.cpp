@@ -4,6 +4,7 @@
 #include "sources/soundsourceproxy.h"
 
 #include "sources/audiosourcetrackproxy.h"
+#include "sources/seekindexcache.h"
 
 #ifdef __MAD__
 #include "sources/soundsourcemp3.h"
@@ -152,6 +153,11 @@ void SoundSourceProxy::registerSoundSourceProviders() {
             QRegExp(supportedFileExtensionsRegex, Qt::CaseInsensitive);
 }
 
+// static
+void SoundSourceProxy::setSeekIndexCacheDirectory(const QString& path) {
+    mixxx::SeekIndexCache::setDirectory(path);
+}
+
 // static
 bool SoundSourceProxy::isUrlSupported(const QUrl& url) {
     const QFileInfo fileInfo(url.toLocalFile());
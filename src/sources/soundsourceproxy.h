@@ -14,6 +14,11 @@ class SoundSourceProxy {
     // application.
     static void registerSoundSourceProviders();
 
+    // Sets the directory for caching the seek indices of files that
+    // need to be scanned when opened. Must be called upon startup
+    // before opening any files.
+    static void setSeekIndexCacheDirectory(const QString& path);
+
     static QStringList getSupportedFileExtensions() {
         return s_soundSourceProviders.getRegisteredFileExtensions();
     }
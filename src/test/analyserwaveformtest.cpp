@@ -102,4 +102,30 @@ TEST_F(AnalyzerWaveformTest, wrongTotalSamples) {
         EXPECT_FLOAT_EQ(canaryBigBuf[i], CANARY_FLOAT);
     }
 }
+
+// Waveforms that are waiting in the write queue must not be saved again
+// by TrackDAO.
+TEST_F(AnalyzerWaveformTest, queuedWaveformsAreClaimedOnce) {
+    aw.initialize(tio, tio->getSampleRate(), BIGBUF_SIZE);
+    aw.process(bigbuf, BIGBUF_SIZE);
+    aw.finalize(tio);
+    ConstWaveformPointer pWaveform = tio->getWaveform();
+    ConstWaveformPointer pWaveformSummary = tio->getWaveformSummary();
+    ASSERT_TRUE(pWaveform);
+    ASSERT_TRUE(pWaveformSummary);
+    pWaveform->setSaveState(Waveform::SaveState::SavePending);
+    pWaveformSummary->setSaveState(Waveform::SaveState::SavePending);
+
+    AnalysisDao analysisDao(config());
+    EXPECT_TRUE(analysisDao.queueTrackAnalyses(pWaveform, pWaveformSummary));
+    EXPECT_EQ(Waveform::SaveState::SaveQueued, pWaveform->saveState());
+    EXPECT_EQ(Waveform::SaveState::SaveQueued, pWaveformSummary->saveState());
+    EXPECT_FALSE(analysisDao.queueTrackAnalyses(pWaveform, pWaveformSummary));
+
+    // Both waveforms are released again if only one of them is pending
+    pWaveform->setSaveState(Waveform::SaveState::SavePending);
+    EXPECT_FALSE(analysisDao.queueTrackAnalyses(pWaveform, pWaveformSummary));
+    EXPECT_EQ(Waveform::SaveState::SavePending, pWaveform->saveState());
+    EXPECT_EQ(Waveform::SaveState::SaveQueued, pWaveformSummary->saveState());
+}
 }
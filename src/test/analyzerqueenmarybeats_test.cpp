@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <QSemaphore>
+#include <QThreadPool>
+#include <QtConcurrentRun>
+
+#include <vector>
+
+#include "analyzer/constants.h"
+#include "analyzer/plugins/analyzerqueenmarybeats.h"
+#include "util/math.h"
+
+namespace {
+
+constexpr int kSampleRate = 44100;
+constexpr double kBpm = 128.0;
+
+class AnalyzerQueenMaryBeatsTest : public testing::Test {
+  protected:
+    // A click track with some noise in between that spans several
+    // segments of the parallel mode
+    static std::vector<CSAMPLE> makeClickTrack(int seconds) {
+        const int numBlocks = seconds * kSampleRate / mixxx::kAnalysisFramesPerBlock;
+        std::vector<CSAMPLE> samples(numBlocks * mixxx::kAnalysisSamplesPerBlock);
+        const int framesPerBeat = static_cast<int>(kSampleRate * 60 / kBpm);
+        unsigned int noise = 1;
+        for (size_t frame = 0; frame < samples.size() / 2; ++frame) {
+            noise = noise * 1103515245 + 12345;
+            CSAMPLE value = ((noise >> 16) % 1000) / 20000.0f;
+            if (frame % framesPerBeat < 200) {
+                value += static_cast<CSAMPLE>(
+                        sin(2 * M_PI * 1000 * frame / kSampleRate));
+            }
+            samples[frame * 2] = value;
+            samples[frame * 2 + 1] = value;
+        }
+        return samples;
+    }
+
+    static QVector<double> analyze(
+            const std::vector<CSAMPLE>& samples, bool parallel) {
+        mixxx::AnalyzerQueenMaryBeats analyzer(parallel);
+        EXPECT_TRUE(analyzer.initialize(kSampleRate));
+        for (size_t i = 0; i < samples.size();
+                i += mixxx::kAnalysisSamplesPerBlock) {
+            EXPECT_TRUE(analyzer.process(
+                    samples.data() + i, mixxx::kAnalysisSamplesPerBlock));
+        }
+        EXPECT_TRUE(analyzer.finalize());
+        return analyzer.getBeats();
+    }
+};
+
+TEST_F(AnalyzerQueenMaryBeatsTest, ParallelMatchesSerial) {
+    const std::vector<CSAMPLE> samples = makeClickTrack(150);
+    const QVector<double> serialBeats = analyze(samples, false);
+    const QVector<double> parallelBeats = analyze(samples, true);
+    ASSERT_FALSE(serialBeats.isEmpty());
+    // The segments overlap, so the detection function is identical
+    EXPECT_EQ(serialBeats, parallelBeats);
+}
+
+TEST_F(AnalyzerQueenMaryBeatsTest, ParallelShortTrack) {
+    // Shorter than a single segment
+    const std::vector<CSAMPLE> samples = makeClickTrack(10);
+    EXPECT_EQ(analyze(samples, false), analyze(samples, true));
+}
+
+TEST_F(AnalyzerQueenMaryBeatsTest, ParallelWithBusyThreadPool) {
+    const std::vector<CSAMPLE> samples = makeClickTrack(150);
+    const QVector<double> serialBeats = analyze(samples, false);
+
+    // Occupy all threads of the global thread pool
+    QThreadPool* pThreadPool = QThreadPool::globalInstance();
+    QSemaphore started;
+    QSemaphore release;
+    const int numThreads = pThreadPool->maxThreadCount();
+    for (int i = 0; i < numThreads; ++i) {
+        QtConcurrent::run([&started, &release] {
+            started.release();
+            release.acquire();
+        });
+    }
+    started.acquire(numThreads);
+
+    mixxx::AnalyzerQueenMaryBeats analyzer(true);
+    ASSERT_TRUE(analyzer.initialize(kSampleRate));
+    for (size_t i = 0; i < samples.size();
+            i += mixxx::kAnalysisSamplesPerBlock) {
+        ASSERT_TRUE(analyzer.process(
+                samples.data() + i, mixxx::kAnalysisSamplesPerBlock));
+    }
+    // The remaining segments have been calculated by this thread
+    EXPECT_EQ(mixxx::AnalyzerQueenMaryBeats::kMaxSegmentsInFlight,
+            analyzer.segmentsInFlight());
+
+    release.release(numThreads);
+    ASSERT_TRUE(analyzer.finalize());
+    EXPECT_EQ(serialBeats, analyzer.getBeats());
+}
+
+TEST_F(AnalyzerQueenMaryBeatsTest, DetectionFunctionWarmUp) {
+    std::vector<double> samples(8 * 1024);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = sin(i * 0.01) * (i % 3000 < 100 ? 1.0 : 0.1);
+    }
+    const std::vector<double> complete =
+            mixxx::AnalyzerQueenMaryBeats::calculateDetectionFunction(
+                    samples, false);
+    // Continue after the third window, which is repeated for warming up
+    const std::vector<double> continued =
+            mixxx::AnalyzerQueenMaryBeats::calculateDetectionFunction(
+                    std::vector<double>(samples.begin() + 2 * 512, samples.end()),
+                    true);
+    ASSERT_EQ(complete.size(), continued.size() + 3);
+    for (size_t i = 0; i < continued.size(); ++i) {
+        EXPECT_DOUBLE_EQ(complete[i + 3], continued[i]);
+    }
+}
+
+} // namespace
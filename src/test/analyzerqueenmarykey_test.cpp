@@ -0,0 +1,97 @@
+#include <dsp/keydetection/GetKeyMode.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "analyzer/constants.h"
+#include "analyzer/plugins/analyzerqueenmarykey.h"
+#include "util/math.h"
+
+namespace {
+
+constexpr int kSampleRate = 44100;
+
+class AnalyzerQueenMaryKeyTest : public testing::Test {
+  protected:
+    // Triads of the given MIDI notes with some noise, that change every
+    // 40 seconds and span several segments of the parallel mode
+    static std::vector<CSAMPLE> makeChordTrack(int seconds) {
+        const int chords[][3] = {
+                {60, 64, 67}, // C major
+                {57, 60, 64}, // A minor
+                {66, 70, 73}, // F# major
+                {62, 65, 69}, // D minor
+        };
+        const int numBlocks = seconds * kSampleRate / mixxx::kAnalysisFramesPerBlock;
+        std::vector<CSAMPLE> samples(numBlocks * mixxx::kAnalysisSamplesPerBlock);
+        unsigned int noise = 1;
+        for (size_t frame = 0; frame < samples.size() / 2; ++frame) {
+            noise = noise * 1103515245 + 12345;
+            double value = ((noise >> 16) % 1000) / 20000.0;
+            const auto& chord = chords[(frame / (40 * kSampleRate)) % 4];
+            for (int note : chord) {
+                const double frequency = 440.0 * pow(2.0, (note - 69) / 12.0);
+                value += 0.2 * sin(2 * M_PI * frequency * frame / kSampleRate);
+            }
+            samples[frame * 2] = static_cast<CSAMPLE>(value);
+            samples[frame * 2 + 1] = static_cast<CSAMPLE>(value);
+        }
+        return samples;
+    }
+
+    static KeyChangeList analyze(
+            const std::vector<CSAMPLE>& samples, bool parallel) {
+        mixxx::AnalyzerQueenMaryKey analyzer(parallel);
+        EXPECT_TRUE(analyzer.initialize(kSampleRate));
+        for (size_t i = 0; i < samples.size();
+                i += mixxx::kAnalysisSamplesPerBlock) {
+            EXPECT_TRUE(analyzer.process(
+                    samples.data() + i, mixxx::kAnalysisSamplesPerBlock));
+        }
+        EXPECT_TRUE(analyzer.finalize());
+        return analyzer.getKeyChanges();
+    }
+};
+
+TEST_F(AnalyzerQueenMaryKeyTest, ParallelMatchesSerial) {
+    const std::vector<CSAMPLE> samples = makeChordTrack(160);
+    const KeyChangeList serialKeys = analyze(samples, false);
+    const KeyChangeList parallelKeys = analyze(samples, true);
+    ASSERT_FALSE(serialKeys.isEmpty());
+    // The decimation filter of each segment is warmed up, so the
+    // chromagrams only differ by rounding errors
+    EXPECT_EQ(serialKeys, parallelKeys);
+}
+
+TEST_F(AnalyzerQueenMaryKeyTest, ParallelShortTrack) {
+    // Shorter than a single segment
+    const std::vector<CSAMPLE> samples = makeChordTrack(10);
+    EXPECT_EQ(analyze(samples, false), analyze(samples, true));
+}
+
+TEST_F(AnalyzerQueenMaryKeyTest, ChromagramWarmUp) {
+    GetKeyMode keyMode(kSampleRate, 440, 10, 10);
+    const size_t windowSize = keyMode.getBlockSize();
+    const size_t chromaSize = keyMode.getChromaSize();
+    std::vector<double> samples(8 * windowSize);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = sin(i * 0.05) + 0.5 * sin(i * 0.0713);
+    }
+    const std::vector<double> complete =
+            mixxx::AnalyzerQueenMaryKey::calculateChromagram(
+                    kSampleRate, samples, false);
+    // Continue after the third window, which is repeated for warming up
+    const std::vector<double> continued =
+            mixxx::AnalyzerQueenMaryKey::calculateChromagram(
+                    kSampleRate,
+                    std::vector<double>(samples.begin() + 2 * windowSize, samples.end()),
+                    true);
+    ASSERT_EQ(8 * chromaSize, complete.size());
+    ASSERT_EQ(complete.size(), continued.size() + 3 * chromaSize);
+    for (size_t i = 0; i < continued.size(); ++i) {
+        EXPECT_NEAR(complete[i + 3 * chromaSize], continued[i], 1e-9);
+    }
+}
+
+} // namespace
@@ -38,9 +38,11 @@ class MockEffectProcessor : public EffectProcessor {
                                   EffectsManager* pEffectsManager,
                                   const mixxx::EngineParameters& bufferParameters));
     MOCK_METHOD1(createState, EffectState*(const mixxx::EngineParameters& bufferParameters));
+    MOCK_CONST_METHOD0(stateSize, size_t());
     MOCK_METHOD2(loadStatesForInputChannel, bool(const ChannelHandle* inputChannel,
           const EffectStatesMap* pStatesMap));
-    MOCK_METHOD1(deleteStatesForInputChannel, void(const ChannelHandle* inputChannel));
+    MOCK_METHOD2(deleteStatesForInputChannel, void(const ChannelHandle* inputChannel,
+                                                    EffectStatePool* pStatePool));
     MOCK_METHOD7(process, void(const ChannelHandle& inputHandle,
                                const ChannelHandle& outputHandle,
                                const CSAMPLE* pInput,
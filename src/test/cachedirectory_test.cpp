@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+#if QT_VERSION < QT_VERSION_CHECK(5, 10, 0)
+extern "C" {
+    #include <sys/time.h>
+}
+#endif
+
+#include "util/cachedirectory.h"
+
+namespace {
+
+class CacheDirectoryTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_dir.isValid());
+    }
+
+    // Creates a file that has been used the given number of days ago
+    void createFile(const QString& fileName, int size, int daysAgo) {
+        QFile file(m_dir.filePath(fileName));
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        ASSERT_EQ(size, file.write(QByteArray(size, 'x')));
+        // Writing must not modify the times afterwards
+        ASSERT_TRUE(file.flush());
+        const QDateTime time =
+                QDateTime::currentDateTime().addDays(-daysAgo);
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+        ASSERT_TRUE(file.setFileTime(time, QFileDevice::FileAccessTime));
+        ASSERT_TRUE(file.setFileTime(time, QFileDevice::FileModificationTime));
+#else
+        file.close();
+        struct timeval times[2];
+        times[0].tv_sec = time.toMSecsSinceEpoch() / 1000;
+        times[0].tv_usec = 0;
+        times[1] = times[0];
+        ASSERT_EQ(0, utimes(QFile::encodeName(file.fileName()).constData(), times));
+#endif
+    }
+
+    QStringList fileNames() const {
+        return QDir(m_dir.path()).entryList(QDir::Files, QDir::Name);
+    }
+
+    QTemporaryDir m_dir;
+};
+
+TEST_F(CacheDirectoryTest, KeepsFilesWithinLimit) {
+    createFile("a.idx", 1000, 3);
+    createFile("b.idx", 1000, 2);
+    EXPECT_EQ(0, CacheDirectory::prune(m_dir.path(), 2000));
+    EXPECT_EQ(QStringList({"a.idx", "b.idx"}), fileNames());
+}
+
+TEST_F(CacheDirectoryTest, DeletesLeastRecentlyUsedFiles) {
+    createFile("a.idx", 1000, 1);
+    createFile("b.idx", 1000, 3);
+    createFile("c.idx", 1000, 2);
+    createFile("d.idx", 1000, 0);
+    EXPECT_EQ(2, CacheDirectory::prune(m_dir.path(), 2500));
+    EXPECT_EQ(QStringList({"a.idx", "d.idx"}), fileNames());
+}
+
+TEST_F(CacheDirectoryTest, OnlyCountsMatchingFiles) {
+    createFile("a.idx", 1000, 2);
+    createFile("b.idx", 1000, 1);
+    createFile("other.dat", 10000, 3);
+    EXPECT_EQ(1, CacheDirectory::prune(m_dir.path(), 1000,
+            QStringList({"*.idx"})));
+    EXPECT_EQ(QStringList({"b.idx", "other.dat"}), fileNames());
+}
+
+} // namespace
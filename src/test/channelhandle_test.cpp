@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
+
 #include <QtDebug>
 
+#include <iterator>
+
 #include "engine/channelhandle.h"
 #include "test/mixxxtest.h"
 
@@ -66,4 +69,25 @@ TEST(ChannelHandleTest, ChannelHandleMap) {
     EXPECT_QSTRING_EQ("foo", map.at(test));
 }
 
+TEST(ChannelHandleTest, ChannelHandleMapFindDoesNotExpand) {
+    ChannelHandleFactory factory;
+    ChannelHandle test = factory.getOrCreateHandle("[Test]");
+    ChannelHandle test2 = factory.getOrCreateHandle("[Test2]");
+
+    ChannelHandleMap<QString> map;
+    EXPECT_EQ(nullptr, map.find(ChannelHandle()));
+    EXPECT_EQ(nullptr, map.find(test));
+    EXPECT_TRUE(map.isEmpty());
+
+    map.insert(test, "foo");
+    ASSERT_NE(nullptr, map.find(test));
+    EXPECT_QSTRING_EQ("foo", *map.find(test));
+    map.find(test)->append("bar");
+    EXPECT_QSTRING_EQ("foobar", map.at(test));
+
+    // Handles beyond the current size are not inserted
+    EXPECT_EQ(nullptr, map.find(test2));
+    EXPECT_EQ(1, std::distance(map.begin(), map.end()));
+}
+
 }  // namespace
@@ -0,0 +1,161 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QVector>
+
+#include <thread>
+
+#include "control/controlnotifier.h"
+#include "control/controlobject.h"
+#include "control/controlproxy.h"
+#include "test/mixxxtest.h"
+#include "util/memory.h"
+
+namespace {
+
+// Sets the control from a separate thread that acts as the engine thread
+template<typename Control>
+void setFromEngineThread(Control* pControl, const QVector<double>& values) {
+    std::thread engine([pControl, &values] {
+        ControlNotifier::setEngineThread(QThread::currentThread());
+        for (double value : values) {
+            pControl->set(value);
+        }
+        ControlNotifier::setEngineThread(nullptr);
+    });
+    engine.join();
+}
+
+class ControlNotifierTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        m_pControl = std::make_unique<ControlObject>(ConfigKey("[Test]", "control"));
+        m_pProxy = std::make_unique<ControlProxy>(ConfigKey("[Test]", "control"));
+        m_pProxy->connectValueChanged(m_pProxy.get(), [this](double value) {
+            m_received.append(value);
+        });
+    }
+
+    std::unique_ptr<ControlObject> m_pControl;
+    std::unique_ptr<ControlProxy> m_pProxy;
+    QVector<double> m_received;
+};
+
+TEST_F(ControlNotifierTest, EngineChangesAreCoalesced) {
+    setFromEngineThread(m_pControl.get(), {1.0, 2.0, 3.0});
+    EXPECT_DOUBLE_EQ(3.0, m_pProxy->get());
+
+    // No event has been posted for the changes
+    QCoreApplication::processEvents();
+    EXPECT_TRUE(m_received.isEmpty());
+
+    ControlNotifier::deliverChanges();
+    ASSERT_EQ(1, m_received.size());
+    EXPECT_DOUBLE_EQ(3.0, m_received[0]);
+
+    // Delivered only once
+    ControlNotifier::deliverChanges();
+    EXPECT_EQ(1, m_received.size());
+}
+
+TEST_F(ControlNotifierTest, SetterIsPreserved) {
+    ControlProxy setter(ConfigKey("[Test]", "control"));
+    QVector<double> receivedBySetter;
+    setter.connectValueChanged(&setter, [&receivedBySetter](double value) {
+        receivedBySetter.append(value);
+    });
+
+    setFromEngineThread(&setter, {1.0, 2.0});
+    ControlNotifier::deliverChanges();
+
+    // The setter filters its own changes, all other proxies receive them
+    EXPECT_TRUE(receivedBySetter.isEmpty());
+    ASSERT_EQ(1, m_received.size());
+    EXPECT_DOUBLE_EQ(2.0, m_received[0]);
+}
+
+TEST_F(ControlNotifierTest, DeliveryTimer) {
+    QObject parent;
+    ControlNotifier::startDeliveryTimer(&parent);
+
+    // Delivered without any GuiTick
+    setFromEngineThread(m_pControl.get(), {1.0});
+    QElapsedTimer timer;
+    timer.start();
+    while (m_received.isEmpty() && timer.elapsed() < 1000) {
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents, 10);
+    }
+    ASSERT_EQ(1, m_received.size());
+    EXPECT_DOUBLE_EQ(1.0, m_received[0]);
+}
+
+TEST_F(ControlNotifierTest, OtherChangesAreDeliveredImmediately) {
+    m_pControl->set(1.0);
+    ASSERT_EQ(1, m_received.size());
+    EXPECT_DOUBLE_EQ(1.0, m_received[0]);
+}
+
+TEST_F(ControlNotifierTest, DeletedControlIsNotDelivered) {
+    setFromEngineThread(m_pControl.get(), {1.0});
+    m_pProxy.reset();
+    m_pControl.reset();
+
+    // The index of the deleted control is reused
+    ControlObject control(ConfigKey("[Test]", "other"));
+    ControlProxy proxy(ConfigKey("[Test]", "other"));
+    int received = 0;
+    proxy.connectValueChanged(&proxy, [&received](double) {
+        ++received;
+    });
+
+    ControlNotifier::deliverChanges();
+    EXPECT_EQ(0, received);
+}
+
+// Sets a control from the engine thread as often as the engine may do
+// within a few callbacks and delivers the changes to a receiver in the GUI
+// thread. The label shows the number of notifications, each of which
+// allocated an event in the engine thread before.
+static void BM_ControlNotification(benchmark::State& state, bool coalesced) {
+    const int kSetsPerIteration = 1000;
+    ControlObject control(ConfigKey("[Test]", "benchmark"));
+    ControlProxy proxy(ConfigKey("[Test]", "benchmark"));
+    int notifications = 0;
+    if (coalesced) {
+        proxy.connectValueChanged(&proxy, [&notifications](double) {
+            ++notifications;
+        });
+    } else {
+        // The previous behavior of all queued connections
+        QObject::connect(&control, &ControlObject::valueChanged,
+                &proxy, [&notifications](double) {
+                    ++notifications;
+                }, Qt::QueuedConnection);
+    }
+
+    QVector<double> values;
+    for (int i = 0; i < kSetsPerIteration; ++i) {
+        values.append(i);
+    }
+    while (state.KeepRunning()) {
+        setFromEngineThread(&control, values);
+        ControlNotifier::deliverChanges();
+        QCoreApplication::processEvents();
+    }
+    state.SetItemsProcessed(state.iterations() * kSetsPerIteration);
+    state.SetLabel(QString("%1 notifications").arg(notifications).toStdString());
+}
+
+static void BM_ControlNotificationQueued(benchmark::State& state) {
+    BM_ControlNotification(state, false);
+}
+BENCHMARK(BM_ControlNotificationQueued);
+
+static void BM_ControlNotificationCoalesced(benchmark::State& state) {
+    BM_ControlNotification(state, true);
+}
+BENCHMARK(BM_ControlNotificationCoalesced);
+
+} // anonymous namespace
@@ -1,3 +1,6 @@
+#include <thread>
+
+#include "control/controlnotifier.h"
 #include "engine/controls/cuecontrol.h"
 #include "test/signalpathtest.h"
 
@@ -513,3 +516,59 @@ TEST_F(CueControlTest, OutroCue_SetStartEnd_ClearStartEnd) {
 
     EXPECT_EQ(nullptr, pTrack->findCueByType(Cue::OUTRO));
 }
+
+TEST_F(CueControlTest, HotcueActivate_SetIsSynchronous) {
+    TrackPointer pTrack = createAndLoadFakeTrack();
+    ControlProxy hotcueActivate(m_sGroup1, "hotcue_1_activate");
+    ControlProxy hotcuePosition(m_sGroup1, "hotcue_1_position");
+
+    m_pQuantizeEnabled->set(0);
+    setCurrentSample(100.0);
+
+    hotcueActivate.slotSet(1);
+    hotcueActivate.slotSet(0);
+    EXPECT_DOUBLE_EQ(100.0, hotcuePosition.get());
+    EXPECT_EQ(1, pTrack->getCuePoints().size());
+
+    // Activating it again seeks to the stored position
+    setCurrentSample(500.0);
+    hotcueActivate.slotSet(1);
+    hotcueActivate.slotSet(0);
+    ProcessBuffer();
+    EXPECT_DOUBLE_EQ(100.0, getCurrentSample());
+}
+
+TEST_F(CueControlTest, HotcueActivate_SetFromEngineIsDeferred) {
+    TrackPointer pTrack = createAndLoadFakeTrack();
+    ControlProxy hotcueActivate(m_sGroup1, "hotcue_1_activate");
+    ControlProxy hotcuePosition(m_sGroup1, "hotcue_1_position");
+    ControlProxy hotcueEnabled(m_sGroup1, "hotcue_1_enabled");
+
+    m_pQuantizeEnabled->set(0);
+    setCurrentSample(100.0);
+
+    // Activating an empty hotcue from the engine does not touch the track
+    // immediately
+    std::thread engine([&hotcueActivate] {
+        ControlNotifier::setEngineThread(QThread::currentThread());
+        hotcueActivate.slotSet(1);
+        hotcueActivate.slotSet(0);
+        ControlNotifier::setEngineThread(nullptr);
+    });
+    engine.join();
+    EXPECT_DOUBLE_EQ(-1.0, hotcuePosition.get());
+    EXPECT_FALSE(hotcueEnabled.toBool());
+
+    m_pChannel1->getEngineBuffer()->m_pCueControl->processCueEdits();
+    EXPECT_DOUBLE_EQ(100.0, hotcuePosition.get());
+    EXPECT_TRUE(hotcueEnabled.toBool());
+    CuePointer pCue;
+    for (const CuePointer& pCuePoint : pTrack->getCuePoints()) {
+        if (pCuePoint->getHotCue() == 0) {
+            pCue = pCuePoint;
+        }
+    }
+    ASSERT_NE(nullptr, pCue);
+    EXPECT_DOUBLE_EQ(100.0, pCue->getPosition());
+    EXPECT_DOUBLE_EQ(Cue::MANUAL, pCue->getSource());
+}
@@ -1,10 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <QSqlQuery>
+
 #include "test/mixxxtest.h"
 
 #include "database/mixxxdb.h"
 #include "util/db/dbconnectionpooler.h"
 #include "util/db/dbconnectionpooled.h"
+#include "util/db/dbwritequeue.h"
 
 #include "library/dao/settingsdao.h"
 
@@ -35,3 +38,54 @@ TEST_F(DbConnectionPoolTest, MoveSemantics) {
     EXPECT_TRUE(p1.isPooling());
     EXPECT_FALSE(p2.isPooling());
 }
+
+TEST_F(DbConnectionPoolTest, ReadOnlyConnection) {
+    mixxx::DbWriteQueue* pWriteQueue = m_mixxxDb.connectionPool()->writeQueue();
+    ASSERT_TRUE(pWriteQueue->execute([](QSqlDatabase database) {
+        QSqlQuery query(database);
+        return query.exec("CREATE TABLE read_only_test (value INTEGER)");
+    }));
+
+    const mixxx::DbConnectionPooler pooler(
+            m_mixxxDb.connectionPool(),
+            mixxx::DbConnection::AccessMode::ReadOnly);
+    ASSERT_TRUE(pooler.isPooling());
+    QSqlDatabase database = mixxx::DbConnectionPooled(m_mixxxDb.connectionPool());
+    QSqlQuery query(database);
+    EXPECT_TRUE(query.exec("SELECT COUNT(*) FROM read_only_test"));
+    EXPECT_FALSE(query.exec("INSERT INTO read_only_test VALUES (1)"));
+}
+
+TEST_F(DbConnectionPoolTest, WriteQueueExecutesInOrder) {
+    mixxx::DbWriteQueue* pWriteQueue = m_mixxxDb.connectionPool()->writeQueue();
+    ASSERT_TRUE(pWriteQueue->execute([](QSqlDatabase database) {
+        QSqlQuery query(database);
+        return query.exec("CREATE TABLE write_queue_test (value INTEGER)");
+    }));
+    const int kRequestCount = 100;
+    for (int i = 0; i < kRequestCount; ++i) {
+        pWriteQueue->post([i](QSqlDatabase database) {
+            QSqlQuery query(database);
+            query.prepare("INSERT INTO write_queue_test VALUES (:value)");
+            query.bindValue(":value", i);
+            return query.exec();
+        });
+    }
+    // Waits for all preceding requests
+    EXPECT_TRUE(pWriteQueue->execute([](QSqlDatabase) {
+        return true;
+    }));
+
+    const mixxx::DbConnectionPooler pooler(
+            m_mixxxDb.connectionPool(),
+            mixxx::DbConnection::AccessMode::ReadOnly);
+    QSqlDatabase database = mixxx::DbConnectionPooled(m_mixxxDb.connectionPool());
+    QSqlQuery query(database);
+    ASSERT_TRUE(query.exec("SELECT value FROM write_queue_test ORDER BY rowid"));
+    int expectedValue = 0;
+    while (query.next()) {
+        EXPECT_EQ(expectedValue, query.value(0).toInt());
+        ++expectedValue;
+    }
+    EXPECT_EQ(kRequestCount, expectedValue);
+}
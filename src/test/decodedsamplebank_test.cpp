@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <QDir>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "test/mixxxtest.h"
+
+#include "engine/cachingreader/decodedsamplebank.h"
+#include "sources/soundsourceproxy.h"
+
+namespace {
+
+const QDir kTestDir(QDir::current().absoluteFilePath("src/test/id3-test-data"));
+
+class DecodedSampleBankTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        m_pTrack = Track::newTemporary(kTestDir.absoluteFilePath("cover-test.wav"));
+        ASSERT_TRUE(SoundSourceProxy::isFileNameSupported(m_pTrack->getLocation()));
+    }
+
+    TrackPointer m_pTrack;
+};
+
+TEST_F(DecodedSampleBankTest, SharedBetweenLoads) {
+    const int sampleCount = DecodedSampleBank::sampleCount();
+    DecodedSamplePointer pSample = DecodedSampleBank::load(m_pTrack).get();
+    ASSERT_TRUE(pSample);
+    EXPECT_FALSE(pSample->frameIndexRange().empty());
+    EXPECT_EQ(sampleCount + 1, DecodedSampleBank::sampleCount());
+
+    // Another sampler loads the same file
+    DecodedSamplePointer pOtherSample = DecodedSampleBank::load(
+            Track::newTemporary(m_pTrack->getFileInfo())).get();
+    EXPECT_EQ(pSample, pOtherSample);
+    EXPECT_EQ(sampleCount + 1, DecodedSampleBank::sampleCount());
+
+    // Released with the last reference
+    pSample.reset();
+    EXPECT_EQ(sampleCount + 1, DecodedSampleBank::sampleCount());
+    pOtherSample.reset();
+    EXPECT_EQ(sampleCount, DecodedSampleBank::sampleCount());
+}
+
+TEST_F(DecodedSampleBankTest, ConcurrentLoadsDoNotWait) {
+    DecodedSampleFuture future;
+    std::thread decoder([this, &future] {
+        future = DecodedSampleBank::load(m_pTrack);
+    });
+    // Either decodes the file itself or shares the result of the other
+    // thread without waiting for it
+    std::atomic<int> callbacks(0);
+    const DecodedSampleFuture otherFuture = DecodedSampleBank::load(
+            Track::newTemporary(m_pTrack->getFileInfo()),
+            &callbacks,
+            [&callbacks] {
+                ++callbacks;
+            });
+    const bool ready = otherFuture.wait_for(std::chrono::seconds(0)) ==
+            std::future_status::ready;
+    decoder.join();
+
+    ASSERT_TRUE(future.valid());
+    EXPECT_TRUE(future.get());
+    EXPECT_EQ(future.get(), otherFuture.get());
+    // Invoked once if the other thread has decoded the file
+    EXPECT_GE(1, callbacks.load());
+    if (!ready) {
+        EXPECT_EQ(1, callbacks.load());
+    }
+}
+
+TEST_F(DecodedSampleBankTest, WaiterRegisteredWhileDecoding) {
+    const int sampleCount = DecodedSampleBank::sampleCount();
+    // The load of the waiter might start before or finish after the
+    // decode of the other thread. Retried until it has been registered
+    // while the decode was in flight.
+    const int kMaxAttempts = 100;
+    bool registered = false;
+    for (int attempt = 0; attempt < kMaxAttempts && !registered; ++attempt) {
+        std::atomic<bool> started(false);
+        std::thread::id decoderThreadId;
+        DecodedSampleFuture future;
+        std::thread decoder([this, &started, &decoderThreadId, &future] {
+            decoderThreadId = std::this_thread::get_id();
+            started.store(true);
+            future = DecodedSampleBank::load(m_pTrack);
+        });
+        while (!started.load()) {
+            std::this_thread::yield();
+        }
+
+        std::atomic<int> callbacks(0);
+        std::thread::id callbackThreadId;
+        const DecodedSampleFuture waiterFuture = DecodedSampleBank::load(
+                Track::newTemporary(m_pTrack->getFileInfo()),
+                &callbacks,
+                [&callbacks, &callbackThreadId] {
+                    callbackThreadId = std::this_thread::get_id();
+                    ++callbacks;
+                });
+        registered = waiterFuture.wait_for(std::chrono::seconds(0)) !=
+                std::future_status::ready;
+        decoder.join();
+
+        ASSERT_TRUE(future.valid());
+        EXPECT_TRUE(future.get());
+        EXPECT_EQ(future.get(), waiterFuture.get());
+        if (registered) {
+            // Woken up exactly once by the thread that has decoded the
+            // sample
+            EXPECT_EQ(1, callbacks.load());
+            EXPECT_EQ(decoderThreadId, callbackThreadId);
+        } else {
+            // Either decoded the file itself or shared the sample
+            // that had already been decoded
+            EXPECT_EQ(0, callbacks.load());
+        }
+        DecodedSampleBank::cancel(&callbacks);
+    }
+    EXPECT_TRUE(registered);
+    // Released with the last reference
+    EXPECT_EQ(sampleCount, DecodedSampleBank::sampleCount());
+}
+
+TEST_F(DecodedSampleBankTest, LoadOfHeldSampleIsReady) {
+    DecodedSamplePointer pSample = DecodedSampleBank::load(m_pTrack).get();
+    ASSERT_TRUE(pSample);
+
+    std::atomic<int> callbacks(0);
+    const DecodedSampleFuture future = DecodedSampleBank::load(
+            m_pTrack,
+            &callbacks,
+            [&callbacks] {
+                ++callbacks;
+            });
+    ASSERT_EQ(std::future_status::ready,
+            future.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ(pSample, future.get());
+    EXPECT_EQ(0, callbacks.load());
+    DecodedSampleBank::cancel(&callbacks);
+}
+
+TEST_F(DecodedSampleBankTest, ReadReverse) {
+    DecodedSamplePointer pSample = DecodedSampleBank::load(m_pTrack).get();
+    ASSERT_TRUE(pSample);
+    // Overlaps the end of the sample
+    const auto frameIndexRange = mixxx::IndexRange::between(
+            pSample->frameIndexRange().end() - 100,
+            pSample->frameIndexRange().end() + 100);
+    std::vector<CSAMPLE> forward(400);
+    std::vector<CSAMPLE> reverse(400);
+    const auto expected = mixxx::IndexRange::between(
+            frameIndexRange.start(), pSample->frameIndexRange().end());
+    EXPECT_EQ(expected, pSample->readSampleFrames(
+            forward.data(), frameIndexRange));
+    EXPECT_EQ(expected, pSample->readSampleFramesReverse(
+            reverse.data() + reverse.size(), frameIndexRange));
+    // The frames are reversed but the channels of each frame are not
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(forward[2 * i], reverse[398 - 2 * i]);
+        EXPECT_EQ(forward[2 * i + 1], reverse[399 - 2 * i]);
+    }
+}
+
+TEST_F(DecodedSampleBankTest, OnlyShortTracksAreEligible) {
+    m_pTrack->setDuration(0.0);
+    EXPECT_FALSE(DecodedSampleBank::isEligible(*m_pTrack));
+    m_pTrack->setDuration(2.5);
+    EXPECT_TRUE(DecodedSampleBank::isEligible(*m_pTrack));
+    m_pTrack->setDuration(300.0);
+    EXPECT_FALSE(DecodedSampleBank::isEligible(*m_pTrack));
+}
+
+}  // namespace
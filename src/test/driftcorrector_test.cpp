@@ -0,0 +1,231 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "soundio/driftcorrector.h"
+#include "util/math.h"
+#include "util/types.h"
+
+namespace {
+
+const SINT kFramesPerBuffer = 256;
+const double kNominalFrameRate = 44100;
+
+// A fake sound device with a simulated clock. Its callbacks are
+// scheduled in CPU time according to its actual frame rate with
+// some random jitter.
+class FakeSoundDevice {
+  public:
+    FakeSoundDevice(double frameRate, double jitterSecs, unsigned int seed)
+            : m_frameRate(frameRate),
+              m_jitter(0, jitterSecs),
+              m_random(seed),
+              m_callbackCount(0) {
+        m_frameRateEstimator.reset(kNominalFrameRate);
+    }
+
+    // The CPU time of the next callback
+    double nextCallbackTime() {
+        return m_callbackCount * kFramesPerBuffer / m_frameRate
+                + m_jitter(m_random);
+    }
+
+    void callback(double timeSecs) {
+        m_frameRateEstimator.update(timeSecs, kFramesPerBuffer);
+        ++m_callbackCount;
+    }
+
+    double estimatedFrameRate() const {
+        return m_frameRateEstimator.getFrameRate();
+    }
+
+  private:
+    const double m_frameRate;
+    std::uniform_real_distribution<double> m_jitter;
+    std::mt19937 m_random;
+    FrameRateEstimator m_frameRateEstimator;
+    int m_callbackCount;
+};
+
+// Simulates a clock reference device that writes buffers into a FIFO
+// and a secondary output device that reads them with drift correction
+// as done by SoundDevicePortAudio::callbackProcessDrift().
+class DriftCorrectorTest : public testing::Test {
+  protected:
+    void simulate(double clkRefFrameRate, double frameRate,
+            double durationSecs, bool estimateFrameRates) {
+        const SINT fifoCapacity = 3 * kFramesPerBuffer;
+        const SINT targetFillLevel = 2 * kFramesPerBuffer;
+        std::deque<CSAMPLE> fifo(kFramesPerBuffer * 3 / 2, CSAMPLE_ZERO);
+
+        FakeSoundDevice clkRefDevice(clkRefFrameRate,
+                0.2 * kFramesPerBuffer / kNominalFrameRate, 1);
+        FakeSoundDevice device(frameRate,
+                0.2 * kFramesPerBuffer / kNominalFrameRate, 2);
+        DriftCorrector driftCorrector;
+        driftCorrector.reset(1);
+
+        std::vector<CSAMPLE> source;
+        std::vector<CSAMPLE> dest(kFramesPerBuffer);
+        m_underflowCount = 0;
+        m_overflowCount = 0;
+        m_minFillLevel = fifoCapacity;
+        m_maxFillLevel = 0;
+        // The average ratio is measured after the loop has settled
+        SINT sourceFrames = 0;
+        SINT destFrames = 0;
+        double timeSecs = 0;
+        while (timeSecs < durationSecs) {
+            const double clkRefTime = clkRefDevice.nextCallbackTime();
+            const double time = device.nextCallbackTime();
+            if (clkRefTime <= time) {
+                timeSecs = clkRefTime;
+                clkRefDevice.callback(timeSecs);
+                for (SINT i = 0; i < kFramesPerBuffer; ++i) {
+                    if (static_cast<SINT>(fifo.size()) >= fifoCapacity) {
+                        ++m_overflowCount;
+                        break;
+                    }
+                    fifo.push_back(CSAMPLE_ZERO);
+                }
+            } else {
+                timeSecs = time;
+                device.callback(timeSecs);
+                const SINT fillLevel = fifo.size();
+                m_minFillLevel = math_min(m_minFillLevel, fillLevel);
+                m_maxFillLevel = math_max(m_maxFillLevel, fillLevel);
+                if (estimateFrameRates) {
+                    driftCorrector.updateRatio(
+                            clkRefDevice.estimatedFrameRate(),
+                            device.estimatedFrameRate(),
+                            static_cast<double>(fillLevel - targetFillLevel)
+                                    / kFramesPerBuffer);
+                } else {
+                    driftCorrector.updateRatio(0, 0,
+                            static_cast<double>(fillLevel - targetFillLevel)
+                                    / kFramesPerBuffer);
+                }
+                source.assign(fifo.begin(), fifo.end());
+                const DriftCorrector::Result result = driftCorrector.process(
+                        source.data(), source.size(),
+                        dest.data(), kFramesPerBuffer);
+                fifo.erase(fifo.begin(), fifo.begin() + result.sourceFrames);
+                if (result.destFrames < kFramesPerBuffer) {
+                    ++m_underflowCount;
+                }
+                if (timeSecs > durationSecs / 2) {
+                    sourceFrames += result.sourceFrames;
+                    destFrames += result.destFrames;
+                }
+            }
+        }
+        m_ratio = static_cast<double>(sourceFrames) / destFrames;
+    }
+
+    int m_underflowCount;
+    int m_overflowCount;
+    SINT m_minFillLevel;
+    SINT m_maxFillLevel;
+    double m_ratio;
+};
+
+TEST_F(DriftCorrectorTest, PassThroughAtRatioOne) {
+    DriftCorrector driftCorrector;
+    driftCorrector.reset(2);
+    const CSAMPLE source[] = {1, -1, 2, -2, 3, -3, 4, -4, 5, -5};
+    CSAMPLE dest[8] = {};
+    DriftCorrector::Result result = driftCorrector.process(source, 4, dest, 4);
+    // The last frame is kept for interpolating the next destination frame
+    EXPECT_EQ(4, result.sourceFrames);
+    EXPECT_EQ(3, result.destFrames);
+    result = driftCorrector.process(&source[8], 1, &dest[6], 1);
+    EXPECT_EQ(1, result.sourceFrames);
+    EXPECT_EQ(1, result.destFrames);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_FLOAT_EQ(source[i], dest[i]);
+    }
+}
+
+TEST_F(DriftCorrectorTest, InterpolatesRamp) {
+    DriftCorrector driftCorrector;
+    driftCorrector.reset(1);
+    // A fill level error of 4 buffers speeds up the stream
+    for (int i = 0; i < 1000; ++i) {
+        driftCorrector.updateRatio(0, 0, 4);
+    }
+    const double ratio = driftCorrector.getRatio();
+    EXPECT_GT(ratio, 1);
+
+    std::vector<CSAMPLE> source(1000);
+    for (SINT i = 0; i < static_cast<SINT>(source.size()); ++i) {
+        source[i] = static_cast<CSAMPLE>(i);
+    }
+    std::vector<CSAMPLE> dest(900);
+    // Feed the source in small pieces
+    SINT sourceFrame = 0;
+    SINT destFrame = 0;
+    while (destFrame < static_cast<SINT>(dest.size())) {
+        const DriftCorrector::Result result = driftCorrector.process(
+                &source[sourceFrame], 7,
+                &dest[destFrame], dest.size() - destFrame);
+        sourceFrame += result.sourceFrames;
+        destFrame += result.destFrames;
+    }
+    for (SINT i = 0; i < destFrame; ++i) {
+        EXPECT_NEAR(i * ratio, dest[i], 1e-3);
+    }
+}
+
+TEST_F(DriftCorrectorTest, FrameRateEstimation) {
+    FakeSoundDevice device(44105, 0.002, 3);
+    for (int i = 0; i < 10000; ++i) {
+        device.callback(device.nextCallbackTime());
+    }
+    EXPECT_NEAR(44105, device.estimatedFrameRate(), 0.5);
+}
+
+TEST_F(DriftCorrectorTest, FollowsSlowerDevice) {
+    // 100 ppm
+    simulate(44100, 44095.59, 600, true);
+    EXPECT_EQ(0, m_underflowCount);
+    EXPECT_EQ(0, m_overflowCount);
+    EXPECT_NEAR(44100 / 44095.59, m_ratio, 0.00002);
+    EXPECT_GE(m_minFillLevel, kFramesPerBuffer);
+    EXPECT_LE(m_maxFillLevel, 3 * kFramesPerBuffer);
+}
+
+TEST_F(DriftCorrectorTest, FollowsFasterDevice) {
+    // 1000 ppm
+    simulate(44100, 44144.1, 600, true);
+    EXPECT_EQ(0, m_underflowCount);
+    EXPECT_EQ(0, m_overflowCount);
+    EXPECT_NEAR(44100 / 44144.1, m_ratio, 0.00002);
+}
+
+TEST_F(DriftCorrectorTest, FollowsFillLevelWithoutEstimation) {
+    // 100 ppm, e.g. if the clock reference is a network device
+    simulate(44100, 44104.41, 600, false);
+    EXPECT_EQ(0, m_underflowCount);
+    EXPECT_EQ(0, m_overflowCount);
+    EXPECT_NEAR(44100 / 44104.41, m_ratio, 0.00005);
+}
+
+static void BM_DriftCorrectorProcess(benchmark::State& state) {
+    const int channelCount = state.range_x();
+    DriftCorrector driftCorrector;
+    driftCorrector.reset(channelCount);
+    driftCorrector.updateRatio(44100, 44101, 0);
+    std::vector<CSAMPLE> source(channelCount * (kFramesPerBuffer + 2));
+    std::vector<CSAMPLE> dest(channelCount * kFramesPerBuffer);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(driftCorrector.process(
+                source.data(), kFramesPerBuffer + 2,
+                dest.data(), kFramesPerBuffer));
+    }
+}
+BENCHMARK(BM_DriftCorrectorProcess)->Arg(2)->Arg(8);
+
+}  // namespace
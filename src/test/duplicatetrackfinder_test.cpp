@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "analyzer/analyzerchromaprint.h"
+#include "library/dao/analysisdao.h"
+#include "library/duplicatetrackfinder.h"
+#include "test/librarytest.h"
+
+namespace {
+
+class DuplicateTrackFinderTest : public LibraryTest {
+  protected:
+    DuplicateTrackFinderTest()
+            : m_analysisDao(config()),
+              m_random(42) {
+        m_analysisDao.initialize(dbConnection());
+    }
+
+    RawFingerprint randomFingerprint() {
+        // About 2 minutes of audio
+        RawFingerprint fingerprint(960);
+        for (auto& subFingerprint : fingerprint) {
+            subFingerprint = m_random();
+        }
+        return fingerprint;
+    }
+
+    // Flips about 2% of all bits like a different encoding
+    RawFingerprint reencodeFingerprint(const RawFingerprint& fingerprint) {
+        RawFingerprint reencodedFingerprint(fingerprint);
+        for (auto& subFingerprint : reencodedFingerprint) {
+            for (int bit = 0; bit < 32; ++bit) {
+                if (m_random() % 50 == 0) {
+                    subFingerprint ^= 1u << bit;
+                }
+            }
+        }
+        return reencodedFingerprint;
+    }
+
+    void saveFingerprint(
+            TrackId trackId,
+            const RawFingerprint& fingerprint,
+            const QString& version = QString()) {
+        AnalysisDao::AnalysisInfo analysis =
+                AnalyzerChromaprint::analysisFromFingerprint(trackId, fingerprint);
+        if (!version.isNull()) {
+            analysis.version = version;
+        }
+        ASSERT_TRUE(m_analysisDao.saveAnalysis(&analysis));
+    }
+
+    AnalysisDao m_analysisDao;
+    std::mt19937 m_random;
+};
+
+TEST_F(DuplicateTrackFinderTest, LoadFingerprints) {
+    const RawFingerprint fingerprint = randomFingerprint();
+    saveFingerprint(TrackId(1), fingerprint);
+    saveFingerprint(TrackId(2), randomFingerprint());
+    saveFingerprint(TrackId(3), reencodeFingerprint(fingerprint));
+    // Outdated fingerprints are ignored
+    saveFingerprint(TrackId(4), fingerprint, "ChromaprintRaw-0.0");
+
+    FingerprintIndex index;
+    DuplicateTrackFinder::loadFingerprints(&m_analysisDao, &index);
+    EXPECT_EQ(3, index.size());
+
+    const QList<FingerprintIndex::Duplicate> duplicates =
+            index.findDuplicates(DuplicateTrackFinder::kMinSimilarity);
+    ASSERT_EQ(1, duplicates.size());
+    EXPECT_EQ(TrackId(1), duplicates.first().trackId);
+    EXPECT_EQ(TrackId(3), duplicates.first().otherTrackId);
+}
+
+TEST_F(DuplicateTrackFinderTest, SortDuplicates) {
+    const QList<FingerprintIndex::Duplicate> duplicates = {
+            {TrackId(4), TrackId(2), 1.0},
+            {TrackId(1), TrackId(6), 1.0},
+            {TrackId(2), TrackId(3), 1.0},
+    };
+    const QList<TrackId> expectedTrackIds = {
+            TrackId(1), TrackId(6), TrackId(2), TrackId(3), TrackId(4),
+    };
+    EXPECT_EQ(expectedTrackIds, DuplicateTrackFinder::sortDuplicates(duplicates));
+}
+
+} // anonymous namespace
@@ -4,14 +4,19 @@
 #include <QtDebug>
 #include <QScopedPointer>
 
+#include <memory>
+#include <vector>
+
 #include "mixxxtest.h"
 #include "control/controlobject.h"
 #include "effects/effectchain.h"
 #include "effects/effectchainslot.h"
 #include "effects/effectrack.h"
 #include "effects/effectsmanager.h"
+#include "effects/effectstatepool.h"
 #include "test/baseeffecttest.h"
 
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::_;
 
@@ -22,11 +27,46 @@ class EffectChainSlotTest : public BaseEffectTest {
               m_headphone(m_factory.getOrCreateHandle("[Headphone]"), "[Headphone]") {
     }
 
+    // Registers an effect with a mocked processor that creates the
+    // EffectStates into m_states
+    MockEffectProcessor* registerStatefulTestEffect(EffectManifestPointer pManifest) {
+        if (!m_pTestBackend) {
+            registerTestBackend();
+        }
+        MockEffectProcessor* pProcessor = new MockEffectProcessor();
+        MockEffectInstantiator* pInstantiator = new MockEffectInstantiator();
+        EXPECT_CALL(*pInstantiator, instantiate(_, _))
+                .WillOnce(Return(pProcessor));
+        EXPECT_CALL(*pProcessor, initialize(_, _, _));
+        ON_CALL(*pProcessor, stateSize())
+                .WillByDefault(Return(kStateSize));
+        ON_CALL(*pProcessor, createState(_))
+                .WillByDefault(Invoke(this, &EffectChainSlotTest::createState));
+        // The processor is owned by the EngineEffect that is only deleted
+        // by the engine
+        testing::Mock::AllowLeak(pProcessor);
+        m_pTestBackend->registerEffect(pManifest->id(), pManifest,
+                EffectInstantiatorPointer(pInstantiator));
+        return pProcessor;
+    }
+
+    EffectState* createState(const mixxx::EngineParameters& bufferParameters) {
+        m_states.emplace_back(new EffectState(bufferParameters));
+        return m_states.back().get();
+    }
+
+    static constexpr size_t kStateSize = 100;
+
     ChannelHandleFactory m_factory;
     ChannelHandleAndGroup m_master;
     ChannelHandleAndGroup m_headphone;
+
+    // The EffectStates are owned by the EffectProcessor in the engine
+    std::vector<std::unique_ptr<EffectState>> m_states;
 };
 
+constexpr size_t EffectChainSlotTest::kStateSize;
+
 TEST_F(EffectChainSlotTest, ChainSlotMirrorsLoadedChain) {
     EffectChainPointer pChain(new EffectChain(m_pEffectsManager.data(),
                                               "org.mixxx.test.chain1"));
@@ -57,6 +97,10 @@ TEST_F(EffectChainSlotTest, ChainSlotMirrorsLoadedChain) {
     ControlObject::set(ConfigKey(group, "num_effects"), 1);
     EXPECT_EQ(0U, pChain->numEffects());
 
+    // No EffectStates are allocated for a chain without effects.
+    ControlObject::set(ConfigKey(group, "state_memory"), 1);
+    EXPECT_DOUBLE_EQ(0.0, ControlObject::get(ConfigKey(group, "state_memory")));
+
     pChain->setMix(1.0);
     EXPECT_DOUBLE_EQ(pChain->mix(),
                      ControlObject::get(ConfigKey(group, "mix")));
@@ -111,3 +155,122 @@ TEST_F(EffectChainSlotTest, ChainSlotMirrorsLoadedChain_Clear) {
     ControlObject::set(ConfigKey(group, "clear"), 1.0);
     EXPECT_DOUBLE_EQ(0.0, ControlObject::get(ConfigKey(group, "loaded")));
 }
+
+TEST_F(EffectChainSlotTest, EffectStatesAllocatedOnlyForEnabledEffects) {
+    m_pEffectsManager->registerInputChannel(m_master);
+    m_pEffectsManager->registerOutputChannel(m_master);
+    m_pEffectsManager->registerOutputChannel(m_headphone);
+
+    EffectManifestPointer pManifest(new EffectManifest());
+    pManifest->setId("org.mixxx.test.effect");
+    pManifest->setName("Test Effect");
+    MockEffectProcessor* pProcessor = registerStatefulTestEffect(pManifest);
+
+    StandardEffectRackPointer pRack = m_pEffectsManager->addStandardEffectRack();
+    EffectChainSlotPointer pChainSlot = pRack->getEffectChainSlot(0);
+    EffectChainPointer pChain(new EffectChain(m_pEffectsManager.data(),
+                                              "org.mixxx.test.chain1"));
+    pChainSlot->loadEffectChainToSlot(pChain);
+    pChain->addToEngine(pRack->getEngineEffectRack(), 0);
+    const ConfigKey stateMemoryKey(
+            StandardEffectRack::formatEffectChainSlotGroupString(0, 0),
+            "state_memory");
+
+    // Neither loading a disabled effect nor routing an input channel to
+    // its chain allocates EffectStates
+    EXPECT_CALL(*pProcessor, createState(_)).Times(0);
+    EffectPointer pEffect = m_pEffectsManager->instantiateEffect(pManifest->id());
+    pChain->addEffect(pEffect);
+    pChain->enableForInputChannel(m_master);
+    EXPECT_TRUE(m_states.empty());
+    EXPECT_DOUBLE_EQ(0.0, ControlObject::get(stateMemoryKey));
+    testing::Mock::VerifyAndClearExpectations(pProcessor);
+
+    // Enabling the effect allocates the EffectStates for each output
+    // channel of the routed input channel
+    EXPECT_CALL(*pProcessor, createState(_)).Times(2);
+    pEffect->setEnabled(true);
+    EXPECT_EQ(2U, m_states.size());
+    EXPECT_DOUBLE_EQ(2 * kStateSize, ControlObject::get(stateMemoryKey));
+    testing::Mock::VerifyAndClearExpectations(pProcessor);
+
+    // The EffectStates are kept while the effect is toggled
+    EXPECT_CALL(*pProcessor, createState(_)).Times(0);
+    pEffect->setEnabled(false);
+    pEffect->setEnabled(true);
+    EXPECT_EQ(2U, m_states.size());
+    EXPECT_DOUBLE_EQ(2 * kStateSize, ControlObject::get(stateMemoryKey));
+
+    // Unrouting the input channel releases its EffectStates
+    pChain->disableForInputChannel(m_master);
+    EXPECT_DOUBLE_EQ(0.0, ControlObject::get(stateMemoryKey));
+    testing::Mock::VerifyAndClearExpectations(pProcessor);
+
+    // Routing the input channel to the chain of the enabled effect
+    // allocates new EffectStates immediately
+    EXPECT_CALL(*pProcessor, createState(_)).Times(2);
+    pChain->enableForInputChannel(m_master);
+    EXPECT_EQ(4U, m_states.size());
+    EXPECT_DOUBLE_EQ(2 * kStateSize, ControlObject::get(stateMemoryKey));
+    testing::Mock::VerifyAndClearExpectations(pProcessor);
+
+    // Unloading the effect releases all of its EffectStates
+    pChain->removeEffect(0);
+    EXPECT_DOUBLE_EQ(0.0, ControlObject::get(stateMemoryKey));
+}
+
+TEST_F(EffectChainSlotTest, EffectStatesReusedAfterDisablingInputChannel) {
+    m_pEffectsManager->registerInputChannel(m_master);
+    m_pEffectsManager->registerOutputChannel(m_master);
+    m_pEffectsManager->registerOutputChannel(m_headphone);
+
+    EffectManifestPointer pManifest(new EffectManifest());
+    pManifest->setId("org.mixxx.test.effect");
+    pManifest->setName("Test Effect");
+    MockEffectProcessor* pProcessor = registerStatefulTestEffect(pManifest);
+
+    StandardEffectRackPointer pRack = m_pEffectsManager->addStandardEffectRack();
+    EffectChainSlotPointer pChainSlot = pRack->getEffectChainSlot(0);
+    EffectChainPointer pChain(new EffectChain(m_pEffectsManager.data(),
+                                              "org.mixxx.test.chain1"));
+    pChainSlot->loadEffectChainToSlot(pChain);
+    pChain->addToEngine(pRack->getEngineEffectRack(), 0);
+
+    EffectPointer pEffect = m_pEffectsManager->instantiateEffect(pManifest->id());
+    pChain->addEffect(pEffect);
+    EXPECT_CALL(*pProcessor, createState(_)).Times(2);
+    pEffect->setEnabled(true);
+    pChain->enableForInputChannel(m_master);
+    ASSERT_EQ(2U, m_states.size());
+    pChain->disableForInputChannel(m_master);
+    testing::Mock::VerifyAndClearExpectations(pProcessor);
+
+    // The engine releases the EffectStates into the pool of the manifest
+    // after it has processed them for the last time
+    EffectStatePool* pPool = m_pEffectsManager->getEffectStatePool(pManifest->id());
+    EXPECT_EQ(0, pPool->size());
+    pPool->release(m_states[0].get());
+    pPool->release(m_states[1].get());
+    EXPECT_EQ(2, pPool->size());
+
+    // Routing the input channel again reuses the released EffectStates
+    EXPECT_CALL(*pProcessor, createState(_)).Times(0);
+    pChain->enableForInputChannel(m_master);
+    EXPECT_EQ(0, pPool->size());
+    EXPECT_EQ(2U, m_states.size());
+    testing::Mock::VerifyAndClearExpectations(pProcessor);
+}
+
+TEST_F(EffectChainSlotTest, EffectStatePoolDeletesStatesWhenFull) {
+    EffectStatePool pool(1);
+    const mixxx::EngineParameters bufferParameters(
+            mixxx::AudioSignal::SampleRate(44100), 1024);
+    EffectState* pState = new EffectState(bufferParameters);
+    pool.release(pState);
+    pool.release(new EffectState(bufferParameters));
+    EXPECT_EQ(1, pool.size());
+
+    EXPECT_EQ(pState, pool.acquire());
+    EXPECT_EQ(nullptr, pool.acquire());
+    delete pState;
+}
@@ -1,3 +1,4 @@
+#include <benchmark/benchmark.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -99,6 +100,12 @@ class EngineBufferScaleLinearTest : public MixxxTest {
         }
     }
 
+    void AssertWholeBufferNear(const CSAMPLE* pBuffer, CSAMPLE value, int iBufferLen) {
+        for (int i = 0; i < iBufferLen; ++i) {
+            EXPECT_NEAR(value, pBuffer[i], 1e-5);
+        }
+    }
+
     void AssertBufferCycles(const CSAMPLE* pBuffer, int iBufferLen,
                             CSAMPLE* pCycleBuffer, int iCycleLength) {
         int cycleRead = 0;
@@ -296,4 +303,135 @@ TEST_F(EngineBufferScaleLinearTest, TestRepeatedScaleCalls) {
     SampleUtil::free(pOutput);
 }
 
+TEST_F(EngineBufferScaleLinearTest, InterpolationKeepsConstant) {
+    // The history before the first buffer is silence, skip the first
+    // frames that the kernels see it.
+    const int kSkipSamples = 32;
+
+    const EngineBufferScaleLinear::Interpolation interpolations[] = {
+        EngineBufferScaleLinear::Interpolation::Cubic,
+        EngineBufferScaleLinear::Interpolation::Sinc,
+    };
+    const double rates[] = { 0.5, 0.77, 2.0, 3.3 };
+
+    CSAMPLE readBuffer[1] = { 1.0f };
+
+    EXPECT_CALL(*m_pReadAheadMock, getNextSamples(_, _, _))
+            .WillRepeatedly(Invoke(m_pReadAheadMock, &ReadAheadManagerMock::getNextSamplesFake));
+
+    CSAMPLE* pOutput = SampleUtil::alloc(kiLinearScaleReadAheadLength);
+    for (const auto interpolation : interpolations) {
+        for (const double rate : rates) {
+            m_pScaler->clear();
+            m_pScaler->setInterpolation(interpolation);
+            SetRateNoLerp(rate);
+            m_pReadAheadMock->setReadBuffer(readBuffer, 1);
+
+            m_pScaler->scaleBuffer(pOutput, kiLinearScaleReadAheadLength);
+            AssertWholeBufferNear(pOutput + kSkipSamples, 1.0f,
+                    kiLinearScaleReadAheadLength - kSkipSamples);
+        }
+    }
+
+    SampleUtil::free(pOutput);
+}
+
+TEST_F(EngineBufferScaleLinearTest, CubicHalfSpeedSmoothlyDoublesSamples) {
+    m_pScaler->setInterpolation(EngineBufferScaleLinear::Interpolation::Cubic);
+    SetRateNoLerp(0.5);
+
+    CSAMPLE readBuffer[] = { -101.0, 101.0,
+                             -99.0, 99.0 };
+    m_pReadAheadMock->setReadBuffer(readBuffer, 4);
+
+    EXPECT_CALL(*m_pReadAheadMock, getNextSamples(_, _, _))
+            .WillRepeatedly(Invoke(m_pReadAheadMock, &ReadAheadManagerMock::getNextSamplesFake));
+
+    CSAMPLE* pOutput = SampleUtil::alloc(kiLinearScaleReadAheadLength);
+    m_pScaler->scaleBuffer(pOutput, kiLinearScaleReadAheadLength);
+
+    // The alternating samples are symmetric, so the cubic interpolation
+    // hits the same midpoints as the linear one. The first frames are
+    // interpolated with the silence before the first buffer.
+    CSAMPLE expectedResult[] = { -101.0, 101.0,
+                                 -100.0, 100.0,
+                                 -99.0, 99.0,
+                                 -100.0, 100.0 };
+    AssertBufferCycles(pOutput + 8, kiLinearScaleReadAheadLength - 8,
+                       expectedResult, 8);
+
+    SampleUtil::free(pOutput);
+}
+
+TEST_F(EngineBufferScaleLinearTest, SwitchInterpolationWhilePlaying) {
+    SetRateNoLerp(0.7);
+
+    CSAMPLE readBuffer[1] = { 1.0f };
+    m_pReadAheadMock->setReadBuffer(readBuffer, 1);
+
+    EXPECT_CALL(*m_pReadAheadMock, getNextSamples(_, _, _))
+            .WillRepeatedly(Invoke(m_pReadAheadMock, &ReadAheadManagerMock::getNextSamplesFake));
+
+    CSAMPLE* pOutput = SampleUtil::alloc(kiLinearScaleReadAheadLength);
+    m_pScaler->scaleBuffer(pOutput, kiLinearScaleReadAheadLength);
+
+    // The history of the linear interpolation is available to the
+    // other kernels, so switching must not produce a gap.
+    m_pScaler->setInterpolation(EngineBufferScaleLinear::Interpolation::Sinc);
+    m_pScaler->scaleBuffer(pOutput, kiLinearScaleReadAheadLength);
+    AssertWholeBufferNear(pOutput, 1.0f, kiLinearScaleReadAheadLength);
+
+    m_pScaler->setInterpolation(EngineBufferScaleLinear::Interpolation::Linear);
+    m_pScaler->scaleBuffer(pOutput, kiLinearScaleReadAheadLength);
+    AssertWholeBufferNear(pOutput, 1.0f, kiLinearScaleReadAheadLength);
+
+    SampleUtil::free(pOutput);
+}
+
+// Plays a 440 Hz sine at any rate
+class ReadAheadManagerSine : public ReadAheadManager {
+  public:
+    ReadAheadManagerSine()
+            : m_dFrame(0) {
+    }
+
+    SINT getNextSamples(double dRate, CSAMPLE* buffer, SINT requested_samples) override {
+        const double step = dRate < 0 ? -1 : 1;
+        for (SINT i = 0; i < requested_samples; i += 2) {
+            const CSAMPLE sample = static_cast<CSAMPLE>(
+                    sin(2 * M_PI * 440.0 * m_dFrame / 44100.0));
+            buffer[i] = sample;
+            buffer[i + 1] = sample;
+            m_dFrame += step;
+        }
+        return requested_samples;
+    }
+
+  private:
+    double m_dFrame;
+};
+
+// Scratching back and forth with up to twice the normal speed, which
+// changes the rate in every callback and crosses zero regularly.
+static void BM_ScaleBufferScratch(benchmark::State& state) {
+    ReadAheadManagerSine readAheadManager;
+    EngineBufferScaleLinear scaler(&readAheadManager);
+    scaler.setSampleRate(44100);
+    scaler.setInterpolation(
+            static_cast<EngineBufferScaleLinear::Interpolation>(state.range_x()));
+
+    const SINT kBufferSize = 1024;
+    CSAMPLE* pOutput = SampleUtil::alloc(kBufferSize);
+    int callback = 0;
+    while (state.KeepRunning()) {
+        double tempoRatio = 2.0 * sin(callback++ * 0.1);
+        double pitchRatio = tempoRatio;
+        scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+        scaler.scaleBuffer(pOutput, kBufferSize);
+    }
+    SampleUtil::free(pOutput);
+}
+// 0: Linear, 1: Cubic, 2: Sinc
+BENCHMARK(BM_ScaleBufferScratch)->Arg(0)->Arg(1)->Arg(2);
+
 }  // namespace
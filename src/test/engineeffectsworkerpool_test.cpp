@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <QThread>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "engine/effects/engineeffectsworkerpool.h"
+#include "util/memory.h"
+#include "util/performancetimer.h"
+
+namespace {
+
+class CountingTask : public EngineEffectsWorkerPool::Task {
+  public:
+    CountingTask(int numJobs, int numLanes)
+            : m_pEngineThread(QThread::currentThread()),
+              m_jobPrepares(numJobs),
+              m_jobRuns(numJobs),
+              m_jobCommits(numJobs),
+              m_jobDrops(numJobs),
+              m_lanesInUse(numLanes) {
+        for (int i = 0; i < numJobs; ++i) {
+            m_jobPrepares[i].store(0);
+            m_jobRuns[i].store(0);
+            m_jobCommits[i].store(0);
+            m_jobDrops[i].store(0);
+        }
+        for (auto& inUse : m_lanesInUse) {
+            inUse.store(false);
+        }
+    }
+
+    void prepare(int jobIndex, int lane) override {
+        EXPECT_EQ(m_pEngineThread, QThread::currentThread());
+        EXPECT_FALSE(m_lanesInUse[lane].load());
+        m_jobPrepares[jobIndex].fetch_add(1);
+    }
+
+    void run(int jobIndex, int lane) override {
+        // No two jobs may use the same lane at the same time
+        EXPECT_FALSE(m_lanesInUse[lane].exchange(true));
+        EXPECT_EQ(1, m_jobPrepares[jobIndex].load());
+        if (QThread::currentThread() != m_pEngineThread &&
+                m_workerJobDelayMicros > 0) {
+            // The engine thread runs out of jobs before the workers
+            QThread::usleep(m_workerJobDelayMicros);
+        }
+        m_jobRuns[jobIndex].fetch_add(1);
+        m_lanesInUse[lane].store(false);
+    }
+
+    void commit(int jobIndex, int lane) override {
+        EXPECT_EQ(m_pEngineThread, QThread::currentThread());
+        EXPECT_FALSE(m_lanesInUse[lane].load());
+        EXPECT_EQ(1, m_jobRuns[jobIndex].load());
+        m_jobCommits[jobIndex].fetch_add(1);
+    }
+
+    void drop(int jobIndex) override {
+        EXPECT_EQ(m_pEngineThread, QThread::currentThread());
+        m_jobDrops[jobIndex].fetch_add(1);
+    }
+
+    void setWorkerJobDelay(unsigned long micros) {
+        m_workerJobDelayMicros = micros;
+    }
+
+    int commits(int jobIndex) const {
+        return m_jobCommits[jobIndex].load();
+    }
+
+    int drops(int jobIndex) const {
+        return m_jobDrops[jobIndex].load();
+    }
+
+  private:
+    QThread* const m_pEngineThread;
+    std::vector<std::atomic<int>> m_jobPrepares;
+    std::vector<std::atomic<int>> m_jobRuns;
+    std::vector<std::atomic<int>> m_jobCommits;
+    std::vector<std::atomic<int>> m_jobDrops;
+    std::vector<std::atomic<bool>> m_lanesInUse;
+    unsigned long m_workerJobDelayMicros = 0;
+};
+
+const mixxx::Duration kNoDeadline = mixxx::Duration::fromSeconds(60);
+
+class EngineEffectsWorkerPoolTest : public testing::Test {
+};
+
+TEST_F(EngineEffectsWorkerPoolTest, RunsEachJobOnce) {
+    EngineEffectsWorkerPool pool(3);
+    ASSERT_EQ(4, pool.numLanes());
+
+    for (int numJobs = 0; numJobs <= 16; ++numJobs) {
+        CountingTask task(numJobs, pool.numLanes());
+        const int jobsRunByWorkers = pool.run(&task, numJobs, kNoDeadline);
+        EXPECT_GE(jobsRunByWorkers, 0);
+        EXPECT_LT(jobsRunByWorkers, std::max(numJobs, 1));
+        for (int i = 0; i < numJobs; ++i) {
+            EXPECT_EQ(1, task.commits(i));
+            EXPECT_EQ(0, task.drops(i));
+        }
+    }
+}
+
+TEST_F(EngineEffectsWorkerPoolTest, WaitsForSlowWorkers) {
+    EngineEffectsWorkerPool pool(3);
+
+    // Each batch must only return after all of its jobs have finished,
+    // even if the workers finish after the engine thread
+    for (int batch = 0; batch < 20; ++batch) {
+        CountingTask task(4, pool.numLanes());
+        task.setWorkerJobDelay(1000);
+        pool.run(&task, 4, kNoDeadline);
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(1, task.commits(i));
+        }
+    }
+}
+
+TEST_F(EngineEffectsWorkerPoolTest, RunsInlineWithoutWorkers) {
+    EngineEffectsWorkerPool pool(0);
+    ASSERT_EQ(1, pool.numLanes());
+
+    CountingTask task(8, pool.numLanes());
+    EXPECT_EQ(0, pool.run(&task, 8, mixxx::Duration::fromNanos(0)));
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(1, task.commits(i));
+    }
+}
+
+TEST_F(EngineEffectsWorkerPoolTest, DropsJobsAfterDeadline) {
+    EngineEffectsWorkerPool pool(3);
+    const mixxx::Duration deadline = mixxx::Duration::fromMillis(1);
+
+    // The engine thread takes over the jobs of workers that have not been
+    // scheduled yet, so retry until a worker has started a slow job.
+    std::vector<std::unique_ptr<CountingTask>> tasks;
+    bool dropped = false;
+    for (int batch = 0; batch < 100 && !dropped; ++batch) {
+        while (pool.isBusy()) {
+            QThread::usleep(100);
+        }
+        tasks.push_back(std::make_unique<CountingTask>(4, pool.numLanes()));
+        CountingTask* pTask = tasks.back().get();
+        pTask->setWorkerJobDelay(200000);
+        PerformanceTimer timer;
+        timer.start();
+        pool.run(pTask, 4, deadline);
+        // Returns without waiting for the slow workers
+        EXPECT_LT(timer.elapsed(), mixxx::Duration::fromMillis(100));
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(1, pTask->commits(i) + pTask->drops(i));
+            dropped = dropped || pTask->drops(i) > 0;
+        }
+    }
+    ASSERT_TRUE(dropped);
+    ASSERT_TRUE(pool.isBusy());
+
+    // All jobs are dropped while a dropped job is still running
+    tasks.push_back(std::make_unique<CountingTask>(4, pool.numLanes()));
+    CountingTask* pTask = tasks.back().get();
+    EXPECT_EQ(0, pool.run(pTask, 4, deadline));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(0, pTask->commits(i));
+        EXPECT_EQ(1, pTask->drops(i));
+    }
+
+    while (pool.isBusy()) {
+        QThread::usleep(1000);
+    }
+    tasks.push_back(std::make_unique<CountingTask>(4, pool.numLanes()));
+    pTask = tasks.back().get();
+    pool.run(pTask, 4, kNoDeadline);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(1, pTask->commits(i));
+        EXPECT_EQ(0, pTask->drops(i));
+    }
+}
+
+} // anonymous namespace
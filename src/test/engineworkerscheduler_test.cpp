@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <QTest>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "engine/engineworker.h"
+#include "engine/engineworkerscheduler.h"
+
+namespace {
+
+// Performs a number of units of work after each wake up
+class CountingWorker : public EngineWorker {
+  public:
+    CountingWorker()
+            : m_pendingRuns(0),
+              m_runs(0),
+              m_running(false) {
+    }
+    ~CountingWorker() override {
+        quitWait();
+    }
+
+    void addWork(int runs) {
+        m_pendingRuns.fetch_add(runs);
+        workReady();
+    }
+
+    bool runOnce() override {
+        // A worker must never be run by two threads at the same time
+        EXPECT_FALSE(m_running.exchange(true));
+        bool pending = false;
+        if (m_pendingRuns.load() > 0) {
+            m_runs.fetch_add(1);
+            pending = m_pendingRuns.fetch_sub(1) > 1;
+        }
+        m_running.store(false);
+        return pending;
+    }
+
+    int runs() const {
+        return m_runs.load();
+    }
+
+  private:
+    std::atomic<int> m_pendingRuns;
+    std::atomic<int> m_runs;
+    std::atomic<bool> m_running;
+};
+
+class EngineWorkerSchedulerTest : public testing::Test {
+  protected:
+    // Simulates the engine callback until all work is done
+    static bool runUntilDone(EngineWorkerScheduler* pScheduler,
+            const std::vector<std::unique_ptr<CountingWorker>>& workers,
+            int expectedRuns) {
+        for (int i = 0; i < 1000; ++i) {
+            pScheduler->runWorkers();
+            bool done = true;
+            for (const auto& pWorker : workers) {
+                done = done && pWorker->runs() == expectedRuns;
+            }
+            if (done) {
+                return true;
+            }
+            QTest::qSleep(1);
+        }
+        return false;
+    }
+};
+
+TEST_F(EngineWorkerSchedulerTest, RunsAllWorkers) {
+    EngineWorkerScheduler scheduler;
+    scheduler.start(QThread::NormalPriority);
+    EXPECT_GE(scheduler.threadCount(), 2);
+
+    // Many more workers than threads, e.g. samplers
+    std::vector<std::unique_ptr<CountingWorker>> workers;
+    for (int i = 0; i < 64; ++i) {
+        workers.push_back(std::make_unique<CountingWorker>());
+        workers.back()->setScheduler(&scheduler);
+        if (i % 8 == 0) {
+            workers.back()->setPriority(EngineWorker::Priority::High);
+        }
+    }
+    for (const auto& pWorker : workers) {
+        // More than a single batch
+        pWorker->addWork(20);
+    }
+    EXPECT_TRUE(runUntilDone(&scheduler, workers, 20));
+}
+
+TEST_F(EngineWorkerSchedulerTest, RemoveWorkerWhileRunning) {
+    EngineWorkerScheduler scheduler;
+    scheduler.start(QThread::NormalPriority);
+    std::vector<std::unique_ptr<CountingWorker>> workers;
+    for (int i = 0; i < 8; ++i) {
+        workers.push_back(std::make_unique<CountingWorker>());
+        workers.back()->setScheduler(&scheduler);
+        workers.back()->addWork(1000);
+    }
+    scheduler.runWorkers();
+    // Destroying the workers removes them from the scheduler
+    workers.clear();
+}
+
+TEST_F(EngineWorkerSchedulerTest, WorkersOutliveScheduler) {
+    auto pWorker = std::make_unique<CountingWorker>();
+    {
+        EngineWorkerScheduler scheduler;
+        scheduler.start(QThread::NormalPriority);
+        pWorker->setScheduler(&scheduler);
+    }
+    // The worker has been detached by the scheduler
+    pWorker.reset();
+}
+
+}  // namespace
@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include <benchmark/benchmark.h>
+
+#include <QFile>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+
+#include <memory>
+
+#include "library/externallibraryimporter.h"
+#include "library/traktor/traktorfeature.h"
+#include "library/treeitem.h"
+#include "test/librarytest.h"
+
+namespace {
+
+class ExternalLibraryImporterTest : public LibraryTest {
+  protected:
+    ExternalLibraryImporterTest()
+            : m_importer(dbConnection(), "test") {
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(m_dir.isValid());
+        m_filePath = m_dir.filePath("collection.nml");
+        writeSourceFile("<NML/>");
+    }
+
+    void writeSourceFile(const QByteArray& content) {
+        QFile file(m_filePath);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Append));
+        ASSERT_EQ(content.size(), file.write(content));
+    }
+
+    bool insertTrack(const QString& location) {
+        QSqlQuery query = m_importer.preparedQuery(
+                "INSERT INTO traktor_library (location) VALUES (:location)");
+        query.bindValue(":location", location);
+        if (!m_importer.execute(query)) {
+            return false;
+        }
+        m_importer.addTrackLocation(location, query.lastInsertId().toInt());
+        return true;
+    }
+
+    int countTracks() const {
+        QSqlQuery query(dbConnection());
+        if (!query.exec("SELECT COUNT(*) FROM traktor_library") || !query.next()) {
+            return -1;
+        }
+        return query.value(0).toInt();
+    }
+
+    QTemporaryDir m_dir;
+    QString m_filePath;
+    ExternalLibraryImporter m_importer;
+};
+
+TEST_F(ExternalLibraryImporterTest, UnchangedSourceIsSkipped) {
+    const QStringList sourceFiles(m_filePath);
+    EXPECT_FALSE(m_importer.isSourceUnchanged(sourceFiles, "traktor_library"));
+
+    // The shadow table is still empty
+    m_importer.storeSourceState(sourceFiles);
+    EXPECT_FALSE(m_importer.isSourceUnchanged(sourceFiles, "traktor_library"));
+
+    ASSERT_TRUE(insertTrack("/music/a.mp3"));
+    EXPECT_TRUE(m_importer.isSourceUnchanged(sourceFiles, "traktor_library"));
+
+    writeSourceFile("<NML/>");
+    EXPECT_FALSE(m_importer.isSourceUnchanged(sourceFiles, "traktor_library"));
+
+    m_importer.storeSourceState(sourceFiles);
+    EXPECT_TRUE(m_importer.isSourceUnchanged(sourceFiles, "traktor_library"));
+
+    // An interrupted import
+    m_importer.resetSourceState();
+    EXPECT_FALSE(m_importer.isSourceUnchanged(sourceFiles, "traktor_library"));
+
+    m_importer.storeSourceState(sourceFiles);
+    ASSERT_TRUE(QFile::remove(m_filePath));
+    EXPECT_FALSE(m_importer.isSourceUnchanged(sourceFiles, "traktor_library"));
+}
+
+TEST_F(ExternalLibraryImporterTest, PlaylistEntriesAreResolvedByLocation) {
+    ASSERT_TRUE(insertTrack("/music/a.mp3"));
+    ASSERT_TRUE(insertTrack("/music/b.mp3"));
+    const int trackIdA = m_importer.trackIdForLocation("/music/a.mp3");
+    const int trackIdB = m_importer.trackIdForLocation("/music/b.mp3");
+    EXPECT_NE(-1, trackIdA);
+    EXPECT_NE(-1, trackIdB);
+    EXPECT_NE(trackIdA, trackIdB);
+    EXPECT_EQ(-1, m_importer.trackIdForLocation("/music/c.mp3"));
+
+    // The first track of a location wins
+    m_importer.addTrackLocation("/music/a.mp3", trackIdB);
+    EXPECT_EQ(trackIdA, m_importer.trackIdForLocation("/music/a.mp3"));
+
+    m_importer.clearTables(QStringList("traktor_library"));
+    EXPECT_EQ(0, countTracks());
+    EXPECT_EQ(-1, m_importer.trackIdForLocation("/music/a.mp3"));
+    EXPECT_EQ(-1, m_importer.trackIdForLocation("/music/b.mp3"));
+}
+
+TEST_F(ExternalLibraryImporterTest, LargeTransactionsAreCommittedInBetween) {
+    const int kNumTracks = ExternalLibraryImporter::kStatementsPerTransaction + 10;
+    ASSERT_TRUE(m_importer.beginTransaction());
+    for (int i = 0; i < kNumTracks; ++i) {
+        ASSERT_TRUE(insertTrack(QString("/music/%1.mp3").arg(i)));
+    }
+    EXPECT_EQ(kNumTracks, countTracks());
+
+    // Only the statements after the last intermediate commit are lost
+    ASSERT_TRUE(dbConnection().rollback());
+    EXPECT_FALSE(m_importer.commitTransaction());
+    EXPECT_EQ(ExternalLibraryImporter::kStatementsPerTransaction, countTracks());
+}
+
+TEST(TraktorPlaylistTreeTest, FoldersAreRestoredFromPlaylistPaths) {
+    const QStringList playlistPaths = {
+            "-->A-->B-->playlist1",
+            "-->playlist2",
+            "-->A-->playlist3",
+            "-->A-->B-->playlist4",
+            "",
+    };
+    const std::unique_ptr<TreeItem> pRoot(
+            TraktorFeature::buildPlaylistTree(nullptr, playlistPaths));
+    ASSERT_EQ(2, pRoot->childRows());
+
+    const TreeItem* pFolderA = pRoot->child(0);
+    EXPECT_EQ("A", pFolderA->getLabel());
+    EXPECT_EQ("-->A", pFolderA->getData().toString());
+    ASSERT_EQ(2, pFolderA->childRows());
+
+    const TreeItem* pFolderB = pFolderA->child(0);
+    EXPECT_EQ("B", pFolderB->getLabel());
+    EXPECT_EQ("-->A-->B", pFolderB->getData().toString());
+    ASSERT_EQ(2, pFolderB->childRows());
+    EXPECT_EQ("playlist1", pFolderB->child(0)->getLabel());
+    EXPECT_EQ("-->A-->B-->playlist1", pFolderB->child(0)->getData().toString());
+    EXPECT_EQ("playlist4", pFolderB->child(1)->getLabel());
+    EXPECT_FALSE(pFolderB->child(1)->hasChildren());
+
+    EXPECT_EQ("playlist3", pFolderA->child(1)->getLabel());
+    EXPECT_EQ("-->A-->playlist3", pFolderA->child(1)->getData().toString());
+
+    EXPECT_EQ("playlist2", pRoot->child(1)->getLabel());
+    EXPECT_EQ("-->playlist2", pRoot->child(1)->getData().toString());
+}
+
+// Imports the tracks and a playlist that contains all of them, like a
+// large Traktor collection
+static void BM_ImportTracks(benchmark::State& state) {
+    const int numTracks = state.range_x();
+    const QString connectionName("BM_ImportTracks");
+    {
+        QSqlDatabase database = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+        database.setDatabaseName(":memory:");
+        if (!database.open()) {
+            state.SetLabel("Failed to open database");
+            while (state.KeepRunning()) {
+            }
+            return;
+        }
+        QSqlQuery(database).exec(
+                "CREATE TABLE library (id INTEGER PRIMARY KEY AUTOINCREMENT,"
+                "title varchar(48), location varchar(512) UNIQUE)");
+        QSqlQuery(database).exec(
+                "CREATE TABLE playlist_tracks (id INTEGER PRIMARY KEY AUTOINCREMENT,"
+                "playlist_id INTEGER, track_id INTEGER, position INTEGER)");
+
+        ExternalLibraryImporter importer(database, "benchmark");
+        const QStringList tables = {"library", "playlist_tracks"};
+        while (state.KeepRunning()) {
+            importer.beginTransaction();
+            importer.clearTables(tables);
+            QSqlQuery insertTrack = importer.preparedQuery(
+                    "INSERT INTO library (title, location) VALUES (:title, :location)");
+            for (int i = 0; i < numTracks; ++i) {
+                const QString location = QString("/music/%1.mp3").arg(i);
+                insertTrack.bindValue(":title", QString::number(i));
+                insertTrack.bindValue(":location", location);
+                importer.execute(insertTrack);
+                importer.addTrackLocation(location, insertTrack.lastInsertId().toInt());
+            }
+            QSqlQuery insertEntry = importer.preparedQuery(
+                    "INSERT INTO playlist_tracks (playlist_id, track_id, position) "
+                    "VALUES (:playlist_id, :track_id, :position)");
+            for (int i = 0; i < numTracks; ++i) {
+                insertEntry.bindValue(":playlist_id", 1);
+                insertEntry.bindValue(":track_id", importer.trackIdForLocation(
+                        QString("/music/%1.mp3").arg(numTracks - 1 - i)));
+                insertEntry.bindValue(":position", i + 1);
+                importer.execute(insertEntry);
+            }
+            importer.commitTransaction();
+        }
+    }
+    QSqlDatabase::removeDatabase(connectionName);
+    state.SetItemsProcessed(state.iterations() * numTracks);
+}
+BENCHMARK(BM_ImportTracks)->Arg(100000);
+
+} // anonymous namespace
@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "musicbrainz/fingerprintindex.h"
+
+namespace {
+
+// About 2 minutes of audio
+const int kFingerprintSize = 960;
+
+// Different encodings of the same audio differ in a few percent of all
+// bits of the sub-fingerprints
+const double kBitErrorRate = 0.05;
+
+RawFingerprint randomFingerprint(std::mt19937* pRandom) {
+    RawFingerprint fingerprint(kFingerprintSize);
+    for (auto& subFingerprint : fingerprint) {
+        subFingerprint = (*pRandom)();
+    }
+    return fingerprint;
+}
+
+// The same audio with some leading audio cut off and a different encoding
+// that flips any of the bits of each sub-fingerprint
+RawFingerprint reencodeFingerprint(
+        const RawFingerprint& fingerprint,
+        std::mt19937* pRandom) {
+    const quint32 threshold = static_cast<quint32>(kBitErrorRate * 4294967296.0);
+    RawFingerprint reencodedFingerprint;
+    for (std::size_t i = 20; i < fingerprint.size(); ++i) {
+        quint32 subFingerprint = fingerprint[i];
+        for (int bit = 0; bit < 32; ++bit) {
+            if ((*pRandom)() < threshold) {
+                subFingerprint ^= 1u << bit;
+            }
+        }
+        reencodedFingerprint.push_back(subFingerprint);
+    }
+    return reencodedFingerprint;
+}
+
+class FingerprintIndexTest : public testing::Test {
+  protected:
+    FingerprintIndexTest()
+            : m_random(42) {
+        m_fingerprint = randomFingerprint(&m_random);
+        m_otherFingerprint = randomFingerprint(&m_random);
+        m_reencodedFingerprint = reencodeFingerprint(m_fingerprint, &m_random);
+    }
+
+    std::mt19937 m_random;
+    RawFingerprint m_fingerprint;
+    RawFingerprint m_reencodedFingerprint;
+    RawFingerprint m_otherFingerprint;
+};
+
+TEST_F(FingerprintIndexTest, FindDuplicates) {
+    FingerprintIndex index;
+    index.insert(TrackId(1), m_fingerprint);
+    index.insert(TrackId(2), m_otherFingerprint);
+    index.insert(TrackId(3), m_reencodedFingerprint);
+    EXPECT_EQ(3, index.size());
+
+    const QList<FingerprintIndex::Duplicate> duplicates =
+            index.findDuplicates(0.9);
+    ASSERT_EQ(1, duplicates.size());
+    EXPECT_EQ(TrackId(1), duplicates.first().trackId);
+    EXPECT_EQ(TrackId(3), duplicates.first().otherTrackId);
+    // Estimated from the signatures
+    EXPECT_NEAR(1.0 - kBitErrorRate, duplicates.first().similarity, 0.03);
+}
+
+TEST_F(FingerprintIndexTest, FindSimilar) {
+    FingerprintIndex index;
+    index.insert(TrackId(1), m_fingerprint);
+    index.insert(TrackId(2), m_otherFingerprint);
+
+    const QList<FingerprintIndex::Match> matches =
+            index.findSimilar(m_reencodedFingerprint, 0.9);
+    ASSERT_EQ(1, matches.size());
+    EXPECT_EQ(TrackId(1), matches.first().trackId);
+
+    // Replacing the fingerprint of a track
+    index.insert(TrackId(1), m_otherFingerprint);
+    EXPECT_EQ(2, index.size());
+    EXPECT_TRUE(index.findSimilar(m_reencodedFingerprint, 0.9).isEmpty());
+    EXPECT_EQ(2, index.findSimilar(m_otherFingerprint, 0.9).size());
+
+    index.remove(TrackId(1));
+    EXPECT_EQ(1, index.size());
+    EXPECT_EQ(1, index.findSimilar(m_otherFingerprint, 0.9).size());
+
+    // Empty fingerprints are not indexed
+    index.insert(TrackId(3), RawFingerprint());
+    EXPECT_EQ(1, index.size());
+}
+
+TEST_F(FingerprintIndexTest, CompareFingerprints) {
+    EXPECT_DOUBLE_EQ(1.0, FingerprintIndex::compareFingerprints(
+            m_fingerprint, m_fingerprint));
+    EXPECT_NEAR(1.0 - kBitErrorRate, FingerprintIndex::compareFingerprints(
+            m_fingerprint, m_reencodedFingerprint), 0.005);
+    EXPECT_NEAR(1.0 - kBitErrorRate, FingerprintIndex::compareFingerprints(
+            m_reencodedFingerprint, m_fingerprint), 0.005);
+    // About half of the bits of unrelated fingerprints are equal
+    EXPECT_GT(0.6, FingerprintIndex::compareFingerprints(
+            m_fingerprint, m_otherFingerprint));
+}
+
+// Finds the duplicates in a library with the given number of tracks. Every
+// 100th track has been imported twice with a different encoding. The raw
+// fingerprints are generated while building the index, which is not
+// measured.
+static void BM_FindDuplicates(benchmark::State& state) {
+    const int numTracks = state.range_x();
+    std::mt19937 random(42);
+    FingerprintIndex index;
+    int numDuplicates = 0;
+    for (int i = 1; i <= numTracks; ++i) {
+        const RawFingerprint fingerprint = randomFingerprint(&random);
+        index.insert(TrackId(i), fingerprint);
+        if (i % 100 == 0 && i < numTracks) {
+            ++i;
+            index.insert(TrackId(i), reencodeFingerprint(fingerprint, &random));
+            ++numDuplicates;
+        }
+    }
+
+    int numFound = 0;
+    while (state.KeepRunning()) {
+        numFound = index.findDuplicates(0.9).size();
+    }
+    state.SetItemsProcessed(state.iterations() * numTracks);
+    state.SetLabel(QString("%1 of %2 duplicates")
+            .arg(numFound).arg(numDuplicates).toStdString());
+}
+BENCHMARK(BM_FindDuplicates)->Arg(30000)->Arg(300000);
+
+}  // namespace
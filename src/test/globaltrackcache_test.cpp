@@ -185,3 +185,86 @@ TEST_F(GlobalTrackCacheTest, evictWhileMoving) {
     EXPECT_TRUE(static_cast<bool>(track1));
     EXPECT_FALSE(static_cast<bool>(track2));
 }
+
+class GlobalTrackCacheWriteBehindTest: public MixxxTest, public virtual GlobalTrackCacheSaver {
+  public:
+    void saveCachedTrack(Track* pTrack) noexcept override {
+        ASSERT_FALSE(pTrack == nullptr);
+        ++m_savedTrackCount;
+    }
+
+    bool saveEvictedTrackLater(
+            const GlobalTrackCacheEntryPointer& cacheEntryPtr) noexcept override {
+        m_pendingTracks.push_back(cacheEntryPtr);
+        return true;
+    }
+
+    GlobalTrackCacheEntryPointer reclaimEvictedTrack(
+            const TrackRef& trackRef) noexcept override {
+        for (auto i = m_pendingTracks.begin(); i != m_pendingTracks.end(); ++i) {
+            if ((*i)->getPlainPtr()->getId() == trackRef.getId()) {
+                auto cacheEntryPtr = std::move(*i);
+                m_pendingTracks.erase(i);
+                return cacheEntryPtr;
+            }
+        }
+        return GlobalTrackCacheEntryPointer();
+    }
+
+    void saveEvictedTracks() noexcept override {
+        for (const auto& cacheEntryPtr : m_pendingTracks) {
+            saveCachedTrack(cacheEntryPtr->getPlainPtr());
+        }
+        m_pendingTracks.clear();
+    }
+
+  protected:
+    GlobalTrackCacheWriteBehindTest()
+            : m_savedTrackCount(0) {
+        GlobalTrackCache::createInstance(this);
+    }
+    ~GlobalTrackCacheWriteBehindTest() {
+        GlobalTrackCache::destroyInstance();
+    }
+
+    std::vector<GlobalTrackCacheEntryPointer> m_pendingTracks;
+    int m_savedTrackCount;
+};
+
+TEST_F(GlobalTrackCacheWriteBehindTest, reclaimPendingTrack) {
+    ASSERT_TRUE(GlobalTrackCacheLocker().isEmpty());
+
+    const TrackId trackId(1);
+
+    TrackPointer track;
+    {
+        GlobalTrackCacheResolver resolver(kTestFile);
+        track = resolver.getTrack();
+        ASSERT_TRUE(static_cast<bool>(track));
+        resolver.initTrackIdAndUnlockCache(trackId);
+    }
+    const Track* plainPtr = track.get();
+
+    // The evicted track is kept by the saver
+    track.reset();
+    EXPECT_TRUE(GlobalTrackCacheLocker().isEmpty());
+    ASSERT_EQ(1u, m_pendingTracks.size());
+    EXPECT_EQ(0, m_savedTrackCount);
+
+    // Resolving the track again reuses the pending track object
+    {
+        GlobalTrackCacheResolver resolver(kTestFile, trackId);
+        EXPECT_EQ(GlobalTrackCacheLookupResult::HIT, resolver.getLookupResult());
+        track = resolver.getTrack();
+    }
+    EXPECT_EQ(plainPtr, track.get());
+    EXPECT_TRUE(m_pendingTracks.empty());
+    EXPECT_EQ(track, GlobalTrackCacheLocker().lookupTrackById(trackId));
+
+    // Pending tracks are saved when deactivating the cache
+    track.reset();
+    EXPECT_EQ(1u, m_pendingTracks.size());
+    GlobalTrackCacheLocker().deactivateCache();
+    EXPECT_TRUE(m_pendingTracks.empty());
+    EXPECT_EQ(1, m_savedTrackCount);
+}
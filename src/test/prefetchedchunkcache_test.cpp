@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <QSet>
+
+#include "engine/cachingreader/prefetchedchunkcache.h"
+#include "util/sample.h"
+
+namespace {
+
+const QString kTrackKey = "track|1";
+const QString kOtherTrackKey = "other|1";
+const qint64 kChunkBytes = CachingReaderChunk::kSamples * sizeof(CSAMPLE);
+
+class PrefetchedChunkCacheTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        PrefetchedChunkCache::retainTracks(QSet<QString>());
+        PrefetchedChunkCache::setMaxSizeInBytes(4 * kChunkBytes);
+    }
+
+    void TearDown() override {
+        PrefetchedChunkCache::retainTracks(QSet<QString>());
+    }
+
+    // A chunk whose samples are all set to the given value
+    static void insertChunk(const QString& trackKey, SINT chunkIndex, CSAMPLE value) {
+        mixxx::SampleBuffer sampleBuffer(CachingReaderChunk::kSamples);
+        SampleUtil::fill(sampleBuffer.data(), value, sampleBuffer.size());
+        PrefetchedChunkCache::insert(
+                trackKey,
+                chunkIndex,
+                mixxx::IndexRange::forward(
+                        chunkIndex * CachingReaderChunk::kFrames,
+                        CachingReaderChunk::kFrames),
+                std::move(sampleBuffer));
+    }
+};
+
+TEST_F(PrefetchedChunkCacheTest, TakeOnce) {
+    insertChunk(kTrackKey, 3, 0.5f);
+    ASSERT_TRUE(PrefetchedChunkCache::contains(kTrackKey, 3));
+    EXPECT_FALSE(PrefetchedChunkCache::contains(kOtherTrackKey, 3));
+    EXPECT_FALSE(PrefetchedChunkCache::contains(kTrackKey, 2));
+
+    mixxx::SampleBuffer chunkSampleBuffer(CachingReaderChunk::kSamples);
+    CachingReaderChunkForOwner chunk(
+            mixxx::SampleBuffer::WritableSlice(chunkSampleBuffer));
+    chunk.init(3);
+    const auto frameIndexRange = PrefetchedChunkCache::take(kTrackKey, &chunk);
+    EXPECT_EQ(mixxx::IndexRange::forward(
+                      3 * CachingReaderChunk::kFrames, CachingReaderChunk::kFrames),
+            frameIndexRange);
+    CSAMPLE samples[4];
+    EXPECT_EQ(mixxx::IndexRange::forward(frameIndexRange.start() + 10, 2),
+            chunk.readBufferedSampleFrames(samples,
+                    mixxx::IndexRange::forward(frameIndexRange.start() + 10, 2)));
+    for (CSAMPLE sample : samples) {
+        EXPECT_EQ(0.5f, sample);
+    }
+
+    // The chunk is now owned by the reader
+    EXPECT_FALSE(PrefetchedChunkCache::contains(kTrackKey, 3));
+    EXPECT_EQ(0, PrefetchedChunkCache::sizeInBytes());
+    chunk.init(3);
+    EXPECT_TRUE(PrefetchedChunkCache::take(kTrackKey, &chunk).empty());
+}
+
+TEST_F(PrefetchedChunkCacheTest, OldestChunksAreEvicted) {
+    for (int i = 0; i < 5; ++i) {
+        insertChunk(kTrackKey, i, 0.0f);
+    }
+    EXPECT_EQ(4, PrefetchedChunkCache::chunkCount());
+    EXPECT_EQ(4 * kChunkBytes, PrefetchedChunkCache::sizeInBytes());
+    EXPECT_FALSE(PrefetchedChunkCache::contains(kTrackKey, 0));
+    EXPECT_TRUE(PrefetchedChunkCache::contains(kTrackKey, 4));
+
+    // Replacing a chunk doesn't evict others
+    insertChunk(kTrackKey, 4, 1.0f);
+    EXPECT_EQ(4, PrefetchedChunkCache::chunkCount());
+    EXPECT_TRUE(PrefetchedChunkCache::contains(kTrackKey, 1));
+
+    PrefetchedChunkCache::setMaxSizeInBytes(kChunkBytes);
+    EXPECT_EQ(1, PrefetchedChunkCache::chunkCount());
+    EXPECT_TRUE(PrefetchedChunkCache::contains(kTrackKey, 4));
+}
+
+TEST_F(PrefetchedChunkCacheTest, RetainTracks) {
+    insertChunk(kTrackKey, 0, 0.0f);
+    insertChunk(kOtherTrackKey, 0, 0.0f);
+    PrefetchedChunkCache::retainTracks(QSet<QString>{kOtherTrackKey});
+    EXPECT_FALSE(PrefetchedChunkCache::contains(kTrackKey, 0));
+    EXPECT_TRUE(PrefetchedChunkCache::contains(kOtherTrackKey, 0));
+    EXPECT_EQ(kChunkBytes, PrefetchedChunkCache::sizeInBytes());
+}
+
+} // namespace
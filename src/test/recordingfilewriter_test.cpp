@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <QFile>
+#include <QTemporaryDir>
+
+#include "engine/sidechain/recordingfilewriter.h"
+
+namespace {
+
+class RecordingFileWriterTest : public testing::Test {
+  protected:
+    QByteArray readFile() const {
+        QFile file(filePath());
+        EXPECT_TRUE(file.open(QIODevice::ReadOnly));
+        return file.readAll();
+    }
+
+    QString filePath() const {
+        return m_dir.filePath("recording.wav");
+    }
+
+    QTemporaryDir m_dir;
+    RecordingFileWriter m_writer;
+};
+
+TEST_F(RecordingFileWriterTest, WritesAllBlocks) {
+    ASSERT_TRUE(m_writer.open(filePath()));
+    QByteArray expected;
+    // Spans several blocks with writes that don't match the block size
+    for (int i = 0; i < 1000; ++i) {
+        const QByteArray chunk(1000 + i, static_cast<char>(i));
+        m_writer.write(chunk.constData(), chunk.size());
+        expected += chunk;
+    }
+    EXPECT_EQ(expected.size(), m_writer.pos());
+    EXPECT_EQ(expected.size(), m_writer.size());
+    m_writer.close();
+    EXPECT_FALSE(m_writer.isOpen());
+    EXPECT_EQ(0, m_writer.overruns());
+
+    // The preallocated space must not be visible
+    EXPECT_EQ(expected, readFile());
+}
+
+TEST_F(RecordingFileWriterTest, RewritesHeaderAfterSeek) {
+    ASSERT_TRUE(m_writer.open(filePath()));
+    const QByteArray header(44, '\0');
+    m_writer.write(header.constData(), header.size());
+    const QByteArray body(100000, 'b');
+    m_writer.write(body.constData(), body.size());
+
+    // Like libsndfile when closing a WAV file
+    const QByteArray finalHeader(44, 'h');
+    m_writer.seek(0);
+    m_writer.write(finalHeader.constData(), finalHeader.size());
+    EXPECT_EQ(header.size(), m_writer.pos());
+    EXPECT_EQ(header.size() + body.size(), m_writer.size());
+    m_writer.seek(m_writer.size());
+    m_writer.close();
+
+    EXPECT_EQ(finalHeader + body, readFile());
+}
+
+TEST_F(RecordingFileWriterTest, ReopenStartsNewFile) {
+    ASSERT_TRUE(m_writer.open(filePath()));
+    const QByteArray first(200000, 'a');
+    m_writer.write(first.constData(), first.size());
+    m_writer.close();
+
+    ASSERT_TRUE(m_writer.open(filePath()));
+    EXPECT_EQ(0, m_writer.pos());
+    const QByteArray second(10, 'b');
+    m_writer.write(second.constData(), second.size());
+    m_writer.close();
+
+    EXPECT_EQ(second, readFile());
+}
+
+#ifdef __LINUX__
+TEST_F(RecordingFileWriterTest, FailedWritesAreCountedAsOverruns) {
+    // Every write fails with ENOSPC
+    ASSERT_TRUE(m_writer.open("/dev/full"));
+    const QByteArray data(200000, 'a');
+    m_writer.write(data.constData(), data.size());
+    m_writer.close();
+    EXPECT_LT(0, m_writer.overruns());
+
+    // The errors are counted per file
+    ASSERT_TRUE(m_writer.open(filePath()));
+    m_writer.write(data.constData(), data.size());
+    m_writer.close();
+    EXPECT_EQ(0, m_writer.overruns());
+    EXPECT_EQ(data, readFile());
+}
+#endif // __LINUX__
+
+} // namespace
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include "sources/seekindexcache.h"
+
+namespace {
+
+class SeekIndexCacheTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_dir.isValid());
+    }
+
+    void TearDown() override {
+        mixxx::SeekIndexCache::setDirectory(QString());
+    }
+
+    void createFile(const QString& fileName, int size) {
+        QFile file(m_dir.filePath(fileName));
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        ASSERT_EQ(size, file.write(QByteArray(size, 'x')));
+    }
+
+    int numFiles() const {
+        return QDir(m_dir.path()).entryList(QDir::Files).size();
+    }
+
+    QTemporaryDir m_dir;
+};
+
+TEST_F(SeekIndexCacheTest, PrunesDirectoryOnStartup) {
+    // Index files of different SoundSources share the directory
+    createFile("a.mp3idx", 1000);
+    createFile("b.ffidx", 1000);
+    createFile("c.mp3idx", 1000);
+    createFile("d.ffidx", 1000);
+
+    mixxx::SeekIndexCache::setDirectory(m_dir.path(), 4000);
+    EXPECT_EQ(4, numFiles());
+
+    mixxx::SeekIndexCache::setDirectory(m_dir.path(), 2500);
+    EXPECT_EQ(2, numFiles());
+}
+
+TEST_F(SeekIndexCacheTest, DisabledWithoutDirectory) {
+    createFile("track.mp3", 1000);
+    const QString audioFilePath = m_dir.filePath("track.mp3");
+    EXPECT_TRUE(mixxx::SeekIndexCache::filePath(audioFilePath, ".mp3idx").isEmpty());
+
+    const QString cachePath = m_dir.filePath("seekindex");
+    mixxx::SeekIndexCache::setDirectory(cachePath);
+    const QString indexFilePath =
+            mixxx::SeekIndexCache::filePath(audioFilePath, ".mp3idx");
+    EXPECT_TRUE(indexFilePath.startsWith(cachePath));
+    EXPECT_TRUE(indexFilePath.endsWith(".mp3idx"));
+}
+
+} // anonymous namespace
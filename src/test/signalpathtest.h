@@ -8,6 +8,7 @@
 #include <QTest>
 
 #include "preferences/usersettings.h"
+#include "control/controlnotifier.h"
 #include "control/controlobject.h"
 #include "mixer/deck.h"
 #include "effects/effectsmanager.h"
@@ -54,7 +55,7 @@ class TestEngineMaster : public EngineMaster {
 
 class BaseSignalPathTest : public MixxxTest {
   protected:
-    BaseSignalPathTest() {
+    explicit BaseSignalPathTest(bool bEnableSidechain = false) {
         m_pGuiTick = std::make_unique<GuiTick>();
         m_pChannelHandleFactory = new ChannelHandleFactory();
         m_pNumDecks = new ControlObject(ConfigKey("[Master]", "num_decks"));
@@ -62,7 +63,7 @@ class BaseSignalPathTest : public MixxxTest {
         m_pVisualsManager = new VisualsManager();
         m_pEngineMaster = new TestEngineMaster(m_pConfig, "[Master]",
                                                m_pEffectsManager, m_pChannelHandleFactory,
-                                               false);
+                                               bEnableSidechain);
 
         m_pMixerDeck1 = new Deck(NULL, m_pConfig, m_pEngineMaster, m_pEffectsManager,
                 m_pVisualsManager, EngineChannel::CENTER, m_sGroup1);
@@ -196,8 +197,11 @@ class BaseSignalPathTest : public MixxxTest {
         return (rate - 1.0) / kRateRangeDivisor;
     }
 
+    // The test thread acts as the engine thread only while processing and
+    // as the GUI thread in between
     void ProcessBuffer() {
         m_pEngineMaster->process(kProcessBufferSize);
+        ControlNotifier::setEngineThread(nullptr);
     }
 
     ChannelHandleFactory* m_pChannelHandleFactory;
@@ -0,0 +1,56 @@
+#include <QDomDocument>
+#include <QImage>
+#include <QTemporaryDir>
+
+#include "test/mixxxtest.h"
+#include "skin/skincache.h"
+
+class SkinCacheTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_cacheDir.isValid());
+        SkinCache::setCacheDirectory(m_cacheDir.path());
+    }
+
+    void TearDown() override {
+        SkinCache::setCacheDirectory(QString());
+    }
+
+    QTemporaryDir m_cacheDir;
+};
+
+TEST_F(SkinCacheTest, OpenDocumentIsShared) {
+    ScopedTemporaryFile pFile(makeTemporaryFile(
+            "<skin><manifest><title>Test</title></manifest></skin>"));
+
+    QDomDocument first = SkinCache::openDocument(pFile->fileName());
+    ASSERT_FALSE(first.isNull());
+    EXPECT_QSTRING_EQ("skin", first.documentElement().tagName());
+
+    // The second request must not parse the file again
+    QDomDocument second = SkinCache::openDocument(pFile->fileName());
+    EXPECT_TRUE(first.documentElement() == second.documentElement());
+}
+
+TEST_F(SkinCacheTest, OpenInvalidDocument) {
+    ScopedTemporaryFile pFile(makeTemporaryFile("<skin><manifest></skin>"));
+    EXPECT_TRUE(SkinCache::openDocument(pFile->fileName()).isNull());
+}
+
+TEST_F(SkinCacheTest, RasterizedSvgRoundTrip) {
+    PixmapSource source;
+    source.setSVG("<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"4\" height=\"3\"/>");
+
+    EXPECT_TRUE(SkinCache::loadRasterizedSvg(source, 2.0).isNull());
+
+    QImage image(8, 6, QImage::Format_ARGB32);
+    image.fill(0x80ff0000);
+    SkinCache::storeRasterizedSvg(source, 2.0, image);
+
+    QImage cached = SkinCache::loadRasterizedSvg(source, 2.0);
+    ASSERT_FALSE(cached.isNull());
+    EXPECT_EQ(image, cached);
+
+    // Different scale factors are cached separately
+    EXPECT_TRUE(SkinCache::loadRasterizedSvg(source, 1.0).isNull());
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QVector>
+
+#include <atomic>
+
+#include "engine/sidechain/enginesidechain.h"
+#include "engine/sidechain/sidechainworker.h"
+#include "soundio/soundmanager.h"
+#include "soundio/soundmanagerconfig.h"
+#include "test/signalpathtest.h"
+#include "util/cmdlineargs.h"
+#include "util/math.h"
+
+namespace {
+
+const bool kEnableSidechain = true;
+
+const double kRenderLengthSeconds = 0.5;
+
+// Collects all samples that are rendered into the sidechain
+class CollectingSideChainWorker : public SideChainWorker {
+  public:
+    void process(const CSAMPLE* pBuffer, const int iBufferSize) override {
+        QMutexLocker locker(&m_mutex);
+        for (int i = 0; i < iBufferSize; ++i) {
+            m_samples.append(pBuffer[i]);
+        }
+    }
+
+    void shutdown() override {
+    }
+
+    QVector<CSAMPLE> takeSamples() {
+        QMutexLocker locker(&m_mutex);
+        QVector<CSAMPLE> samples;
+        samples.swap(m_samples);
+        return samples;
+    }
+
+  private:
+    QMutex m_mutex;
+    QVector<CSAMPLE> m_samples;
+};
+
+class SoundDeviceRenderTest : public BaseSignalPathTest {
+  protected:
+    SoundDeviceRenderTest()
+            : BaseSignalPathTest(kEnableSidechain) {
+        // SoundManager only creates the render device in render mode
+        CmdlineArgs::Instance().setRenderFile("render.wav");
+        CmdlineArgs::Instance().setRenderLength(kRenderLengthSeconds);
+        m_pSoundManager = std::make_unique<SoundManager>(
+                config(), m_pEngineMaster);
+        // Owned by the sidechain
+        m_pWorker = new CollectingSideChainWorker();
+        m_pEngineMaster->getSideChain()->addSideChainWorker(m_pWorker);
+
+        const QString kTrackLocationTest =
+                QDir::currentPath() + "/src/test/sine-30.wav";
+        loadTrack(m_pMixerDeck1, Track::newTemporary(kTrackLocationTest));
+    }
+
+    ~SoundDeviceRenderTest() override {
+        m_pSoundManager.reset();
+        CmdlineArgs::Instance().setRenderFile(QString());
+        CmdlineArgs::Instance().setRenderLength(0.0);
+    }
+
+    // Starts playing the first deck from the beginning and renders
+    // the session. The render thread waits for the GUI thread after
+    // each buffer, i.e. events must be processed while waiting.
+    QVector<CSAMPLE> render() {
+        ControlObject::set(ConfigKey(m_sGroup1, "play"), 0.0);
+        ProcessBuffer();
+        ControlObject::set(ConfigKey(m_sGroup1, "playposition"), 0.0);
+        ProcessBuffer();
+        // Discard the buffers that have not been rendered
+        m_pEngineMaster->getSideChain()->waitUntilDrained();
+        m_pWorker->takeSamples();
+        ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+
+        std::atomic<bool> finished(false);
+        const auto connection = QObject::connect(
+                m_pSoundManager.get(), &SoundManager::renderFinished,
+                [&finished] {
+                    finished.store(true);
+                });
+        EXPECT_EQ(SOUNDDEVICE_ERROR_OK, m_pSoundManager->setupDevices());
+        QElapsedTimer timer;
+        timer.start();
+        while (!finished.load() && timer.elapsed() < 30000) {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+        QObject::disconnect(connection);
+        EXPECT_TRUE(finished.load());
+        return m_pWorker->takeSamples();
+    }
+
+    // The last buffer is rendered completely
+    int expectedSampleCount() const {
+        const SoundManagerConfig config = m_pSoundManager->getConfig();
+        const int frameCount =
+                static_cast<int>(kRenderLengthSeconds * config.getSampleRate());
+        const int framesPerBuffer = config.getFramesPerBuffer();
+        const int bufferCount =
+                (frameCount + framesPerBuffer - 1) / framesPerBuffer;
+        return bufferCount * framesPerBuffer * 2;
+    }
+
+    std::unique_ptr<SoundManager> m_pSoundManager;
+    CollectingSideChainWorker* m_pWorker;
+};
+
+TEST_F(SoundDeviceRenderTest, RendersRequestedLength) {
+    const QVector<CSAMPLE> samples = render();
+    ASSERT_EQ(expectedSampleCount(), samples.size());
+
+    // The playing deck has been rendered
+    CSAMPLE maxAmplitude = 0;
+    for (CSAMPLE sample : samples) {
+        maxAmplitude = math_max(maxAmplitude, static_cast<CSAMPLE>(fabs(sample)));
+    }
+    EXPECT_GT(maxAmplitude, 0.1);
+}
+
+TEST_F(SoundDeviceRenderTest, RenderingTheSameSessionTwiceMatches) {
+    // Reading the track is not synchronized with rendering. The first
+    // render only ensures that all rendered samples have been cached.
+    render();
+
+    const QVector<CSAMPLE> firstSamples = render();
+    const QVector<CSAMPLE> secondSamples = render();
+    ASSERT_EQ(expectedSampleCount(), firstSamples.size());
+    ASSERT_EQ(firstSamples.size(), secondSamples.size());
+    // Same tolerance as for the reference buffers of the signal path,
+    // because the state of the EQ filters is not reset
+    for (int i = 0; i < firstSamples.size(); ++i) {
+        ASSERT_NEAR(firstSamples[i], secondSamples[i], .0001) << "at sample " << i;
+    }
+}
+
+} // anonymous namespace
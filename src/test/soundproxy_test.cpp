@@ -1,6 +1,11 @@
+#include <benchmark/benchmark.h>
+
+#include <QTemporaryDir>
 #include <QTemporaryFile>
 #include <QtDebug>
 
+#include <random>
+
 #include "test/mixxxtest.h"
 
 #include "sources/soundsourceproxy.h"
@@ -12,6 +17,10 @@
 #include "sources/soundsourceopus.h"
 #endif // __OPUS__
 
+#ifdef __FFMPEGFILE__
+#include "sources/soundsourceffmpeg.h"
+#endif // __FFMPEGFILE__
+
 namespace {
 
 const QDir kTestDir(QDir::current().absoluteFilePath("src/test/id3-test-data"));
@@ -645,3 +654,175 @@ TEST_F(SoundSourceProxyTest, regressionTestCachingReaderChunkJumpForward) {
         }
     }
 }
+
+#ifdef __MAD__
+TEST_F(SoundSourceProxyTest, mp3SeekIndexCache) {
+    QTemporaryDir cacheDir;
+    ASSERT_TRUE(cacheDir.isValid());
+    SoundSourceProxy::setSeekIndexCacheDirectory(cacheDir.path());
+
+    const QString filePath = kTestDir.absoluteFilePath("cover-test-png.mp3");
+
+    // The seek index is stored when scanning the file for the first time
+    mixxx::AudioSourcePointer pScannedSource(openAudioSource(filePath));
+    ASSERT_FALSE(!pScannedSource);
+    EXPECT_EQ(1, QDir(cacheDir.path()).entryList(QDir::Files).size());
+
+    mixxx::AudioSourcePointer pCachedSource(openAudioSource(filePath));
+    ASSERT_FALSE(!pCachedSource);
+    EXPECT_EQ(pScannedSource->sampleRate(), pCachedSource->sampleRate());
+    EXPECT_EQ(pScannedSource->frameIndexRange(), pCachedSource->frameIndexRange());
+    EXPECT_EQ(pScannedSource->bitrate(), pCachedSource->bitrate());
+
+    // Decoding after seeking must not be affected by the cached index
+    const SINT kReadFrameCount = 1024;
+    const auto readRange = mixxx::IndexRange::forward(
+            pScannedSource->frameIndexMin() + pScannedSource->frameLength() / 2,
+            kReadFrameCount);
+    mixxx::SampleBuffer scannedData(
+            pScannedSource->frames2samples(kReadFrameCount));
+    mixxx::SampleBuffer cachedData(
+            pCachedSource->frames2samples(kReadFrameCount));
+    EXPECT_EQ(readRange,
+            pScannedSource->readSampleFrames(
+                    mixxx::WritableSampleFrames(
+                            readRange,
+                            mixxx::SampleBuffer::WritableSlice(scannedData))).frameIndexRange());
+    EXPECT_EQ(readRange,
+            pCachedSource->readSampleFrames(
+                    mixxx::WritableSampleFrames(
+                            readRange,
+                            mixxx::SampleBuffer::WritableSlice(cachedData))).frameIndexRange());
+    expectDecodedSamplesEqual(
+            scannedData.size(),
+            &scannedData[0],
+            &cachedData[0],
+            "Decoding mismatch with cached seek index");
+
+    SoundSourceProxy::setSeekIndexCacheDirectory(QString());
+}
+#endif // __MAD__
+
+#ifdef __FFMPEGFILE__
+TEST_F(SoundSourceProxyTest, ffmpegSeekToJumpPoints) {
+    QTemporaryDir cacheDir;
+    ASSERT_TRUE(cacheDir.isValid());
+    SoundSourceProxy::setSeekIndexCacheDirectory(cacheDir.path());
+
+    const SINT kReadFrameCount = 1024;
+    for (const auto& filePath: getFilePaths()) {
+        const QUrl url = QUrl::fromLocalFile(filePath);
+        mixxx::SoundSourceFFmpeg contReadSource(url);
+        if (contReadSource.open(mixxx::AudioSource::OpenMode::Strict) !=
+                mixxx::AudioSource::OpenResult::Succeeded) {
+            // skip test file
+            continue;
+        }
+        qDebug() << "FFmpeg jump point test:" << filePath;
+
+        // The jump points are collected while reading the whole
+        // stream contiguously
+        const auto frameIndexRange = contReadSource.frameIndexRange();
+        mixxx::SampleBuffer contReadData(
+                contReadSource.frames2samples(frameIndexRange.length()));
+        ASSERT_EQ(frameIndexRange,
+                contReadSource.readSampleFrames(
+                        mixxx::WritableSampleFrames(
+                                frameIndexRange,
+                                mixxx::SampleBuffer::WritableSlice(contReadData)))
+                        .frameIndexRange());
+
+        // Seeks backwards from the end to the beginning of the stream
+        const auto expectSeekReadsEqual = [&](mixxx::AudioSource* pSeekReadSource) {
+            ASSERT_EQ(frameIndexRange, pSeekReadSource->frameIndexRange());
+            mixxx::SampleBuffer seekReadData(
+                    pSeekReadSource->frames2samples(kReadFrameCount));
+            for (SINT frameIndex = frameIndexRange.end() - kReadFrameCount;
+                    frameIndex >= frameIndexRange.start();
+                    frameIndex -= 3 * kReadFrameCount + 17) {
+                const auto readRange =
+                        mixxx::IndexRange::forward(frameIndex, kReadFrameCount);
+                const auto seekSampleFrames = pSeekReadSource->readSampleFrames(
+                        mixxx::WritableSampleFrames(
+                                readRange,
+                                mixxx::SampleBuffer::WritableSlice(seekReadData)));
+                ASSERT_EQ(readRange, seekSampleFrames.frameIndexRange());
+                expectDecodedSamplesEqual(
+                        pSeekReadSource->frames2samples(kReadFrameCount),
+                        &contReadData[pSeekReadSource->frames2samples(
+                                frameIndex - frameIndexRange.start())],
+                        seekSampleFrames.readableData(),
+                        "Decoding mismatch after seeking to a jump point");
+            }
+        };
+
+        // The jump points that have been collected in memory
+        expectSeekReadsEqual(&contReadSource);
+
+        // The jump points that have been stored when closing the source
+        contReadSource.close();
+        mixxx::SoundSourceFFmpeg cachedSource(url);
+        ASSERT_EQ(mixxx::AudioSource::OpenResult::Succeeded,
+                cachedSource.open(mixxx::AudioSource::OpenMode::Strict));
+        expectSeekReadsEqual(&cachedSource);
+    }
+
+    SoundSourceProxy::setSeekIndexCacheDirectory(QString());
+}
+#endif // __FFMPEGFILE__
+
+namespace {
+
+// 0: AIFF, 1: FLAC, 2: AAC, 3: MP3, 4: Vorbis, 5: Opus, 6: WAV, 7: WavPack
+const char* const kRandomSeekFileNameSuffixes[] = {
+        ".aiff",
+        ".flac",
+        ".m4a",
+        "-png.mp3",
+        ".ogg",
+        ".opus",
+        ".wav",
+        ".wv",
+};
+
+} // anonymous namespace
+
+// Reads short chunks at random positions of a test file that has been
+// opened with the preferred decoder for its file type. Every read needs
+// to seek, like the CachingReader when jumping around in a track.
+static void BM_RandomSeek(benchmark::State& state) {
+    const QString fileNameSuffix(kRandomSeekFileNameSuffixes[state.range_x()]);
+    const QString filePath = kTestDir.absoluteFilePath("cover-test" + fileNameSuffix);
+    auto pTrack = Track::newTemporary(filePath);
+    SoundSourceProxy proxy(pTrack);
+    mixxx::AudioSourcePointer pAudioSource;
+    if (proxy.getSoundSourceProvider()) {
+        pAudioSource = proxy.openAudioSource();
+    }
+    if (!pAudioSource) {
+        state.SetLabel(QString("%1 unsupported").arg(fileNameSuffix).toStdString());
+        while (state.KeepRunning()) {
+        }
+        return;
+    }
+    state.SetLabel(QString("%1 %2")
+            .arg(fileNameSuffix, proxy.getSoundSourceProvider()->getName())
+            .toStdString());
+
+    const SINT kReadFrameCount = 1024;
+    mixxx::SampleBuffer readBuffer(
+            pAudioSource->frames2samples(kReadFrameCount));
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<SINT> frameIndexDistribution(
+            pAudioSource->frameIndexMin(),
+            pAudioSource->frameIndexMax() - kReadFrameCount);
+    while (state.KeepRunning()) {
+        pAudioSource->readSampleFrames(
+                mixxx::WritableSampleFrames(
+                        mixxx::IndexRange::forward(
+                                frameIndexDistribution(generator),
+                                kReadFrameCount),
+                        mixxx::SampleBuffer::WritableSlice(readBuffer)));
+    }
+}
+BENCHMARK(BM_RandomSeek)->DenseRange(0, 7);
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#ifdef __VINYLCONTROL__
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QVector>
+
+#include "vinylcontrol/timecodelutcache.h"
+
+namespace {
+
+// The shortest timecode
+const char* const kTimecode = "mixvibes_7inch";
+
+class TimecodeLUTCacheTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_dir.isValid());
+        m_filePath = m_dir.filePath("vinylcontrol/timecode.lut");
+    }
+
+    void TearDown() override {
+        timecoder_free_lookup();
+    }
+
+    // Builds the lookup table of the definition and writes it into the
+    // cache. Returns the definition without a lookup table.
+    timecode_def* writeAndFreeLUT() {
+        timecode_def* def = timecoder_find_definition(kTimecode);
+        EXPECT_TRUE(def != nullptr);
+        EXPECT_TRUE(TimecodeLUTCache::write(*def, m_filePath));
+        for (unsigned int slotNo = 0; slotNo < def->length; slotNo += 1000) {
+            m_timecodes.append(def->lut.slot[slotNo].timecode);
+        }
+        timecoder_free_lookup();
+        EXPECT_FALSE(def->lookup);
+        return def;
+    }
+
+    // Overwrites a slot number at the given offset from the end of the file
+    void corruptSlotNumber(qint64 offsetFromEnd, slot_no_t slotNo) {
+        QFile file(m_filePath);
+        ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+        ASSERT_TRUE(file.seek(file.size() - offsetFromEnd));
+        ASSERT_EQ(static_cast<qint64>(sizeof(slotNo)),
+                file.write(reinterpret_cast<const char*>(&slotNo), sizeof(slotNo)));
+    }
+
+    QTemporaryDir m_dir;
+    QString m_filePath;
+    QVector<unsigned int> m_timecodes;
+};
+
+TEST_F(TimecodeLUTCacheTest, RoundTrip) {
+    timecode_def* def = writeAndFreeLUT();
+
+    ASSERT_TRUE(TimecodeLUTCache::read(def, m_filePath));
+    EXPECT_TRUE(def->lookup);
+    EXPECT_EQ(def->length, def->lut.avail);
+    for (int i = 0; i < m_timecodes.size(); ++i) {
+        EXPECT_EQ(static_cast<unsigned int>(i * 1000),
+                lut_lookup(&def->lut, m_timecodes[i]));
+    }
+}
+
+TEST_F(TimecodeLUTCacheTest, OtherDefinitionIsRejected) {
+    writeAndFreeLUT();
+
+    timecode_def* otherDef = timecoder_find_definition_unbuilt("serato_2a");
+    ASSERT_TRUE(otherDef != nullptr);
+    EXPECT_FALSE(TimecodeLUTCache::read(otherDef, m_filePath));
+    EXPECT_FALSE(otherDef->lookup);
+}
+
+TEST_F(TimecodeLUTCacheTest, TruncatedFileIsRejected) {
+    timecode_def* def = writeAndFreeLUT();
+    QFile file(m_filePath);
+    ASSERT_TRUE(file.resize(file.size() - 1));
+
+    EXPECT_FALSE(TimecodeLUTCache::read(def, m_filePath));
+    EXPECT_FALSE(def->lookup);
+}
+
+TEST_F(TimecodeLUTCacheTest, InvalidSlotNumbersAreRejected) {
+    timecode_def* def = writeAndFreeLUT();
+    const qint64 tableBytes = sizeof(slot_no_t) << LUT_HASH_BITS;
+
+    // The last hash points behind the slots
+    corruptSlotNumber(sizeof(slot_no_t), def->length);
+    EXPECT_FALSE(TimecodeLUTCache::read(def, m_filePath));
+    EXPECT_FALSE(def->lookup);
+
+    // The last slot is chained to itself
+    def = writeAndFreeLUT();
+    corruptSlotNumber(tableBytes + sizeof(slot_no_t), def->length - 1);
+    EXPECT_FALSE(TimecodeLUTCache::read(def, m_filePath));
+    EXPECT_FALSE(def->lookup);
+}
+
+} // anonymous namespace
+
+#endif // __VINYLCONTROL__
@@ -38,8 +38,8 @@ TEST_F(TrackDAOTest, detectMovedTracks) {
     QSet<TrackId> tracksMovedSetOld;
     QSet<TrackId> tracksMovedSetNew;
     QStringList addedTracks(newFile);
-    bool cancel = false;
-    trackDAO.detectMovedTracks(&tracksMovedSetOld, &tracksMovedSetNew, addedTracks, &cancel);
+    trackDAO.detectMovedTracks(trackDAO.getDeletedTrackLocations(), addedTracks,
+            &tracksMovedSetOld, &tracksMovedSetNew);
 
     EXPECT_THAT(tracksMovedSetOld, UnorderedElementsAre(oldId));
     EXPECT_THAT(tracksMovedSetNew, UnorderedElementsAre(newId));
@@ -5,6 +5,21 @@
 
 #include <QDebug>
 #include <QScopedPointer>
+#include <QTemporaryDir>
+
+namespace {
+
+// Large enough that a partial file of half the size is not copied again
+// completely when resuming
+QByteArray largeFileContents() {
+    QByteArray contents(3 * 1024 * 1024, Qt::Uninitialized);
+    for (int i = 0; i < contents.size(); ++i) {
+        contents[i] = static_cast<char>(i % 251);
+    }
+    return contents;
+}
+
+} // anonymous namespace
 
 FakeOverwriteAnswerer::~FakeOverwriteAnswerer() { }
 
@@ -297,3 +312,98 @@ TEST_F(TrackExporterTest, MungeFilename) {
     // Remove the track we created.
     tempPath.remove("cover-test.ogg");
 }
+
+TEST_F(TrackExporterTest, SkipUnchanged) {
+    // Export a track twice. The second export must neither ask about
+    // overwriting nor copy the file again.
+    QFileInfo fileinfo1(m_testDataDir.filePath("cover-test.ogg"));
+    TrackPointer track1(Track::newTemporary(fileinfo1));
+    QList<TrackPointer> tracks;
+    tracks.append(track1);
+
+    TrackExportWorker worker(m_exportDir.canonicalPath(), tracks);
+    m_answerer.reset(new FakeOverwriteAnswerer(&worker));
+    worker.run();
+    EXPECT_TRUE(worker.wait(10000));
+    EXPECT_EQ(1, m_answerer->currentProgress());
+
+    // The answerer fails if it is asked about the existing file.
+    TrackExportWorker worker2(m_exportDir.canonicalPath(), tracks);
+    m_answerer.reset(new FakeOverwriteAnswerer(&worker2));
+    worker2.run();
+    EXPECT_TRUE(worker2.wait(10000));
+
+    EXPECT_EQ(1, m_answerer->currentProgress());
+    EXPECT_EQ(1, m_answerer->currentProgressCount());
+    QFileInfo newfile1(m_exportDir.filePath("cover-test.ogg"));
+    EXPECT_TRUE(newfile1.exists());
+    EXPECT_EQ(fileinfo1.size(), newfile1.size());
+}
+
+TEST_F(TrackExporterTest, ResumePartialCopy) {
+    QTemporaryDir sourceDir;
+    ASSERT_TRUE(sourceDir.isValid());
+    const QByteArray contents = largeFileContents();
+    QFile source(sourceDir.filePath("large.flac"));
+    ASSERT_TRUE(source.open(QIODevice::WriteOnly));
+    ASSERT_EQ(contents.size(), source.write(contents));
+    source.close();
+    QFileInfo fileinfo1(source.fileName());
+    TrackPointer track1(Track::newTemporary(fileinfo1));
+
+    // Simulate an interrupted export that has copied the first half of the
+    // file.
+    QFile partial(m_exportDir.filePath("large.flac.part"));
+    ASSERT_TRUE(partial.open(QIODevice::WriteOnly));
+    partial.write(contents.left(contents.size() / 2));
+    partial.close();
+
+    QList<TrackPointer> tracks;
+    tracks.append(track1);
+    TrackExportWorker worker(m_exportDir.canonicalPath(), tracks);
+    m_answerer.reset(new FakeOverwriteAnswerer(&worker));
+    worker.run();
+    EXPECT_TRUE(worker.wait(10000));
+
+    EXPECT_EQ(1, m_answerer->currentProgress());
+    EXPECT_EQ(1, m_answerer->currentProgressCount());
+    // The copy has been resumed at an offset > 0
+    EXPECT_GT(worker.bytesCopied(), 0);
+    EXPECT_LT(worker.bytesCopied(), contents.size());
+    EXPECT_FALSE(partial.exists());
+    QFile newfile1(m_exportDir.filePath("large.flac"));
+    ASSERT_TRUE(newfile1.open(QIODevice::ReadOnly));
+    EXPECT_EQ(contents, newfile1.readAll());
+}
+
+TEST_F(TrackExporterTest, RestartMismatchingPartialCopy) {
+    QTemporaryDir sourceDir;
+    ASSERT_TRUE(sourceDir.isValid());
+    const QByteArray contents = largeFileContents();
+    QFile source(sourceDir.filePath("large.flac"));
+    ASSERT_TRUE(source.open(QIODevice::WriteOnly));
+    ASSERT_EQ(contents.size(), source.write(contents));
+    source.close();
+    QFileInfo fileinfo1(source.fileName());
+    TrackPointer track1(Track::newTemporary(fileinfo1));
+
+    // A partial file of another track with the same name
+    QFile partial(m_exportDir.filePath("large.flac.part"));
+    ASSERT_TRUE(partial.open(QIODevice::WriteOnly));
+    partial.write(QByteArray(contents.size() / 2, 'x'));
+    partial.close();
+
+    QList<TrackPointer> tracks;
+    tracks.append(track1);
+    TrackExportWorker worker(m_exportDir.canonicalPath(), tracks);
+    m_answerer.reset(new FakeOverwriteAnswerer(&worker));
+    worker.run();
+    EXPECT_TRUE(worker.wait(10000));
+
+    // The copy has been started over
+    EXPECT_EQ(contents.size(), worker.bytesCopied());
+    EXPECT_FALSE(partial.exists());
+    QFile newfile1(m_exportDir.filePath("large.flac"));
+    ASSERT_TRUE(newfile1.open(QIODevice::ReadOnly));
+    EXPECT_EQ(contents, newfile1.readAll());
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <QFile>
+#include <QMutex>
+#include <QTemporaryDir>
+#include <QWaitCondition>
+
+#include "library/trackprefetcher.h"
+#include "test/mixxxtest.h"
+#include "util/memory.h"
+
+namespace {
+
+const qint64 kMiB = 1024 * 1024;
+
+// Records the files that have been read and optionally blocks the worker
+// thread before reading the next file
+class TestTrackPrefetcher : public TrackPrefetcher {
+  public:
+    struct Read {
+        QString location;
+        qint64 bytes;
+    };
+
+    explicit TestTrackPrefetcher(UserSettingsPointer pConfig)
+            : TrackPrefetcher(nullptr, pConfig, mixxx::DbConnectionPoolPtr()),
+              m_blocked(false),
+              m_numStarted(0) {
+    }
+
+    ~TestTrackPrefetcher() override {
+        // Pending tasks must not call readFile() while this object is
+        // destroyed
+        setBlocked(false);
+        cancel();
+        waitForDone();
+    }
+
+    void setBlocked(bool blocked) {
+        QMutexLocker locker(&m_mutex);
+        m_blocked = blocked;
+        m_changed.wakeAll();
+    }
+
+    bool waitForStarted(int numStarted) {
+        QMutexLocker locker(&m_mutex);
+        while (m_numStarted < numStarted) {
+            if (!m_changed.wait(&m_mutex, 5000)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    QList<Read> reads() {
+        QMutexLocker locker(&m_mutex);
+        return m_reads;
+    }
+
+  protected:
+    qint64 readFile(const TrackPointer& pTrack, int generation) override {
+        {
+            QMutexLocker locker(&m_mutex);
+            ++m_numStarted;
+            m_changed.wakeAll();
+            while (m_blocked) {
+                m_changed.wait(&m_mutex);
+            }
+        }
+        const qint64 bytes = TrackPrefetcher::readFile(pTrack, generation);
+        QMutexLocker locker(&m_mutex);
+        m_reads.append(Read{pTrack->getLocation(), bytes});
+        return bytes;
+    }
+
+  private:
+    QMutex m_mutex;
+    QWaitCondition m_changed;
+    bool m_blocked;
+    int m_numStarted;
+    QList<Read> m_reads;
+};
+
+class TrackPrefetcherTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_dir.isValid());
+        m_pPrefetcher = std::make_unique<TestTrackPrefetcher>(config());
+    }
+
+    void TearDown() override {
+        m_pPrefetcher.reset();
+    }
+
+    // The files are not decodable. Only reading them matters.
+    TrackPointer createTrack(const QString& fileName, qint64 size) {
+        QFile file(m_dir.filePath(fileName));
+        EXPECT_TRUE(file.open(QIODevice::WriteOnly));
+        EXPECT_EQ(size, file.write(QByteArray(size, 'x')));
+        return Track::newTemporary(QFileInfo(file.fileName()));
+    }
+
+    QTemporaryDir m_dir;
+    std::unique_ptr<TestTrackPrefetcher> m_pPrefetcher;
+};
+
+TEST_F(TrackPrefetcherTest, ReplacingTracksCancelsPendingTracks) {
+    TrackPointer pTrack1 = createTrack("track1.bin", 2 * kMiB);
+    TrackPointer pTrack2 = createTrack("track2.bin", 2 * kMiB);
+    TrackPointer pTrack3 = createTrack("track3.bin", 2 * kMiB);
+
+    m_pPrefetcher->setBlocked(true);
+    m_pPrefetcher->prefetchTracks({pTrack1, pTrack2});
+    ASSERT_TRUE(m_pPrefetcher->waitForStarted(1));
+    m_pPrefetcher->prefetchTracks({pTrack3});
+    m_pPrefetcher->setBlocked(false);
+    m_pPrefetcher->waitForDone();
+
+    // The first track has been cancelled before reading it and the
+    // second track has been skipped
+    const auto reads = m_pPrefetcher->reads();
+    ASSERT_EQ(2, reads.size());
+    EXPECT_EQ(pTrack1->getLocation(), reads[0].location);
+    EXPECT_EQ(0, reads[0].bytes);
+    EXPECT_EQ(pTrack3->getLocation(), reads[1].location);
+    EXPECT_EQ(2 * kMiB, reads[1].bytes);
+}
+
+TEST_F(TrackPrefetcherTest, CancelSkipsPendingTracks) {
+    TrackPointer pTrack1 = createTrack("track1.bin", kMiB);
+    TrackPointer pTrack2 = createTrack("track2.bin", kMiB);
+
+    m_pPrefetcher->setBlocked(true);
+    m_pPrefetcher->prefetchTracks({pTrack1, pTrack2});
+    ASSERT_TRUE(m_pPrefetcher->waitForStarted(1));
+    m_pPrefetcher->cancel();
+    m_pPrefetcher->setBlocked(false);
+    m_pPrefetcher->waitForDone();
+
+    const auto reads = m_pPrefetcher->reads();
+    ASSERT_EQ(1, reads.size());
+    EXPECT_EQ(0, reads[0].bytes);
+}
+
+TEST_F(TrackPrefetcherTest, UnchangedTracksAreNotPrefetchedAgain) {
+    TrackPointer pTrack = createTrack("track.bin", kMiB);
+
+    m_pPrefetcher->prefetchTracks({pTrack});
+    m_pPrefetcher->waitForDone();
+    m_pPrefetcher->prefetchTracks({pTrack});
+    m_pPrefetcher->waitForDone();
+
+    EXPECT_EQ(1, m_pPrefetcher->reads().size());
+}
+
+TEST_F(TrackPrefetcherTest, ReadAheadIsLimited) {
+    config()->setValue(ConfigKey("[Auto DJ]", "PrefetchReadAheadMB"), 4);
+    TrackPointer pTrack1 = createTrack("track1.bin", 3 * kMiB);
+    TrackPointer pTrack2 = createTrack("track2.bin", 3 * kMiB);
+    TrackPointer pTrack3 = createTrack("track3.bin", 3 * kMiB);
+
+    m_pPrefetcher->prefetchTracks({pTrack1, pTrack2, pTrack3});
+    m_pPrefetcher->waitForDone();
+
+    // Reading stops within the second track and the third track is
+    // skipped
+    auto reads = m_pPrefetcher->reads();
+    ASSERT_EQ(2, reads.size());
+    EXPECT_EQ(3 * kMiB, reads[0].bytes);
+    EXPECT_EQ(kMiB, reads[1].bytes);
+    EXPECT_GE(0, m_pPrefetcher->remainingReadAheadBytes());
+
+    // The limit applies to each set of tracks
+    m_pPrefetcher->prefetchTracks({pTrack3});
+    m_pPrefetcher->waitForDone();
+    reads = m_pPrefetcher->reads();
+    ASSERT_EQ(3, reads.size());
+    EXPECT_EQ(pTrack3->getLocation(), reads[2].location);
+    EXPECT_EQ(3 * kMiB, reads[2].bytes);
+    EXPECT_EQ(kMiB, m_pPrefetcher->remainingReadAheadBytes());
+}
+
+} // anonymous namespace
@@ -0,0 +1,275 @@
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QSqlQuery>
+#include <QWaitCondition>
+
+#include <thread>
+
+#include "test/mixxxtest.h"
+
+#include "database/mixxxdb.h"
+#include "library/trackcollection.h"
+#include "library/tracksavequeue.h"
+#include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+
+namespace {
+
+void deleteTestTrack(Track* pTrack) {
+    delete pTrack;
+}
+
+// Records the batches of the save thread and optionally blocks
+// the save thread before saving the next batch
+class TestTrackSaveQueue : public TrackSaveQueue {
+  public:
+    struct Batch {
+        qint64 startMillis;
+        QList<Track*> tracks;
+    };
+
+    TestTrackSaveQueue(
+            mixxx::DbConnectionPoolPtr pDbConnectionPool,
+            TrackCollection* pTrackCollection,
+            const UserSettingsPointer& pConfig)
+            : TrackSaveQueue(std::move(pDbConnectionPool), pTrackCollection, pConfig),
+              m_blocked(false),
+              m_numTracks(0) {
+        m_clock.start();
+    }
+
+    void setBlocked(bool blocked) {
+        QMutexLocker locker(&m_mutex);
+        m_blocked = blocked;
+        m_changed.wakeAll();
+    }
+
+    bool waitForTracks(int numTracks) {
+        QMutexLocker locker(&m_mutex);
+        while (m_numTracks < numTracks) {
+            if (!m_changed.wait(&m_mutex, 5000)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    QList<Batch> batches() {
+        QMutexLocker locker(&m_mutex);
+        return m_batches;
+    }
+
+  protected:
+    int saveTracks(
+            const QList<Track*>& tracks,
+            const QList<int>& dirtyRevisions) override {
+        {
+            QMutexLocker locker(&m_mutex);
+            m_batches.append(Batch{m_clock.elapsed(), tracks});
+            m_numTracks += tracks.size();
+            m_changed.wakeAll();
+            while (m_blocked) {
+                m_changed.wait(&m_mutex);
+            }
+        }
+        return TrackSaveQueue::saveTracks(tracks, dirtyRevisions);
+    }
+
+  private:
+    QElapsedTimer m_clock;
+    QMutex m_mutex;
+    QWaitCondition m_changed;
+    bool m_blocked;
+    QList<Batch> m_batches;
+    int m_numTracks;
+};
+
+class TrackSaveQueueTest : public MixxxTest {
+  protected:
+    TrackSaveQueueTest()
+            // The save thread needs its own connection to the same
+            // database, i.e. the database must not be in memory
+            : m_mixxxDb(config()),
+              m_dbConnectionPooler(m_mixxxDb.connectionPool()),
+              m_trackCollection(config()) {
+        QSqlDatabase dbConnection =
+                mixxx::DbConnectionPooled(m_mixxxDb.connectionPool());
+        MixxxDb::initDatabaseSchema(dbConnection);
+        m_trackCollection.connectDatabase(dbConnection);
+        m_pQueue = std::make_unique<TestTrackSaveQueue>(
+                m_mixxxDb.connectionPool(), &m_trackCollection, config());
+    }
+
+    ~TrackSaveQueueTest() override {
+        m_pQueue->setBlocked(false);
+        m_pQueue->flush();
+        m_pQueue.reset();
+        m_trackCollection.disconnectDatabase();
+    }
+
+    GlobalTrackCacheEntryPointer newEntry(int id) {
+        auto pTrack = std::unique_ptr<Track, void (&)(Track*)>(
+                new Track(
+                        QFileInfo(filePath(id)),
+                        SecurityTokenPointer(),
+                        TrackId(id)),
+                deleteTestTrack);
+        pTrack->markForMetadataExport();
+        return std::make_shared<GlobalTrackCacheEntry>(std::move(pTrack));
+    }
+
+    QString filePath(int id) const {
+        return getTestDataDir().filePath(QString("track%1.mp3").arg(id));
+    }
+
+    // Only tracks that exist in the library can be saved
+    void addLibraryRow(int id) {
+        QSqlQuery query(mixxx::DbConnectionPooled(m_mixxxDb.connectionPool()));
+        query.prepare("INSERT INTO library (id) VALUES (:id)");
+        query.bindValue(":id", id);
+        ASSERT_TRUE(query.exec());
+    }
+
+    TrackRef trackRef(int id) const {
+        return TrackRef::fromFileInfo(QFileInfo(filePath(id)), TrackId(id));
+    }
+
+    // Tracks are only accepted after the save thread has been started
+    void enqueue(const GlobalTrackCacheEntryPointer& entry) {
+        QElapsedTimer timer;
+        timer.start();
+        while (!m_pQueue->enqueue(entry)) {
+            ASSERT_LT(timer.elapsed(), 5000);
+            QThread::msleep(1);
+        }
+    }
+
+    const MixxxDb m_mixxxDb;
+    const mixxx::DbConnectionPooler m_dbConnectionPooler;
+    TrackCollection m_trackCollection;
+    std::unique_ptr<TestTrackSaveQueue> m_pQueue;
+};
+
+TEST_F(TrackSaveQueueTest, ReclaimPendingTrack) {
+    auto entry = newEntry(1);
+    enqueue(entry);
+    EXPECT_TRUE(entry->getPlainPtr()->signalsBlocked());
+
+    EXPECT_EQ(entry, m_pQueue->reclaim(trackRef(1)));
+    EXPECT_FALSE(entry->getPlainPtr()->signalsBlocked());
+    EXPECT_FALSE(m_pQueue->reclaim(trackRef(1)));
+
+    m_pQueue->flush();
+    EXPECT_TRUE(m_pQueue->batches().isEmpty());
+}
+
+TEST_F(TrackSaveQueueTest, ReclaimDuringSave) {
+    auto entry = newEntry(1);
+    enqueue(entry);
+
+    m_pQueue->setBlocked(true);
+    std::thread flusher([this] {
+        m_pQueue->flush();
+    });
+    ASSERT_TRUE(m_pQueue->waitForTracks(1));
+
+    // The track is handed back without waiting for the blocked save
+    EXPECT_EQ(entry, m_pQueue->reclaim(trackRef(1)));
+    EXPECT_FALSE(m_pQueue->reclaim(trackRef(1)));
+    EXPECT_TRUE(entry->getPlainPtr()->signalsBlocked());
+
+    m_pQueue->setBlocked(false);
+    flusher.join();
+    // Unblocked by the owning thread after the save has finished
+    EXPECT_TRUE(entry->getPlainPtr()->signalsBlocked());
+    QCoreApplication::processEvents();
+    EXPECT_FALSE(entry->getPlainPtr()->signalsBlocked());
+}
+
+TEST_F(TrackSaveQueueTest, ModifiedDuringSaveRemainsDirty) {
+    addLibraryRow(1);
+    addLibraryRow(2);
+    auto entry = newEntry(1);
+    auto unmodifiedEntry = newEntry(2);
+    entry->getPlainPtr()->markDirty();
+    unmodifiedEntry->getPlainPtr()->markDirty();
+    enqueue(entry);
+    enqueue(unmodifiedEntry);
+
+    m_pQueue->setBlocked(true);
+    std::thread flusher([this] {
+        m_pQueue->flush();
+    });
+    ASSERT_TRUE(m_pQueue->waitForTracks(2));
+
+    Track* pTrack = entry->getPlainPtr();
+    ASSERT_EQ(entry, m_pQueue->reclaim(trackRef(1)));
+    int numChanged = 0;
+    QObject::connect(pTrack, &Track::changed,
+            [&numChanged](Track*) {
+                ++numChanged;
+            });
+    // Modified with blocked signals while the save is in flight
+    pTrack->setTitle("Modified");
+    EXPECT_EQ(0, numChanged);
+
+    m_pQueue->setBlocked(false);
+    flusher.join();
+    EXPECT_TRUE(pTrack->isDirty());
+    EXPECT_FALSE(unmodifiedEntry->getPlainPtr()->isDirty());
+
+    // The blocked notifications are sent afterwards
+    QCoreApplication::processEvents();
+    EXPECT_FALSE(pTrack->signalsBlocked());
+    EXPECT_TRUE(pTrack->isDirty());
+    EXPECT_EQ(1, numChanged);
+}
+
+TEST_F(TrackSaveQueueTest, ThrottlesSmallBatches) {
+    const int numTracks = 2 * TrackSaveQueue::kMaxTracksPerBatch;
+    QList<GlobalTrackCacheEntryPointer> entries;
+    for (int i = 0; i < numTracks; ++i) {
+        entries.append(newEntry(i + 1));
+        enqueue(entries.last());
+    }
+
+    ASSERT_TRUE(m_pQueue->waitForTracks(1));
+    // Tracks that wait for the next batch can be reclaimed
+    EXPECT_EQ(entries.last(), m_pQueue->reclaim(trackRef(numTracks)));
+
+    ASSERT_TRUE(m_pQueue->waitForTracks(numTracks - 1));
+    const auto batches = m_pQueue->batches();
+    ASSERT_LE(2, batches.size());
+    for (int i = 0; i < batches.size(); ++i) {
+        EXPECT_LE(batches[i].tracks.size(), TrackSaveQueue::kMaxTracksPerBatch);
+        EXPECT_FALSE(batches[i].tracks.contains(entries.last()->getPlainPtr()));
+        if (i > 0) {
+            // The metadata of all tracks in the previous batch has been
+            // exported. Both clocks are truncated to milliseconds.
+            EXPECT_GE(batches[i].startMillis - batches[i - 1].startMillis,
+                    batches[i - 1].tracks.size() *
+                            TrackSaveQueue::kMinMetadataExportIntervalMillis - 1);
+        }
+    }
+}
+
+TEST_F(TrackSaveQueueTest, FlushSavesAllPendingTracks) {
+    const int numTracks = 3 * TrackSaveQueue::kMaxTracksPerBatch;
+    for (int i = 0; i < numTracks; ++i) {
+        enqueue(newEntry(i + 1));
+    }
+
+    // Neither delayed nor throttled
+    m_pQueue->flush();
+    const auto batches = m_pQueue->batches();
+    ASSERT_EQ(1, batches.size());
+    EXPECT_EQ(numTracks, batches[0].tracks.size());
+    for (int i = 0; i < numTracks; ++i) {
+        EXPECT_FALSE(m_pQueue->reclaim(trackRef(i + 1)));
+    }
+}
+
+} // anonymous namespace
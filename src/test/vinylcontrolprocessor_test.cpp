@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#ifdef __VINYLCONTROL__
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QThread>
+#include <QVector>
+
+#include <vector>
+
+#include "test/mixxxtest.h"
+#include "vinylcontrol/defs_vinylcontrol.h"
+#include "vinylcontrol/vinylcontrol.h"
+#include "vinylcontrol/vinylcontrolprocessor.h"
+
+namespace {
+
+// Records the samples it receives and the thread that analyzes them
+class TestVinylControl : public VinylControl {
+  public:
+    TestVinylControl(UserSettingsPointer pConfig, QString group)
+            : VinylControl(pConfig, group),
+              m_pThread(nullptr),
+              m_numFrames(0),
+              m_sampleSum(0.0) {
+    }
+
+    void analyzeSamples(CSAMPLE* pSamples, size_t nFrames) override {
+        QMutexLocker locker(&m_mutex);
+        m_pThread = QThread::currentThread();
+        m_numFrames += nFrames;
+        for (size_t i = 0; i < nFrames * 2; ++i) {
+            m_sampleSum += pSamples[i];
+        }
+    }
+
+    bool writeQualityReport(VinylSignalQualityReport*) override {
+        return false;
+    }
+
+    QThread* analyzingThread() {
+        QMutexLocker locker(&m_mutex);
+        return m_pThread;
+    }
+
+    size_t numFrames() {
+        QMutexLocker locker(&m_mutex);
+        return m_numFrames;
+    }
+
+    double sampleSum() {
+        QMutexLocker locker(&m_mutex);
+        return m_sampleSum;
+    }
+
+  protected:
+    float getAngle() override {
+        return 0.0f;
+    }
+
+  private:
+    QMutex m_mutex;
+    QThread* m_pThread;
+    size_t m_numFrames;
+    double m_sampleSum;
+};
+
+class TestVinylControlProcessor : public VinylControlProcessor {
+  public:
+    explicit TestVinylControlProcessor(UserSettingsPointer pConfig)
+            : VinylControlProcessor(nullptr, pConfig),
+              m_pConfig(pConfig),
+              m_vinylControls(kMaximumVinylControlInputs, nullptr) {
+    }
+
+    // Owned by the processor
+    TestVinylControl* vinylControl(int index) const {
+        return m_vinylControls[index];
+    }
+
+  protected:
+    VinylControl* newVinylControl(int index) override {
+        TestVinylControl* pVinylControl = new TestVinylControl(
+                m_pConfig, kVCGroup.arg(index + 1));
+        m_vinylControls[index] = pVinylControl;
+        return pVinylControl;
+    }
+
+  private:
+    const UserSettingsPointer m_pConfig;
+    QVector<TestVinylControl*> m_vinylControls;
+};
+
+class VinylControlProcessorTest : public MixxxTest {
+  protected:
+    bool waitForFrames(TestVinylControl* pVinylControl, size_t numFrames) {
+        QElapsedTimer timer;
+        timer.start();
+        while (pVinylControl->numFrames() < numFrames) {
+            if (timer.elapsed() > 5000) {
+                return false;
+            }
+            QThread::msleep(1);
+        }
+        return true;
+    }
+};
+
+TEST_F(VinylControlProcessorTest, BuffersAreDispatchedToTheLaneOfTheirInput) {
+    const unsigned int kFrames = 512;
+    TestVinylControlProcessor processor(config());
+    const AudioInput input1(AudioInput::VINYLCONTROL, 0, 2, 0);
+    const AudioInput input2(AudioInput::VINYLCONTROL, 2, 2, 1);
+    processor.onInputConfigured(input1);
+    processor.onInputConfigured(input2);
+    TestVinylControl* pVinylControl1 = processor.vinylControl(0);
+    TestVinylControl* pVinylControl2 = processor.vinylControl(1);
+    ASSERT_TRUE(pVinylControl1 != nullptr);
+    ASSERT_TRUE(pVinylControl2 != nullptr);
+
+    const std::vector<CSAMPLE> buffer1(kFrames * 2, 0.25f);
+    const std::vector<CSAMPLE> buffer2(kFrames * 2, 0.5f);
+    processor.receiveBuffer(input1, buffer1.data(), kFrames);
+    processor.receiveBuffer(input2, buffer2.data(), kFrames);
+    processor.receiveBuffer(input2, buffer2.data(), kFrames);
+
+    ASSERT_TRUE(waitForFrames(pVinylControl1, kFrames));
+    ASSERT_TRUE(waitForFrames(pVinylControl2, 2 * kFrames));
+    EXPECT_EQ(kFrames, pVinylControl1->numFrames());
+    EXPECT_DOUBLE_EQ(kFrames * 2 * 0.25, pVinylControl1->sampleSum());
+    EXPECT_DOUBLE_EQ(2 * kFrames * 2 * 0.5, pVinylControl2->sampleSum());
+
+    // Each input is decoded in its own lane
+    EXPECT_NE(pVinylControl1->analyzingThread(), pVinylControl2->analyzingThread());
+    EXPECT_NE(QThread::currentThread(), pVinylControl1->analyzingThread());
+    EXPECT_NE(QThread::currentThread(), pVinylControl2->analyzingThread());
+}
+
+} // anonymous namespace
+
+#endif // __VINYLCONTROL__
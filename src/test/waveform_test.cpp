@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+
+#include "proto/waveform.pb.h"
+#include "waveform/waveform.h"
+
+using namespace mixxx::track;
+
+namespace {
+
+// About 6 minutes of audio at 44.1 kHz in the default resolution of the
+// big waveform
+const int kAudioSamples = 2 * 44100 * 360;
+const int kVisualSampleRate = 441;
+
+class WaveformTest : public testing::Test {
+  public:
+    static WaveformPointer createWaveform() {
+        WaveformPointer pWaveform(new Waveform(
+                44100, kAudioSamples, kVisualSampleRate, -1));
+        for (int i = 0; i < pWaveform->getDataSize(); ++i) {
+            WaveformData& datum = pWaveform->data()[i];
+            datum.filtered.low = static_cast<unsigned char>(i);
+            datum.filtered.mid = static_cast<unsigned char>(i / 3);
+            datum.filtered.high = static_cast<unsigned char>(i * 7);
+            datum.filtered.all = static_cast<unsigned char>(255 - i);
+        }
+        pWaveform->setCompletion(pWaveform->getDataSize());
+        return pWaveform;
+    }
+
+    // Serializes a waveform in the protobuf format of Mixxx 2.2 and before
+    static QByteArray toProtobufByteArray(const Waveform& waveform) {
+        io::Waveform proto;
+        proto.set_visual_sample_rate(kVisualSampleRate);
+        proto.set_audio_visual_ratio(waveform.getAudioVisualRatio());
+        io::Waveform::Signal* all = proto.mutable_signal_all();
+        io::Waveform::FilteredSignal* filtered = proto.mutable_signal_filtered();
+        io::Waveform::Signal* low = filtered->mutable_low();
+        io::Waveform::Signal* mid = filtered->mutable_mid();
+        io::Waveform::Signal* high = filtered->mutable_high();
+        for (int i = 0; i < waveform.getDataSize(); ++i) {
+            all->add_value(waveform.getAll(i));
+            low->add_value(waveform.getLow(i));
+            mid->add_value(waveform.getMid(i));
+            high->add_value(waveform.getHigh(i));
+        }
+        std::string output;
+        proto.SerializeToString(&output);
+        return QByteArray(output.data(), output.length());
+    }
+
+    static void expectEqual(const Waveform& expected, const Waveform& actual) {
+        ASSERT_EQ(expected.getDataSize(), actual.getDataSize());
+        EXPECT_EQ(expected.getDataSize(), actual.getCompletion());
+        EXPECT_DOUBLE_EQ(expected.getAudioVisualRatio(),
+                actual.getAudioVisualRatio());
+        for (int i = 0; i < expected.getDataSize(); ++i) {
+            ASSERT_EQ(expected.get(i).m_i, actual.get(i).m_i) << i;
+        }
+    }
+};
+
+TEST_F(WaveformTest, CompactRoundTrip) {
+    WaveformPointer pWaveform = createWaveform();
+    QByteArray data = pWaveform->toByteArray();
+    EXPECT_TRUE(Waveform::isCompactFormat(data));
+    Waveform loaded(data);
+    expectEqual(*pWaveform, loaded);
+    EXPECT_EQ(Waveform::SaveState::Saved, loaded.saveState());
+}
+
+TEST_F(WaveformTest, CompressedRoundTrip) {
+    WaveformPointer pWaveform = createWaveform();
+    QByteArray data = pWaveform->toByteArray(true);
+    EXPECT_TRUE(Waveform::isCompactFormat(data));
+    EXPECT_LT(data.size(), pWaveform->toByteArray().size());
+    Waveform loaded(data);
+    expectEqual(*pWaveform, loaded);
+}
+
+TEST_F(WaveformTest, ProtobufIsConvertedLazily) {
+    WaveformPointer pWaveform = createWaveform();
+    QByteArray data = toProtobufByteArray(*pWaveform);
+    EXPECT_FALSE(Waveform::isCompactFormat(data));
+    Waveform loaded(data);
+    expectEqual(*pWaveform, loaded);
+    // Saved again in the compact format together with the track
+    EXPECT_EQ(Waveform::SaveState::SavePending, loaded.saveState());
+}
+
+TEST_F(WaveformTest, RejectsTruncatedPayload) {
+    WaveformPointer pWaveform = createWaveform();
+    QByteArray data = pWaveform->toByteArray();
+    data.chop(1);
+    Waveform loaded(data);
+    EXPECT_EQ(0, loaded.getDataSize());
+    EXPECT_FALSE(loaded.isValid());
+}
+
+static void BM_WaveformLoadProtobuf(benchmark::State& state) {
+    WaveformPointer pWaveform = WaveformTest::createWaveform();
+    // Stored with qCompress() by AnalysisDao
+    const QByteArray data = qCompress(
+            WaveformTest::toProtobufByteArray(*pWaveform));
+    while (state.KeepRunning()) {
+        Waveform loaded(qUncompress(data));
+        benchmark::DoNotOptimize(loaded.getDataSize());
+    }
+}
+BENCHMARK(BM_WaveformLoadProtobuf);
+
+static void BM_WaveformLoadCompact(benchmark::State& state) {
+    WaveformPointer pWaveform = WaveformTest::createWaveform();
+    const QByteArray data = pWaveform->toByteArray(state.range_x());
+    while (state.KeepRunning()) {
+        Waveform loaded(data);
+        benchmark::DoNotOptimize(loaded.getDataSize());
+    }
+}
+BENCHMARK(BM_WaveformLoadCompact)->Arg(false)->Arg(true);
+
+}  // namespace
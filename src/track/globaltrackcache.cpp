@@ -329,6 +329,10 @@ void GlobalTrackCache::deactivate() {
     // referenced or not. This ensures that the eviction
     // callback is triggered for all modified tracks before
     // exiting the application.
+    if (m_pSaver) {
+        // Finish saving all tracks that have already been evicted
+        m_pSaver->saveEvictedTracks();
+    }
     auto i = m_tracksById.begin();
     while (i != m_tracksById.end()) {
         Track* plainPtr= i->second->getPlainPtr();
@@ -442,6 +446,42 @@ TrackPointer GlobalTrackCache::revive(
     return savingPtr;
 }
 
+TrackPointer GlobalTrackCache::reclaim(
+        const TrackRef& trackRef) {
+    // An evicted track might still be waiting to be saved. Reusing
+    // it is not only cheaper than loading the track again, but also
+    // required to not load outdated metadata from the database.
+    GlobalTrackCacheEntryPointer cacheEntryPtr =
+            m_pSaver->reclaimEvictedTrack(trackRef);
+    if (!cacheEntryPtr) {
+        return TrackPointer();
+    }
+    Track* plainPtr = cacheEntryPtr->getPlainPtr();
+    DEBUG_ASSERT(isEvicted(plainPtr));
+    const TrackRef reclaimedTrackRef = createTrackRef(*plainPtr);
+    if (debugLogEnabled()) {
+        kLogger.debug()
+                << "Reclaiming evicted track"
+                << reclaimedTrackRef
+                << plainPtr;
+    }
+    if (reclaimedTrackRef.hasId()) {
+        DEBUG_ASSERT(m_tracksById.find(
+                reclaimedTrackRef.getId()) == m_tracksById.end());
+        m_tracksById.insert(std::make_pair(
+                reclaimedTrackRef.getId(),
+                cacheEntryPtr));
+    }
+    if (reclaimedTrackRef.hasCanonicalLocation()) {
+        DEBUG_ASSERT(m_tracksByCanonicalLocation.find(
+                reclaimedTrackRef.getCanonicalLocation()) == m_tracksByCanonicalLocation.end());
+        m_tracksByCanonicalLocation.insert(std::make_pair(
+                reclaimedTrackRef.getCanonicalLocation(),
+                cacheEntryPtr));
+    }
+    return revive(std::move(cacheEntryPtr));
+}
+
 void GlobalTrackCache::resolve(
         GlobalTrackCacheResolver* /*in/out*/ pCacheResolver,
         QFileInfo /*in*/ fileInfo,
@@ -506,6 +546,23 @@ void GlobalTrackCache::resolve(
                 << trackRef;
         return;
     }
+    {
+        auto strongPtr = reclaim(trackRef);
+        if (strongPtr) {
+            if (debugLogEnabled()) {
+                kLogger.debug()
+                        << "Cache hit - reclaimed evicted track"
+                        << trackRef
+                        << strongPtr.get();
+            }
+            TrackRef reclaimedTrackRef = createTrackRef(*strongPtr);
+            pCacheResolver->initLookupResult(
+                    GlobalTrackCacheLookupResult::HIT,
+                    std::move(strongPtr),
+                    std::move(reclaimedTrackRef));
+            return;
+        }
+    }
     if (debugLogEnabled()) {
         kLogger.debug()
                 << "Cache miss - allocating track"
@@ -604,7 +661,9 @@ void GlobalTrackCache::evictAndSave(
     // We need to be sure this is always called from the main thread
     // because we can only access the DB from it and we must not lose the
     // the lock until all changes are persistently stored in file and DB
-    // to not hand out the track again with old metadata.
+    // to not hand out the track again with old metadata. If the saver
+    // defers saving the track it is responsible for handing it back
+    // on request by reclaimEvictedTrack() until it has been saved.
     DEBUG_ASSERT(QApplication::instance()->thread() == QThread::currentThread());
 
     GlobalTrackCacheLocker cacheLocker;
@@ -633,10 +692,13 @@ void GlobalTrackCache::evictAndSave(
     }
 
     DEBUG_ASSERT(isEvicted(cacheEntryPtr->getPlainPtr()));
-    m_pSaver->saveCachedTrack(cacheEntryPtr->getPlainPtr());
+    if (!m_pSaver->saveEvictedTrackLater(cacheEntryPtr)) {
+        m_pSaver->saveCachedTrack(cacheEntryPtr->getPlainPtr());
+    }
 
     // here the cacheEntryPtr goes out of scope, the cache is deleted
-    // including the owned track
+    // including the owned track unless the saver has kept it for
+    // saving it later
 }
 
 bool GlobalTrackCache::evict(Track* plainPtr) {
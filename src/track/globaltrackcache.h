@@ -167,6 +167,27 @@ private:
     friend class GlobalTrackCache;
     virtual void saveCachedTrack(Track* pTrack) noexcept = 0;
 
+    // Optional write-behind saving of evicted tracks. The saver may
+    // keep the evicted cache entry and save the track later instead
+    // of saving it synchronously with saveCachedTrack(). Returns false
+    // if the track needs to be saved synchronously.
+    virtual bool saveEvictedTrackLater(
+            const GlobalTrackCacheEntryPointer& /*cacheEntryPtr*/) noexcept {
+        return false;
+    }
+    // Hands an evicted track that has been kept for saving it later
+    // back to the cache when the track is requested again. This also
+    // applies to a track that is currently being saved, i.e. this
+    // function must not block. Returns a null pointer if no matching
+    // track is pending.
+    virtual GlobalTrackCacheEntryPointer reclaimEvictedTrack(
+            const TrackRef& /*trackRef*/) noexcept {
+        return GlobalTrackCacheEntryPointer();
+    }
+    // Blocks until all evicted tracks have been saved.
+    virtual void saveEvictedTracks() noexcept {
+    }
+
 protected:
     virtual ~GlobalTrackCacheSaver() {}
 };
@@ -206,6 +227,7 @@ private:
             const TrackRef& trackRef);
 
     TrackPointer revive(GlobalTrackCacheEntryPointer entryPtr);
+    TrackPointer reclaim(const TrackRef& trackRef);
 
     void resolve(
             GlobalTrackCacheResolver* /*in/out*/ pCacheResolver,
@@ -68,6 +68,7 @@ Track::Track(
           m_pSecurityToken(openSecurityToken(m_fileInfo, std::move(pSecurityToken))),
           m_record(trackId),
           m_bDirty(false),
+          m_dirtyRevision(0),
           m_bMarkedForMetadataExport(false) {
     if (kLogStats && kLogger.debugEnabled()) {
         long numberOfInstancesBefore = s_numberOfInstances.fetch_add(1);
@@ -861,6 +862,20 @@ void Track::markClean() {
     setDirtyAndUnlock(&lock, false);
 }
 
+bool Track::markClean(int dirtyRevision) {
+    QMutexLocker lock(&m_qMutex);
+    if (m_dirtyRevision != dirtyRevision) {
+        return false;
+    }
+    setDirtyAndUnlock(&lock, false);
+    return true;
+}
+
+int Track::getDirtyRevision() const {
+    QMutexLocker lock(&m_qMutex);
+    return m_dirtyRevision;
+}
+
 void Track::markDirtyAndUnlock(QMutexLocker* pLock, bool bDirty) {
     bool result = m_bDirty || bDirty;
     setDirtyAndUnlock(pLock, result);
@@ -869,6 +884,9 @@ void Track::markDirtyAndUnlock(QMutexLocker* pLock, bool bDirty) {
 void Track::setDirtyAndUnlock(QMutexLocker* pLock, bool bDirty) {
     const bool dirtyChanged = m_bDirty != bDirty;
     m_bDirty = bDirty;
+    if (bDirty) {
+        ++m_dirtyRevision;
+    }
 
     // Unlock before emitting any signals!
     pLock->unlock();
@@ -296,6 +296,13 @@ class Track : public QObject {
     void markDirty();
     // Mark the track clean if it isn't already.
     void markClean();
+    // Mark the track clean unless it has been modified after the given
+    // revision has been obtained, e.g. while it was being saved on
+    // another thread. Returns false if it has been modified.
+    bool markClean(int dirtyRevision);
+
+    // Incremented whenever the track is marked dirty
+    int getDirtyRevision() const;
 
     // Explicitly request to export the track's metadata. The actual
     // export is deferred to prevent race conditions when writing into
@@ -371,6 +378,7 @@ class Track : public QObject {
     // Flag that indicates whether or not the TIO has changed. This is used by
     // TrackDAO to determine whether or not to write the Track back.
     bool m_bDirty;
+    int m_dirtyRevision;
 
     // Flag indicating that the user has explicitly requested to save
     // the metadata.
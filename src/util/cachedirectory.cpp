@@ -0,0 +1,65 @@
+#include "util/cachedirectory.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+#include <algorithm>
+
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("CacheDirectory");
+
+QDateTime lastUsed(const QFileInfo& fileInfo) {
+    const QDateTime lastRead = fileInfo.lastRead();
+    const QDateTime lastModified = fileInfo.lastModified();
+    if (lastRead.isValid() && lastRead > lastModified) {
+        return lastRead;
+    }
+    return lastModified;
+}
+
+} // anonymous namespace
+
+// static
+int CacheDirectory::prune(
+        const QString& path,
+        qint64 maxTotalSize,
+        const QStringList& nameFilters) {
+    QFileInfoList fileInfos = QDir(path).entryInfoList(
+            nameFilters, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot);
+    qint64 totalSize = 0;
+    for (const auto& fileInfo : fileInfos) {
+        totalSize += fileInfo.size();
+    }
+    if (totalSize <= maxTotalSize) {
+        return 0;
+    }
+
+    // Least recently used first
+    std::sort(fileInfos.begin(), fileInfos.end(),
+            [](const QFileInfo& lhs, const QFileInfo& rhs) {
+                return lastUsed(lhs) < lastUsed(rhs);
+            });
+    int deletedFiles = 0;
+    for (const auto& fileInfo : fileInfos) {
+        if (totalSize <= maxTotalSize) {
+            break;
+        }
+        if (!QFile::remove(fileInfo.absoluteFilePath())) {
+            kLogger.warning()
+                    << "Failed to delete cached file"
+                    << fileInfo.absoluteFilePath();
+            continue;
+        }
+        totalSize -= fileInfo.size();
+        ++deletedFiles;
+    }
+    kLogger.debug()
+            << "Deleted" << deletedFiles
+            << "cached files from" << path;
+    return deletedFiles;
+}
@@ -0,0 +1,29 @@
+#ifndef MIXXX_UTIL_CACHEDIRECTORY_H
+#define MIXXX_UTIL_CACHEDIRECTORY_H
+
+#include <QString>
+#include <QStringList>
+
+// Keeps directories with cached files within a size limit.
+//
+// The cached files are evicted in least recently used order. The last
+// use of a file is the later of its last access and its last
+// modification time. Most systems only update the access time at most
+// once per day (relatime), which is sufficient for evicting files that
+// have not been used for a long time.
+class CacheDirectory {
+  public:
+    // Deletes the least recently used files that match the name filters
+    // until the total size of all matching files doesn't exceed the
+    // maximum size. Subdirectories are ignored. Returns the number of
+    // deleted files.
+    static int prune(
+            const QString& path,
+            qint64 maxTotalSize,
+            const QStringList& nameFilters = QStringList());
+
+  private:
+    CacheDirectory() = delete;
+};
+
+#endif // MIXXX_UTIL_CACHEDIRECTORY_H
@@ -17,6 +17,7 @@ CmdlineArgs::CmdlineArgs()
       m_settingsPathSet(false),
       m_logLevel(mixxx::kLogLevelDefault),
       m_logFlushLevel(mixxx::kLogFlushLevelDefault),
+      m_renderLength(0.0),
 // We are not ready to switch to XDG folders under Linux, so keeping $HOME/.mixxx as preferences folder. see lp:1463273
 #ifdef __LINUX__
     m_settingsPath(QDir::homePath().append("/").append(SETTINGS_PATH)) {
@@ -58,6 +59,18 @@ bool CmdlineArgs::Parse(int &argc, char **argv) {
         } else if (argv[i] == QString("--timelinePath") && i+1 < argc) {
             m_timelinePath = QString::fromLocal8Bit(argv[i+1]);
             i++;
+        } else if (argv[i] == QString("--render") && i+1 < argc) {
+            m_renderFile = QString::fromLocal8Bit(argv[i+1]);
+            i++;
+        } else if (argv[i] == QString("--renderLength") && i+1 < argc) {
+            bool ok = false;
+            m_renderLength = QString::fromLocal8Bit(argv[i+1]).toDouble(&ok);
+            if (!ok || m_renderLength < 0.0) {
+                fputs("\nrenderLength argument wasn't a positive number of seconds! Mixxx will render\n\
+until it is closed.\n", stdout);
+                m_renderLength = 0.0;
+            }
+            i++;
         } else if (argv[i] == QString("--logLevel") && i+1 < argc) {
             logLevelSet = true;
             auto level = QLatin1String(argv[i+1]);
@@ -156,6 +169,14 @@ void CmdlineArgs::printUsage() {
 \n\
 -f, --fullScreen        Starts Mixxx in full-screen mode\n\
 \n\
+--render FILE           Renders the master mix into FILE as fast as\n\
+                        possible instead of playing it on the configured\n\
+                        sound devices. The file type is chosen by its\n\
+                        extension, e.g. .wav, .flac or .mp3\n\
+\n\
+--renderLength SECONDS  Stops rendering and exits Mixxx after the given\n\
+                        duration of audio has been rendered\n\
+\n\
 --logLevel LEVEL        Sets the verbosity of command line logging\n\
                         critical - Critical/Fatal only\n\
                         warning  - Above + Warnings\n\
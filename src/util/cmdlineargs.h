@@ -37,6 +37,16 @@ class CmdlineArgs final {
     const QString& getResourcePath() const { return m_resourcePath; }
     const QString& getPluginPath() const { return m_pluginPath; }
     const QString& getTimelinePath() const { return m_timelinePath; }
+    bool getRenderMode() const { return !m_renderFile.isEmpty(); }
+    const QString& getRenderFile() const { return m_renderFile; }
+    // The length of the render in seconds or 0 if unlimited
+    double getRenderLength() const { return m_renderLength; }
+    void setRenderFile(const QString& renderFile) {
+        m_renderFile = renderFile;
+    }
+    void setRenderLength(double renderLength) {
+        m_renderLength = renderLength;
+    }
 
   private:
     CmdlineArgs();
@@ -55,6 +65,8 @@ class CmdlineArgs final {
     QString m_resourcePath;
     QString m_pluginPath;
     QString m_timelinePath;
+    QString m_renderFile;
+    double m_renderLength;
 };
 
 #endif /* CMDLINEARGS_H */
@@ -1,5 +1,7 @@
 #include <QSqlDriver>
 #include <QSqlError>
+#include <QSqlQuery>
+#include <QThread>
 
 #ifdef __SQLITE3__
 #include <sqlite3.h>
@@ -11,6 +13,9 @@
 #include "util/memory.h"
 #include "util/logger.h"
 #include "util/assert.h"
+#include "util/math.h"
+#include "util/stat.h"
+#include "util/timer.h"
 
 
 // Originally from public domain code:
@@ -84,6 +89,18 @@ void makeLatinLow(QChar* c, int count) {
 
 const QChar kSqlLikeEscapeDefault = '\0';
 
+// The delays between retries while the database is locked by another
+// connection, similar to the default busy handler of SQLite. After the
+// last delay has been reached it is repeated until the timeout expires.
+const int kLockRetryDelaysMillis[] = { 1, 2, 5, 10, 15, 20, 25, 25, 25, 50, 50, 100 };
+const int kLockRetryDelayCount =
+        sizeof(kLockRetryDelaysMillis) / sizeof(kLockRetryDelaysMillis[0]);
+// Same as the default of the Qt SQLite driver
+const int kLockTimeoutMillis = 5000;
+
+const QString kLockWaitStatKey = QStringLiteral("DbConnection lock wait");
+const QString kLockTimeoutStatKey = QStringLiteral("DbConnection lock timeout");
+
 // Compare two strings for equality where the first string is
 // a "LIKE" expression. Return true (1) if they are the same and
 // false (0) if they are different.
@@ -226,9 +243,47 @@ void sqliteLike(sqlite3_context *context,
     return;
 }
 
+// Replaces the busy timeout of the Qt SQLite driver for reporting the
+// time spent waiting for locks that are held by other connections,
+// e.g. while the library scanner is writing.
+int sqliteBusyHandler(void* pArg, int retries) {
+    Q_UNUSED(pArg);
+    const int delayIndex = math_min(retries, kLockRetryDelayCount - 1);
+    int waitedMillis = 0;
+    for (int i = 0; i < delayIndex; ++i) {
+        waitedMillis += kLockRetryDelaysMillis[i];
+    }
+    waitedMillis += (retries - delayIndex) * kLockRetryDelaysMillis[delayIndex];
+    if (waitedMillis >= kLockTimeoutMillis) {
+        Stat::track(kLockTimeoutStatKey, Stat::UNSPECIFIED,
+                Stat::COUNT, 1.0);
+        return 0; // give up with SQLITE_BUSY
+    }
+    const int delayMillis = kLockRetryDelaysMillis[delayIndex];
+    QThread::msleep(delayMillis);
+    Stat::track(kLockWaitStatKey, Stat::DURATION_NANOSEC,
+            kDefaultComputeFlags,
+            mixxx::Duration::fromMillis(delayMillis).toIntegerNanos());
+    return 1; // retry
+}
+
 #endif // __SQLITE3__
 
-bool initDatabase(QSqlDatabase database, StringCollator* pCollator) {
+bool execPragma(QSqlDatabase database, const QString& pragma) {
+    QSqlQuery query(database);
+    if (!query.exec("PRAGMA " + pragma)) {
+        kLogger.warning()
+                << "Failed to execute PRAGMA" << pragma
+                << query.lastError();
+        return false;
+    }
+    return true;
+}
+
+bool initDatabase(
+        QSqlDatabase database,
+        StringCollator* pCollator,
+        DbConnection::AccessMode accessMode) {
     DEBUG_ASSERT(database.isOpen());
 #ifdef __SQLITE3__
     QVariant v = database.driver()->handle();
@@ -289,7 +344,25 @@ bool initDatabase(QSqlDatabase database, StringCollator* pCollator) {
                 << "Failed to install custom 3-arg LIKE function for SQLite3:"
                 << result;
     }
+
+    result = sqlite3_busy_handler(handle, sqliteBusyHandler, nullptr);
+    VERIFY_OR_DEBUG_ASSERT(result == SQLITE_OK) {
+        kLogger.warning()
+                << "Failed to install busy handler for SQLite3:"
+                << result;
+    }
+
+    // Readers don't block the writer and are not blocked by it in
+    // write-ahead logging mode. The mode is persistent, but is set for
+    // every connection to cover existing databases. In-memory databases
+    // silently keep their journal mode.
+    execPragma(database, "journal_mode = WAL");
+    // Sufficient for consistency in WAL mode and avoids a sync per commit
+    execPragma(database, "synchronous = NORMAL");
 #endif // __SQLITE3__
+    if (accessMode == DbConnection::AccessMode::ReadOnly) {
+        execPragma(database, "query_only = ON");
+    }
     return true;
 }
 
@@ -312,7 +385,7 @@ DbConnection::~DbConnection() {
     removeDatabase(&m_sqlDatabase);
 }
 
-bool DbConnection::open() {
+bool DbConnection::open(AccessMode accessMode) {
     if (kLogger.debugEnabled()) {
         kLogger.debug()
                 << "Opening database connection"
@@ -325,7 +398,7 @@ bool DbConnection::open() {
                 << m_sqlDatabase.lastError();
         return false; // abort
     }
-    if (!initDatabase(m_sqlDatabase, &m_collator)) {
+    if (!initDatabase(m_sqlDatabase, &m_collator, accessMode)) {
         kLogger.warning()
                 << "Failed to initialize database connection"
                 << *this;
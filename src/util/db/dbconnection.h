@@ -24,6 +24,12 @@ class DbConnection final {
 
     static void makeStringLatinLow(QString* string);
 
+    enum class AccessMode {
+        ReadWrite,
+        // Rejects all statements that modify the database
+        ReadOnly,
+    };
+
     struct Params {
         QString type;
         QString hostName;
@@ -45,7 +51,7 @@ class DbConnection final {
         return m_sqlDatabase.connectionName();
     }
 
-    bool open();
+    bool open(AccessMode accessMode = AccessMode::ReadWrite);
     void close();
 
     bool isOpen() const {
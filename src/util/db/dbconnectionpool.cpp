@@ -1,5 +1,6 @@
 #include "util/db/dbconnectionpool.h"
 
+#include "util/db/dbwritequeue.h"
 #include "util/logger.h"
 
 
@@ -11,7 +12,8 @@ const Logger kLogger("DbConnectionPool");
 
 } // anonymous namespace
 
-bool DbConnectionPool::createThreadLocalConnection() {
+bool DbConnectionPool::createThreadLocalConnection(
+        DbConnection::AccessMode accessMode) {
     VERIFY_OR_DEBUG_ASSERT(!m_threadLocalConnections.hasLocalData()) {
         DEBUG_ASSERT(m_threadLocalConnections.localData());
         kLogger.critical()
@@ -26,7 +28,7 @@ bool DbConnectionPool::createThreadLocalConnection() {
                     m_prototypeConnection.name(),
                     QString::number(connectionIndex));
     auto pConnection = std::make_unique<DbConnection>(m_prototypeConnection, indexedConnectionName);
-    if (!pConnection->open()) {
+    if (!pConnection->open(accessMode)) {
         kLogger.critical()
                 << "Failed to open thread-local database connection"
                 << *pConnection;
@@ -57,4 +59,19 @@ DbConnectionPool::DbConnectionPool(
       m_connectionCounter(0) {
 }
 
+DbConnectionPool::~DbConnectionPool() {
+    // Executes all pending write requests
+    m_pWriteQueue.reset();
+}
+
+DbWriteQueue* DbConnectionPool::writeQueue() {
+    QMutexLocker locker(&m_writeQueueMutex);
+    if (!m_pWriteQueue) {
+        m_pWriteQueue = std::make_unique<DbWriteQueue>(
+                m_prototypeConnection,
+                QString("%1-writer").arg(m_prototypeConnection.name()));
+    }
+    return m_pWriteQueue.get();
+}
+
 } // namespace mixxx
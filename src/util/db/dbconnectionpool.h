@@ -3,6 +3,7 @@
 
 
 #include <QAtomicInt>
+#include <QMutex>
 #include <QThreadStorage>
 
 #include "util/db/dbconnection.h"
@@ -13,6 +14,7 @@
 namespace mixxx {
 
 class DbConnectionPool;
+class DbWriteQueue;
 typedef std::shared_ptr<DbConnectionPool> DbConnectionPoolPtr;
 
 class DbConnectionPool final {
@@ -32,13 +34,23 @@ class DbConnectionPool final {
     DbConnectionPool(
             const DbConnection::Params& params,
             const QString& connectionName);
+    ~DbConnectionPool();
 
     // Prefer to use DbConnectionPooler instead of the
     // following functions. Only if there is no appropriate
     // scoping possible then use these functions directly.
-    bool createThreadLocalConnection();
+    bool createThreadLocalConnection(
+            DbConnection::AccessMode accessMode = DbConnection::AccessMode::ReadWrite);
     void destroyThreadLocalConnection();
 
+    // Returns the queue for executing write requests with the dedicated
+    // writer connection. Threads that only need to store their results
+    // should post them into this queue and use a read-only connection
+    // instead of competing for the write lock of the database. The queue
+    // is created on first use and executes all pending requests before
+    // the pool is destroyed.
+    DbWriteQueue* writeQueue();
+
   private:
     DbConnectionPool(const DbConnectionPool&) = delete;
     DbConnectionPool(const DbConnectionPool&&) = delete;
@@ -62,6 +74,8 @@ class DbConnectionPool final {
 
     QThreadStorage<DbConnection*> m_threadLocalConnections;
 
+    QMutex m_writeQueueMutex;
+    std::unique_ptr<DbWriteQueue> m_pWriteQueue;
 };
 
 } // namespace mixxx
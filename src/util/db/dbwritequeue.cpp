@@ -0,0 +1,127 @@
+#include "util/db/dbwritequeue.h"
+
+#include "util/assert.h"
+#include "util/logger.h"
+#include "util/stat.h"
+#include "util/timer.h"
+
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("DbWriteQueue");
+
+const QString kWaitStatKey = QStringLiteral("DbWriteQueue wait");
+const QString kPendingStatKey = QStringLiteral("DbWriteQueue pending");
+
+} // anonymous namespace
+
+DbWriteQueue::DbWriteQueue(
+        const DbConnection& prototypeConnection,
+        const QString& connectionName)
+    : m_prototypeConnection(prototypeConnection),
+      m_connectionName(connectionName),
+      m_connectionFailed(false),
+      m_quit(false) {
+    setObjectName("DbWriteQueue");
+    start();
+}
+
+DbWriteQueue::~DbWriteQueue() {
+    {
+        QMutexLocker locker(&m_mutex);
+        m_quit = true;
+        m_requestsPending.wakeAll();
+    }
+    wait();
+    DEBUG_ASSERT(m_pendingRequests.isEmpty());
+}
+
+void DbWriteQueue::post(Request request) {
+    enqueue(std::move(request), nullptr);
+}
+
+bool DbWriteQueue::execute(Request request) {
+    VERIFY_OR_DEBUG_ASSERT(QThread::currentThread() != this) {
+        // Requests must not wait for each other
+        return false;
+    }
+    Completion completion{false, false};
+    enqueue(std::move(request), &completion);
+    QMutexLocker locker(&m_mutex);
+    while (!completion.done) {
+        m_requestsExecuted.wait(&m_mutex);
+    }
+    return completion.result;
+}
+
+void DbWriteQueue::enqueue(Request request, Completion* pCompletion) {
+    PendingRequest pendingRequest{std::move(request), PerformanceTimer(), pCompletion};
+    pendingRequest.waitTimer.start();
+    QMutexLocker locker(&m_mutex);
+    if (m_connectionFailed) {
+        kLogger.warning()
+                << "Discarding request without a database connection";
+        if (pCompletion) {
+            pCompletion->done = true;
+        }
+        return;
+    }
+    m_pendingRequests.append(std::move(pendingRequest));
+    Stat::track(kPendingStatKey, Stat::UNSPECIFIED,
+            Stat::COUNT | Stat::AVERAGE | Stat::MAX,
+            m_pendingRequests.size());
+    m_requestsPending.wakeOne();
+}
+
+void DbWriteQueue::run() {
+    kLogger.debug() << "Entering thread";
+
+    DbConnection connection(m_prototypeConnection, m_connectionName);
+    const bool connected = connection.open();
+    if (!connected) {
+        kLogger.critical()
+                << "Failed to open writer database connection"
+                << connection;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    m_connectionFailed = !connected;
+    while (!m_quit || !m_pendingRequests.isEmpty()) {
+        if (m_pendingRequests.isEmpty()) {
+            m_requestsPending.wait(&m_mutex);
+            continue;
+        }
+        PendingRequest pendingRequest = m_pendingRequests.takeFirst();
+        locker.unlock();
+
+        Stat::track(kWaitStatKey, Stat::DURATION_NANOSEC,
+                kDefaultComputeFlags,
+                pendingRequest.waitTimer.elapsed().toIntegerNanos());
+        bool result = false;
+        if (connected) {
+            ScopedTimer t("DbWriteQueue execute");
+            result = pendingRequest.request(connection);
+        }
+        if (!result) {
+            kLogger.warning() << "Write request failed";
+        }
+        // Release all resources that have been captured by the request
+        // before signaling its completion
+        pendingRequest.request = Request();
+
+        locker.relock();
+        if (pendingRequest.pCompletion) {
+            pendingRequest.pCompletion->done = true;
+            pendingRequest.pCompletion->result = result;
+            m_requestsExecuted.wakeAll();
+        }
+    }
+    locker.unlock();
+
+    connection.close();
+    kLogger.debug() << "Exiting thread";
+}
+
+} // namespace mixxx
@@ -0,0 +1,79 @@
+#ifndef MIXXX_DBWRITEQUEUE_H
+#define MIXXX_DBWRITEQUEUE_H
+
+
+#include <QList>
+#include <QMutex>
+#include <QSqlDatabase>
+#include <QThread>
+#include <QWaitCondition>
+
+#include <functional>
+
+#include "util/db/dbconnection.h"
+#include "util/performancetimer.h"
+
+
+namespace mixxx {
+
+// Executes write requests one after another on a dedicated thread with
+// the single writer connection of a DbConnectionPool.
+//
+// SQLite allows only a single writer at a time. Connections that compete
+// for the write lock poll with increasing delays and may finally fail.
+// Requests in this queue are executed in order instead, and the time they
+// have been waiting is reported in the stats.
+//
+// Each request is responsible for its own transaction.
+class DbWriteQueue final : public QThread {
+    Q_OBJECT
+  public:
+    // Returns false if the request failed
+    typedef std::function<bool(QSqlDatabase)> Request;
+
+    DbWriteQueue(
+            const DbConnection& prototypeConnection,
+            const QString& connectionName);
+    // Executes all pending requests before returning
+    ~DbWriteQueue() override;
+
+    // Executes the request asynchronously
+    void post(Request request);
+
+    // Blocks until the request has been executed
+    bool execute(Request request);
+
+  protected:
+    void run() override;
+
+  private:
+    struct Completion {
+        bool done;
+        bool result;
+    };
+
+    struct PendingRequest {
+        Request request;
+        PerformanceTimer waitTimer;
+        // Only for requests that are waited for
+        Completion* pCompletion;
+    };
+
+    void enqueue(Request request, Completion* pCompletion);
+
+    const DbConnection& m_prototypeConnection;
+    const QString m_connectionName;
+
+    // Guards all following members
+    QMutex m_mutex;
+    QWaitCondition m_requestsPending;
+    QWaitCondition m_requestsExecuted;
+    QList<PendingRequest> m_pendingRequests;
+    bool m_connectionFailed;
+    bool m_quit;
+};
+
+} // namespace mixxx
+
+
+#endif // MIXXX_DBWRITEQUEUE_H
@@ -0,0 +1,248 @@
+#include "util/filecopy.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QObject>
+#include <QtGlobal>
+
+#ifdef __LINUX__
+extern "C" {
+    #include <errno.h>
+    #include <string.h>
+    #include <linux/fs.h>
+    #include <sys/ioctl.h>
+    #include <sys/sendfile.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+}
+#endif // __LINUX__
+
+#if !defined(__WINDOWS__) && QT_VERSION < QT_VERSION_CHECK(5, 10, 0)
+extern "C" {
+    #include <sys/stat.h>
+    #include <sys/time.h>
+}
+#endif
+
+#include "util/logger.h"
+#include "util/math.h"
+
+namespace {
+
+mixxx::Logger kLogger("FileCopy");
+
+// Large enough for keeping the overhead per chunk low and small enough
+// for reporting the progress and reacting on aborts within a fraction of
+// a second even for slow devices.
+const qint64 kChunkSize = 4 * 1024 * 1024;
+
+const qint64 kModificationTimeResolutionMillis = 2000;
+
+#ifdef __LINUX__
+
+QString systemErrorString(int error) {
+    return QString::fromLocal8Bit(strerror(error));
+}
+
+bool isUnsupported(int error) {
+    return error == ENOSYS || error == EXDEV || error == EINVAL ||
+            error == EOPNOTSUPP || error == ENOTSUP || error == EBADF;
+}
+
+// Returns the number of bytes that have been copied in the kernel,
+// starting at the offset in both files. Stops early if the kernel
+// doesn't support copying between the two files. Returns -1 on errors
+// or if aborted.
+qint64 copyInKernel(
+        int sourceFd,
+        int destFd,
+        qint64 offset,
+        qint64 size,
+        const FileCopy::ProgressCallback& progressCallback,
+        QString* pErrorString) {
+    loff_t sourceOffset = offset;
+    loff_t destOffset = offset;
+#ifdef SYS_copy_file_range
+    bool useCopyFileRange = true;
+#else
+    bool useCopyFileRange = false;
+#endif
+    bool useSendFile = true;
+    while (destOffset < size) {
+        const size_t chunkSize = static_cast<size_t>(
+                math_min<qint64>(size - destOffset, kChunkSize));
+        ssize_t copied;
+        if (useCopyFileRange) {
+#ifdef SYS_copy_file_range
+            copied = syscall(SYS_copy_file_range,
+                    sourceFd, &sourceOffset, destFd, &destOffset, chunkSize, 0u);
+#else
+            copied = -1;
+            errno = ENOSYS;
+#endif
+            if (copied < 0 && isUnsupported(errno)) {
+                useCopyFileRange = false;
+                continue;
+            }
+        } else if (useSendFile) {
+            // sendfile() writes at the current position of the destination
+            if (lseek(destFd, destOffset, SEEK_SET) != destOffset) {
+                *pErrorString = systemErrorString(errno);
+                return -1;
+            }
+            off_t sendFileOffset = sourceOffset;
+            copied = sendfile(destFd, sourceFd, &sendFileOffset, chunkSize);
+            sourceOffset = sendFileOffset;
+            if (copied < 0 && isUnsupported(errno)) {
+                useSendFile = false;
+                continue;
+            }
+            if (copied > 0) {
+                destOffset += copied;
+            }
+        } else {
+            break;
+        }
+        if (copied < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            *pErrorString = systemErrorString(errno);
+            return -1;
+        }
+        if (copied == 0) {
+            // The source file has been truncated meanwhile
+            break;
+        }
+        if (!progressCallback(copied)) {
+            *pErrorString = QObject::tr("Aborted");
+            return -1;
+        }
+    }
+    return destOffset - offset;
+}
+
+#endif // __LINUX__
+
+// The portable fallback
+bool copyBuffered(
+        QFile* pSourceFile,
+        QFile* pDestFile,
+        qint64 offset,
+        const FileCopy::ProgressCallback& progressCallback,
+        QString* pErrorString) {
+    if (!pSourceFile->seek(offset) || !pDestFile->seek(offset)) {
+        *pErrorString = pSourceFile->errorString();
+        return false;
+    }
+    QByteArray buffer(static_cast<int>(kChunkSize), Qt::Uninitialized);
+    while (true) {
+        const qint64 bytesRead = pSourceFile->read(buffer.data(), buffer.size());
+        if (bytesRead < 0) {
+            *pErrorString = pSourceFile->errorString();
+            return false;
+        }
+        if (bytesRead == 0) {
+            return true;
+        }
+        if (pDestFile->write(buffer.constData(), bytesRead) != bytesRead) {
+            *pErrorString = pDestFile->errorString();
+            return false;
+        }
+        if (!progressCallback(bytesRead)) {
+            *pErrorString = QObject::tr("Aborted");
+            return false;
+        }
+    }
+}
+
+} // anonymous namespace
+
+// static
+bool FileCopy::copyContents(
+        const QString& sourcePath,
+        const QString& destPath,
+        qint64 offset,
+        const ProgressCallback& progressCallback,
+        QString* pErrorString) {
+    // Unbuffered, because the kernel functions bypass QFile
+    QFile sourceFile(sourcePath);
+    if (!sourceFile.open(QIODevice::ReadOnly | QIODevice::Unbuffered)) {
+        *pErrorString = sourceFile.errorString();
+        return false;
+    }
+    QFile destFile(destPath);
+    if (!destFile.open(QIODevice::ReadWrite | QIODevice::Unbuffered) ||
+            !destFile.resize(offset)) {
+        *pErrorString = destFile.errorString();
+        return false;
+    }
+    const qint64 size = sourceFile.size();
+
+#ifdef __LINUX__
+    const int sourceFd = sourceFile.handle();
+    const int destFd = destFile.handle();
+#ifdef FICLONE
+    // Files on Btrfs and XFS share their extents until modified
+    if (offset == 0 && ioctl(destFd, FICLONE, sourceFd) == 0) {
+        kLogger.debug() << "Cloned" << sourcePath << "to" << destPath;
+        return progressCallback(size);
+    }
+#endif // FICLONE
+    const qint64 copied = copyInKernel(
+            sourceFd, destFd, offset, size, progressCallback, pErrorString);
+    if (copied < 0) {
+        return false;
+    }
+    offset += copied;
+    if (offset >= size) {
+        return true;
+    }
+#endif // __LINUX__
+
+    return copyBuffered(
+            &sourceFile, &destFile, offset, progressCallback, pErrorString);
+}
+
+// static
+bool FileCopy::copyModificationTime(
+        const QString& sourcePath,
+        const QString& destPath) {
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+    QFile destFile(destPath);
+    if (!destFile.open(QIODevice::ReadWrite)) {
+        return false;
+    }
+    return destFile.setFileTime(
+            QFileInfo(sourcePath).lastModified(),
+            QFileDevice::FileModificationTime);
+#elif !defined(__WINDOWS__)
+    struct stat sourceStat;
+    if (stat(QFile::encodeName(sourcePath).constData(), &sourceStat) != 0) {
+        return false;
+    }
+    struct timeval times[2];
+    times[0].tv_sec = sourceStat.st_atime;
+    times[0].tv_usec = 0;
+    times[1].tv_sec = sourceStat.st_mtime;
+    times[1].tv_usec = 0;
+    return utimes(QFile::encodeName(destPath).constData(), times) == 0;
+#else
+    Q_UNUSED(sourcePath);
+    Q_UNUSED(destPath);
+    return false;
+#endif
+}
+
+// static
+bool FileCopy::isSameSizeAndModificationTime(
+        const QFileInfo& sourceInfo,
+        const QFileInfo& destInfo) {
+    if (!sourceInfo.exists() || !destInfo.exists() ||
+            sourceInfo.size() != destInfo.size()) {
+        return false;
+    }
+    const qint64 diffMillis =
+            sourceInfo.lastModified().msecsTo(destInfo.lastModified());
+    return qAbs(diffMillis) < kModificationTimeResolutionMillis;
+}
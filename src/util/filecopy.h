@@ -0,0 +1,47 @@
+#ifndef MIXXX_UTIL_FILECOPY_H
+#define MIXXX_UTIL_FILECOPY_H
+
+#include <QFileInfo>
+#include <QString>
+
+#include <functional>
+
+// Copies files with the most efficient method that is supported by the
+// operating system and the file systems involved. On Linux the file is
+// cloned (reflink) if possible. Otherwise the data is copied in the kernel
+// with copy_file_range() or sendfile() without passing through user space.
+// Everywhere else and as the last resort the data is read and written in
+// large chunks.
+class FileCopy {
+  public:
+    // Receives the number of bytes that have been copied since the last
+    // invocation. Returning false aborts the copy.
+    typedef std::function<bool(qint64)> ProgressCallback;
+
+    // Copies the contents of the source file into the destination file,
+    // starting at the given offset in both files. The destination file is
+    // created if it doesn't exist and truncated to the offset otherwise,
+    // i.e. an offset > 0 continues an interrupted copy. Returns false if
+    // the copy failed or has been aborted and sets pErrorString.
+    static bool copyContents(
+            const QString& sourcePath,
+            const QString& destPath,
+            qint64 offset,
+            const ProgressCallback& progressCallback,
+            QString* pErrorString);
+
+    // Sets the modification time of the destination file to that of the
+    // source file.
+    static bool copyModificationTime(
+            const QString& sourcePath,
+            const QString& destPath);
+
+    // Returns true if both files have the same size and modification time.
+    // FAT file systems, e.g. on USB sticks, store the modification time
+    // with a resolution of only 2 seconds.
+    static bool isSameSizeAndModificationTime(
+            const QFileInfo& sourceInfo,
+            const QFileInfo& destInfo);
+};
+
+#endif // MIXXX_UTIL_FILECOPY_H
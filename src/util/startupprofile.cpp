@@ -0,0 +1,110 @@
+#include "util/startupprofile.h"
+
+#include <QFile>
+#include <QTextStream>
+
+#include "util/logger.h"
+#include "util/stat.h"
+#include "util/timer.h"
+
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("StartupProfile");
+
+const QString kStatKeyPrefix = QStringLiteral("MixxxMainWindow::startup ");
+
+} // anonymous namespace
+
+StartupProfile::StartupProfile()
+        : m_interactive(false) {
+    m_startupTimer.start();
+}
+
+void StartupProfile::beginPhase(const QString& name) {
+    endPhase();
+    m_currentPhase = name;
+    m_phaseTimer.start();
+}
+
+void StartupProfile::endPhase() {
+    if (m_currentPhase.isEmpty()) {
+        return;
+    }
+    m_phases.append(Phase{
+            m_currentPhase,
+            m_phaseTimer.elapsed(),
+            false,
+            m_interactive});
+    m_currentPhase.clear();
+}
+
+void StartupProfile::addConcurrentPhase(const QString& name, Duration duration) {
+    m_phases.append(Phase{
+            name,
+            duration,
+            true,
+            m_interactive});
+}
+
+void StartupProfile::markInteractive() {
+    if (m_interactive) {
+        return;
+    }
+    endPhase();
+    m_timeToInteractive = m_startupTimer.elapsed();
+    m_interactive = true;
+}
+
+void StartupProfile::finish(const QString& profileFilePath) {
+    endPhase();
+    const Duration total = m_startupTimer.elapsed();
+
+    QString profile;
+    QTextStream stream(&profile);
+    for (const auto& phase : m_phases) {
+        stream << QString::number(phase.duration.toDoubleMillis(), 'f', 1)
+               << " ms\t" << phase.name;
+        if (phase.concurrent) {
+            stream << " (concurrent)";
+        }
+        if (phase.deferred) {
+            stream << " (deferred)";
+        }
+        stream << '\n';
+        Stat::track(kStatKeyPrefix + phase.name,
+                Stat::DURATION_NANOSEC,
+                kDefaultComputeFlags,
+                phase.duration.toIntegerNanos());
+    }
+    stream << QString::number(m_timeToInteractive.toDoubleMillis(), 'f', 1)
+           << " ms\ttime to interactive\n";
+    stream << QString::number(total.toDoubleMillis(), 'f', 1)
+           << " ms\ttotal\n";
+    stream.flush();
+
+    kLogger.info()
+            << "Time to interactive:"
+            << m_timeToInteractive.debugMillisWithUnit()
+            << "- total startup time:"
+            << total.debugMillisWithUnit();
+    for (const auto& line : profile.split('\n', QString::SkipEmptyParts)) {
+        kLogger.debug() << line;
+    }
+
+    if (profileFilePath.isEmpty()) {
+        return;
+    }
+    QFile file(profileFilePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        kLogger.warning()
+                << "Failed to write startup profile"
+                << profileFilePath;
+        return;
+    }
+    file.write(profile.toUtf8());
+}
+
+} // namespace mixxx
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <QString>
+#include <QVector>
+
+#include "util/duration.h"
+#include "util/performancetimer.h"
+
+
+namespace mixxx {
+
+// Records the wall-clock time spent in each phase of application startup.
+//
+// Phases on the GUI thread are sequential: starting a new phase implicitly
+// ends the previous one. Steps that run concurrently on worker threads
+// measure their own duration and report it afterwards with
+// addConcurrentPhase(). The time-to-interactive is the time between
+// construction and markInteractive(), i.e. the first paint of the main
+// window. Everything recorded after that point is listed as deferred work.
+//
+// This class is not thread-safe and must only be used from the GUI thread.
+class StartupProfile final {
+  public:
+    StartupProfile();
+
+    // Ends the current phase (if any) and starts a new one.
+    void beginPhase(const QString& name);
+    // Ends the current phase (if any) without starting a new one.
+    void endPhase();
+
+    // Records a step that has been executed concurrently to the
+    // sequential phases, e.g. by a worker thread.
+    void addConcurrentPhase(const QString& name, Duration duration);
+
+    void markInteractive();
+    bool isInteractive() const {
+        return m_interactive;
+    }
+    Duration timeToInteractive() const {
+        return m_timeToInteractive;
+    }
+
+    // Logs all recorded phases, reports them to the StatsManager and
+    // writes them into a plain text profile file if a path is given.
+    void finish(const QString& profileFilePath = QString());
+
+  private:
+    struct Phase {
+        QString name;
+        Duration duration;
+        bool concurrent;
+        bool deferred;
+    };
+
+    PerformanceTimer m_startupTimer;
+    PerformanceTimer m_phaseTimer;
+    QString m_currentPhase;
+    QVector<Phase> m_phases;
+    bool m_interactive;
+    Duration m_timeToInteractive;
+};
+
+} // namespace mixxx
@@ -80,6 +80,17 @@ class ScopedTimer {
         }
     }
 
+    // For keys that have been built in advance, e.g. to avoid formatting
+    // them in the engine callback
+    explicit ScopedTimer(const QString& key,
+                Stat::ComputeFlags compute = kDefaultComputeFlags)
+            : m_pTimer(NULL),
+              m_cancel(false) {
+        if (CmdlineArgs::Instance().getDeveloper()) {
+            initialize(key, QString(), compute);
+        }
+    }
+
     virtual ~ScopedTimer() {
         if (m_pTimer) {
             if (!m_cancel) {
@@ -0,0 +1,142 @@
+#include "vinylcontrol/timecodelutcache.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QtDebug>
+
+#include <string.h>
+
+#include "util/assert.h"
+#include "util/version.h"
+
+namespace {
+
+const quint32 kLUTCacheMagic = 0x4d584c55; // "MXLU"
+// Must be incremented if xwax generates different lookup tables for the
+// same definitions
+const quint32 kLUTCacheVersion = 2;
+
+const slot_no_t kNoSlot = static_cast<slot_no_t>(-1);
+
+struct LUTCacheHeader {
+    quint32 magic;
+    quint32 version;
+    quint32 build;
+    quint32 slotSize;
+    quint32 hashBits;
+    quint32 bits;
+    quint32 seed;
+    quint32 taps;
+    quint32 length;
+    quint32 avail;
+};
+
+// Other builds may generate different tables, e.g. after changes of xwax
+// that did not increment kLUTCacheVersion
+quint32 buildHash() {
+    return qHash(Version::version() +
+            Version::developmentRevision() +
+            Version::applicationTitle());
+}
+
+LUTCacheHeader lutCacheHeader(const timecode_def& def) {
+    LUTCacheHeader header;
+    header.magic = kLUTCacheMagic;
+    header.version = kLUTCacheVersion;
+    header.build = buildHash();
+    header.slotSize = sizeof(struct slot);
+    header.hashBits = LUT_HASH_BITS;
+    header.bits = def.bits;
+    header.seed = def.seed;
+    header.taps = def.taps;
+    header.length = def.length;
+    header.avail = def.length;
+    return header;
+}
+
+// A corrupt file would make lut_lookup() read outside of the table or
+// follow the slots in a cycle
+bool isConsistent(const struct lut& lookupTable, unsigned int length) {
+    for (unsigned int slotNo = 0; slotNo < length; ++slotNo) {
+        // lut_push() chains each slot to a previous slot
+        const slot_no_t next = lookupTable.slot[slotNo].next;
+        if (next != kNoSlot && next >= slotNo) {
+            return false;
+        }
+    }
+    for (unsigned int hash = 0; hash < (1u << LUT_HASH_BITS); ++hash) {
+        const slot_no_t slotNo = lookupTable.table[hash];
+        if (slotNo != kNoSlot && slotNo >= length) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+// static
+QString TimecodeLUTCache::filePath(const UserSettingsPointer& pConfig, const char* timecode) {
+    return QDir(pConfig->getSettingsPath()).filePath(
+            QString("vinylcontrol/%1.lut").arg(timecode));
+}
+
+// static
+bool TimecodeLUTCache::read(timecode_def* def, const QString& filePath) {
+    DEBUG_ASSERT(!def->lookup);
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    const LUTCacheHeader expectedHeader = lutCacheHeader(*def);
+    LUTCacheHeader header;
+    if (file.read(reinterpret_cast<char*>(&header), sizeof(header)) != sizeof(header) ||
+            memcmp(&header, &expectedHeader, sizeof(header)) != 0) {
+        qWarning() << "Ignoring outdated timecode lookup table" << filePath;
+        return false;
+    }
+    if (lut_init(&def->lut, def->length) == -1) {
+        return false;
+    }
+    const qint64 slotBytes = sizeof(struct slot) * def->length;
+    const qint64 tableBytes = sizeof(slot_no_t) << LUT_HASH_BITS;
+    if (file.read(reinterpret_cast<char*>(def->lut.slot), slotBytes) != slotBytes ||
+            file.read(reinterpret_cast<char*>(def->lut.table), tableBytes) != tableBytes) {
+        qWarning() << "Failed to read timecode lookup table" << filePath;
+        lut_clear(&def->lut);
+        return false;
+    }
+    if (!isConsistent(def->lut, def->length)) {
+        qWarning() << "Ignoring corrupt timecode lookup table" << filePath;
+        lut_clear(&def->lut);
+        return false;
+    }
+    def->lut.avail = header.avail;
+    def->lookup = true;
+    return true;
+}
+
+// static
+bool TimecodeLUTCache::write(const timecode_def& def, const QString& filePath) {
+    DEBUG_ASSERT(def.lookup);
+    if (!QDir().mkpath(QFileInfo(filePath).absolutePath())) {
+        return false;
+    }
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    const LUTCacheHeader header = lutCacheHeader(def);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(def.lut.slot),
+            sizeof(struct slot) * def.length);
+    file.write(reinterpret_cast<const char*>(def.lut.table),
+            sizeof(slot_no_t) << LUT_HASH_BITS);
+    if (!file.commit()) {
+        qWarning() << "Failed to write timecode lookup table" << filePath;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,39 @@
+#ifndef TIMECODELUTCACHE_H
+#define TIMECODELUTCACHE_H
+
+#include <QString>
+
+#include "preferences/usersettings.h"
+
+#ifdef _MSC_VER
+#include "timecoder.h"
+#else
+extern "C" {
+#include "timecoder.h"
+}
+#endif
+
+// Caches the lookup tables of the xwax timecode definitions in the
+// settings directory, because generating them for every start is slow for
+// the long timecodes.
+//
+// The cache files are only read by the same build on the same machine and
+// therefore use the native byte order. The slot numbers are validated
+// after reading, because lut_lookup() follows them without any checks.
+class TimecodeLUTCache {
+  public:
+    static QString filePath(const UserSettingsPointer& pConfig, const char* timecode);
+
+    // Reads the lookup table of a definition that has not been built yet.
+    // Fails if the file has been written by a different build, for a
+    // different definition or if it is inconsistent.
+    static bool read(timecode_def* def, const QString& filePath);
+
+    // Either the complete file is written or none
+    static bool write(const timecode_def& def, const QString& filePath);
+
+  private:
+    TimecodeLUTCache() = delete;
+};
+
+#endif // TIMECODELUTCACHE_H
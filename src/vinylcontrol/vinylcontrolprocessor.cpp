@@ -5,7 +5,9 @@
 #include "control/controlpushbutton.h"
 #include "util/defs.h"
 #include "util/event.h"
+#include "util/stat.h"
 #include "util/sample.h"
+#include "util/time.h"
 #include "util/timer.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 #include "vinylcontrol/vinylcontrol.h"
@@ -14,89 +16,58 @@
 #define SIGNAL_QUALITY_FIFO_SIZE 256
 #define SAMPLE_PIPE_FIFO_SIZE 65536
 
-VinylControlProcessor::VinylControlProcessor(QObject* pParent, UserSettingsPointer pConfig)
-        : QThread(pParent),
-          m_pConfig(pConfig),
-          m_pToggle(new ControlPushButton(ConfigKey(VINYL_PREF_KEY, "Toggle"))),
+VinylControlLane::VinylControlLane(VinylControlProcessor* pProcessor, int index)
+        : m_pProcessor(pProcessor),
+          m_index(index),
+          m_samplePipe(SAMPLE_PIPE_FIFO_SIZE),
           m_pWorkBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
-          m_processorsLock(QMutex::Recursive),
-          m_processors(kMaximumVinylControlInputs, NULL),
-          m_signalQualityFifo(SIGNAL_QUALITY_FIFO_SIZE),
-          m_bReportSignalQuality(false),
+          m_pendingSinceNanos(0),
+          m_latencyStatKey(QString("VinylControlLane %1 latency").arg(index + 1)),
           m_bQuit(false),
           m_bReloadConfig(false) {
-    connect(m_pToggle, SIGNAL(valueChanged(double)),
-            this, SLOT(toggleDeck(double)),
-            Qt::DirectConnection);
-
-    for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
-        m_samplePipes[i] = new FIFO<CSAMPLE>(SAMPLE_PIPE_FIFO_SIZE);
-    }
-
-    start(QThread::HighPriority);
 }
 
-VinylControlProcessor::~VinylControlProcessor() {
-    m_bQuit = true;
-    m_samplesAvailableSignal.wakeAll();
+VinylControlLane::~VinylControlLane() {
+    shutdown();
     wait();
-
-    delete m_pToggle;
     SampleUtil::free(m_pWorkBuffer);
-
-    {
-        QMutexLocker locker(&m_processorsLock);
-        for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
-            VinylControl* pProcessor = m_processors.at(i);
-            m_processors[i] = NULL;
-            delete pProcessor;
-
-            delete m_samplePipes[i];
-            m_samplePipes[i] = NULL;
-        }
-    }
-
-    // xwax has a global LUT that we need to free after we've shut down our
-    // vinyl control threads because it's not thread-safe.
-    VinylControlXwax::freeLUTs();
 }
 
-void VinylControlProcessor::setSignalQualityReporting(bool enable) {
-    m_bReportSignalQuality = enable;
-}
-
-void VinylControlProcessor::shutdown() {
+void VinylControlLane::shutdown() {
     m_bQuit = true;
-    m_samplesAvailableSignal.wakeAll();
+    wake();
 }
 
-void VinylControlProcessor::requestReloadConfig() {
+void VinylControlLane::requestReloadConfig() {
     m_bReloadConfig = true;
+    wake();
+}
+
+void VinylControlLane::wake() {
     m_samplesAvailableSignal.wakeAll();
 }
 
-void VinylControlProcessor::run() {
-    unsigned static id = 0; //the id of this thread, for debugging purposes //XXX copypasta (should factor this out somehow), -kousu 2/2009
-    QThread::currentThread()->setObjectName(QString("VinylControlProcessor %1").arg(++id));
+void VinylControlLane::run() {
+    QThread::currentThread()->setObjectName(
+            QString("VinylControlLane %1").arg(m_index + 1));
+    const QString tag = QString("VinylControlLane %1").arg(m_index + 1);
 
     while (!m_bQuit) {
-        Event::start("VinylControlProcessor");
+        Event::start(tag);
         if (m_bReloadConfig) {
-            reloadConfig();
             m_bReloadConfig = false;
+            m_pProcessor->reloadConfig(m_index);
         }
 
-        for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
-            QMutexLocker locker(&m_processorsLock);
-            VinylControl* pProcessor = m_processors[i];
-            locker.unlock();
-            FIFO<CSAMPLE>* pSamplePipe = m_samplePipes[i];
+        VinylControl* pProcessor = m_pProcessor->getProcessor(m_index);
 
-            if (pSamplePipe->readAvailable() > 0) {
-                int samplesRead = pSamplePipe->read(m_pWorkBuffer, MAX_BUFFER_LEN);
+        if (m_samplePipe.readAvailable() > 0) {
+            const qint64 pendingSinceNanos = m_pendingSinceNanos.exchange(0);
+            while (m_samplePipe.readAvailable() > 0) {
+                int samplesRead = m_samplePipe.read(m_pWorkBuffer, MAX_BUFFER_LEN);
 
                 if (samplesRead % 2 != 0) {
-                    qWarning() << "VinylControlProcessor received non-even number of samples via sample FIFO.";
+                    qWarning() << "VinylControlLane received non-even number of samples via sample FIFO.";
                     samplesRead--;
                 }
                 int framesRead = samplesRead / 2;
@@ -105,54 +76,155 @@ void VinylControlProcessor::run() {
                     pProcessor->analyzeSamples(m_pWorkBuffer, framesRead);
                 } else {
                     // Samples are being written to a non-existent processor. Warning?
-                    qWarning() << "Samples written to non-existent VinylControl processor:" << i;
+                    qWarning() << "Samples written to non-existent VinylControl processor:" << m_index;
                 }
             }
-
-            // TODO(rryan) define a time-based update rate. This will update way
-            // too quickly.
-            if (pProcessor && m_bReportSignalQuality) {
-                VinylSignalQualityReport report;
-                if (pProcessor->writeQualityReport(&report)) {
-                    report.processor = i;
-                    if (m_signalQualityFifo.write(&report, 1) != 1) {
-                        qWarning() << "VinylControlProcessor could not write signal quality report for VC index:" << i;
-                    }
-                }
+            // The time from receiving the input buffer until the pitch and
+            // position have been updated
+            if (pProcessor && pendingSinceNanos > 0) {
+                Stat::track(m_latencyStatKey, Stat::DURATION_NANOSEC,
+                        Stat::AVERAGE | Stat::MAX | Stat::SAMPLE_VARIANCE,
+                        mixxx::Time::elapsed().toIntegerNanos() - pendingSinceNanos);
             }
         }
 
+        // TODO(rryan) define a time-based update rate. This will update way
+        // too quickly.
+        if (pProcessor) {
+            m_pProcessor->reportSignalQuality(m_index, pProcessor);
+        }
+
         if (m_bQuit) {
             break;
         }
 
         // Wait for a signal from the main thread or engine thread that we
         // should wake up and process input.
-        Event::end("VinylControlProcessor");
+        Event::end(tag);
         m_waitForSampleMutex.lock();
-        m_samplesAvailableSignal.wait(&m_waitForSampleMutex);
+        if (!m_bQuit && !m_bReloadConfig && m_samplePipe.readAvailable() == 0) {
+            m_samplesAvailableSignal.wait(&m_waitForSampleMutex);
+        }
         m_waitForSampleMutex.unlock();
     }
 }
 
-void VinylControlProcessor::reloadConfig() {
+void VinylControlLane::receiveBuffer(const CSAMPLE* pBuffer, unsigned int nFrames) {
+    const int kChannels = 2;
+    const int nSamples = nFrames * kChannels;
+    int samplesWritten = m_samplePipe.write(pBuffer, nSamples);
+
+    if (samplesWritten < nSamples) {
+        qWarning() << "ERROR: Buffer overflow in VinylControlProcessor. Dropping samples on the floor."
+                   << "VCIndex:" << m_index;
+    }
+
+    qint64 expected = 0;
+    m_pendingSinceNanos.compare_exchange_strong(
+            expected, mixxx::Time::elapsed().toIntegerNanos());
+
+    wake();
+}
+
+VinylControlProcessor::VinylControlProcessor(QObject* pParent, UserSettingsPointer pConfig)
+        : QObject(pParent),
+          m_pConfig(pConfig),
+          m_pToggle(new ControlPushButton(ConfigKey(VINYL_PREF_KEY, "Toggle"))),
+          m_processorsLock(QMutex::Recursive),
+          m_processors(kMaximumVinylControlInputs, NULL),
+          m_signalQualityFifo(SIGNAL_QUALITY_FIFO_SIZE),
+          m_bReportSignalQuality(false) {
+    connect(m_pToggle, SIGNAL(valueChanged(double)),
+            this, SLOT(toggleDeck(double)),
+            Qt::DirectConnection);
+
+    for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
+        m_lanes[i] = new VinylControlLane(this, i);
+        m_lanes[i]->start(QThread::HighPriority);
+    }
+}
+
+VinylControlProcessor::~VinylControlProcessor() {
+    // Stop all lanes before deleting any of them
+    shutdown();
     for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
+        delete m_lanes[i];
+        m_lanes[i] = NULL;
+    }
+
+    delete m_pToggle;
+
+    {
         QMutexLocker locker(&m_processorsLock);
-        VinylControl* pCurrent = m_processors[i];
+        for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
+            VinylControl* pProcessor = m_processors.at(i);
+            m_processors[i] = NULL;
+            delete pProcessor;
+        }
+    }
+
+    // xwax has a global LUT that we need to free after we've shut down our
+    // vinyl control threads because it's not thread-safe.
+    VinylControlXwax::freeLUTs();
+}
 
-        if (pCurrent == NULL) {
-            continue;
+void VinylControlProcessor::setSignalQualityReporting(bool enable) {
+    m_bReportSignalQuality = enable;
+}
+
+void VinylControlProcessor::shutdown() {
+    for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
+        if (m_lanes[i]) {
+            m_lanes[i]->shutdown();
         }
+    }
+}
 
-        VinylControl *pNew = new VinylControlXwax(
-            m_pConfig, kVCGroup.arg(i + 1));
-        m_processors.replace(i, pNew);
-        locker.unlock();
-        // Delete outside of the critical section to avoid deadlocks.
-        delete pCurrent;
+void VinylControlProcessor::requestReloadConfig() {
+    for (int i = 0; i < kMaximumVinylControlInputs; ++i) {
+        m_lanes[i]->requestReloadConfig();
     }
 }
 
+VinylControl* VinylControlProcessor::getProcessor(int index) {
+    QMutexLocker locker(&m_processorsLock);
+    return m_processors[index];
+}
+
+void VinylControlProcessor::reportSignalQuality(int index, VinylControl* pProcessor) {
+    if (!m_bReportSignalQuality) {
+        return;
+    }
+    VinylSignalQualityReport report;
+    if (pProcessor->writeQualityReport(&report)) {
+        report.processor = index;
+        // The FIFO has a single reader but is written by all lanes
+        QMutexLocker locker(&m_signalQualityFifoMutex);
+        if (m_signalQualityFifo.write(&report, 1) != 1) {
+            qWarning() << "VinylControlProcessor could not write signal quality report for VC index:" << index;
+        }
+    }
+}
+
+VinylControl* VinylControlProcessor::newVinylControl(int index) {
+    return new VinylControlXwax(m_pConfig, kVCGroup.arg(index + 1));
+}
+
+void VinylControlProcessor::reloadConfig(int index) {
+    QMutexLocker locker(&m_processorsLock);
+    VinylControl* pCurrent = m_processors[index];
+
+    if (pCurrent == NULL) {
+        return;
+    }
+
+    VinylControl* pNew = newVinylControl(index);
+    m_processors.replace(index, pNew);
+    locker.unlock();
+    // Delete outside of the critical section to avoid deadlocks.
+    delete pCurrent;
+}
+
 void VinylControlProcessor::onInputConfigured(AudioInput input) {
     if (input.getType() != AudioInput::VINYLCONTROL) {
         qDebug() << "WARNING: AudioInput type is not VINYLCONTROL. Ignoring.";
@@ -166,8 +238,7 @@ void VinylControlProcessor::onInputConfigured(AudioInput input) {
         return;
     }
 
-    VinylControl *pNew = new VinylControlXwax(
-        m_pConfig, kVCGroup.arg(index + 1));
+    VinylControl* pNew = newVinylControl(index);
 
     QMutexLocker locker(&m_processorsLock);
     VinylControl* pCurrent = m_processors.at(index);
@@ -219,23 +290,7 @@ void VinylControlProcessor::receiveBuffer(AudioInput input,
         return;
     }
 
-    FIFO<CSAMPLE>* pSamplePipe = m_samplePipes[vcIndex];
-
-    if (pSamplePipe == NULL) {
-        // Should not be possible.
-        return;
-    }
-
-    const int kChannels = 2;
-    const int nSamples = nFrames * kChannels;
-    int samplesWritten = pSamplePipe->write(pBuffer, nSamples);
-
-    if (samplesWritten < nSamples) {
-        qWarning() << "ERROR: Buffer overflow in VinylControlProcessor. Dropping samples on the floor."
-                   << "VCIndex:" << vcIndex;
-    }
-
-    m_samplesAvailableSignal.wakeAll();
+    m_lanes[vcIndex]->receiveBuffer(pBuffer, nFrames);
 }
 
 void VinylControlProcessor::toggleDeck(double value) {
@@ -7,19 +7,59 @@
 #include <QMutex>
 #include <QWaitCondition>
 
+#include <atomic>
+
 #include "preferences/usersettings.h"
 #include "util/fifo.h"
 #include "vinylcontrol/vinylsignalquality.h"
 #include "soundio/soundmanagerutil.h"
 
 class VinylControl;
+class VinylControlProcessor;
 class ControlPushButton;
 
-// VinylControlProcessor is a thread that is in charge of receiving samples from
-// the engine callback and feeding those samples to the VinylControl
-// classes. The most important thing is that the connection between the engine
-// callback and VinylControlProcessor (the receiveBuffer method) is lock-free.
-class VinylControlProcessor : public QThread, public AudioDestination {
+// A thread that feeds the samples of a single vinyl control input to its
+// VinylControl. Each input has its own lane, so that the timecodes of
+// multiple decks are decoded concurrently.
+class VinylControlLane : public QThread {
+  public:
+    VinylControlLane(VinylControlProcessor* pProcessor, int index);
+    ~VinylControlLane() override;
+
+    // Called from the main thread.
+    void shutdown();
+    void requestReloadConfig();
+
+    // Called by the engine callback. Lock-free except for waking up the
+    // lane.
+    void receiveBuffer(const CSAMPLE* pBuffer, unsigned int iNumFrames);
+
+  protected:
+    void run() override;
+
+  private:
+    void wake();
+
+    VinylControlProcessor* const m_pProcessor;
+    const int m_index;
+    FIFO<CSAMPLE> m_samplePipe;
+    CSAMPLE* m_pWorkBuffer;
+    // The time when the oldest samples in m_samplePipe have been received
+    // or 0 if the pipe has been drained.
+    std::atomic<qint64> m_pendingSinceNanos;
+    const QString m_latencyStatKey;
+    QWaitCondition m_samplesAvailableSignal;
+    QMutex m_waitForSampleMutex;
+    volatile bool m_bQuit;
+    volatile bool m_bReloadConfig;
+};
+
+// VinylControlProcessor is in charge of receiving samples from the engine
+// callback and feeding those samples to the VinylControl classes. Each
+// input is processed by a separate VinylControlLane thread. The most
+// important thing is that the connection between the engine callback and
+// the lanes (the receiveBuffer method) is lock-free.
+class VinylControlProcessor : public QObject, public AudioDestination {
     Q_OBJECT
   public:
     VinylControlProcessor(QObject* pParent, UserSettingsPointer pConfig);
@@ -28,10 +68,11 @@ class VinylControlProcessor : public QThread, public AudioDestination {
     // Called from main thread. Must only touch m_bReportSignalQuality.
     void setSignalQualityReporting(bool enable);
 
-    // Called from the main thread. Must only touch m_bQuit;
+    // Called from the main thread. Stops all lanes.
     void shutdown();
 
-    // Called from the main thread. Must only touch m_bReload;
+    // Called from the main thread. Each lane reloads the configuration of
+    // its VinylControl in its own thread.
     void requestReloadConfig();
 
     bool deckConfigured(int index) const;
@@ -45,7 +86,7 @@ class VinylControlProcessor : public QThread, public AudioDestination {
     virtual void onInputUnconfigured(AudioInput input);
 
     // Called by the engine callback. Must not touch any state in
-    // VinylControlProcessor except for m_samplePipes. NOTE:
+    // VinylControlProcessor except for m_lanes. NOTE:
 
     // This is called by SoundManager whenever there are new samples from the
     // configured input to be processed. This is run in the callback thread of
@@ -57,29 +98,30 @@ class VinylControlProcessor : public QThread, public AudioDestination {
                        unsigned int iNumFrames);
 
   protected:
-    void run();
+    // Called from the main thread and the lanes
+    virtual VinylControl* newVinylControl(int index);
 
   private slots:
     void toggleDeck(double value);
 
   private:
-    void reloadConfig();
+    friend class VinylControlLane;
+
+    // Called from the lanes.
+    VinylControl* getProcessor(int index);
+    void reloadConfig(int index);
+    void reportSignalQuality(int index, VinylControl* pProcessor);
 
     UserSettingsPointer m_pConfig;
     ControlPushButton* m_pToggle;
-    // A pre-allocated array of FIFOs for writing samples from the engine
-    // callback to the processor thread. There is a maximum of
-    // kMaximumVinylControlInputs pipes.
-    FIFO<CSAMPLE>* m_samplePipes[kMaximumVinylControlInputs];
-    CSAMPLE* m_pWorkBuffer;
-    QWaitCondition m_samplesAvailableSignal;
-    QMutex m_waitForSampleMutex;
+    // A lane for each of the kMaximumVinylControlInputs inputs
+    VinylControlLane* m_lanes[kMaximumVinylControlInputs];
     QMutex m_processorsLock;
     QVector<VinylControl*> m_processors;
+    // Written by all lanes
+    QMutex m_signalQualityFifoMutex;
     FIFO<VinylSignalQualityReport> m_signalQualityFifo;
     volatile bool m_bReportSignalQuality;
-    volatile bool m_bQuit;
-    volatile bool m_bReloadConfig;
 };
 
 
@@ -23,6 +23,7 @@
 #include <limits.h>
 
 #include "vinylcontrol/vinylcontrolxwax.h"
+#include "vinylcontrol/timecodelutcache.h"
 #include "util/timer.h"
 #include "control/controlproxy.h"
 #include "control/controlobject.h"
@@ -41,6 +42,30 @@
 // Sample threshold below which we consider there to be no signal.
 const double kMinSignal = 75.0 / SAMPLE_MAX;
 
+namespace {
+
+// Finds the definition of the timecode with a lookup table that has
+// either been read from the cache or generated. Must only be called
+// while holding s_xwaxLUTMutex.
+timecode_def* findTimecodeDefinition(
+        const UserSettingsPointer& pConfig, const char* timecode) {
+    timecode_def* def = timecoder_find_definition_unbuilt(timecode);
+    if (def == NULL || def->lookup) {
+        return def;
+    }
+    const QString filePath = TimecodeLUTCache::filePath(pConfig, timecode);
+    if (TimecodeLUTCache::read(def, filePath)) {
+        return def;
+    }
+    def = timecoder_find_definition(timecode);
+    if (def != NULL) {
+        TimecodeLUTCache::write(*def, filePath);
+    }
+    return def;
+}
+
+} // anonymous namespace
+
 bool VinylControlXwax::s_bLUTInitialized = false;
 QMutex VinylControlXwax::s_xwaxLUTMutex;
 
@@ -122,12 +147,6 @@ VinylControlXwax::VinylControlXwax(UserSettingsPointer pConfig, QString group)
     }
 
 
-    timecode_def* tc_def = timecoder_find_definition(timecode);
-    if (tc_def == NULL) {
-        qDebug() << "Error finding timecode definition for " << timecode << ", defaulting to serato_2a";
-        timecode = (char*)"serato_2a";
-        tc_def = timecoder_find_definition(timecode);
-    }
 
     double speed = 1.0;
     double rpm = 100.0 / 3.0;
@@ -158,6 +177,13 @@ VinylControlXwax::VinylControlXwax(UserSettingsPointer pConfig, QString group)
     // do this once across the VinylControlXwax instances.
     s_xwaxLUTMutex.lock();
 
+    timecode_def* tc_def = findTimecodeDefinition(m_pConfig, timecode);
+    if (tc_def == NULL) {
+        qDebug() << "Error finding timecode definition for " << timecode << ", defaulting to serato_2a";
+        timecode = (char*)"serato_2a";
+        tc_def = findTimecodeDefinition(m_pConfig, timecode);
+    }
+
     timecoder_init(&timecoder, tc_def, speed, iSampleRate, /* phono */ false);
     timecoder_monitor_init(&timecoder, MIXXX_VINYL_SCOPE_SIZE);
     //Note that timecoder_init will not double-malloc the LUTs, and after this we are guaranteed
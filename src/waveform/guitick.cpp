@@ -1,6 +1,7 @@
 #include <QTimer>
 
 #include "waveform/guitick.h"
+#include "control/controlnotifier.h"
 #include "control/controlobject.h"
 
 GuiTick::GuiTick() {
@@ -12,6 +13,10 @@ GuiTick::GuiTick() {
 // this is called from WaveformWidgetFactory::render in the main thread with the
 // configured waveform frame rate
 void GuiTick::process() {
+    // Deliver the control changes of the engine before the widgets that
+    // are driven by the tick are updated.
+    ControlNotifier::deliverChanges();
+
     m_cpuTimeLastTick += m_cpuTimer.restart();
     double cpuTimeLastTickSeconds = m_cpuTimeLastTick.toDoubleSeconds();
     m_pCOGuiTickTime->set(cpuTimeLastTickSeconds);
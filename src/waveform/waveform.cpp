@@ -1,11 +1,52 @@
 #include <QtDebug>
+#include <QtEndian>
+
+#include <cstring>
 
 #include "waveform/waveform.h"
 #include "proto/waveform.pb.h"
 
 using namespace mixxx::track;
 
-const int kNumChannels = 2;
+namespace {
+
+// The compact format consists of a fixed size header followed by the
+// interleaved low, mid, high and all bytes of each WaveformData. All header
+// fields are little endian:
+//   0  magic "MXWF"
+//   4  quint32 version
+//   8  quint32 flags
+//   12 quint32 data size, i.e. the number of WaveformData
+//   16 double visual sample rate
+//   24 double audio visual ratio
+// The payload is compressed with qCompress() if kCompactFlagCompressed is set.
+// Otherwise it is copied into the Waveform as is.
+const char kCompactMagic[4] = {'M', 'X', 'W', 'F'};
+const quint32 kCompactVersion = 1;
+const int kCompactHeaderSize = 32;
+const quint32 kCompactFlagCompressed = 0x1;
+// Rejects corrupt headers before allocating memory. This is far beyond the
+// size of the waveform of a 24 h track.
+const int kMaxCompactDataSize = 256 * 1024 * 1024;
+
+// Compression level used for the compressed payload. The default level
+// compresses the big waveform to about half of its size. Higher levels
+// hardly make a difference.
+const int kCompressionLevel = -1;
+
+quint64 doubleToBits(double value) {
+    quint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double bitsToDouble(quint64 bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // anonymous namespace
 
 // Return the smallest power of 2 which is greater than the desired size when
 // squared.
@@ -19,7 +60,7 @@ int computeTextureStride(int size) {
 
 Waveform::Waveform(const QByteArray data)
         : m_id(-1),
-          m_saveState(SaveState::NotSaved),
+          m_saveState(static_cast<int>(SaveState::NotSaved)),
           m_dataSize(0),
           m_visualSampleRate(0),
           m_audioVisualRatio(0),
@@ -31,7 +72,7 @@ Waveform::Waveform(const QByteArray data)
 Waveform::Waveform(int audioSampleRate, int audioSamples,
                    int desiredVisualSampleRate, int maxVisualSamples)
         : m_id(-1),
-          m_saveState(SaveState::NotSaved),
+          m_saveState(static_cast<int>(SaveState::NotSaved)),
           m_dataSize(0),
           m_visualSampleRate(0),
           m_audioVisualRatio(0),
@@ -67,70 +108,97 @@ Waveform::Waveform(int audioSampleRate, int audioSamples,
 Waveform::~Waveform() {
 }
 
-QByteArray Waveform::toByteArray() const {
-    io::Waveform waveform;
-    waveform.set_visual_sample_rate(m_visualSampleRate);
-    waveform.set_audio_visual_ratio(m_audioVisualRatio);
-
-    io::Waveform::Signal* all = waveform.mutable_signal_all();
-    io::Waveform::FilteredSignal* filtered = waveform.mutable_signal_filtered();
-    // TODO(rryan) get the actual cutoff values from analyzerwaveform.cpp so
-    // that if they change we don't have to remember to update these.
-
-    // Frequency cutoffs for butterworth filters:
-    // filtered->set_low_cutoff_frequency(200);
-    // filtered->set_mid_low_cutoff_frequency(200);
-    // filtered->set_mid_high_cutoff_frequency(2000);
-    // filtered->set_high_cutoff_frequency(2000);
-
-    // Frequency cutoff for bessel_lowpass4
-    filtered->set_low_cutoff_frequency(600);
-    // Frequency cutoff for bessel_bandpass
-    filtered->set_mid_low_cutoff_frequency(600);
-    filtered->set_mid_high_cutoff_frequency(4000);
-    // Frequency cutoff for bessel_highpass4
-    filtered->set_high_cutoff_frequency(4000);
-
-    io::Waveform::Signal* low = filtered->mutable_low();
-    io::Waveform::Signal* mid = filtered->mutable_mid();
-    io::Waveform::Signal* high = filtered->mutable_high();
-
-    // TODO(vrince) set max/min for each signal
-    int numChannels = kNumChannels;
-    all->set_units(io::Waveform::RMS);
-    all->set_channels(numChannels);
-    low->set_units(io::Waveform::RMS);
-    low->set_channels(numChannels);
-    mid->set_units(io::Waveform::RMS);
-    mid->set_channels(numChannels);
-    high->set_units(io::Waveform::RMS);
-    high->set_channels(numChannels);
-
-    int dataSize = getDataSize();
-    for (int i = 0; i < dataSize; ++i) {
-        const WaveformData& datum = m_data.at(i);
-        all->add_value(datum.filtered.all);
-        low->add_value(datum.filtered.low);
-        mid->add_value(datum.filtered.mid);
-        high->add_value(datum.filtered.high);
+QByteArray Waveform::toByteArray(bool compress) const {
+    const int dataSize = getDataSize();
+    // WaveformData consists of bytes only, so its memory layout does not
+    // depend on the byte order of the host.
+    QByteArray payload(reinterpret_cast<const char*>(m_data.data()),
+            dataSize * sizeof(WaveformData));
+    quint32 flags = 0;
+    if (compress) {
+        payload = qCompress(payload, kCompressionLevel);
+        flags |= kCompactFlagCompressed;
     }
 
-    qDebug() << "Writing waveform from byte array:"
+    QByteArray data(kCompactHeaderSize, '\0');
+    uchar* pHeader = reinterpret_cast<uchar*>(data.data());
+    memcpy(pHeader, kCompactMagic, sizeof(kCompactMagic));
+    qToLittleEndian<quint32>(kCompactVersion, pHeader + 4);
+    qToLittleEndian<quint32>(flags, pHeader + 8);
+    qToLittleEndian<quint32>(dataSize, pHeader + 12);
+    qToLittleEndian<quint64>(doubleToBits(m_visualSampleRate), pHeader + 16);
+    qToLittleEndian<quint64>(doubleToBits(m_audioVisualRatio), pHeader + 24);
+    data.append(payload);
+
+    qDebug() << "Writing waveform to byte array:"
              << "dataSize" << dataSize
-             << "allSignalSize" << all->value_size()
-             << "visualSampleRate" << waveform.visual_sample_rate()
-             << "audioVisualRatio" << waveform.audio_visual_ratio();
+             << "compressed" << compress
+             << "visualSampleRate" << m_visualSampleRate
+             << "audioVisualRatio" << m_audioVisualRatio;
+    return data;
+}
 
-    std::string output;
-    waveform.SerializeToString(&output);
-    return QByteArray(output.data(), output.length());
+// static
+bool Waveform::isCompactFormat(const QByteArray& data) {
+    return data.size() >= kCompactHeaderSize &&
+            memcmp(data.constData(), kCompactMagic, sizeof(kCompactMagic)) == 0;
 }
 
 void Waveform::readByteArray(const QByteArray& data) {
     if (data.isNull()) {
         return;
     }
+    if (isCompactFormat(data)) {
+        readCompactByteArray(data);
+    } else {
+        readProtobufByteArray(data);
+    }
+}
+
+void Waveform::readCompactByteArray(const QByteArray& data) {
+    const uchar* pHeader = reinterpret_cast<const uchar*>(data.constData());
+    const quint32 version = qFromLittleEndian<quint32>(pHeader + 4);
+    const quint32 flags = qFromLittleEndian<quint32>(pHeader + 8);
+    const quint32 dataSize = qFromLittleEndian<quint32>(pHeader + 12);
+    const double visualSampleRate = bitsToDouble(
+            qFromLittleEndian<quint64>(pHeader + 16));
+    const double audioVisualRatio = bitsToDouble(
+            qFromLittleEndian<quint64>(pHeader + 24));
+    if (version != kCompactVersion || (flags & ~kCompactFlagCompressed) != 0) {
+        qDebug() << "ERROR: Unsupported compact waveform version" << version
+                 << "flags" << flags;
+        return;
+    }
+    if (dataSize > static_cast<quint32>(kMaxCompactDataSize) ||
+            visualSampleRate <= 0 || audioVisualRatio <= 0) {
+        qDebug() << "ERROR: Invalid compact waveform header";
+        return;
+    }
+
+    const char* pPayload = data.constData() + kCompactHeaderSize;
+    int payloadSize = data.size() - kCompactHeaderSize;
+    QByteArray uncompressedPayload;
+    if (flags & kCompactFlagCompressed) {
+        uncompressedPayload = qUncompress(
+                reinterpret_cast<const uchar*>(pPayload), payloadSize);
+        pPayload = uncompressedPayload.constData();
+        payloadSize = uncompressedPayload.size();
+    }
+    if (payloadSize != static_cast<int>(dataSize * sizeof(WaveformData))) {
+        qDebug() << "ERROR: Compact waveform payload has size" << payloadSize
+                 << "instead of" << dataSize * sizeof(WaveformData);
+        return;
+    }
+
+    resize(dataSize);
+    memcpy(m_data.data(), pPayload, payloadSize);
+    m_visualSampleRate = visualSampleRate;
+    m_audioVisualRatio = audioVisualRatio;
+    m_completion = dataSize;
+    setSaveState(SaveState::Saved);
+}
 
+void Waveform::readProtobufByteArray(const QByteArray& data) {
     io::Waveform waveform;
 
     if (!waveform.ParseFromArray(data.constData(), data.size())) {
@@ -167,7 +235,7 @@ void Waveform::readByteArray(const QByteArray& data) {
         qDebug() << "ERROR: Couldn't resize Waveform to" << all.value_size()
                  << "while reading.";
         resize(0);
-        m_saveState = SaveState::NotSaved;
+        setSaveState(SaveState::NotSaved);
         return;
     }
 
@@ -194,7 +262,9 @@ void Waveform::readByteArray(const QByteArray& data) {
         m_data[i].filtered.high = use_high ? static_cast<unsigned char>(high.value(i)) : 0;
     }
     m_completion = dataSize;
-    m_saveState = SaveState::Saved;
+    // Waveforms in the obsolete protobuf format are converted lazily by
+    // saving them again together with their track.
+    setSaveState(SaveState::SavePending);
 }
 
 void Waveform::resize(int size) {
@@ -207,7 +277,7 @@ void Waveform::assign(int size, int value) {
     m_dataSize = size;
     m_textureStride = computeTextureStride(size);
     m_data.assign(m_textureStride * m_textureStride, value);
-    m_saveState = SaveState::SavePending;
+    setSaveState(SaveState::SavePending);
 }
 
 void Waveform::dump() const {
@@ -33,6 +33,9 @@ class Waveform {
     enum class SaveState {
         NotSaved = 0,
         SavePending, 
+        // Claimed for saving by a single writer, e.g. while waiting in the
+        // database write queue
+        SaveQueued,
         Saved
     };
 
@@ -72,7 +75,14 @@ class Waveform {
         m_description = description;
     }
 
-    QByteArray toByteArray() const;
+    // Serializes the waveform in the compact binary format. The payload is
+    // optionally compressed, which halves the size of the big waveform at
+    // the cost of decompressing it when loading.
+    QByteArray toByteArray(bool compress = false) const;
+
+    // Returns true if the data has been created by toByteArray(). Older data
+    // in the protobuf format is still accepted by the constructor.
+    static bool isCompactFormat(const QByteArray& data);
 
     // We do not lock the mutex since m_dataSize and m_visualSampleRate are not
     // changed after the constructor runs.
@@ -81,13 +91,20 @@ class Waveform {
     }
 
     SaveState saveState() const {
-        return m_saveState;
+        return static_cast<SaveState>(m_saveState.load());
     }
 
     // AnalysisDAO needs to be able to change the state to savePending when finished 
     // so we mark this as const and m_saveState mutable.
     void setSaveState(SaveState eState) const {
-        m_saveState = eState;
+        m_saveState.store(static_cast<int>(eState));
+    }
+
+    // Changes the state only if it is still the expected one. The waveforms
+    // of a track are saved from the analyzer and from the library threads.
+    bool testAndSetSaveState(SaveState expectedState, SaveState eState) const {
+        return m_saveState.testAndSetOrdered(
+                static_cast<int>(expectedState), static_cast<int>(eState));
     }
 
     // We do not lock the mutex since m_audioVisualRatio is not changed after
@@ -136,6 +153,8 @@ class Waveform {
 
   private:
     void readByteArray(const QByteArray& data);
+    void readCompactByteArray(const QByteArray& data);
+    void readProtobufByteArray(const QByteArray& data);
     void resize(int size);
     void assign(int size, int value = 0);
 
@@ -149,7 +168,7 @@ class Waveform {
     // If stored in the database, the ID of the waveform.
     int m_id;
     // mutable since AnalysisDAO needs to be able to set the waveform as saved.
-    mutable SaveState m_saveState;
+    mutable QAtomicInt m_saveState;
     QString m_version;
     QString m_description;
 
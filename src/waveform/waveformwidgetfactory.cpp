@@ -103,6 +103,7 @@ WaveformWidgetFactory::WaveformWidgetFactory() :
         m_defaultZoom(WaveformWidgetRenderer::s_waveformDefaultZoom),
         m_zoomSync(false),
         m_overviewNormalized(false),
+        m_threadedRasterization(false),
         m_openGlAvailable(false),
         m_openGlesAvailable(false),
         m_openGLShaderAvailable(false),
@@ -335,6 +336,9 @@ bool WaveformWidgetFactory::setConfig(UserSettingsPointer config) {
         m_config->set(ConfigKey("[Waveform]","OverviewNormalized"), ConfigValue(m_overviewNormalized));
     }
 
+    setThreadedRasterization(m_config->getValue(
+            ConfigKey("[Waveform]", "ThreadedRasterization"), m_threadedRasterization));
+
     m_playMarkerPosition = m_config->getValue(ConfigKey("[Waveform]","PlayMarkerPosition"),
             WaveformWidgetRenderer::s_defaultPlayMarkerPosition);
     setPlayMarkerPosition(m_playMarkerPosition);
@@ -560,6 +564,14 @@ void WaveformWidgetFactory::setOverviewNormalized(bool normalize) {
     }
 }
 
+void WaveformWidgetFactory::setThreadedRasterization(bool threaded) {
+    m_threadedRasterization = threaded;
+    if (m_config) {
+        m_config->setValue(ConfigKey("[Waveform]", "ThreadedRasterization"),
+                m_threadedRasterization);
+    }
+}
+
 void WaveformWidgetFactory::setPlayMarkerPosition(double position) {
     //qDebug() << "setPlayMarkerPosition, position=" << position;
     m_playMarkerPosition = position;
@@ -611,6 +623,18 @@ void WaveformWidgetFactory::render() {
                 // Calculate play position for the new Frame in following run
                 pWaveformWidget->preRender(m_vsyncThread);
             }
+
+            if (m_threadedRasterization) {
+                // Rasterize all software waveforms in parallel, while the
+                // swap of the previous frame may still block the GUI
+                // thread below. render() then only blits the images.
+                for (int i = 0; i < m_waveformWidgetHolders.size(); i++) {
+                    WaveformWidgetAbstract* pWaveformWidget = m_waveformWidgetHolders[i].m_waveformWidget;
+                    if (shouldRenderWaveforms[i] && pWaveformWidget->canRasterizeOffscreen()) {
+                        pWaveformWidget->startOffscreenRasterization(&m_rasterizationThreadPool);
+                    }
+                }
+            }
             //qDebug() << "prerender" << m_vsyncThread->elapsed();
 
             // It may happen that there is an artificially delayed due to
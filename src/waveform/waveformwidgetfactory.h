@@ -2,6 +2,7 @@
 #define WAVEFORMWIDGETFACTORY_H
 
 #include <QObject>
+#include <QThreadPool>
 #include <QTime>
 #include <QVector>
 
@@ -96,6 +97,11 @@ class WaveformWidgetFactory : public QObject, public Singleton<WaveformWidgetFac
     void setOverviewNormalized(bool normalize);
     int isOverviewNormalized() const { return m_overviewNormalized;}
 
+    // Rasterizes the software waveforms of all decks in parallel on
+    // worker threads instead of one after another on the GUI thread.
+    void setThreadedRasterization(bool threaded);
+    bool isThreadedRasterization() const { return m_threadedRasterization; }
+
     const QVector<WaveformWidgetAbstractHandle> getAvailableTypes() const { return m_waveformWidgetHandles;}
     void getAvailableVSyncTypes(QList<QPair<int, QString > >* list);
     void destroyWidgets();
@@ -152,6 +158,8 @@ class WaveformWidgetFactory : public QObject, public Singleton<WaveformWidgetFac
     bool m_zoomSync;
     double m_visualGain[FilterCount];
     bool m_overviewNormalized;
+    bool m_threadedRasterization;
+    QThreadPool m_rasterizationThreadPool;
 
     bool m_openGlAvailable;
     bool m_openGlesAvailable;
@@ -20,6 +20,8 @@ class QtSimpleWaveformWidget : public QGLWidget, public WaveformWidgetAbstract {
     static inline bool useOpenGLShaders() { return false; }
     static inline bool developerOnly() { return false; }
 
+    bool canRasterizeOffscreen() const override { return true; }
+
   protected:
     virtual void castToQWidget();
     virtual void paintEvent(QPaintEvent* event);
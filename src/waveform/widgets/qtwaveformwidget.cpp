@@ -62,7 +62,9 @@ mixxx::Duration QtWaveformWidget::render() {
     // this may delayed until previous buffer swap finished
     QPainter painter(this);
     t1 = timer.restart();
-    draw(&painter, NULL);
+    if (!drawOffscreenImage(&painter)) {
+        draw(&painter, NULL);
+    }
     //t2 = timer.restart();
     //qDebug() << "GLVSyncTestWidget "<< t1 << t2;
     return t1; // return timer for painter setup
@@ -19,6 +19,8 @@ class QtWaveformWidget : public QGLWidget, public WaveformWidgetAbstract {
     static inline bool useOpenGLShaders() { return false; }
     static inline bool developerOnly() { return false; }
 
+    bool canRasterizeOffscreen() const override { return true; }
+
   protected:
     virtual void castToQWidget();
     virtual void paintEvent(QPaintEvent* event);
@@ -37,5 +37,7 @@ void SoftwareWaveformWidget::castToQWidget() {
 
 void SoftwareWaveformWidget::paintEvent(QPaintEvent* event) {
     QPainter painter(this);
-    draw(&painter, event);
+    if (!drawOffscreenImage(&painter)) {
+        draw(&painter, event);
+    }
 }
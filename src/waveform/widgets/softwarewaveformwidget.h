@@ -18,6 +18,8 @@ class SoftwareWaveformWidget : public QWidget, public WaveformWidgetAbstract {
     static inline bool useOpenGLShaders() { return false; }
     static inline bool developerOnly() { return false; }
 
+    bool canRasterizeOffscreen() const override { return true; }
+
   protected:
     virtual void castToQWidget();
     virtual void paintEvent(QPaintEvent* event);
@@ -2,16 +2,20 @@
 #include "waveform/renderers/waveformwidgetrenderer.h"
 #include "util/compatibility.h"
 
+#include <QtConcurrentRun>
 #include <QtDebug>
 #include <QWidget>
 
 WaveformWidgetAbstract::WaveformWidgetAbstract(const char* group)
     : WaveformWidgetRenderer(group),
-      m_initSuccess(false) {
+      m_initSuccess(false),
+      m_offscreenRasterizationPending(false) {
     m_widget = NULL;
 }
 
 WaveformWidgetAbstract::~WaveformWidgetAbstract() {
+    // The worker must not draw into a deleted renderer stack
+    m_offscreenRasterization.waitForFinished();
 }
 
 void WaveformWidgetAbstract::hold() {
@@ -38,7 +42,46 @@ mixxx::Duration WaveformWidgetAbstract::render() {
     return mixxx::Duration();
 }
 
+void WaveformWidgetAbstract::startOffscreenRasterization(QThreadPool* pThreadPool) {
+    if (m_offscreenRasterizationPending) {
+        // The previous image has not been blitted, e.g. because the
+        // widget has been hidden in the meantime
+        m_offscreenRasterization.waitForFinished();
+        m_offscreenRasterizationPending = false;
+    }
+    const QSize imageSize(
+            static_cast<int>(m_width * m_devicePixelRatio),
+            static_cast<int>(m_height * m_devicePixelRatio));
+    if (imageSize.isEmpty()) {
+        return;
+    }
+    // The image is reused unless the widget has been resized
+    if (m_offscreenImage.size() != imageSize) {
+        m_offscreenImage = QImage(imageSize, QImage::Format_ARGB32_Premultiplied);
+        m_offscreenImage.setDevicePixelRatio(m_devicePixelRatio);
+    }
+    // All renderers are only accessed by the worker until the image has
+    // been blitted, because the GUI thread does not process any events
+    // in between.
+    m_offscreenRasterization = QtConcurrent::run(pThreadPool, [this] {
+        QPainter painter(&m_offscreenImage);
+        draw(&painter, nullptr);
+    });
+    m_offscreenRasterizationPending = true;
+}
+
+bool WaveformWidgetAbstract::drawOffscreenImage(QPainter* painter) {
+    if (!m_offscreenRasterizationPending) {
+        return false;
+    }
+    m_offscreenRasterization.waitForFinished();
+    m_offscreenRasterizationPending = false;
+    painter->drawImage(QPoint(0, 0), m_offscreenImage);
+    return true;
+}
+
 void WaveformWidgetAbstract::resize(int width, int height) {
+    m_offscreenRasterization.waitForFinished();
     qreal devicePixelRatio = 1.0;
     if (m_widget) {
         m_widget->resize(width, height);
@@ -1,6 +1,8 @@
 #ifndef WAVEFORMWIDGETABSTRACT_H
 #define WAVEFORMWIDGETABSTRACT_H
 
+#include <QFuture>
+#include <QImage>
 #include <QWidget>
 #include <QString>
 
@@ -9,6 +11,7 @@
 #include "track/track.h"
 #include "util/duration.h"
 
+class QThreadPool;
 class VSyncThread;
 
 // NOTE(vRince) This class represent objects the waveformwidgetfactory can
@@ -34,13 +37,28 @@ class WaveformWidgetAbstract : public WaveformWidgetRenderer {
     virtual mixxx::Duration render();
     virtual void resize(int width, int height);
 
+    // Software renderers can draw the next frame into an off-screen image
+    // on a worker thread after preRender(). render() then waits for the
+    // image and only blits it on the GUI thread.
+    virtual bool canRasterizeOffscreen() const { return false; }
+    void startOffscreenRasterization(QThreadPool* pThreadPool);
+
   protected:
+    // Blits the image of a pending off-screen rasterization. Returns false
+    // if no off-screen rasterization has been started for this frame.
+    bool drawOffscreenImage(QPainter* painter);
+
     QWidget* m_widget;
     bool m_initSuccess;
 
     //this is the factory resposability to trigger QWidget casting after constructor
     virtual void castToQWidget() = 0;
 
+  private:
+    QImage m_offscreenImage;
+    QFuture<void> m_offscreenRasterization;
+    bool m_offscreenRasterizationPending;
+
     friend class WaveformWidgetFactory;
 };
 
@@ -9,6 +9,8 @@
 
 
 // static
+// Recursive, because deleteImage() is also invoked from getImage()
+QMutex WImageStore::m_dictionaryMutex(QMutex::Recursive);
 QHash<QString, std::weak_ptr<QImage> > WImageStore::m_dictionary;
 QSharedPointer<ImgSource> WImageStore::m_loader
         = QSharedPointer<ImgSource>(new ImgLoader());
@@ -28,6 +30,7 @@ std::shared_ptr<QImage> WImageStore::getImage(const PixmapSource& source, double
     if (source.isEmpty()) {
         return nullptr;
     }
+    QMutexLocker locker(&m_dictionaryMutex);
     // Search for Image in list
     QString key = source.getId() + QString::number(scaleFactor);
 
@@ -88,6 +91,7 @@ QImage* WImageStore::getImageNoCache(const PixmapSource& source, double scaleFac
 
 // static
 void WImageStore::deleteImage(QImage* p) {
+    QMutexLocker locker(&m_dictionaryMutex);
     QMutableHashIterator<QString, std::weak_ptr<QImage> >it(m_dictionary);
     while (it.hasNext()) {
         if(it.next().value().expired()) {
@@ -3,6 +3,7 @@
 #define WIMAGESTORE_H
 
 #include <QHash>
+#include <QMutex>
 #include <QSharedPointer>
 #include <unordered_map>
 
@@ -26,7 +27,9 @@ class WImageStore {
   private:
     static void deleteImage(QImage* p);
 
-    // Dictionary of Images already instantiated
+    // Dictionary of Images already instantiated. Images are also requested
+    // by waveform renderers that rasterize on worker threads.
+    static QMutex m_dictionaryMutex;
     static QHash<QString, std::weak_ptr<QImage> > m_dictionary;
     static QSharedPointer<ImgSource> m_loader;
 };
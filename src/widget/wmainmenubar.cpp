@@ -167,6 +167,18 @@ void WMainMenuBar::initialize() {
             this, SIGNAL(createCrate()));
     pLibraryMenu->addAction(pLibraryCreateCrate);
 
+    pLibraryMenu->addSeparator();
+
+    QString findDuplicatesTitle = tr("Find &Duplicate Tracks");
+    QString findDuplicatesText = tr("Collect tracks with the same audio in a new playlist. "
+            "Only tracks that have been fingerprinted during analysis are compared.");
+    auto pLibraryFindDuplicates = new QAction(findDuplicatesTitle, this);
+    pLibraryFindDuplicates->setStatusTip(findDuplicatesText);
+    pLibraryFindDuplicates->setWhatsThis(buildWhatsThis(findDuplicatesTitle, findDuplicatesText));
+    connect(pLibraryFindDuplicates, SIGNAL(triggered()),
+            this, SIGNAL(findDuplicateTracks()));
+    pLibraryMenu->addAction(pLibraryFindDuplicates);
+
     addMenu(pLibraryMenu);
 
     // VIEW MENU
@@ -52,6 +52,7 @@ class WMainMenuBar : public QMenuBar {
   signals:
     void createCrate();
     void createPlaylist();
+    void findDuplicateTracks();
     void loadTrackToDeck(int deck);
     void reloadSkin();
     void rescanLibrary();
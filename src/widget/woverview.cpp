@@ -50,6 +50,8 @@ WOverview::WOverview(
         m_waveformPeak(-1.0),
         m_diffGain(0),
         m_devicePixelRatio(1.0),
+        m_dirtySourceBegin(0),
+        m_dirtySourceEnd(0),
         m_group(group),
         m_pConfig(pConfig),
         m_endOfTrack(false),
@@ -84,6 +86,7 @@ void WOverview::setup(const QDomNode& node, const SkinContext& context) {
     m_signalColors.setup(node, context);
 
     m_qColorBackground = m_signalColors.getBgColor();
+    invalidateScaledImage();
 
     // Clear the background pixmap, if it exists.
     m_backgroundPixmap = QPixmap();
@@ -202,6 +205,7 @@ void WOverview::slotWaveformSummaryUpdated() {
     } else {
         // Null waveform pointer means waveform was cleared.
         m_waveformSourceImage = QImage();
+        invalidateScaledImage();
         m_analyzerProgress = kAnalyzerProgressUnknown;
         m_actualCompletion = 0;
         m_waveformPeak = -1.0;
@@ -241,6 +245,7 @@ void WOverview::slotLoadingTrack(TrackPointer pNewTrack, TrackPointer pOldTrack)
     }
 
     m_waveformSourceImage = QImage();
+    invalidateScaledImage();
     m_analyzerProgress = kAnalyzerProgressUnknown;
     m_actualCompletion = 0;
     m_waveformPeak = -1.0;
@@ -374,19 +379,7 @@ void WOverview::paintEvent(QPaintEvent * /*unused*/) {
                 diffGain = 255.0 - 255.0 / visualGain;
             }
 
-            if (m_diffGain != diffGain || m_waveformImageScaled.isNull()) {
-                QRect sourceRect(0, diffGain, m_waveformSourceImage.width(),
-                    m_waveformSourceImage.height() - 2 * diffGain);
-                QImage croppedImage = m_waveformSourceImage.copy(sourceRect);
-                if (m_orientation == Qt::Vertical) {
-                    // Rotate pixmap
-                    croppedImage = croppedImage.transformed(QTransform(0, 1, 1, 0, 0, 0));
-                }
-                m_waveformImageScaled = croppedImage.scaled(size() * m_devicePixelRatio,
-                                                            Qt::IgnoreAspectRatio,
-                                                            Qt::SmoothTransformation);
-                m_diffGain = diffGain;
-            }
+            updateScaledImage(diffGain);
 
             painter.drawImage(rect(), m_waveformImageScaled);
 
@@ -637,6 +630,78 @@ void WOverview::paintEvent(QPaintEvent * /*unused*/) {
     painter.end();
 }
 
+void WOverview::markSourceColumnsDirty(int begin, int end) {
+    if (m_dirtySourceEnd > m_dirtySourceBegin) {
+        m_dirtySourceBegin = math_min(m_dirtySourceBegin, begin);
+        m_dirtySourceEnd = math_max(m_dirtySourceEnd, end);
+    } else {
+        m_dirtySourceBegin = begin;
+        m_dirtySourceEnd = end;
+    }
+}
+
+void WOverview::invalidateScaledImage() {
+    m_waveformImageScaled = QImage();
+    m_dirtySourceBegin = 0;
+    m_dirtySourceEnd = 0;
+}
+
+void WOverview::updateScaledImage(int diffGain) {
+    ScopedTimer t("WOverview::updateScaledImage");
+
+    const QSize scaledSize = size() * m_devicePixelRatio;
+    if (m_waveformImageScaled.isNull() ||
+            m_waveformImageScaled.size() != scaledSize ||
+            m_diffGain != diffGain) {
+        m_waveformImageScaled = scaleSourceColumns(
+                0, m_waveformSourceImage.width(), diffGain, scaledSize);
+        m_diffGain = diffGain;
+    } else if (m_dirtySourceEnd > m_dirtySourceBegin) {
+        // Rescale only the columns that were drawn since the last paint.
+        // The range is widened by one scaled pixel on each side, because
+        // the smooth transformation blends it with its neighbors.
+        const int sourceLength = m_waveformSourceImage.width();
+        const int scaledLength = m_orientation == Qt::Horizontal ?
+                scaledSize.width() : scaledSize.height();
+        const int scaledBegin = math_max(0,
+                m_dirtySourceBegin * scaledLength / sourceLength - 1);
+        const int scaledEnd = math_min(scaledLength,
+                (m_dirtySourceEnd * scaledLength + sourceLength - 1) / sourceLength + 1);
+        const int sourceBegin = scaledBegin * sourceLength / scaledLength;
+        const int sourceEnd = math_min(sourceLength,
+                (scaledEnd * sourceLength + scaledLength - 1) / scaledLength);
+        if (scaledEnd > scaledBegin && sourceEnd > sourceBegin) {
+            QPainter painter(&m_waveformImageScaled);
+            painter.setCompositionMode(QPainter::CompositionMode_Source);
+            if (m_orientation == Qt::Horizontal) {
+                painter.drawImage(scaledBegin, 0, scaleSourceColumns(
+                        sourceBegin, sourceEnd, diffGain,
+                        QSize(scaledEnd - scaledBegin, scaledSize.height())));
+            } else {
+                painter.drawImage(0, scaledBegin, scaleSourceColumns(
+                        sourceBegin, sourceEnd, diffGain,
+                        QSize(scaledSize.width(), scaledEnd - scaledBegin)));
+            }
+        }
+    }
+    m_dirtySourceBegin = 0;
+    m_dirtySourceEnd = 0;
+}
+
+QImage WOverview::scaleSourceColumns(int begin, int end, int diffGain,
+        const QSize& scaledSize) const {
+    QRect sourceRect(begin, diffGain, end - begin,
+            m_waveformSourceImage.height() - 2 * diffGain);
+    QImage croppedImage = m_waveformSourceImage.copy(sourceRect);
+    if (m_orientation == Qt::Vertical) {
+        // Rotate pixmap
+        croppedImage = croppedImage.transformed(QTransform(0, 1, 1, 0, 0, 0));
+    }
+    return croppedImage.scaled(scaledSize,
+            Qt::IgnoreAspectRatio,
+            Qt::SmoothTransformation);
+}
+
 void WOverview::paintText(const QString &text, QPainter *painter) {
     QColor lowColor = m_signalColors.getLowColor();
     lowColor.setAlphaF(0.5);
@@ -680,8 +745,7 @@ void WOverview::resizeEvent(QResizeEvent * /*unused*/) {
 
     m_devicePixelRatio = getDevicePixelRatioF(this);
 
-    m_waveformImageScaled = QImage();
-    m_diffGain = 0;
+    invalidateScaledImage();
     Init();
 }
 
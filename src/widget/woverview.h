@@ -74,6 +74,13 @@ class WOverview : public WWidget, public TrackDropTarget {
         return m_pWaveform;
     }
 
+    // Marks the columns [begin, end) of m_waveformSourceImage as newly
+    // drawn. Only these are rescaled into m_waveformImageScaled on the
+    // next paint.
+    void markSourceColumnsDirty(int begin, int end);
+    // Forces a full rescale of m_waveformImageScaled on the next paint
+    void invalidateScaledImage();
+
     QImage m_waveformSourceImage;
     QImage m_waveformImageScaled;
 
@@ -88,6 +95,10 @@ class WOverview : public WWidget, public TrackDropTarget {
     int m_diffGain;
     qreal m_devicePixelRatio;
 
+    // The range of source image columns that have not been rescaled yet
+    int m_dirtySourceBegin;
+    int m_dirtySourceEnd;
+
   private slots:
     void onEndOfTrackChange(double v);
 
@@ -102,6 +113,10 @@ class WOverview : public WWidget, public TrackDropTarget {
     // Append the waveform overview pixmap according to available data in waveform
     virtual bool drawNextPixmapPart() = 0;
     void paintText(const QString &text, QPainter *painter);
+    // Brings m_waveformImageScaled up to date with the source image
+    void updateScaledImage(int diffGain);
+    QImage scaleSourceColumns(int begin, int end, int diffGain,
+            const QSize& scaledSize) const;
     inline int valueToPosition(double value) const {
         return static_cast<int>(m_a * value - m_b);
     }
@@ -114,13 +114,15 @@ bool WOverviewLMH::drawNextPixmapPart() {
                 static_cast<float>(pWaveform->getAll(currentCompletion + 1)));
     }
 
+    markSourceColumnsDirty(m_actualCompletion / 2, nextCompletion / 2);
     m_actualCompletion = nextCompletion;
-    m_waveformImageScaled = QImage();
-    m_diffGain = 0;
 
     // Test if the complete waveform is done
     if (m_actualCompletion >= dataSize - 2) {
         m_pixmapDone = true;
+        // Rescale the complete waveform once to get rid of the seams
+        // between the incrementally scaled parts
+        invalidateScaledImage();
         //qDebug() << "m_waveformPeakRatio" << m_waveformPeak;
     }
 